@@ -1,14 +1,17 @@
 // YK:argparse,arrayutils,console,cpu,process,tinycthread,toml,whereami#
 #include "yk__lib.h"
-#define yy__cpu_Cpu struct yk__cpu_info
+#define yy__in_process_Compilation void*
+#define yy__buffer_StringBuffer yk__sds*
 #define yy__mutex_Mutex mtx_t
 #define yy__condition_Condition cnd_t
 #define yy__thread_Thread thrd_t
-#define yy__buffer_StringBuffer yk__sds*
+#define yy__cpu_Cpu struct yk__cpu_info
 #define yy__argparse_ArgParseRemainder struct yk__arg_remainder*
 #define yy__argparse_ArgParse struct argparse*
 #define yy__argparse_ArgParseWrapper struct yk__argparse_wrapper*
 #define yy__argparse_Option struct argparse_option
+#define yy__numbers_cstr2i atoi
+#define yy__numbers_i2s(nn__a) (yk__sdsfromlonglong(nn__a))
 #define yy__toml_Table toml_table_t*
 #define yy__toml_TomlArray toml_array_t*
 #define yy__toml_valid_table(nn__x) (NULL != nn__x)
@@ -16,7 +19,14 @@
 #define yy__path_mkdir yk__mkdir
 #define yy__path_exists yk__exists
 #define yy__path_readable yk__readable
+#define yy__path_writable yk__writable
 #define yy__path_executable yk__executable
+#define yy__path_file_size yk__file_size
+#define yy__path_mtime yk__file_mtime
+#define yy__path_touch yk__touch
+#define yy__path_remove yk__remove_file
+#define yy__path_rename yk__rename
+#define yy__path_list_dir yk__list_dir
 #define yy__array_del_str_array yk__delsdsarray
 #define yy__array_dup yk__sdsarraydup
 #define yy__c_CStr char*
@@ -25,6 +35,8 @@
 #define yy__os_Arguments struct yk__arguments*
 #define yy__os_get_args yk__get_args
 #define yy__os_ProcessResult struct yk__process_result*
+int32_t const  yy__object_cache_DEFAULT_MAX_SIZE_MB = INT32_C(2048);
+struct yk__bstr const yy__building_UNIT_SEPARATOR = ((struct yk__bstr){.data.s = "\n// YK-UNIT\n", .l = 12, .t = yk__bstr_static});
 int32_t const  yy__mutex_PLAIN = INT32_C(0);
 int32_t const  yy__thread_SUCCESS = INT32_C(1);
 int32_t const  yy__pool_IMMEDIATE_SHUTDOWN = INT32_C(1);
@@ -41,12 +53,23 @@ int32_t const  yy__pool_SUCCESS = INT32_C(0);
 int32_t const  yy__configuration_CLANG = INT32_C(44);
 int32_t const  yy__configuration_GCC = INT32_C(33);
 int32_t const  yy__configuration_NOT_FOUND = INT32_C(0);
+struct yk__bstr const yy__configuration_PROFILE_SIZE = ((struct yk__bstr){.data.s = "size", .l = 4, .t = yk__bstr_static});
+struct yk__bstr const yy__configuration_PROFILE_SPEED = ((struct yk__bstr){.data.s = "speed", .l = 5, .t = yk__bstr_static});
+struct yk__bstr const yy__configuration_PROFILE_NATIVE = ((struct yk__bstr){.data.s = "native", .l = 6, .t = yk__bstr_static});
+struct yk__bstr const yy__configuration_PROFILE_PGO = ((struct yk__bstr){.data.s = "pgo", .l = 3, .t = yk__bstr_static});
+int32_t const  yy__configuration_PGO_NONE = INT32_C(0);
+int32_t const  yy__configuration_PGO_GENERATE = INT32_C(1);
+int32_t const  yy__configuration_PGO_USE = INT32_C(2);
 int32_t const  yy__argparse_ARGPARSE_DEFAULT = INT32_C(0);
 struct yy__building_BObject;
+struct yy__building_JobState;
+struct yy__building_TargetBuild;
 struct yy__configuration_CCode;
 struct yy__configuration_Compilation;
 struct yy__configuration_Config;
 struct yy__configuration_Project;
+struct yy__object_cache_CacheEntry;
+struct yy__object_cache_ObjectCache;
 struct yy__pool_ThreadPool;
 struct yy__raylib_support_BuildData;
 struct yy__raylib_support_CObject;
@@ -59,6 +82,28 @@ struct yy__building_BObject {
     yk__sds yy__building_object_file_path;
     bool yy__building_always_build;
     bool yy__building_print_info;
+    struct yy__object_cache_ObjectCache* yy__building_cache;
+    bool yy__building_cache_hit;
+    bool yy__building_cache_miss;
+    struct yy__building_TargetBuild* yy__building_owner;
+};
+struct yy__building_JobState {
+    yy__mutex_Mutex yy__building_lock;
+    yy__condition_Condition yy__building_objects_done;
+    int64_t yy__building_start_ms;
+};
+struct yy__building_TargetBuild {
+    yk__sds yy__building_target;
+    yk__sds* yy__building_compile_args;
+    yk__sds* yy__building_link_args;
+    struct yy__building_BObject** yy__building_buildables;
+    struct yy__building_JobState* yy__building_state;
+    int32_t yy__building_remaining;
+    bool yy__building_link_ok;
+    yk__sds yy__building_link_output;
+    int64_t yy__building_compile_ms;
+    int64_t yy__building_link_ms;
+    int64_t yy__building_finished_ms;
 };
 struct yy__configuration_CCode {
     yk__sds* yy__configuration_include_paths;
@@ -69,6 +114,7 @@ struct yy__configuration_CCode {
     yk__sds* yy__configuration_c_code;
     yk__sds* yy__configuration_cpp_code;
     yk__sds* yy__configuration_runtime_feature_defines;
+    yk__sds* yy__configuration_runtime_feature_implementations;
     yk__sds* yy__configuration_runtime_feature_includes;
     yk__sds* yy__configuration_runtime_feature_c_code;
     yk__sds* yy__configuration_runtime_feature_compiler_defines;
@@ -86,6 +132,11 @@ struct yy__configuration_Compilation {
     yk__sds yy__configuration_web_assets;
     bool yy__configuration_wasm4;
     bool yy__configuration_disable_parallel_build;
+    int32_t yy__configuration_c_units;
+    int32_t yy__configuration_jobs;
+    yk__sds yy__configuration_profile;
+    yk__sds* yy__configuration_pgo_train;
+    bool yy__configuration_slab_alloc;
 };
 struct yy__configuration_Config {
     yk__sds yy__configuration_runtime_path;
@@ -97,6 +148,7 @@ struct yy__configuration_Config {
     yk__sds yy__configuration_clang_compiler_path;
     int32_t yy__configuration_alt_compiler;
     bool yy__configuration_use_alt_compiler;
+    int32_t yy__configuration_pgo_stage;
     yk__sds yy__configuration_emrun_path;
     yk__sds yy__configuration_w4_path;
     struct yy__configuration_CCode* yy__configuration_c_code;
@@ -109,6 +161,19 @@ struct yy__configuration_Project {
     yk__sds yy__configuration_name;
     yk__sds yy__configuration_author;
 };
+struct yy__object_cache_CacheEntry {
+    yk__sds yy__object_cache_name;
+    int64_t yy__object_cache_size;
+    int64_t yy__object_cache_mtime;
+};
+struct yy__object_cache_ObjectCache {
+    bool yy__object_cache_enabled;
+    yk__sds yy__object_cache_path;
+    yk__sds yy__object_cache_compiler_version;
+    int64_t yy__object_cache_max_size;
+    int32_t yy__object_cache_hits;
+    int32_t yy__object_cache_misses;
+};
 struct yy__pool_ThreadPool {
     yy__mutex_Mutex yy__pool_lock;
     yy__condition_Condition yy__pool_notify;
@@ -132,6 +197,24 @@ struct yy__raylib_support_CObject {
     yk__sds yy__raylib_support_base_name;
     yk__sds* yy__raylib_support_args;
 };
+bool yy__in_process_available();
+yy__in_process_Compilation yy__in_process_compile(yk__sds, yk__sds, int32_t);
+yk__sds yy__in_process_header(yy__in_process_Compilation);
+int32_t yy__in_process_write(yy__in_process_Compilation, yk__sds, yk__sds, yk__sds, yk__sds);
+void yy__in_process_del_compilation(yy__in_process_Compilation);
+yk__sds yy__object_cache_hash_data(struct yk__bstr);
+yk__sds yy__object_cache_default_path();
+struct yy__object_cache_ObjectCache* yy__object_cache_create();
+void yy__object_cache_del_cache(struct yy__object_cache_ObjectCache*);
+yk__sds* yy__object_cache_compiler_command(yk__sds*);
+void yy__object_cache_detect_compiler(struct yy__object_cache_ObjectCache*, yk__sds*);
+yk__sds yy__object_cache_key_for(struct yy__object_cache_ObjectCache*, yk__sds*, yk__sds);
+yk__sds yy__object_cache_entry_path(struct yy__object_cache_ObjectCache*, yk__sds);
+bool yy__object_cache_fetch(struct yy__object_cache_ObjectCache*, yk__sds, yk__sds);
+void yy__object_cache_store(struct yy__object_cache_ObjectCache*, yk__sds, yk__sds);
+int32_t yy__object_cache_cmp_entry(void const* const , void const* const );
+void yy__object_cache_trim(struct yy__object_cache_ObjectCache*);
+void yy__object_cache_print_stats(struct yy__object_cache_ObjectCache*);
 struct yy__raylib_support_CObject* yy__raylib_support_fill_arguments(yk__sds, struct yy__raylib_support_CObject*, bool);
 struct yy__raylib_support_CObject* yy__raylib_support_fill_web_arguments(yk__sds, struct yy__raylib_support_CObject*);
 struct yy__raylib_support_CObject* yy__raylib_support_co(yk__sds, yk__sds, yk__sds, bool, bool);
@@ -145,7 +228,39 @@ void yy__raylib_support_build_object(void*);
 void yy__raylib_support_build_objects_sequential(struct yy__raylib_support_CObject**, struct yy__configuration_Config*);
 void yy__raylib_support_build_objects(struct yy__raylib_support_CObject**, struct yy__configuration_Config*);
 yk__sds* yy__raylib_support_get_raylib_args(struct yy__configuration_Config*, yk__sds);
-yy__cpu_Cpu yy__cpu_info();
+yy__buffer_StringBuffer yy__buffer_new();
+void yy__buffer_append(yy__buffer_StringBuffer, struct yk__bstr);
+yk__sds yy__buffer_to_str(yy__buffer_StringBuffer);
+void yy__buffer_del_buf(yy__buffer_StringBuffer);
+yk__sds yy__building_code_prefix(struct yy__configuration_Config*);
+yk__sds yy__building_implementation_prefix(struct yy__configuration_Config*);
+yk__sds yy__building_prepare_code(struct yy__configuration_Config*, yk__sds);
+yk__sds* yy__building_write_units(struct yy__configuration_Config*, yk__sds, yk__sds);
+yk__sds* yy__building_write_code(struct yy__configuration_Config*, yk__sds, yy__in_process_Compilation, yk__sds, yk__sds);
+bool yy__building_is_target_macos(yk__sds);
+bool yy__building_is_target_windows(yk__sds);
+void yy__building_produce_obj_function(void*);
+yk__sds yy__building_core_object(yk__sds, yk__sds, yk__sds, bool, struct yy__object_cache_ObjectCache*, struct yy__building_TargetBuild*);
+void yy__building_object_job(void*);
+void yy__building_link_job(void*);
+void yy__building_run_jobs_sequential(struct yy__building_TargetBuild**);
+void yy__building_run_jobs(struct yy__configuration_Config*, struct yy__building_TargetBuild**);
+void yy__building_cleanup_buildables(struct yy__building_BObject**);
+bool yy__building_keep_ray_objects(yk__sds, bool);
+yk__sds yy__building_get_alt_compiler(struct yy__configuration_Config*);
+yk__sds* yy__building_optimization_args(struct yy__configuration_Config*, yk__sds, yk__sds);
+yk__sds* yy__building_create_args(struct yy__configuration_Config*, yk__sds*, yk__sds, yk__sds, yk__sds*, struct yy__object_cache_ObjectCache*, struct yy__building_TargetBuild*);
+void yy__building_print_target_eq(yk__sds, bool);
+struct yy__building_TargetBuild* yy__building_new_target_build(struct yy__configuration_Config*, yk__sds*, yk__sds, yk__sds, yk__sds*, struct yy__object_cache_ObjectCache*, struct yy__building_JobState*);
+void yy__building_del_target_build(struct yy__building_TargetBuild*);
+int32_t yy__building_report_target(struct yy__building_TargetBuild*, bool);
+void yy__building_print_timings(struct yy__building_TargetBuild**);
+int32_t yy__building_build_targets(struct yy__configuration_Config*, yk__sds*, yk__sds, yk__sds*, yk__sds*, struct yy__object_cache_ObjectCache*, bool, bool);
+bool yy__building_print_error(yk__sds, int32_t);
+void yy__building_clear_dir(yk__sds);
+bool yy__building_train_pgo(struct yy__configuration_Config*, yk__sds*, yk__sds, yk__sds, yk__sds*, struct yy__object_cache_ObjectCache*);
+int32_t yy__building_build(struct yy__configuration_Config*, yk__sds, yy__in_process_Compilation);
+int32_t yy__building_build_simple(struct yy__configuration_Config*, yk__sds, yy__in_process_Compilation, bool);
 int32_t yy__mutex_init(yy__mutex_Mutex*, int32_t);
 void yy__mutex_destroy(yy__mutex_Mutex*);
 int32_t yy__mutex_lock(yy__mutex_Mutex*);
@@ -155,6 +270,7 @@ void yy__condition_destroy(yy__condition_Condition*);
 int32_t yy__condition_signal(yy__condition_Condition*);
 int32_t yy__condition_broadcast(yy__condition_Condition*);
 int32_t yy__condition_wait(yy__condition_Condition*, yy__mutex_Mutex*);
+int64_t yy__timespec_millis();
 int32_t yy__thread_create_with_data(yy__thread_Thread*, yt_fn_in_any_ptr_out_i32, void*);
 void yy__thread_exit(int32_t);
 int32_t yy__thread_join(yy__thread_Thread);
@@ -163,26 +279,7 @@ int32_t yy__pool_add(struct yy__pool_ThreadPool*, yt_fn_in_any_ptr_out, void*);
 int32_t yy__pool_destroy(struct yy__pool_ThreadPool*, bool);
 int32_t yy__pool_internal_del_pool(struct yy__pool_ThreadPool*);
 int32_t yy__pool_internal_tpool_work(void*);
-yy__buffer_StringBuffer yy__buffer_new();
-void yy__buffer_append(yy__buffer_StringBuffer, struct yk__bstr);
-yk__sds yy__buffer_to_str(yy__buffer_StringBuffer);
-void yy__buffer_del_buf(yy__buffer_StringBuffer);
-yk__sds yy__building_prepare_code(struct yy__configuration_Config*, yk__sds);
-bool yy__building_is_target_macos(yk__sds);
-bool yy__building_is_target_windows(yk__sds);
-void yy__building_produce_obj_function(void*);
-yk__sds yy__building_core_object(yk__sds*, yk__sds, yk__sds, yk__sds, bool, struct yy__building_BObject***);
-void yy__building_build_objects_sequential(struct yy__building_BObject**);
-void yy__building_build_objects(struct yy__building_BObject**);
-void yy__building_cleanup_buildables(struct yy__building_BObject**);
-bool yy__building_keep_ray_objects(yk__sds, bool);
-yk__sds yy__building_get_alt_compiler(struct yy__configuration_Config*);
-yk__sds* yy__building_create_args(struct yy__configuration_Config*, yk__sds, yk__sds, yk__sds, yk__sds*);
-void yy__building_print_target_eq(yk__sds, bool);
-int32_t yy__building_build_target(struct yy__configuration_Config*, yk__sds, yk__sds, yk__sds, yk__sds*, bool);
-bool yy__building_print_error(yk__sds, int32_t);
-int32_t yy__building_build(struct yy__configuration_Config*, yk__sds);
-int32_t yy__building_build_simple(struct yy__configuration_Config*, yk__sds, bool);
+yy__cpu_Cpu yy__cpu_info();
 void yy__configuration_find_runtime_path(struct yy__configuration_Config*);
 void yy__configuration_find_libs_path(struct yy__configuration_Config*);
 void yy__configuration_find_yaksha_compiler(struct yy__configuration_Config*);
@@ -191,11 +288,13 @@ void yy__configuration_find_emsdk(struct yy__configuration_Config*);
 void yy__configuration_find_w4(struct yy__configuration_Config*);
 struct yy__configuration_Project* yy__configuration_load_project(yy__toml_Table, struct yy__configuration_Config*);
 struct yy__configuration_CCode* yy__configuration_load_c_code(yy__toml_Table, struct yy__configuration_Config*);
+bool yy__configuration_valid_profile(yk__sds);
 struct yy__configuration_Compilation* yy__configuration_load_compilation(yy__toml_Table, struct yy__configuration_Config*);
 struct yy__configuration_CCode* yy__configuration_inject_c_code_defaults(struct yy__configuration_CCode*, struct yy__configuration_Config*);
 struct yy__configuration_Config* yy__configuration_load_runtime_features(struct yy__configuration_Config*, yk__sds, bool);
 struct yy__configuration_Config* yy__configuration_load_config();
 struct yy__configuration_Config* yy__configuration_create_adhoc_config(yk__sds, yk__sds, bool, bool, bool, yk__sds, yk__sds, bool, bool);
+uint8_t yy__configuration_job_count(struct yy__configuration_Config*);
 void yy__configuration_del_config(struct yy__configuration_Config*);
 yy__argparse_ArgParseWrapper yy__argparse_new_ex(yy__argparse_Option*, yk__sds*, int32_t);
 yy__argparse_ArgParseWrapper yy__argparse_new(yy__argparse_Option*, yk__sds*);
@@ -205,6 +304,7 @@ void yy__argparse_usage(yy__argparse_ArgParse);
 void yy__argparse_del_remainder(yy__argparse_ArgParseRemainder);
 yy__argparse_Option yy__argparse_opt_boolean(yk__sds, yk__sds, int32_t*, yk__sds);
 yy__argparse_Option yy__argparse_opt_string(yk__sds, yk__sds, yy__c_CStr*, yk__sds);
+yy__argparse_Option yy__argparse_opt_integer(yk__sds, yk__sds, int32_t*, yk__sds);
 yy__argparse_Option yy__argparse_opt_end();
 void yy__console_set_color(int32_t);
 void yy__console_color_print(int32_t, struct yk__bstr);
@@ -212,6 +312,7 @@ void yy__console_red(struct yk__bstr);
 void yy__console_green(struct yk__bstr);
 void yy__console_yellow(struct yk__bstr);
 void yy__console_cyan(struct yk__bstr);
+int32_t yy__numbers_s2i(yk__sds);
 yk__sds yy__io_readfile(struct yk__bstr);
 bool yy__io_writefile(struct yk__bstr, struct yk__bstr);
 yy__toml_Table yy__toml_from_str(struct yk__bstr);
@@ -219,7 +320,9 @@ yy__toml_Table yy__toml_get_table(yy__toml_Table, struct yk__bstr);
 yy__toml_TomlArray yy__toml_get_array(yy__toml_Table, struct yk__bstr);
 int32_t yy__toml_array_len(yy__toml_TomlArray);
 yk__sds yy__toml_get_string(yy__toml_Table, struct yk__bstr);
+yk__sds yy__toml_get_string_default(yy__toml_Table, struct yk__bstr, struct yk__bstr);
 bool yy__toml_get_bool_default(yy__toml_Table, struct yk__bstr, bool);
+int32_t yy__toml_get_int_default(yy__toml_Table, struct yk__bstr, int32_t);
 yk__sds yy__toml_string_at(yy__toml_TomlArray, int32_t);
 yk__sds* yy__toml_get_string_array(yy__toml_Table, struct yk__bstr);
 void yy__toml_del_table(yy__toml_Table);
@@ -261,11 +364,549 @@ void yy__print_banner();
 void yy__print_errors(yk__sds*);
 void yy__printkv(yk__sds, yk__sds);
 void yy__print_config(struct yy__configuration_Config*);
+int32_t yy__build_in_process(struct yy__configuration_Config*, bool, bool);
 int32_t yy__build_from_config(struct yy__configuration_Config*, bool, bool);
-int32_t yy__perform_build();
-int32_t yy__perform_mini_build(yk__sds, bool, bool, bool, yk__sds, yk__sds, bool, bool, bool, bool, int32_t);
+int32_t yy__perform_build(int32_t, yk__sds);
+int32_t yy__perform_mini_build(yk__sds, bool, bool, bool, yk__sds, yk__sds, bool, bool, bool, bool, int32_t, int32_t, yk__sds);
 int32_t yy__handle_args(yy__os_Arguments);
 int32_t yy__main();
+bool yy__in_process_available() 
+{
+    bool result = false;
+    #if defined(YK__CARPNTR_IN_PROCESS)
+    result = true;
+    #endif
+    return result;
+}
+yy__in_process_Compilation yy__in_process_compile(yk__sds nn__main_file, yk__sds nn__libs_path, int32_t nn__units) 
+{
+    void *result = NULL;
+    #if defined(YK__CARPNTR_IN_PROCESS)
+    void *compile_in_memory(char *, size_t, char *, size_t, size_t);
+    result = compile_in_memory(nn__main_file, yk__sdslen(nn__main_file), nn__libs_path, yk__sdslen(nn__libs_path), (size_t) nn__units);
+    #endif
+    yk__sdsfree(nn__main_file);
+    yk__sdsfree(nn__libs_path);
+    return result;
+}
+yk__sds yy__in_process_header(yy__in_process_Compilation nn__comp) 
+{
+    yk__sds result = NULL;
+    #if defined(YK__CARPNTR_IN_PROCESS)
+    const char *compilation_header(void *);
+    result = yk__sdsnew(compilation_header(nn__comp));
+    #else
+    result = yk__sdsempty();
+    #endif
+    return result;
+}
+int32_t yy__in_process_write(yy__in_process_Compilation nn__comp, yk__sds nn__prefix, yk__sds nn__unit_prefix, yk__sds nn__dir_path, yk__sds nn__name) 
+{
+    int32_t result = -1;
+    #if defined(YK__CARPNTR_IN_PROCESS)
+    int write_compilation(void *, char *, size_t, char *, size_t, char *, size_t, char *, size_t);
+    result = write_compilation(nn__comp, nn__prefix, yk__sdslen(nn__prefix), nn__unit_prefix, yk__sdslen(nn__unit_prefix), nn__dir_path, yk__sdslen(nn__dir_path), nn__name, yk__sdslen(nn__name));
+    #endif
+    yk__sdsfree(nn__prefix);
+    yk__sdsfree(nn__unit_prefix);
+    yk__sdsfree(nn__dir_path);
+    yk__sdsfree(nn__name);
+    return result;
+}
+void yy__in_process_del_compilation(yy__in_process_Compilation nn__comp) 
+{
+    #if defined(YK__CARPNTR_IN_PROCESS)
+    void del_compilation(void *);
+    del_compilation(nn__comp);
+    #endif
+    return;
+}
+yk__sds yy__object_cache_hash_data(struct yk__bstr nn__data) 
+{
+    static const uint32_t k[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+    uint32_t h[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    const unsigned char* bytes = (const unsigned char*)yk__bstr_get_reference(nn__data);
+    size_t length = yk__bstr_len(nn__data);
+    // Last one or two blocks hold remaining bytes, 0x80 and bit length (big endian)
+    unsigned char tail[128] = {0};
+    size_t full = length / 64 * 64;
+    size_t tail_length = (length - full + 9 <= 64) ? 64 : 128;
+    memcpy(tail, bytes + full, length - full);
+    tail[length - full] = 0x80;
+    uint64_t bits = (uint64_t)length * 8;
+    for (int i = 0; i < 8; i++) {
+        tail[tail_length - 1 - i] = (unsigned char)(bits >> (8 * i));
+    }
+    for (size_t offset = 0; offset < full + tail_length; offset += 64) {
+        const unsigned char* block = (offset < full) ? bytes + offset : tail + (offset - full);
+        uint32_t w[64];
+        for (int i = 0; i < 16; i++) {
+            w[i] = ((uint32_t)block[i * 4] << 24) | ((uint32_t)block[i * 4 + 1] << 16) |
+                   ((uint32_t)block[i * 4 + 2] << 8) | (uint32_t)block[i * 4 + 3];
+        }
+        for (int i = 16; i < 64; i++) {
+            uint32_t a = w[i - 15], b = w[i - 2];
+            uint32_t s0 = ((a >> 7) | (a << 25)) ^ ((a >> 18) | (a << 14)) ^ (a >> 3);
+            uint32_t s1 = ((b >> 17) | (b << 15)) ^ ((b >> 19) | (b << 13)) ^ (b >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        uint32_t v[8];
+        memcpy(v, h, sizeof(v));
+        for (int i = 0; i < 64; i++) {
+            uint32_t e = v[4], a = v[0];
+            uint32_t s1 = ((e >> 6) | (e << 26)) ^ ((e >> 11) | (e << 21)) ^ ((e >> 25) | (e << 7));
+            uint32_t t1 = v[7] + s1 + ((e & v[5]) ^ (~e & v[6])) + k[i] + w[i];
+            uint32_t s0 = ((a >> 2) | (a << 30)) ^ ((a >> 13) | (a << 19)) ^ ((a >> 22) | (a << 10));
+            uint32_t t2 = s0 + ((a & v[1]) ^ (a & v[2]) ^ (v[1] & v[2]));
+            memmove(v + 1, v, 7 * sizeof(uint32_t));
+            v[4] += t1;
+            v[0] = t1 + t2;
+        }
+        for (int i = 0; i < 8; i++) {
+            h[i] += v[i];
+        }
+    }
+    return yk__sdscatprintf(yk__sdsempty(), "%08x%08x%08x%08x%08x%08x%08x%08x",
+        h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7]);
+}
+yk__sds yy__object_cache_default_path() 
+{
+    yk__sds yy__object_cache_base = yk__sdsnewlen("" , 0);
+    if (yy__os_is_windows())
+    {
+        yk__sds t__0 = yy__os_getenv(yk__sdsnewlen("LOCALAPPDATA", 12));
+        yk__sdsfree(yy__object_cache_base);
+        yy__object_cache_base = yk__sdsdup(t__0);
+        yk__sdsfree(t__0);
+    }
+    else
+    {
+        yk__sds t__1 = yy__os_getenv(yk__sdsnewlen("XDG_CACHE_HOME", 14));
+        yk__sdsfree(yy__object_cache_base);
+        yy__object_cache_base = yk__sdsdup(t__1);
+        if (yk__sdslen(yy__object_cache_base) == INT32_C(0))
+        {
+            yk__sds t__2 = yy__os_getenv(yk__sdsnewlen("HOME", 4));
+            yk__sds yy__object_cache_home = yk__sdsdup(t__2);
+            if (yk__sdslen(yy__object_cache_home) == INT32_C(0))
+            {
+                yk__sdsfree(yy__object_cache_home);
+                yk__sdsfree(t__2);
+                yk__sdsfree(t__1);
+                yk__sdsfree(yy__object_cache_base);
+                return yk__sdsnewlen("", 0);
+            }
+            yk__sds t__3 = yy__path_join(yk__bstr_h(yy__object_cache_home), yk__bstr_s(".cache", 6));
+            yk__sdsfree(yy__object_cache_base);
+            yy__object_cache_base = yk__sdsdup(t__3);
+            yy__path_mkdir(yk__sdsdup(yy__object_cache_base));
+            yk__sdsfree(t__3);
+            yk__sdsfree(yy__object_cache_home);
+            yk__sdsfree(t__2);
+        }
+        yk__sdsfree(t__1);
+    }
+    if (yk__sdslen(yy__object_cache_base) == INT32_C(0))
+    {
+        yk__sdsfree(yy__object_cache_base);
+        return yk__sdsnewlen("", 0);
+    }
+    yk__sds t__4 = yy__path_join(yk__bstr_h(yy__object_cache_base), yk__bstr_s("yaksha", 6));
+    yk__sdsfree(yy__object_cache_base);
+    yy__object_cache_base = yk__sdsdup(t__4);
+    yy__path_mkdir(yk__sdsdup(yy__object_cache_base));
+    yk__sds t__5 = yy__path_join(yk__bstr_h(yy__object_cache_base), yk__bstr_s("objects", 7));
+    yk__sds t__6 = t__5;
+    yk__sdsfree(t__4);
+    yk__sdsfree(yy__object_cache_base);
+    return t__6;
+}
+struct yy__object_cache_ObjectCache* yy__object_cache_create() 
+{
+    struct yy__object_cache_ObjectCache* yy__object_cache_cache = yk__obj_alloc(struct yy__object_cache_ObjectCache);
+    yy__object_cache_cache->yy__object_cache_enabled = false;
+    yy__object_cache_cache->yy__object_cache_hits = INT32_C(0);
+    yy__object_cache_cache->yy__object_cache_misses = INT32_C(0);
+    yy__object_cache_cache->yy__object_cache_compiler_version = yk__sdsnewlen("", 0);
+    yy__object_cache_cache->yy__object_cache_max_size = ((int64_t)yy__object_cache_DEFAULT_MAX_SIZE_MB);
+    yk__sds t__7 = yy__os_getenv(yk__sdsnewlen("YAKSHA_CACHE_MAX_SIZE_MB", 24));
+    int32_t yy__object_cache_max_size_mb = yy__numbers_s2i(yk__sdsdup(t__7));
+    if (yy__object_cache_max_size_mb > INT32_C(0))
+    {
+        yy__object_cache_cache->yy__object_cache_max_size = ((int64_t)yy__object_cache_max_size_mb);
+    }
+    yy__object_cache_cache->yy__object_cache_max_size = (yy__object_cache_cache->yy__object_cache_max_size * INT64_C(1048576));
+    yk__sds t__8 = yy__os_getenv(yk__sdsnewlen("YAKSHA_CACHE_DIR", 16));
+    yy__object_cache_cache->yy__object_cache_path = yk__sdsdup(t__8);
+    yk__sds t__9 = yy__os_getenv(yk__sdsnewlen("YAKSHA_CACHE_DISABLE", 20));
+    if (yk__cmp_sds_lit(t__9, "1", 1) == 0)
+    {
+        struct yy__object_cache_ObjectCache* t__10 = yy__object_cache_cache;
+        yk__sdsfree(t__9);
+        yk__sdsfree(t__8);
+        yk__sdsfree(t__7);
+        return t__10;
+    }
+    if (yk__sdslen(yy__object_cache_cache->yy__object_cache_path) == INT32_C(0))
+    {
+        yk__sdsfree(yy__object_cache_cache->yy__object_cache_path);
+        yk__sds t__11 = yy__object_cache_default_path();
+        yy__object_cache_cache->yy__object_cache_path = yk__sdsdup(t__11);
+        yk__sdsfree(t__11);
+    }
+    if (yk__sdslen(yy__object_cache_cache->yy__object_cache_path) == INT32_C(0))
+    {
+        struct yy__object_cache_ObjectCache* t__12 = yy__object_cache_cache;
+        yk__sdsfree(t__9);
+        yk__sdsfree(t__8);
+        yk__sdsfree(t__7);
+        return t__12;
+    }
+    yy__path_mkdir(yk__sdsdup(yy__object_cache_cache->yy__object_cache_path));
+    yy__object_cache_cache->yy__object_cache_enabled = yy__path_writable(yk__sdsdup(yy__object_cache_cache->yy__object_cache_path));
+    struct yy__object_cache_ObjectCache* t__13 = yy__object_cache_cache;
+    yk__sdsfree(t__9);
+    yk__sdsfree(t__8);
+    yk__sdsfree(t__7);
+    return t__13;
+}
+void yy__object_cache_del_cache(struct yy__object_cache_ObjectCache* yy__object_cache_cache) 
+{
+    yk__sdsfree(yy__object_cache_cache->yy__object_cache_path);
+    yk__sdsfree(yy__object_cache_cache->yy__object_cache_compiler_version);
+    yk__obj_free(yy__object_cache_cache);
+    return;
+}
+yk__sds* yy__object_cache_compiler_command(yk__sds* yy__object_cache_args) 
+{
+    yk__sds* t__14 = NULL;
+    yk__arrsetcap(t__14, 1);
+    yk__arrput(t__14, yk__sdsdup(yy__object_cache_args[INT32_C(0)]));
+    yk__sds* yy__object_cache_command = t__14;
+    if ((yk__arrlen(yy__object_cache_args) > INT32_C(1)) && (yk__cmp_sds_lit(yy__object_cache_args[INT32_C(1)], "cc", 2) == 0))
+    {
+        yk__arrput(yy__object_cache_command, yk__sdsnewlen("cc", 2));
+    }
+    yk__sds* t__15 = yy__object_cache_command;
+    return t__15;
+}
+void yy__object_cache_detect_compiler(struct yy__object_cache_ObjectCache* yy__object_cache_cache, yk__sds* yy__object_cache_args) 
+{
+    if ((!(yy__object_cache_cache->yy__object_cache_enabled)) || (yk__sdslen(yy__object_cache_cache->yy__object_cache_compiler_version) > INT32_C(0)))
+    {
+        return;
+    }
+    yk__sds* yy__object_cache_command = yy__object_cache_compiler_command(yy__object_cache_args);
+    yk__arrput(yy__object_cache_command, yk__sdsnewlen("--version", 9));
+    yy__os_ProcessResult yy__object_cache_pr = yy__os_run(yy__object_cache_command);
+    if (yy__object_cache_pr->ok && (yk__sdslen(yy__object_cache_pr->output) > INT32_C(0)))
+    {
+        yk__sdsfree(yy__object_cache_cache->yy__object_cache_compiler_version);
+        yy__object_cache_cache->yy__object_cache_compiler_version = yk__sdsdup(yy__object_cache_pr->output);
+    }
+    else
+    {
+        yy__object_cache_cache->yy__object_cache_enabled = false;
+    }
+    yy__os_del_process_result(yy__object_cache_pr);
+    yy__array_del_str_array(yy__object_cache_command);
+    return;
+}
+yk__sds yy__object_cache_key_for(struct yy__object_cache_ObjectCache* yy__object_cache_cache, yk__sds* yy__object_cache_args, yk__sds yy__object_cache_c_file) 
+{
+    if ((!(yy__object_cache_cache->yy__object_cache_enabled)) || (yk__sdslen(yy__object_cache_cache->yy__object_cache_compiler_version) == INT32_C(0)))
+    {
+        yk__sdsfree(yy__object_cache_c_file);
+        return yk__sdsnewlen("", 0);
+    }
+    yk__sds* yy__object_cache_preprocess = yy__object_cache_compiler_command(yy__object_cache_args);
+    yk__sds yy__object_cache_key_data = yk__sdsdup(yy__object_cache_cache->yy__object_cache_compiler_version);
+    int32_t yy__object_cache_length = yk__arrlen(yy__object_cache_args);
+    int32_t yy__object_cache_x = yk__arrlen(yy__object_cache_preprocess);
+    while (true)
+    {
+        if (!(yy__object_cache_x < yy__object_cache_length))
+        {
+            break;
+        }
+        yk__sds yy__object_cache_arg = yk__sdsdup(yy__object_cache_args[yy__object_cache_x]);
+        yy__object_cache_x = (yy__object_cache_x + INT32_C(1));
+        if ((yk__cmp_sds_lit(yy__object_cache_arg, "-MMD", 4) == 0) || (yk__cmp_sds_lit(yy__object_cache_arg, "-MP", 3) == 0))
+        {
+            yk__sdsfree(yy__object_cache_arg);
+            continue;
+        }
+        yk__arrput(yy__object_cache_preprocess, yk__sdsdup(yy__object_cache_arg));
+        if ((!(yy__strings_startswith(yk__bstr_h(yy__object_cache_arg), yk__bstr_s("-I", 2)))) && (!(yy__strings_startswith(yk__bstr_h(yy__object_cache_arg), yk__bstr_s("-D", 2)))))
+        {
+            yk__sds t__16 = yk__concat_lit_sds("\n", 1, yy__object_cache_arg);
+            yy__object_cache_key_data = yk__append_sds_sds(yy__object_cache_key_data, t__16);
+            yk__sdsfree(t__16);
+        }
+        yk__sdsfree(yy__object_cache_arg);
+    }
+    yk__arrput(yy__object_cache_preprocess, yk__sdsnewlen("-E", 2));
+    yk__arrput(yy__object_cache_preprocess, yk__sdsnewlen("-P", 2));
+    yk__arrput(yy__object_cache_preprocess, yk__sdsdup(yy__object_cache_c_file));
+    yy__os_ProcessResult yy__object_cache_pr = yy__os_run(yy__object_cache_preprocess);
+    if (!(yy__object_cache_pr->ok))
+    {
+        yy__os_del_process_result(yy__object_cache_pr);
+        yy__array_del_str_array(yy__object_cache_preprocess);
+        yk__sdsfree(yy__object_cache_key_data);
+        yk__sdsfree(yy__object_cache_c_file);
+        return yk__sdsnewlen("", 0);
+    }
+    yy__object_cache_key_data = yk__append_sds_lit(yy__object_cache_key_data, "\n" , 1);
+    yk__sds t__17 = yy__object_cache_hash_data(yk__bstr_h(yy__object_cache_pr->output));
+    yy__object_cache_key_data = yk__append_sds_sds(yy__object_cache_key_data, t__17);
+    yk__sds t__18 = yy__object_cache_key_data;
+    yy__os_del_process_result(yy__object_cache_pr);
+    yy__array_del_str_array(yy__object_cache_preprocess);
+    yk__sdsfree(t__17);
+    yk__sdsfree(yy__object_cache_c_file);
+    return t__18;
+}
+yk__sds yy__object_cache_entry_path(struct yy__object_cache_ObjectCache* yy__object_cache_cache, yk__sds yy__object_cache_key) 
+{
+    yk__sds t__19 = yy__object_cache_hash_data(yk__bstr_h(yy__object_cache_key));
+    yk__sds t__20 = yk__concat_sds_lit(t__19, ".o", 2);
+    yk__sds t__21 = yy__path_join(yk__bstr_h(yy__object_cache_cache->yy__object_cache_path), yk__bstr_h(t__20));
+    yk__sds t__22 = t__21;
+    yk__sdsfree(t__20);
+    yk__sdsfree(t__19);
+    yk__sdsfree(yy__object_cache_key);
+    return t__22;
+}
+bool yy__object_cache_fetch(struct yy__object_cache_ObjectCache* yy__object_cache_cache, yk__sds yy__object_cache_key, yk__sds yy__object_cache_object_file_path) 
+{
+    yk__sds t__23 = yy__object_cache_entry_path(yy__object_cache_cache, yk__sdsdup(yy__object_cache_key));
+    yk__sds yy__object_cache_entry = yk__sdsdup(t__23);
+    if (!(yy__path_readable(yk__sdsdup(yy__object_cache_entry))))
+    {
+        yk__sdsfree(yy__object_cache_entry);
+        yk__sdsfree(t__23);
+        yk__sdsfree(yy__object_cache_object_file_path);
+        yk__sdsfree(yy__object_cache_key);
+        return false;
+    }
+    yk__sds t__24 = yk__concat_sds_lit(yy__object_cache_entry, ".key", 4);
+    yk__sds t__25 = yy__io_readfile(yk__bstr_h(t__24));
+    if (yk__sdscmp(t__25 , yy__object_cache_key) != 0)
+    {
+        yk__sdsfree(t__25);
+        yk__sdsfree(t__24);
+        yk__sdsfree(yy__object_cache_entry);
+        yk__sdsfree(t__23);
+        yk__sdsfree(yy__object_cache_object_file_path);
+        yk__sdsfree(yy__object_cache_key);
+        return false;
+    }
+    yk__sds t__26 = yy__io_readfile(yk__bstr_h(yy__object_cache_entry));
+    yk__sds yy__object_cache_data = yk__sdsdup(t__26);
+    if (yk__sdslen(yy__object_cache_data) == INT32_C(0))
+    {
+        yk__sdsfree(yy__object_cache_data);
+        yk__sdsfree(t__26);
+        yk__sdsfree(t__25);
+        yk__sdsfree(t__24);
+        yk__sdsfree(yy__object_cache_entry);
+        yk__sdsfree(t__23);
+        yk__sdsfree(yy__object_cache_object_file_path);
+        yk__sdsfree(yy__object_cache_key);
+        return false;
+    }
+    if (!(yy__io_writefile(yk__bstr_h(yy__object_cache_object_file_path), yk__bstr_h(yy__object_cache_data))))
+    {
+        yk__sdsfree(yy__object_cache_data);
+        yk__sdsfree(t__26);
+        yk__sdsfree(t__25);
+        yk__sdsfree(t__24);
+        yk__sdsfree(yy__object_cache_entry);
+        yk__sdsfree(t__23);
+        yk__sdsfree(yy__object_cache_object_file_path);
+        yk__sdsfree(yy__object_cache_key);
+        return false;
+    }
+    yy__path_touch(yk__sdsdup(yy__object_cache_entry));
+    yk__sdsfree(yy__object_cache_data);
+    yk__sdsfree(t__26);
+    yk__sdsfree(t__25);
+    yk__sdsfree(t__24);
+    yk__sdsfree(yy__object_cache_entry);
+    yk__sdsfree(t__23);
+    yk__sdsfree(yy__object_cache_object_file_path);
+    yk__sdsfree(yy__object_cache_key);
+    return true;
+}
+void yy__object_cache_store(struct yy__object_cache_ObjectCache* yy__object_cache_cache, yk__sds yy__object_cache_key, yk__sds yy__object_cache_object_file_path) 
+{
+    yk__sds t__27 = yy__io_readfile(yk__bstr_h(yy__object_cache_object_file_path));
+    yk__sds yy__object_cache_data = yk__sdsdup(t__27);
+    if (yk__sdslen(yy__object_cache_data) == INT32_C(0))
+    {
+        yk__sdsfree(yy__object_cache_data);
+        yk__sdsfree(t__27);
+        yk__sdsfree(yy__object_cache_object_file_path);
+        yk__sdsfree(yy__object_cache_key);
+        return;
+    }
+    yk__sds t__28 = yy__object_cache_entry_path(yy__object_cache_cache, yk__sdsdup(yy__object_cache_key));
+    yk__sds yy__object_cache_entry = yk__sdsdup(t__28);
+    yk__sds t__29 = yk__concat_sds_lit(yy__object_cache_entry, ".", 1);
+    yk__sds t__30 = yy__path_basename(yk__sdsdup(yy__object_cache_object_file_path));
+    yk__sds t__31 = yk__sdscatsds(yk__sdsdup(t__29), t__30);
+    yk__sds t__32 = yk__concat_sds_lit(t__31, ".tmp", 4);
+    yk__sds yy__object_cache_temp = yk__sdsdup(t__32);
+    if ((!(yy__io_writefile(yk__bstr_h(yy__object_cache_temp), yk__bstr_h(yy__object_cache_data)))) || (!(yy__path_rename(yk__sdsdup(yy__object_cache_temp), yk__sdsdup(yy__object_cache_entry)))))
+    {
+        yy__path_remove(yk__sdsdup(yy__object_cache_temp));
+        yk__sdsfree(yy__object_cache_temp);
+        yk__sdsfree(t__32);
+        yk__sdsfree(t__31);
+        yk__sdsfree(t__30);
+        yk__sdsfree(t__29);
+        yk__sdsfree(yy__object_cache_entry);
+        yk__sdsfree(t__28);
+        yk__sdsfree(yy__object_cache_data);
+        yk__sdsfree(t__27);
+        yk__sdsfree(yy__object_cache_object_file_path);
+        yk__sdsfree(yy__object_cache_key);
+        return;
+    }
+    yk__sds t__33 = yk__concat_sds_lit(yy__object_cache_entry, ".key", 4);
+    if ((!(yy__io_writefile(yk__bstr_h(yy__object_cache_temp), yk__bstr_h(yy__object_cache_key)))) || (!(yy__path_rename(yk__sdsdup(yy__object_cache_temp), yk__sdsdup(t__33)))))
+    {
+        yy__path_remove(yk__sdsdup(yy__object_cache_temp));
+    }
+    yk__sdsfree(t__33);
+    yk__sdsfree(yy__object_cache_temp);
+    yk__sdsfree(t__32);
+    yk__sdsfree(t__31);
+    yk__sdsfree(t__30);
+    yk__sdsfree(t__29);
+    yk__sdsfree(yy__object_cache_entry);
+    yk__sdsfree(t__28);
+    yk__sdsfree(yy__object_cache_data);
+    yk__sdsfree(t__27);
+    yk__sdsfree(yy__object_cache_object_file_path);
+    yk__sdsfree(yy__object_cache_key);
+    return;
+}
+int32_t yy__object_cache_cmp_entry(void const* const  yy__object_cache_a, void const* const  yy__object_cache_b) 
+{
+    struct yy__object_cache_CacheEntry* yy__object_cache_ea = (*(((struct yy__object_cache_CacheEntry**)yy__object_cache_a)));
+    struct yy__object_cache_CacheEntry* yy__object_cache_eb = (*(((struct yy__object_cache_CacheEntry**)yy__object_cache_b)));
+    if (yy__object_cache_ea->yy__object_cache_mtime < yy__object_cache_eb->yy__object_cache_mtime)
+    {
+        return INT32_C(-1);
+    }
+    if (yy__object_cache_ea->yy__object_cache_mtime > yy__object_cache_eb->yy__object_cache_mtime)
+    {
+        return INT32_C(1);
+    }
+    return INT32_C(0);
+}
+void yy__object_cache_trim(struct yy__object_cache_ObjectCache* yy__object_cache_cache) 
+{
+    if (!(yy__object_cache_cache->yy__object_cache_enabled))
+    {
+        return;
+    }
+    yk__sds* yy__object_cache_names = yy__path_list_dir(yk__sdsdup(yy__object_cache_cache->yy__object_cache_path));
+    struct yy__object_cache_CacheEntry** yy__object_cache_entries = NULL;
+    int64_t yy__object_cache_total = INT64_C(0);
+    int32_t yy__object_cache_length = yk__arrlen(yy__object_cache_names);
+    int32_t yy__object_cache_x = INT32_C(0);
+    while (true)
+    {
+        if (!(yy__object_cache_x < yy__object_cache_length))
+        {
+            break;
+        }
+        yk__sds yy__object_cache_name = yk__sdsdup(yy__object_cache_names[yy__object_cache_x]);
+        yy__object_cache_x = (yy__object_cache_x + INT32_C(1));
+        if (!(yy__strings_endswith(yk__bstr_h(yy__object_cache_name), yk__bstr_s(".o", 2))))
+        {
+            yk__sdsfree(yy__object_cache_name);
+            continue;
+        }
+        yk__sds t__34 = yy__path_join(yk__bstr_h(yy__object_cache_cache->yy__object_cache_path), yk__bstr_h(yy__object_cache_name));
+        yk__sds yy__object_cache_full_path = yk__sdsdup(t__34);
+        struct yy__object_cache_CacheEntry* yy__object_cache_e = yk__obj_alloc(struct yy__object_cache_CacheEntry);
+        yy__object_cache_e->yy__object_cache_name = yk__sdsdup(yy__object_cache_full_path);
+        yy__object_cache_e->yy__object_cache_size = yy__path_file_size(yk__sdsdup(yy__object_cache_full_path));
+        yy__object_cache_e->yy__object_cache_mtime = yy__path_mtime(yk__sdsdup(yy__object_cache_full_path));
+        yy__object_cache_total = (yy__object_cache_total + yy__object_cache_e->yy__object_cache_size);
+        yk__arrput(yy__object_cache_entries, yy__object_cache_e);
+        yk__sdsfree(yy__object_cache_full_path);
+        yk__sdsfree(t__34);
+        yk__sdsfree(yy__object_cache_name);
+    }
+    if (yy__object_cache_total > yy__object_cache_cache->yy__object_cache_max_size)
+    {
+        (yk__quicksort(yy__object_cache_entries,sizeof(struct yy__object_cache_CacheEntry*),yk__arrlenu(yy__object_cache_entries),yy__object_cache_cmp_entry) == 0);
+        int64_t yy__object_cache_limit = ((yy__object_cache_cache->yy__object_cache_max_size / INT64_C(10)) * INT64_C(9));
+        yy__object_cache_x = INT32_C(0);
+        yy__object_cache_length = yk__arrlen(yy__object_cache_entries);
+        while (true)
+        {
+            if (!((((yy__object_cache_x < yy__object_cache_length) && (yy__object_cache_total > yy__object_cache_limit)))))
+            {
+                break;
+            }
+            if (yy__path_remove(yk__sdsdup(yy__object_cache_entries[yy__object_cache_x]->yy__object_cache_name)))
+            {
+                yy__object_cache_total = (yy__object_cache_total - yy__object_cache_entries[yy__object_cache_x]->yy__object_cache_size);
+                yk__sds t__35 = yk__concat_sds_lit(yy__object_cache_entries[yy__object_cache_x]->yy__object_cache_name, ".key", 4);
+                yy__path_remove(yk__sdsdup(t__35));
+                yk__sdsfree(t__35);
+            }
+            yy__object_cache_x = (yy__object_cache_x + INT32_C(1));
+        }
+    }
+    yy__object_cache_x = INT32_C(0);
+    yy__object_cache_length = yk__arrlen(yy__object_cache_entries);
+    while (true)
+    {
+        if (!(yy__object_cache_x < yy__object_cache_length))
+        {
+            break;
+        }
+        yk__sdsfree(yy__object_cache_entries[yy__object_cache_x]->yy__object_cache_name);
+        yk__obj_free(yy__object_cache_entries[yy__object_cache_x]);
+        yy__object_cache_x = (yy__object_cache_x + INT32_C(1));
+    }
+    yk__arrfree(yy__object_cache_entries);
+    yy__array_del_str_array(yy__object_cache_names);
+    return;
+}
+void yy__object_cache_print_stats(struct yy__object_cache_ObjectCache* yy__object_cache_cache) 
+{
+    if (!(yy__object_cache_cache->yy__object_cache_enabled))
+    {
+        return;
+    }
+    yy__console_cyan(yk__bstr_s("object_cache", 12));
+    yy__console_red(yk__bstr_s(" := ", 4));
+    yy__console_green(yk__bstr_h(yy__object_cache_cache->yy__object_cache_path));
+    yy__console_cyan(yk__bstr_s(" (", 2));
+    yk__printint((intmax_t)yy__object_cache_cache->yy__object_cache_hits);
+    yy__console_green(yk__bstr_s(" hit(s)", 7));
+    yy__console_cyan(yk__bstr_s(", ", 2));
+    yk__printint((intmax_t)yy__object_cache_cache->yy__object_cache_misses);
+    yy__console_yellow(yk__bstr_s(" miss(es)", 9));
+    yy__console_cyan(yk__bstr_s(")\n", 2));
+    return;
+}
 struct yy__raylib_support_CObject* yy__raylib_support_fill_arguments(yk__sds yy__raylib_support_src_path, struct yy__raylib_support_CObject* yy__raylib_support_c, bool yy__raylib_support_dll) 
 {
     yk__sds* yy__raylib_support_args = NULL;
@@ -356,7 +997,7 @@ struct yy__raylib_support_CObject* yy__raylib_support_fill_web_arguments(yk__sds
 }
 struct yy__raylib_support_CObject* yy__raylib_support_co(yk__sds yy__raylib_support_filename, yk__sds yy__raylib_support_src_path, yk__sds yy__raylib_support_target_path, bool yy__raylib_support_web, bool yy__raylib_support_dll) 
 {
-    struct yy__raylib_support_CObject* yy__raylib_support_obj = calloc(1, sizeof(struct yy__raylib_support_CObject));
+    struct yy__raylib_support_CObject* yy__raylib_support_obj = yk__obj_alloc(struct yy__raylib_support_CObject);
     yk__sds t__13 = yk__concat_sds_lit(yy__raylib_support_filename, ".c", 2);
     yk__sds t__14 = yy__path_join(yk__bstr_h(yy__raylib_support_src_path), yk__bstr_h(t__13));
     yy__raylib_support_obj->yy__raylib_support_c_file = yk__sdsdup(t__14);
@@ -398,7 +1039,7 @@ void yy__raylib_support_del_c_object(struct yy__raylib_support_CObject* yy__rayl
     yk__sdsfree(yy__raylib_support_c->yy__raylib_support_o_file);
     yk__sdsfree(yy__raylib_support_c->yy__raylib_support_base_name);
     yy__array_del_str_array(yy__raylib_support_c->yy__raylib_support_args);
-    free(yy__raylib_support_c);
+    yk__obj_free(yy__raylib_support_c);
     return;
 }
 void yy__raylib_support_del_objects(struct yy__raylib_support_CObject** yy__raylib_support_x) 
@@ -605,9 +1246,7 @@ void yy__raylib_support_build_objects(struct yy__raylib_support_CObject** yy__ra
         return;
     }
     int32_t yy__raylib_support_object_count = yk__arrlen(yy__raylib_support_objects);
-    yy__cpu_Cpu yy__raylib_support_cpu_data = yy__cpu_info();
-    uint8_t yy__raylib_support_threads = ((uint8_t)yy__raylib_support_cpu_data.n_processors);
-    yy__raylib_support_threads = ((yy__raylib_support_threads > yy__pool_MAX_THREAD_SIZE) ? yy__pool_MAX_THREAD_SIZE : yy__raylib_support_threads);
+    uint8_t yy__raylib_support_threads = yy__configuration_job_count(yy__raylib_support_conf);
     struct yy__pool_ThreadPool* yy__raylib_support_tpool = yy__pool_create(yy__raylib_support_threads, ((uint32_t)(yy__raylib_support_object_count + INT32_C(2))));
     if (yy__raylib_support_tpool == NULL)
     {
@@ -623,7 +1262,7 @@ void yy__raylib_support_build_objects(struct yy__raylib_support_CObject** yy__ra
             break;
         }
         struct yy__raylib_support_CObject* yy__raylib_support_object = yy__raylib_support_objects[yy__raylib_support_pos];
-        struct yy__raylib_support_BuildData* yy__raylib_support_data = calloc(1, sizeof(struct yy__raylib_support_BuildData));
+        struct yy__raylib_support_BuildData* yy__raylib_support_data = yk__obj_alloc(struct yy__raylib_support_BuildData);
         yy__raylib_support_data->yy__raylib_support_object_data = yy__raylib_support_object;
         yy__raylib_support_data->yy__raylib_support_config = yy__raylib_support_conf;
         yk__arrput(yy__raylib_support_to_pass, yy__raylib_support_data);
@@ -638,7 +1277,7 @@ void yy__raylib_support_build_objects(struct yy__raylib_support_CObject** yy__ra
         {
             break;
         }
-        free(yy__raylib_support_to_pass[yy__raylib_support_pos]);
+        yk__obj_free(yy__raylib_support_to_pass[yy__raylib_support_pos]);
         yy__raylib_support_pos += INT32_C(1);
     }
     yk__arrfree(yy__raylib_support_to_pass);
@@ -710,224 +1349,11 @@ yk__sds* yy__raylib_support_get_raylib_args(struct yy__configuration_Config* yy_
     yk__sdsfree(yy__raylib_support_build_path);
     return t__43;
 }
-yy__cpu_Cpu yy__cpu_info() { return yk__get_cpu_count(); }
-int32_t yy__mutex_init(yy__mutex_Mutex* nn__mtx, int32_t nn__type) { return mtx_init(nn__mtx, nn__type); }
-void yy__mutex_destroy(yy__mutex_Mutex* nn__mtx) { mtx_destroy(nn__mtx); }
-int32_t yy__mutex_lock(yy__mutex_Mutex* nn__mtx) { return mtx_lock(nn__mtx); }
-int32_t yy__mutex_unlock(yy__mutex_Mutex* nn__mtx) { return mtx_unlock(nn__mtx); }
-int32_t yy__condition_init(yy__condition_Condition* nn__cnd) { return cnd_init(nn__cnd); }
-void yy__condition_destroy(yy__condition_Condition* nn__cnd) { cnd_destroy(nn__cnd); }
-int32_t yy__condition_signal(yy__condition_Condition* nn__cnd) { return cnd_signal(nn__cnd); }
-int32_t yy__condition_broadcast(yy__condition_Condition* nn__cnd) { return cnd_broadcast(nn__cnd); }
-int32_t yy__condition_wait(yy__condition_Condition* nn__cnd, yy__mutex_Mutex* nn__mtx) { return cnd_wait(nn__cnd, nn__mtx); }
-int32_t yy__thread_create_with_data(yy__thread_Thread* nn__thr, yt_fn_in_any_ptr_out_i32 nn__func, void* nn__data) { return thrd_create(nn__thr, nn__func, nn__data); }
-void yy__thread_exit(int32_t nn__res) { thrd_exit(nn__res); }
-int32_t yy__thread_join(yy__thread_Thread nn__thr) 
+yy__buffer_StringBuffer yy__buffer_new() 
 {
-    return thrd_join(nn__thr, NULL);
-}
-struct yy__pool_ThreadPool* yy__pool_create(uint8_t yy__pool_thread_count, uint32_t yy__pool_queue_size) 
-{
-    if ((((yy__pool_thread_count == UINT8_C(0)) || (yy__pool_queue_size == UINT32_C(0))) || (yy__pool_thread_count > yy__pool_MAX_THREAD_SIZE)) || (yy__pool_queue_size > yy__pool_MAX_QUEUE_SIZE))
-    {
-        struct yy__pool_ThreadPool* t__0 = NULL;
-        return t__0;
-    }
-    struct yy__pool_ThreadPool* yy__pool_tpool = calloc(1, sizeof(struct yy__pool_ThreadPool));
-    if (yy__pool_tpool == NULL)
-    {
-        struct yy__pool_ThreadPool* t__1 = yy__pool_tpool;
-        return t__1;
-    }
-    yy__pool_tpool->yy__pool_thread_count = INT32_C(0);
-    yy__pool_tpool->yy__pool_queue_size = ((int32_t)yy__pool_queue_size);
-    yy__pool_tpool->yy__pool_head = INT32_C(0);
-    yy__pool_tpool->yy__pool_tail = INT32_C(0);
-    yy__pool_tpool->yy__pool_count = INT32_C(0);
-    yy__pool_tpool->yy__pool_shutdown = INT32_C(0);
-    yy__pool_tpool->yy__pool_started = INT32_C(0);
-    yk__arrsetlen(yy__pool_tpool->yy__pool_threads, yy__pool_thread_count);
-    yk__arrsetlen(yy__pool_tpool->yy__pool_queue, yy__pool_queue_size);
-    bool yy__pool_locks_ok = ((yy__mutex_init((&(yy__pool_tpool->yy__pool_lock)), yy__mutex_PLAIN) == yy__thread_SUCCESS) && (yy__condition_init((&(yy__pool_tpool->yy__pool_notify))) == yy__thread_SUCCESS));
-    bool yy__pool_arrays_ok = ((yy__pool_tpool->yy__pool_threads != NULL) && (yy__pool_tpool->yy__pool_queue != NULL));
-    if (!yy__pool_locks_ok || !yy__pool_arrays_ok)
-    {
-        yy__pool_internal_del_pool(yy__pool_tpool);
-        struct yy__pool_ThreadPool* t__2 = NULL;
-        return t__2;
-    }
-    int32_t yy__pool_i = INT32_C(0);
-    int32_t yy__pool_thread_count_i = ((int32_t)yy__pool_thread_count);
-    while (true)
-    {
-        if (!(yy__pool_i < yy__pool_thread_count_i))
-        {
-            break;
-        }
-        bool yy__pool_ok = (yy__thread_create_with_data((&(yy__pool_tpool->yy__pool_threads[yy__pool_i])), yy__pool_internal_tpool_work, yy__pool_tpool) == yy__thread_SUCCESS);
-        if (!yy__pool_ok)
-        {
-            yy__pool_destroy(yy__pool_tpool, true);
-            struct yy__pool_ThreadPool* t__3 = NULL;
-            return t__3;
-        }
-        yy__pool_i += INT32_C(1);
-        yy__pool_tpool->yy__pool_thread_count += INT32_C(1);
-        yy__pool_tpool->yy__pool_started += INT32_C(1);
-    }
-    struct yy__pool_ThreadPool* t__4 = yy__pool_tpool;
-    return t__4;
-}
-int32_t yy__pool_add(struct yy__pool_ThreadPool* yy__pool_tpool, yt_fn_in_any_ptr_out yy__pool_func, void* yy__pool_arg) 
-{
-    int32_t yy__pool_err = yy__pool_SUCCESS;
-    int32_t yy__pool_next = INT32_C(0);
-    if (yy__pool_tpool == NULL)
-    {
-        int32_t const  t__5 = yy__pool_ERROR_INVALID;
-        return t__5;
-    }
-    if (yy__mutex_lock((&(yy__pool_tpool->yy__pool_lock))) != yy__thread_SUCCESS)
-    {
-        int32_t const  t__6 = yy__pool_ERROR_LOCK_FAILURE;
-        return t__6;
-    }
-    yy__pool_next = (((yy__pool_tpool->yy__pool_tail + INT32_C(1))) % yy__pool_tpool->yy__pool_queue_size);
-    while (true)
-    {
-        if (yy__pool_tpool->yy__pool_count == yy__pool_tpool->yy__pool_queue_size)
-        {
-            yy__pool_err = yy__pool_ERROR_QUEUE_FULL;
-            break;
-        }
-        if (yy__pool_tpool->yy__pool_shutdown != yy__pool_NO_SHUTDOWN)
-        {
-            yy__pool_err = yy__pool_ERROR_SHUTDOWN;
-            break;
-        }
-        yy__pool_tpool->yy__pool_queue[yy__pool_tpool->yy__pool_tail].e1 = yy__pool_func;
-        yy__pool_tpool->yy__pool_queue[yy__pool_tpool->yy__pool_tail].e2 = yy__pool_arg;
-        yy__pool_tpool->yy__pool_tail = yy__pool_next;
-        yy__pool_tpool->yy__pool_count += INT32_C(1);
-        if (yy__condition_signal((&(yy__pool_tpool->yy__pool_notify))) != yy__thread_SUCCESS)
-        {
-            yy__pool_err = yy__pool_ERROR_LOCK_FAILURE;
-        }
-        break;
-    }
-    if (yy__mutex_unlock((&(yy__pool_tpool->yy__pool_lock))) != yy__thread_SUCCESS)
-    {
-        yy__pool_err = yy__pool_ERROR_LOCK_FAILURE;
-    }
-    int32_t t__7 = yy__pool_err;
-    return t__7;
-}
-int32_t yy__pool_destroy(struct yy__pool_ThreadPool* yy__pool_tpool, bool yy__pool_graceful) 
-{
-    if (yy__pool_tpool == NULL)
-    {
-        int32_t const  t__8 = yy__pool_ERROR_INVALID;
-        return t__8;
-    }
-    if (yy__mutex_lock((&(yy__pool_tpool->yy__pool_lock))) != yy__thread_SUCCESS)
-    {
-        int32_t const  t__9 = yy__pool_ERROR_LOCK_FAILURE;
-        return t__9;
-    }
-    int32_t yy__pool_err = yy__pool_SUCCESS;
-    while (true)
-    {
-        if (yy__pool_tpool->yy__pool_shutdown != yy__pool_NO_SHUTDOWN)
-        {
-            yy__pool_err = yy__pool_ERROR_SHUTDOWN;
-            break;
-        }
-        yy__pool_tpool->yy__pool_shutdown = (yy__pool_graceful ? yy__pool_GRACEFUL_SHUTDOWN : yy__pool_IMMEDIATE_SHUTDOWN);
-        if ((yy__condition_broadcast((&(yy__pool_tpool->yy__pool_notify))) != yy__thread_SUCCESS) || (yy__mutex_unlock((&(yy__pool_tpool->yy__pool_lock))) != yy__thread_SUCCESS))
-        {
-            yy__pool_err = yy__pool_ERROR_LOCK_FAILURE;
-            break;
-        }
-        int32_t yy__pool_i = INT32_C(0);
-        while (true)
-        {
-            if (!(yy__pool_i < yy__pool_tpool->yy__pool_thread_count))
-            {
-                break;
-            }
-            bool yy__pool_ok = (yy__thread_join(yy__pool_tpool->yy__pool_threads[yy__pool_i]) == yy__thread_SUCCESS);
-            if (!yy__pool_ok)
-            {
-                yy__pool_err = yy__pool_ERROR_THREAD_FAILURE;
-            }
-            yy__pool_i += INT32_C(1);
-        }
-        break;
-    }
-    if (yy__pool_err == yy__pool_SUCCESS)
-    {
-        yy__pool_internal_del_pool(yy__pool_tpool);
-    }
-    int32_t t__10 = yy__pool_err;
-    return t__10;
-}
-int32_t yy__pool_internal_del_pool(struct yy__pool_ThreadPool* yy__pool_tpool) 
-{
-    if ((yy__pool_tpool == NULL) || (yy__pool_tpool->yy__pool_started > INT32_C(0)))
-    {
-        int32_t const  t__11 = yy__pool_ERROR_INVALID;
-        return t__11;
-    }
-    if ((yy__pool_tpool->yy__pool_threads != NULL) || (yy__pool_tpool->yy__pool_queue != NULL))
-    {
-        yk__arrfree(yy__pool_tpool->yy__pool_threads);
-        yk__arrfree(yy__pool_tpool->yy__pool_queue);
-        yy__mutex_lock((&(yy__pool_tpool->yy__pool_lock)));
-        yy__mutex_unlock((&(yy__pool_tpool->yy__pool_lock)));
-        yy__mutex_destroy((&(yy__pool_tpool->yy__pool_lock)));
-        yy__condition_destroy((&(yy__pool_tpool->yy__pool_notify)));
-    }
-    free(yy__pool_tpool);
-    int32_t const  t__12 = yy__pool_SUCCESS;
-    return t__12;
-}
-int32_t yy__pool_internal_tpool_work(void* yy__pool_tpool_obj) 
-{
-    struct yy__pool_ThreadPool* yy__pool_tpool = ((struct yy__pool_ThreadPool*)yy__pool_tpool_obj);
-    struct yt_tuple_fn_in_any_ptr_out_any_ptr yy__pool_task;
-    while (true)
-    {
-        yy__mutex_lock((&(yy__pool_tpool->yy__pool_lock)));
-        while (true)
-        {
-            if (!((((yy__pool_tpool->yy__pool_count == INT32_C(0)) && (yy__pool_tpool->yy__pool_shutdown == yy__pool_NO_SHUTDOWN)))))
-            {
-                break;
-            }
-            yy__condition_wait((&(yy__pool_tpool->yy__pool_notify)), (&(yy__pool_tpool->yy__pool_lock)));
-        }
-        if ((((yy__pool_tpool->yy__pool_shutdown == yy__pool_GRACEFUL_SHUTDOWN) && (yy__pool_tpool->yy__pool_count == INT32_C(0)))) || (yy__pool_tpool->yy__pool_shutdown == yy__pool_IMMEDIATE_SHUTDOWN))
-        {
-            break;
-        }
-        yy__pool_task.e1 = yy__pool_tpool->yy__pool_queue[yy__pool_tpool->yy__pool_head].e1;
-        yy__pool_task.e2 = yy__pool_tpool->yy__pool_queue[yy__pool_tpool->yy__pool_head].e2;
-        yy__pool_tpool->yy__pool_head = (((yy__pool_tpool->yy__pool_head + INT32_C(1))) % yy__pool_tpool->yy__pool_queue_size);
-        yy__pool_tpool->yy__pool_count -= INT32_C(1);
-        yy__mutex_unlock((&(yy__pool_tpool->yy__pool_lock)));
-        yt_fn_in_any_ptr_out yy__pool_fnc = yy__pool_task.e1;
-        yy__pool_fnc(yy__pool_task.e2);
-    }
-    yy__pool_tpool->yy__pool_started -= INT32_C(1);
-    yy__mutex_unlock((&(yy__pool_tpool->yy__pool_lock)));
-    yy__thread_exit(INT32_C(0));
-    return INT32_C(0);
-}
-yy__buffer_StringBuffer yy__buffer_new() 
-{
-    yk__sds* srr = calloc(1, sizeof(yk__sds*));
-    srr[0] = yk__sdsempty();
-    return srr;
+    yk__sds* srr = calloc(1, sizeof(yk__sds*));
+    srr[0] = yk__sdsempty();
+    return srr;
 }
 void yy__buffer_append(yy__buffer_StringBuffer nn__buf, struct yk__bstr nn__v) 
 {
@@ -942,12 +1368,12 @@ void yy__buffer_del_buf(yy__buffer_StringBuffer nn__buf)
     yk__sdsfree(nn__buf[0]); 
     free(nn__buf);
 }
-yk__sds yy__building_prepare_code(struct yy__configuration_Config* yy__building_c, yk__sds yy__building_code) 
+yk__sds yy__building_code_prefix(struct yy__configuration_Config* yy__building_c) 
 {
     yy__buffer_StringBuffer yy__building_buf = yy__buffer_new();
     int32_t yy__building_length = INT32_C(0);
     int32_t yy__building_x = INT32_C(0);
-    yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_defines);
+    yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_defines);
     yy__building_x = INT32_C(0);
     while (true)
     {
@@ -955,14 +1381,14 @@ yk__sds yy__building_prepare_code(struct yy__configuration_Config* yy__building_
         {
             break;
         }
-        yk__sds t__0 = yk__concat_lit_sds("#define ", 8, yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_defines[yy__building_x]);
+        yk__sds t__0 = yk__concat_lit_sds("#define ", 8, yy__building_c->yy__configuration_c_code->yy__configuration_defines[yy__building_x]);
         yk__sds t__1 = yk__concat_sds_lit(t__0, "\n", 1);
         yy__buffer_append(yy__building_buf, yk__bstr_h(t__1));
         yy__building_x = (yy__building_x + INT32_C(1));
         yk__sdsfree(t__1);
         yk__sdsfree(t__0);
     }
-    yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_defines);
+    yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_system_includes);
     yy__building_x = INT32_C(0);
     while (true)
     {
@@ -970,14 +1396,22 @@ yk__sds yy__building_prepare_code(struct yy__configuration_Config* yy__building_
         {
             break;
         }
-        yk__sds t__2 = yk__concat_lit_sds("#define ", 8, yy__building_c->yy__configuration_c_code->yy__configuration_defines[yy__building_x]);
-        yk__sds t__3 = yk__concat_sds_lit(t__2, "\n", 1);
+        yk__sds t__2 = yk__concat_lit_sds("#include <", 10, yy__building_c->yy__configuration_c_code->yy__configuration_system_includes[yy__building_x]);
+        yk__sds t__3 = yk__concat_sds_lit(t__2, ">\n", 2);
         yy__buffer_append(yy__building_buf, yk__bstr_h(t__3));
         yy__building_x = (yy__building_x + INT32_C(1));
         yk__sdsfree(t__3);
         yk__sdsfree(t__2);
     }
-    yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_system_includes);
+    if (yy__building_c->yy__configuration_compilation->yy__configuration_raylib)
+    {
+        yy__buffer_append(yy__building_buf, yk__bstr_s("#include \"raylib.h\"\n", 20));
+        yy__buffer_append(yy__building_buf, yk__bstr_s("#include \"raygui.h\"\n", 20));
+        yy__buffer_append(yy__building_buf, yk__bstr_s("#include \"raymath.h\"\n", 21));
+        yy__buffer_append(yy__building_buf, yk__bstr_s("#include \"rlgl.h\"\n", 18));
+        yy__buffer_append(yy__building_buf, yk__bstr_s("#include \"rayextras.h\"\n", 23));
+    }
+    yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes);
     yy__building_x = INT32_C(0);
     while (true)
     {
@@ -985,22 +1419,14 @@ yk__sds yy__building_prepare_code(struct yy__configuration_Config* yy__building_
         {
             break;
         }
-        yk__sds t__4 = yk__concat_lit_sds("#include <", 10, yy__building_c->yy__configuration_c_code->yy__configuration_system_includes[yy__building_x]);
-        yk__sds t__5 = yk__concat_sds_lit(t__4, ">\n", 2);
+        yk__sds t__4 = yk__concat_lit_sds("#include \"", 10, yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes[yy__building_x]);
+        yk__sds t__5 = yk__concat_sds_lit(t__4, "\"\n", 2);
         yy__buffer_append(yy__building_buf, yk__bstr_h(t__5));
         yy__building_x = (yy__building_x + INT32_C(1));
         yk__sdsfree(t__5);
         yk__sdsfree(t__4);
     }
-    if (yy__building_c->yy__configuration_compilation->yy__configuration_raylib)
-    {
-        yy__buffer_append(yy__building_buf, yk__bstr_s("#include \"raylib.h\"\n", 20));
-        yy__buffer_append(yy__building_buf, yk__bstr_s("#include \"raygui.h\"\n", 20));
-        yy__buffer_append(yy__building_buf, yk__bstr_s("#include \"raymath.h\"\n", 21));
-        yy__buffer_append(yy__building_buf, yk__bstr_s("#include \"rlgl.h\"\n", 18));
-        yy__buffer_append(yy__building_buf, yk__bstr_s("#include \"rayextras.h\"\n", 23));
-    }
-    yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes);
+    yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_includes);
     yy__building_x = INT32_C(0);
     while (true)
     {
@@ -1008,14 +1434,26 @@ yk__sds yy__building_prepare_code(struct yy__configuration_Config* yy__building_
         {
             break;
         }
-        yk__sds t__6 = yk__concat_lit_sds("#include \"", 10, yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes[yy__building_x]);
+        yk__sds t__6 = yk__concat_lit_sds("#include \"", 10, yy__building_c->yy__configuration_c_code->yy__configuration_includes[yy__building_x]);
         yk__sds t__7 = yk__concat_sds_lit(t__6, "\"\n", 2);
         yy__buffer_append(yy__building_buf, yk__bstr_h(t__7));
         yy__building_x = (yy__building_x + INT32_C(1));
         yk__sdsfree(t__7);
         yk__sdsfree(t__6);
     }
-    yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_includes);
+    yk__sds t__8 = yy__buffer_to_str(yy__building_buf);
+    yk__sds yy__building_result = yk__sdsdup(t__8);
+    yk__sds t__9 = yy__building_result;
+    yy__buffer_del_buf(yy__building_buf);
+    yk__sdsfree(t__8);
+    return t__9;
+}
+yk__sds yy__building_implementation_prefix(struct yy__configuration_Config* yy__building_c) 
+{
+    yy__buffer_StringBuffer yy__building_buf = yy__buffer_new();
+    int32_t yy__building_length = INT32_C(0);
+    int32_t yy__building_x = INT32_C(0);
+    yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_defines);
     yy__building_x = INT32_C(0);
     while (true)
     {
@@ -1023,79 +1461,349 @@ yk__sds yy__building_prepare_code(struct yy__configuration_Config* yy__building_
         {
             break;
         }
-        yk__sds t__8 = yk__concat_lit_sds("#include \"", 10, yy__building_c->yy__configuration_c_code->yy__configuration_includes[yy__building_x]);
-        yk__sds t__9 = yk__concat_sds_lit(t__8, "\"\n", 2);
-        yy__buffer_append(yy__building_buf, yk__bstr_h(t__9));
+        yk__sds t__10 = yk__concat_lit_sds("#define ", 8, yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_defines[yy__building_x]);
+        yk__sds t__11 = yk__concat_sds_lit(t__10, "\n", 1);
+        yy__buffer_append(yy__building_buf, yk__bstr_h(t__11));
         yy__building_x = (yy__building_x + INT32_C(1));
-        yk__sdsfree(t__9);
-        yk__sdsfree(t__8);
+        yk__sdsfree(t__11);
+        yk__sdsfree(t__10);
+    }
+    yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_implementations);
+    yy__building_x = INT32_C(0);
+    while (true)
+    {
+        if (!(yy__building_x < yy__building_length))
+        {
+            break;
+        }
+        yk__sds t__12 = yk__concat_lit_sds("#include \"", 10, yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_implementations[yy__building_x]);
+        yk__sds t__13 = yk__concat_sds_lit(t__12, "\"\n", 2);
+        yy__buffer_append(yy__building_buf, yk__bstr_h(t__13));
+        yy__building_x = (yy__building_x + INT32_C(1));
+        yk__sdsfree(t__13);
+        yk__sdsfree(t__12);
+    }
+    if (yy__building_c->yy__configuration_compilation->yy__configuration_raylib)
+    {
+        yy__buffer_append(yy__building_buf, yk__bstr_s("#define YK__RAYEXTRAS_IMPLEMENTATION\n", 37));
+        yy__buffer_append(yy__building_buf, yk__bstr_s("#include \"rayextras.h\"\n", 23));
     }
-    yy__buffer_append(yy__building_buf, yk__bstr_h(yy__building_code));
-    yy__buffer_append(yy__building_buf, yk__bstr_s("\n", 1));
-    yk__sds t__10 = yy__buffer_to_str(yy__building_buf);
-    yk__sds yy__building_result = yk__sdsdup(t__10);
-    yk__sds t__11 = yy__building_result;
+    yk__sds t__14 = yy__buffer_to_str(yy__building_buf);
+    yk__sds yy__building_result = yk__sdsdup(t__14);
+    yk__sds t__15 = yy__building_result;
     yy__buffer_del_buf(yy__building_buf);
-    yk__sdsfree(t__10);
+    yk__sdsfree(t__14);
+    return t__15;
+}
+yk__sds yy__building_prepare_code(struct yy__configuration_Config* yy__building_c, yk__sds yy__building_code) 
+{
+    yk__sds t__16 = yy__building_code_prefix(yy__building_c);
+    yk__sds t__17 = yy__building_implementation_prefix(yy__building_c);
+    yk__sds t__18 = yk__sdscatsds(yk__sdsdup(t__16), t__17);
+    yk__sds t__19 = yk__sdscatsds(yk__sdsdup(t__18), yy__building_code);
+    yk__sds t__20 = yk__concat_sds_lit(t__19, "\n", 1);
+    yk__sds t__21 = t__20;
+    yk__sdsfree(t__19);
+    yk__sdsfree(t__18);
+    yk__sdsfree(t__17);
+    yk__sdsfree(t__16);
+    yk__sdsfree(yy__building_code);
+    return t__21;
+}
+yk__sds* yy__building_write_units(struct yy__configuration_Config* yy__building_c, yk__sds yy__building_code, yk__sds yy__building_build_path) 
+{
+    yk__sds* yy__building_paths = NULL;
+    yk__sds* yy__building_units = yy__strings_split(yk__bstr_h(yy__building_code), yy__building_UNIT_SEPARATOR);
+    yk__sds t__22 = yy__path_join(yk__bstr_h(yy__building_build_path), yk__bstr_s("program_code.h", 14));
+    yk__sds yy__building_header_path = yk__sdsdup(t__22);
+    yk__sds t__23 = yy__building_code_prefix(yy__building_c);
+    yk__sds t__24 = yk__concat_lit_sds("#ifndef YK__PROGRAM_CODE_H\n#define YK__PROGRAM_CODE_H\n", 54, t__23);
+    yk__sds t__25 = yk__sdscatsds(yk__sdsdup(t__24), yy__building_units[INT32_C(0)]);
+    yk__sds t__26 = yk__concat_sds_lit(t__25, "\n#endif\n", 8);
+    yk__sds yy__building_header = yk__sdsdup(t__26);
+    if (!(yy__io_writefile(yk__bstr_h(yy__building_header_path), yk__bstr_h(yy__building_header))))
+    {
+        yy__console_red(yk__bstr_s("Failed to write file:", 21));
+        yk__printlnstr(yy__building_header_path);
+        yk__sds* t__27 = yy__building_paths;
+        yy__array_del_str_array(yy__building_units);
+        yk__sdsfree(yy__building_header);
+        yk__sdsfree(t__26);
+        yk__sdsfree(t__25);
+        yk__sdsfree(t__24);
+        yk__sdsfree(t__23);
+        yk__sdsfree(yy__building_header_path);
+        yk__sdsfree(t__22);
+        yk__sdsfree(yy__building_build_path);
+        yk__sdsfree(yy__building_code);
+        return t__27;
+    }
+    int32_t yy__building_length = yk__arrlen(yy__building_units);
+    int32_t yy__building_x = INT32_C(1);
+    while (true)
+    {
+        if (!(yy__building_x < yy__building_length))
+        {
+            break;
+        }
+        yk__sds t__28 = yy__numbers_i2s(yy__building_x);
+        yk__sds t__29 = yk__concat_lit_sds("program_code_", 13, t__28);
+        yk__sds t__30 = yk__concat_sds_lit(t__29, ".c", 2);
+        yk__sds t__31 = yy__path_join(yk__bstr_h(yy__building_build_path), yk__bstr_h(t__30));
+        yk__sds yy__building_unit_path = yk__sdsdup(t__31);
+        yk__sds yy__building_unit_code = yk__sdsnewlen("#include \"program_code.h\"\n" , 26);
+        if (yy__building_x == INT32_C(1))
+        {
+            yk__sds t__32 = yy__building_implementation_prefix(yy__building_c);
+            yy__building_unit_code = yk__append_sds_sds(yy__building_unit_code, t__32);
+            yk__sdsfree(t__32);
+        }
+        yk__sds t__33 = yk__concat_sds_lit(yy__building_units[yy__building_x], "\n", 1);
+        yy__building_unit_code = yk__append_sds_sds(yy__building_unit_code, t__33);
+        if (!(yy__io_writefile(yk__bstr_h(yy__building_unit_path), yk__bstr_h(yy__building_unit_code))))
+        {
+            yy__console_red(yk__bstr_s("Failed to write file:", 21));
+            yk__printlnstr(yy__building_unit_path);
+            yy__array_del_str_array(yy__building_paths);
+            yk__sds* yy__building_failed = NULL;
+            yk__sds* t__34 = yy__building_failed;
+            yy__array_del_str_array(yy__building_units);
+            yk__sdsfree(t__33);
+            yk__sdsfree(yy__building_unit_code);
+            yk__sdsfree(yy__building_unit_path);
+            yk__sdsfree(t__31);
+            yk__sdsfree(t__30);
+            yk__sdsfree(t__29);
+            yk__sdsfree(t__28);
+            yk__sdsfree(yy__building_header);
+            yk__sdsfree(t__26);
+            yk__sdsfree(t__25);
+            yk__sdsfree(t__24);
+            yk__sdsfree(t__23);
+            yk__sdsfree(yy__building_header_path);
+            yk__sdsfree(t__22);
+            yk__sdsfree(yy__building_build_path);
+            yk__sdsfree(yy__building_code);
+            return t__34;
+        }
+        yk__arrput(yy__building_paths, yk__sdsdup(yy__building_unit_path));
+        yy__building_x = (yy__building_x + INT32_C(1));
+        yk__sdsfree(t__33);
+        yk__sdsfree(yy__building_unit_code);
+        yk__sdsfree(yy__building_unit_path);
+        yk__sdsfree(t__31);
+        yk__sdsfree(t__30);
+        yk__sdsfree(t__29);
+        yk__sdsfree(t__28);
+    }
+    yk__sds* t__35 = yy__building_paths;
+    yy__array_del_str_array(yy__building_units);
+    yk__sdsfree(yy__building_header);
+    yk__sdsfree(t__26);
+    yk__sdsfree(t__25);
+    yk__sdsfree(t__24);
+    yk__sdsfree(t__23);
+    yk__sdsfree(yy__building_header_path);
+    yk__sdsfree(t__22);
+    yk__sdsfree(yy__building_build_path);
+    yk__sdsfree(yy__building_code);
+    return t__35;
+}
+yk__sds* yy__building_write_code(struct yy__configuration_Config* yy__building_c, yk__sds yy__building_code, yy__in_process_Compilation yy__building_comp, yk__sds yy__building_dir_path, yk__sds yy__building_name) 
+{
+    yk__sds* yy__building_paths = NULL;
+    if (yy__building_comp != NULL)
+    {
+        yk__sds t__36 = yy__building_code_prefix(yy__building_c);
+        yk__sds t__37 = yy__building_implementation_prefix(yy__building_c);
+        int32_t yy__building_units = yy__in_process_write(yy__building_comp, yk__sdsdup(t__36), yk__sdsdup(t__37), yk__sdsdup(yy__building_dir_path), yk__sdsdup(yy__building_name));
+        if (yy__building_units < INT32_C(0))
+        {
+            yy__console_red(yk__bstr_s("Failed to write compiled code to:", 33));
+            yk__printlnstr(yy__building_dir_path);
+        }
+        else
+        {
+            if (yy__building_units == INT32_C(0))
+            {
+                yk__sds t__38 = yk__concat_sds_lit(yy__building_name, ".c", 2);
+                yk__sds t__39 = yy__path_join(yk__bstr_h(yy__building_dir_path), yk__bstr_h(t__38));
+                yk__arrput(yy__building_paths, yk__sdsdup(t__39));
+                yk__sdsfree(t__39);
+                yk__sdsfree(t__38);
+            }
+            else
+            {
+                int32_t yy__building_x = INT32_C(1);
+                while (true)
+                {
+                    if (!(yy__building_x <= yy__building_units))
+                    {
+                        break;
+                    }
+                    yk__sds t__40 = yk__concat_sds_lit(yy__building_name, "_", 1);
+                    yk__sds t__41 = yy__numbers_i2s(yy__building_x);
+                    yk__sds t__42 = yk__sdscatsds(yk__sdsdup(t__40), t__41);
+                    yk__sds t__43 = yk__concat_sds_lit(t__42, ".c", 2);
+                    yk__sds t__44 = yy__path_join(yk__bstr_h(yy__building_dir_path), yk__bstr_h(t__43));
+                    yk__arrput(yy__building_paths, yk__sdsdup(t__44));
+                    yy__building_x = (yy__building_x + INT32_C(1));
+                    yk__sdsfree(t__44);
+                    yk__sdsfree(t__43);
+                    yk__sdsfree(t__42);
+                    yk__sdsfree(t__41);
+                    yk__sdsfree(t__40);
+                }
+            }
+        }
+        yk__sds* t__45 = yy__building_paths;
+        yk__sdsfree(t__37);
+        yk__sdsfree(t__36);
+        yk__sdsfree(yy__building_name);
+        yk__sdsfree(yy__building_dir_path);
+        yk__sdsfree(yy__building_code);
+        return t__45;
+        yk__sdsfree(t__37);
+        yk__sdsfree(t__36);
+    }
+    if (yy__strings_contains(yk__bstr_h(yy__building_code), yy__building_UNIT_SEPARATOR))
+    {
+        yk__sds* t__46 = yy__building_write_units(yy__building_c, yk__sdsdup(yy__building_code), yk__sdsdup(yy__building_dir_path));
+        yk__sdsfree(yy__building_name);
+        yk__sdsfree(yy__building_dir_path);
+        yk__sdsfree(yy__building_code);
+        return t__46;
+    }
+    yk__sds t__47 = yk__concat_sds_lit(yy__building_name, ".c", 2);
+    yk__sds t__48 = yy__path_join(yk__bstr_h(yy__building_dir_path), yk__bstr_h(t__47));
+    yk__sds yy__building_code_path = yk__sdsdup(t__48);
+    yk__sds t__49 = yy__building_prepare_code(yy__building_c, yk__sdsdup(yy__building_code));
+    if (!(yy__io_writefile(yk__bstr_h(yy__building_code_path), yk__bstr_h(t__49))))
+    {
+        yy__console_red(yk__bstr_s("Failed to write file:", 21));
+        yk__printlnstr(yy__building_code_path);
+        yk__sds* t__50 = yy__building_paths;
+        yk__sdsfree(t__49);
+        yk__sdsfree(yy__building_code_path);
+        yk__sdsfree(t__48);
+        yk__sdsfree(t__47);
+        yk__sdsfree(yy__building_name);
+        yk__sdsfree(yy__building_dir_path);
+        yk__sdsfree(yy__building_code);
+        return t__50;
+    }
+    yk__arrput(yy__building_paths, yk__sdsdup(yy__building_code_path));
+    yk__sds* t__51 = yy__building_paths;
+    yk__sdsfree(t__49);
+    yk__sdsfree(yy__building_code_path);
+    yk__sdsfree(t__48);
+    yk__sdsfree(t__47);
+    yk__sdsfree(yy__building_name);
+    yk__sdsfree(yy__building_dir_path);
     yk__sdsfree(yy__building_code);
-    return t__11;
+    return t__51;
 }
 bool yy__building_is_target_macos(yk__sds yy__building_target_to_check) 
 {
     bool yy__building_native = (yk__sdslen(yy__building_target_to_check) == INT32_C(0));
     if (yy__building_native)
     {
-        bool t__12 = yy__os_is_macos();
+        bool t__52 = yy__os_is_macos();
         yk__sdsfree(yy__building_target_to_check);
-        return t__12;
+        return t__52;
     }
-    bool t__13 = yy__strings_contains(yk__bstr_h(yy__building_target_to_check), yk__bstr_s("macos", 5));
+    bool t__53 = yy__strings_contains(yk__bstr_h(yy__building_target_to_check), yk__bstr_s("macos", 5));
     yk__sdsfree(yy__building_target_to_check);
-    return t__13;
+    return t__53;
 }
 bool yy__building_is_target_windows(yk__sds yy__building_target_to_check) 
 {
     bool yy__building_native = (yk__sdslen(yy__building_target_to_check) == INT32_C(0));
     if (yy__building_native)
     {
-        bool t__14 = yy__os_is_windows();
+        bool t__54 = yy__os_is_windows();
         yk__sdsfree(yy__building_target_to_check);
-        return t__14;
+        return t__54;
     }
-    bool t__15 = yy__strings_contains(yk__bstr_h(yy__building_target_to_check), yk__bstr_s("windows", 7));
+    bool t__55 = yy__strings_contains(yk__bstr_h(yy__building_target_to_check), yk__bstr_s("windows", 7));
     yk__sdsfree(yy__building_target_to_check);
-    return t__15;
+    return t__55;
 }
 void yy__building_produce_obj_function(void* yy__building_arg) 
 {
     struct yy__building_BObject* yy__building_data = ((struct yy__building_BObject*)yy__building_arg);
     yk__sds* yy__building_my_args = yy__array_dup(yy__building_data->yy__building_args);
-    yk__sds t__16 = yy__path_basename(yk__sdsdup(yy__building_data->yy__building_c_file));
-    yk__sds t__17 = yy__path_remove_extension(yk__sdsdup(t__16));
-    yk__sds yy__building_object_file = yk__sdsdup(t__17);
+    yk__sds t__56 = yy__path_basename(yk__sdsdup(yy__building_data->yy__building_c_file));
+    yk__sds t__57 = yy__path_remove_extension(yk__sdsdup(t__56));
+    yk__sds yy__building_object_file = yk__sdsdup(t__57);
     if (yy__building_data->yy__building_print_info)
     {
         yy__console_cyan(yk__bstr_s("runtime::", 9));
         yy__console_yellow(yk__bstr_h(yy__building_object_file));
         yy__console_cyan(yk__bstr_s(" := ", 4));
     }
-    if ((!(yy__building_data->yy__building_always_build)) && yy__path_readable(yk__sdsdup(yy__building_data->yy__building_object_file_path)))
+    yk__sds t__58 = yy__object_cache_key_for(yy__building_data->yy__building_cache, yy__building_data->yy__building_args, yk__sdsdup(yy__building_data->yy__building_c_file));
+    yk__sds yy__building_key = yk__sdsdup(t__58);
+    if ((yk__sdslen(yy__building_key) > INT32_C(0)) && yy__object_cache_fetch(yy__building_data->yy__building_cache, yk__sdsdup(yy__building_key), yk__sdsdup(yy__building_data->yy__building_object_file_path)))
     {
+        yy__building_data->yy__building_cache_hit = true;
         if (yy__building_data->yy__building_print_info)
         {
-            yy__console_green(yk__bstr_s("ok.\n", 4));
+            yy__console_green(yk__bstr_s("cached.\n", 8));
         }
         yy__array_del_str_array(yy__building_my_args);
+        yk__sdsfree(yy__building_key);
+        yk__sdsfree(t__58);
         yk__sdsfree(yy__building_object_file);
-        yk__sdsfree(t__17);
-        yk__sdsfree(t__16);
+        yk__sdsfree(t__57);
+        yk__sdsfree(t__56);
         return;
     }
+    yk__sds t__59 = yk__concat_sds_lit(yy__building_data->yy__building_object_file_path, ".args", 5);
+    yk__sds yy__building_args_path = yk__sdsdup(t__59);
+    yk__sds t__60 = yy__array_join(yy__building_data->yy__building_args, yk__sdsnewlen("\n", 1));
+    yk__sds yy__building_args_text = yk__sdsdup(t__60);
+    if (((yk__sdslen(yy__building_key) == INT32_C(0)) && (!(yy__building_data->yy__building_always_build))) && yy__path_readable(yk__sdsdup(yy__building_data->yy__building_object_file_path)))
+    {
+        yk__sds t__61 = yy__io_readfile(yk__bstr_h(yy__building_args_path));
+        if (yk__sdscmp(t__61 , yy__building_args_text) == 0)
+        {
+            if (yy__building_data->yy__building_print_info)
+            {
+                yy__console_green(yk__bstr_s("ok.\n", 4));
+            }
+            yy__array_del_str_array(yy__building_my_args);
+            yk__sdsfree(t__61);
+            yk__sdsfree(yy__building_args_text);
+            yk__sdsfree(t__60);
+            yk__sdsfree(yy__building_args_path);
+            yk__sdsfree(t__59);
+            yk__sdsfree(yy__building_key);
+            yk__sdsfree(t__58);
+            yk__sdsfree(yy__building_object_file);
+            yk__sdsfree(t__57);
+            yk__sdsfree(t__56);
+            return;
+        }
+        yk__sdsfree(t__61);
+    }
     yk__arrput(yy__building_my_args, yk__sdsnewlen("-c", 2));
     yk__arrput(yy__building_my_args, yk__sdsdup(yy__building_data->yy__building_c_file));
     yk__arrput(yy__building_my_args, yk__sdsnewlen("-o", 2));
     yk__arrput(yy__building_my_args, yk__sdsdup(yy__building_data->yy__building_object_file_path));
     yy__os_ProcessResult yy__building_pr = yy__os_run(yy__building_my_args);
+    if (yy__building_pr->ok && (yk__sdslen(yy__building_key) > INT32_C(0)))
+    {
+        yy__building_data->yy__building_cache_miss = true;
+        yy__object_cache_store(yy__building_data->yy__building_cache, yk__sdsdup(yy__building_key), yk__sdsdup(yy__building_data->yy__building_object_file_path));
+    }
+    else
+    {
+        if (yy__building_pr->ok && (!(yy__building_data->yy__building_always_build)))
+        {
+            yy__io_writefile(yk__bstr_h(yy__building_args_path), yk__bstr_h(yy__building_args_text));
+        }
+    }
     if (yy__building_data->yy__building_print_info)
     {
         if (yy__building_pr->ok)
@@ -1107,23 +1815,29 @@ void yy__building_produce_obj_function(void* yy__building_arg)
             yy__console_red(yk__bstr_s("failed.\n", 8));
             yy__console_cyan(yk__bstr_s("--c compiler output---\n", 23));
             yy__console_red(yk__bstr_s("command := ", 11));
-            yk__sds t__18 = yy__array_join(yy__building_my_args, yk__sdsnewlen(" ", 1));
-            yk__sds t__19 = yk__concat_sds_lit(t__18, "\n", 1);
-            yy__console_cyan(yk__bstr_h(t__19));
+            yk__sds t__62 = yy__array_join(yy__building_my_args, yk__sdsnewlen(" ", 1));
+            yk__sds t__63 = yk__concat_sds_lit(t__62, "\n", 1);
+            yy__console_cyan(yk__bstr_h(t__63));
             yy__console_red(yk__bstr_h(yy__building_pr->output));
             yy__console_cyan(yk__bstr_s("--end c compiler output---\n", 27));
-            yk__sdsfree(t__19);
-            yk__sdsfree(t__18);
+            yk__sdsfree(t__63);
+            yk__sdsfree(t__62);
         }
     }
     yy__os_del_process_result(yy__building_pr);
     yy__array_del_str_array(yy__building_my_args);
+    yk__sdsfree(yy__building_args_text);
+    yk__sdsfree(t__60);
+    yk__sdsfree(yy__building_args_path);
+    yk__sdsfree(t__59);
+    yk__sdsfree(yy__building_key);
+    yk__sdsfree(t__58);
     yk__sdsfree(yy__building_object_file);
-    yk__sdsfree(t__17);
-    yk__sdsfree(t__16);
+    yk__sdsfree(t__57);
+    yk__sdsfree(t__56);
     return;
 }
-yk__sds yy__building_core_object(yk__sds* yy__building_args, yk__sds yy__building_c_file, yk__sds yy__building_build_path, yk__sds yy__building_target, bool yy__building_always_build, struct yy__building_BObject*** yy__building_bobj_array) 
+yk__sds yy__building_core_object(yk__sds yy__building_c_file, yk__sds yy__building_build_path, yk__sds yy__building_target, bool yy__building_always_build, struct yy__object_cache_ObjectCache* yy__building_cache, struct yy__building_TargetBuild* yy__building_owner) 
 {
     yk__sds yy__building_suffix = yk__sdsnewlen("-" , 1);
     bool yy__building_native = (yk__sdslen(yy__building_target) == INT32_C(0));
@@ -1135,69 +1849,165 @@ yk__sds yy__building_core_object(yk__sds* yy__building_args, yk__sds yy__buildin
     {
         yy__building_suffix = yk__append_sds_sds(yy__building_suffix, yy__building_target);
     }
-    yk__sds t__20 = yy__path_basename(yk__sdsdup(yy__building_c_file));
-    yk__sds t__21 = yy__path_remove_extension(yk__sdsdup(t__20));
-    yk__sds yy__building_object_file = yk__sdsdup(t__21);
+    yk__sds t__64 = yy__path_basename(yk__sdsdup(yy__building_c_file));
+    yk__sds t__65 = yy__path_remove_extension(yk__sdsdup(t__64));
+    yk__sds yy__building_object_file = yk__sdsdup(t__65);
     yy__building_object_file = yk__append_sds_sds(yy__building_object_file, yy__building_suffix);
     yy__building_object_file = yk__append_sds_lit(yy__building_object_file, ".o" , 2);
-    yk__sds t__22 = yy__path_join(yk__bstr_h(yy__building_build_path), yk__bstr_h(yy__building_object_file));
-    yk__sds yy__building_object_file_path = yk__sdsdup(t__22);
-    struct yy__building_BObject* yy__building_bobj = calloc(1, sizeof(struct yy__building_BObject));
-    yy__building_bobj->yy__building_args = yy__building_args;
+    yk__sds t__66 = yy__path_join(yk__bstr_h(yy__building_build_path), yk__bstr_h(yy__building_object_file));
+    yk__sds yy__building_object_file_path = yk__sdsdup(t__66);
+    struct yy__building_BObject* yy__building_bobj = yk__obj_alloc(struct yy__building_BObject);
+    yy__building_bobj->yy__building_args = yy__building_owner->yy__building_compile_args;
     yy__building_bobj->yy__building_c_file = yk__sdsdup(yy__building_c_file);
     yy__building_bobj->yy__building_always_build = yy__building_always_build;
     yy__building_bobj->yy__building_object_file_path = yk__sdsdup(yy__building_object_file_path);
     yy__building_bobj->yy__building_print_info = false;
-    yk__arrput((*(yy__building_bobj_array)), yy__building_bobj);
-    yk__sds t__23 = yy__building_object_file_path;
-    yk__sdsfree(t__22);
+    yy__building_bobj->yy__building_cache = yy__building_cache;
+    yy__building_bobj->yy__building_cache_hit = false;
+    yy__building_bobj->yy__building_cache_miss = false;
+    yy__building_bobj->yy__building_owner = yy__building_owner;
+    yk__arrput(yy__building_owner->yy__building_buildables, yy__building_bobj);
+    yy__building_owner->yy__building_remaining += INT32_C(1);
+    yk__sds t__67 = yy__building_object_file_path;
+    yk__sdsfree(t__66);
     yk__sdsfree(yy__building_object_file);
-    yk__sdsfree(t__21);
-    yk__sdsfree(t__20);
+    yk__sdsfree(t__65);
+    yk__sdsfree(t__64);
     yk__sdsfree(yy__building_suffix);
     yk__sdsfree(yy__building_target);
     yk__sdsfree(yy__building_build_path);
     yk__sdsfree(yy__building_c_file);
-    return t__23;
+    return t__67;
 }
-void yy__building_build_objects_sequential(struct yy__building_BObject** yy__building_buildables) 
+void yy__building_object_job(void* yy__building_arg) 
 {
-    int32_t yy__building_object_count = yk__arrlen(yy__building_buildables);
+    struct yy__building_BObject* yy__building_data = ((struct yy__building_BObject*)yy__building_arg);
+    int64_t yy__building_started = yy__timespec_millis();
+    yy__building_produce_obj_function(yy__building_arg);
+    struct yy__building_TargetBuild* yy__building_tb = yy__building_data->yy__building_owner;
+    yy__mutex_lock((&(yy__building_tb->yy__building_state->yy__building_lock)));
+    yy__building_tb->yy__building_compile_ms += (yy__timespec_millis() - yy__building_started);
+    yy__building_tb->yy__building_remaining -= INT32_C(1);
+    yy__condition_broadcast((&(yy__building_tb->yy__building_state->yy__building_objects_done)));
+    yy__mutex_unlock((&(yy__building_tb->yy__building_state->yy__building_lock)));
+    return;
+}
+void yy__building_link_job(void* yy__building_arg) 
+{
+    struct yy__building_TargetBuild* yy__building_tb = ((struct yy__building_TargetBuild*)yy__building_arg);
+    yy__mutex_lock((&(yy__building_tb->yy__building_state->yy__building_lock)));
+    while (true)
+    {
+        if (!(((yy__building_tb->yy__building_remaining > INT32_C(0)))))
+        {
+            break;
+        }
+        yy__condition_wait((&(yy__building_tb->yy__building_state->yy__building_objects_done)), (&(yy__building_tb->yy__building_state->yy__building_lock)));
+    }
+    yy__mutex_unlock((&(yy__building_tb->yy__building_state->yy__building_lock)));
+    int64_t yy__building_started = yy__timespec_millis();
+    yy__os_ProcessResult yy__building_result = yy__os_run(yy__building_tb->yy__building_link_args);
+    yy__building_tb->yy__building_link_ok = yy__building_result->ok;
+    yk__sdsfree(yy__building_tb->yy__building_link_output);
+    yy__building_tb->yy__building_link_output = yk__sdsdup(yy__building_result->output);
+    yy__os_del_process_result(yy__building_result);
+    int64_t yy__building_finished = yy__timespec_millis();
+    yy__building_tb->yy__building_link_ms = (yy__building_finished - yy__building_started);
+    yy__building_tb->yy__building_finished_ms = (yy__building_finished - yy__building_tb->yy__building_state->yy__building_start_ms);
+    return;
+}
+void yy__building_run_jobs_sequential(struct yy__building_TargetBuild** yy__building_builds) 
+{
+    int32_t yy__building_build_count = yk__arrlen(yy__building_builds);
     int32_t yy__building_pos = INT32_C(0);
     while (true)
     {
-        if (!(yy__building_pos < yy__building_object_count))
+        if (!(yy__building_pos < yy__building_build_count))
         {
             break;
         }
-        struct yy__building_BObject* yy__building_buildable = yy__building_buildables[yy__building_pos];
-        yy__building_buildable->yy__building_print_info = true;
-        yy__building_produce_obj_function(yy__building_buildable);
+        struct yy__building_TargetBuild* yy__building_tb = yy__building_builds[yy__building_pos];
+        int32_t yy__building_object_count = yk__arrlen(yy__building_tb->yy__building_buildables);
+        int32_t yy__building_x = INT32_C(0);
+        while (true)
+        {
+            if (!(yy__building_x < yy__building_object_count))
+            {
+                break;
+            }
+            struct yy__building_BObject* yy__building_buildable = yy__building_tb->yy__building_buildables[yy__building_x];
+            yy__building_buildable->yy__building_print_info = true;
+            yy__building_object_job(yy__building_buildable);
+            yy__building_x += INT32_C(1);
+        }
+        yy__building_link_job(yy__building_tb);
         yy__building_pos += INT32_C(1);
     }
     return;
 }
-void yy__building_build_objects(struct yy__building_BObject** yy__building_buildables) 
+void yy__building_run_jobs(struct yy__configuration_Config* yy__building_c, struct yy__building_TargetBuild** yy__building_builds) 
 {
-    int32_t yy__building_object_count = yk__arrlen(yy__building_buildables);
-    yy__cpu_Cpu yy__building_cpu_data = yy__cpu_info();
-    uint8_t yy__building_threads = ((uint8_t)yy__building_cpu_data.n_processors);
-    yy__building_threads = ((yy__building_threads > yy__pool_MAX_THREAD_SIZE) ? yy__pool_MAX_THREAD_SIZE : yy__building_threads);
-    struct yy__pool_ThreadPool* yy__building_tpool = yy__pool_create(yy__building_threads, ((uint32_t)(yy__building_object_count + INT32_C(2))));
-    if (yy__building_tpool == NULL)
+    if (yy__building_c->yy__configuration_compilation->yy__configuration_disable_parallel_build)
     {
-        yy__building_build_objects_sequential(yy__building_buildables);
+        yy__building_run_jobs_sequential(yy__building_builds);
         return;
     }
+    int32_t yy__building_build_count = yk__arrlen(yy__building_builds);
+    int32_t yy__building_job_count = yy__building_build_count;
     int32_t yy__building_pos = INT32_C(0);
     while (true)
     {
-        if (!(yy__building_pos < yy__building_object_count))
+        if (!(yy__building_pos < yy__building_build_count))
         {
             break;
         }
-        struct yy__building_BObject* yy__building_buildable = yy__building_buildables[yy__building_pos];
-        yy__pool_add(yy__building_tpool, yy__building_produce_obj_function, yy__building_buildable);
+        struct yy__building_TargetBuild* yy__building_tb = yy__building_builds[yy__building_pos];
+        yy__building_job_count += yk__arrlen(yy__building_tb->yy__building_buildables);
+        yy__building_pos += INT32_C(1);
+    }
+    struct yy__pool_ThreadPool* yy__building_tpool = yy__pool_create(yy__configuration_job_count(yy__building_c), ((uint32_t)(yy__building_job_count + INT32_C(2))));
+    if (yy__building_tpool == NULL)
+    {
+        yy__building_run_jobs_sequential(yy__building_builds);
+        return;
+    }
+    yy__building_pos = INT32_C(0);
+    while (true)
+    {
+        if (!(yy__building_pos < yy__building_build_count))
+        {
+            break;
+        }
+        struct yy__building_TargetBuild* yy__building_tb = yy__building_builds[yy__building_pos];
+        int32_t yy__building_object_count = yk__arrlen(yy__building_tb->yy__building_buildables);
+        int32_t yy__building_x = INT32_C(0);
+        while (true)
+        {
+            if (!(yy__building_x < yy__building_object_count))
+            {
+                break;
+            }
+            struct yy__building_BObject* yy__building_buildable = yy__building_tb->yy__building_buildables[yy__building_x];
+            if (yy__pool_add(yy__building_tpool, yy__building_object_job, yy__building_buildable) != yy__pool_SUCCESS)
+            {
+                yy__building_object_job(yy__building_buildable);
+            }
+            yy__building_x += INT32_C(1);
+        }
+        yy__building_pos += INT32_C(1);
+    }
+    yy__building_pos = INT32_C(0);
+    while (true)
+    {
+        if (!(yy__building_pos < yy__building_build_count))
+        {
+            break;
+        }
+        struct yy__building_TargetBuild* yy__building_tb = yy__building_builds[yy__building_pos];
+        if (yy__pool_add(yy__building_tpool, yy__building_link_job, yy__building_tb) != yy__pool_SUCCESS)
+        {
+            yy__building_link_job(yy__building_tb);
+        }
         yy__building_pos += INT32_C(1);
     }
     yy__pool_destroy(yy__building_tpool, true);
@@ -1214,9 +2024,17 @@ void yy__building_cleanup_buildables(struct yy__building_BObject** yy__building_
             break;
         }
         struct yy__building_BObject* yy__building_buildable = yy__building_buildables[yy__building_pos];
+        if (yy__building_buildable->yy__building_cache_hit)
+        {
+            yy__building_buildable->yy__building_cache->yy__object_cache_hits += INT32_C(1);
+        }
+        if (yy__building_buildable->yy__building_cache_miss)
+        {
+            yy__building_buildable->yy__building_cache->yy__object_cache_misses += INT32_C(1);
+        }
         yk__sdsfree(yy__building_buildable->yy__building_c_file);
         yk__sdsfree(yy__building_buildable->yy__building_object_file_path);
-        free(yy__building_buildable);
+        yk__obj_free(yy__building_buildable);
         yy__building_pos += INT32_C(1);
     }
     yk__arrfree(yy__building_buildables);
@@ -1227,84 +2045,152 @@ bool yy__building_keep_ray_objects(yk__sds yy__building_element, bool yy__buildi
     bool yy__building_obj = yy__strings_endswith(yk__bstr_h(yy__building_element), yk__bstr_s(".o", 2));
     if (yy__building_negate)
     {
-        bool t__24 = !yy__building_obj;
+        bool t__68 = !yy__building_obj;
         yk__sdsfree(yy__building_element);
-        return t__24;
+        return t__68;
     }
-    bool t__25 = yy__building_obj;
+    bool t__69 = yy__building_obj;
     yk__sdsfree(yy__building_element);
-    return t__25;
+    return t__69;
 }
 yk__sds yy__building_get_alt_compiler(struct yy__configuration_Config* yy__building_c) 
 {
+    yk__sds yy__building_compiler = yk__sdsdup(yy__building_c->yy__configuration_clang_compiler_path);
     if (yy__building_c->yy__configuration_alt_compiler == yy__configuration_GCC)
     {
-        yk__sds t__26 = yy__building_c->yy__configuration_gcc_compiler_path;
-        return t__26;
+        yk__sdsfree(yy__building_compiler);
+        yy__building_compiler = yk__sdsdup(yy__building_c->yy__configuration_gcc_compiler_path);
     }
-    yk__sds t__27 = yy__building_c->yy__configuration_clang_compiler_path;
-    return t__27;
+    yk__sds t__70 = yy__building_compiler;
+    return t__70;
+}
+yk__sds* yy__building_optimization_args(struct yy__configuration_Config* yy__building_c, yk__sds yy__building_target, yk__sds yy__building_build_path) 
+{
+    if (yk__cmp_sds_bstr(yy__building_c->yy__configuration_compilation->yy__configuration_profile, yy__configuration_PROFILE_SIZE) == 0)
+    {
+        yk__sds* t__71 = NULL;
+        yk__arrsetcap(t__71, 1);
+        yk__arrput(t__71, yk__sdsnewlen("-Oz", 3));
+        yk__sds* t__72 = t__71;
+        yk__sdsfree(yy__building_build_path);
+        yk__sdsfree(yy__building_target);
+        return t__72;
+    }
+    yk__sds* t__73 = NULL;
+    yk__arrsetcap(t__73, 1);
+    yk__arrput(t__73, yk__sdsnewlen("-O3", 3));
+    yk__sds* yy__building_args = t__73;
+    if (yk__sdslen(yy__building_target) != INT32_C(0))
+    {
+        yk__sds* t__74 = yy__building_args;
+        yk__sdsfree(yy__building_build_path);
+        yk__sdsfree(yy__building_target);
+        return t__74;
+    }
+    if (yk__cmp_sds_bstr(yy__building_c->yy__configuration_compilation->yy__configuration_profile, yy__configuration_PROFILE_NATIVE) == 0)
+    {
+        yk__arrput(yy__building_args, yk__sdsnewlen("-march=native", 13));
+    }
+    else
+    {
+        if (yk__cmp_sds_bstr(yy__building_c->yy__configuration_compilation->yy__configuration_profile, yy__configuration_PROFILE_PGO) == 0)
+        {
+            yk__sds t__75 = yy__path_join(yk__bstr_h(yy__building_build_path), yk__bstr_s("pgo", 3));
+            yk__sds yy__building_pgo_path = yk__sdsdup(t__75);
+            if (yy__building_c->yy__configuration_pgo_stage == yy__configuration_PGO_GENERATE)
+            {
+                yk__sds t__76 = yk__concat_lit_sds("-fprofile-generate=", 19, yy__building_pgo_path);
+                yk__arrput(yy__building_args, yk__sdsdup(t__76));
+                yk__sdsfree(t__76);
+            }
+            else
+            {
+                if (yy__building_c->yy__configuration_pgo_stage == yy__configuration_PGO_USE)
+                {
+                    if (yy__building_c->yy__configuration_use_alt_compiler && (yy__building_c->yy__configuration_alt_compiler == yy__configuration_GCC))
+                    {
+                        yk__sds t__77 = yk__concat_lit_sds("-fprofile-use=", 14, yy__building_pgo_path);
+                        yk__arrput(yy__building_args, yk__sdsdup(t__77));
+                        yk__sdsfree(t__77);
+                    }
+                    else
+                    {
+                        yk__sds t__78 = yy__path_join(yk__bstr_h(yy__building_pgo_path), yk__bstr_s("default.profdata", 16));
+                        yk__sds t__79 = yk__concat_lit_sds("-fprofile-use=", 14, t__78);
+                        yk__arrput(yy__building_args, yk__sdsdup(t__79));
+                        yk__sdsfree(t__79);
+                        yk__sdsfree(t__78);
+                    }
+                }
+            }
+            yk__sdsfree(yy__building_pgo_path);
+            yk__sdsfree(t__75);
+        }
+    }
+    yk__sds* t__80 = yy__building_args;
+    yk__sdsfree(yy__building_build_path);
+    yk__sdsfree(yy__building_target);
+    return t__80;
 }
-yk__sds* yy__building_create_args(struct yy__configuration_Config* yy__building_c, yk__sds yy__building_code_path, yk__sds yy__building_build_path, yk__sds yy__building_target, yk__sds* yy__building_raylib_args) 
+yk__sds* yy__building_create_args(struct yy__configuration_Config* yy__building_c, yk__sds* yy__building_code_paths, yk__sds yy__building_build_path, yk__sds yy__building_target, yk__sds* yy__building_raylib_args, struct yy__object_cache_ObjectCache* yy__building_cache, struct yy__building_TargetBuild* yy__building_tb) 
 {
     bool yy__building_native = (yk__sdslen(yy__building_target) == INT32_C(0));
     yk__sds* yy__building_args = NULL;
     yk__sds* yy__building_objects = NULL;
-    struct yy__building_BObject** yy__building_buildable_objects = NULL;
-    yk__sds* t__30 = yy__building_raylib_args;
-    bool t__32 = false;
-    size_t t__29 = yk__arrlenu(t__30);
-    yk__sds* t__33 = NULL;
-    for (size_t t__28 = 0; t__28 < t__29; t__28++) { 
-        yk__sds t__31 = yk__sdsdup(t__30[t__28]);
-        bool t__34 = yy__building_keep_ray_objects(t__31, t__32);
-        t__31 = yk__sdsdup(t__30[t__28]); if (t__34) {yk__arrput(t__33, t__31); } else { yk__sdsfree(t__31); }
-    }
-    yk__sds* yy__building_ray_objects = t__33;
-    yk__sds* t__37 = yy__building_raylib_args;
-    bool t__39 = true;
-    size_t t__36 = yk__arrlenu(t__37);
-    yk__sds* t__40 = NULL;
-    for (size_t t__35 = 0; t__35 < t__36; t__35++) { 
-        yk__sds t__38 = yk__sdsdup(t__37[t__35]);
-        bool t__41 = yy__building_keep_ray_objects(t__38, t__39);
-        t__38 = yk__sdsdup(t__37[t__35]); if (t__41) {yk__arrput(t__40, t__38); } else { yk__sdsfree(t__38); }
-    }
-    yk__sds* yy__building_ray_other_args = t__40;
+    yk__sds* t__83 = yy__building_raylib_args;
+    bool t__85 = false;
+    size_t t__82 = yk__arrlenu(t__83);
+    yk__sds* t__86 = NULL;
+    for (size_t t__81 = 0; t__81 < t__82; t__81++) { 
+        yk__sds t__84 = yk__sdsdup(t__83[t__81]);
+        bool t__87 = yy__building_keep_ray_objects(t__84, t__85);
+        t__84 = yk__sdsdup(t__83[t__81]); if (t__87) {yk__arrput(t__86, t__84); } else { yk__sdsfree(t__84); }
+    }
+    yk__sds* yy__building_ray_objects = t__86;
+    yk__sds* t__90 = yy__building_raylib_args;
+    bool t__92 = true;
+    size_t t__89 = yk__arrlenu(t__90);
+    yk__sds* t__93 = NULL;
+    for (size_t t__88 = 0; t__88 < t__89; t__88++) { 
+        yk__sds t__91 = yk__sdsdup(t__90[t__88]);
+        bool t__94 = yy__building_keep_ray_objects(t__91, t__92);
+        t__91 = yk__sdsdup(t__90[t__88]); if (t__94) {yk__arrput(t__93, t__91); } else { yk__sdsfree(t__91); }
+    }
+    yk__sds* yy__building_ray_other_args = t__93;
     yk__sds yy__building_alt_compiler = yk__sdsnewlen("" , 0);
     if (yy__building_c->yy__configuration_use_alt_compiler)
     {
-        yk__sds t__42 = yy__building_get_alt_compiler(yy__building_c);
+        yk__sds t__95 = yy__building_get_alt_compiler(yy__building_c);
         yk__sdsfree(yy__building_alt_compiler);
-        yy__building_alt_compiler = yk__sdsdup(t__42);
-        yk__sdsfree(t__42);
+        yy__building_alt_compiler = yk__sdsdup(t__95);
+        yk__sdsfree(t__95);
     }
     if (yy__building_c->yy__configuration_compilation->yy__configuration_wasm4)
     {
-        yk__sds* t__43 = NULL;
-        yk__arrsetcap(t__43, 8);
-        yk__arrput(t__43, yk__sdsdup(yy__building_c->yy__configuration_zig_compiler_path));
-        yk__arrput(t__43, yk__sdsnewlen("cc", 2));
-        yk__arrput(t__43, yk__sdsnewlen("-std=c99", 8));
-        yk__arrput(t__43, yk__sdsnewlen("-Wno-newline-eof", 16));
-        yk__arrput(t__43, yk__sdsnewlen("-Wno-parentheses-equality", 25));
-        yk__arrput(t__43, yk__sdsnewlen("-MMD", 4));
-        yk__arrput(t__43, yk__sdsnewlen("-MP", 3));
-        yk__arrput(t__43, yk__sdsnewlen("-Oz", 3));
-        yy__building_args = t__43;
+        yk__sds* t__96 = NULL;
+        yk__arrsetcap(t__96, 8);
+        yk__arrput(t__96, yk__sdsdup(yy__building_c->yy__configuration_zig_compiler_path));
+        yk__arrput(t__96, yk__sdsnewlen("cc", 2));
+        yk__arrput(t__96, yk__sdsnewlen("-std=c99", 8));
+        yk__arrput(t__96, yk__sdsnewlen("-Wno-newline-eof", 16));
+        yk__arrput(t__96, yk__sdsnewlen("-Wno-parentheses-equality", 25));
+        yk__arrput(t__96, yk__sdsnewlen("-MMD", 4));
+        yk__arrput(t__96, yk__sdsnewlen("-MP", 3));
+        yk__arrput(t__96, yk__sdsnewlen("-Oz", 3));
+        yy__building_args = t__96;
     }
     else
     {
         if (yy__building_c->yy__configuration_compilation->yy__configuration_web)
         {
-            yk__sds* t__44 = NULL;
-            yk__arrsetcap(t__44, 5);
-            yk__arrput(t__44, yk__sdsdup(yy__building_c->yy__configuration_emcc_compiler_path));
-            yk__arrput(t__44, yk__sdsnewlen("-std=c99", 8));
-            yk__arrput(t__44, yk__sdsnewlen("-Oz", 3));
-            yk__arrput(t__44, yk__sdsnewlen("-Wno-newline-eof", 16));
-            yk__arrput(t__44, yk__sdsnewlen("-Wno-parentheses-equality", 25));
-            yy__building_args = t__44;
+            yk__sds* t__97 = NULL;
+            yk__arrsetcap(t__97, 5);
+            yk__arrput(t__97, yk__sdsdup(yy__building_c->yy__configuration_emcc_compiler_path));
+            yk__arrput(t__97, yk__sdsnewlen("-std=c99", 8));
+            yk__arrput(t__97, yk__sdsnewlen("-Oz", 3));
+            yk__arrput(t__97, yk__sdsnewlen("-Wno-newline-eof", 16));
+            yk__arrput(t__97, yk__sdsnewlen("-Wno-parentheses-equality", 25));
+            yy__building_args = t__97;
         }
         else
         {
@@ -1312,32 +2198,32 @@ yk__sds* yy__building_create_args(struct yy__configuration_Config* yy__building_
             {
                 if (yy__building_c->yy__configuration_use_alt_compiler)
                 {
-                    yk__sds* t__45 = NULL;
-                    yk__arrsetcap(t__45, 8);
-                    yk__arrput(t__45, yk__sdsdup(yy__building_alt_compiler));
-                    yk__arrput(t__45, yk__sdsnewlen("-std=c99", 8));
-                    yk__arrput(t__45, yk__sdsnewlen("-O1", 3));
-                    yk__arrput(t__45, yk__sdsnewlen("-pedantic", 9));
-                    yk__arrput(t__45, yk__sdsnewlen("-Wall", 5));
-                    yk__arrput(t__45, yk__sdsnewlen("-Wno-newline-eof", 16));
-                    yk__arrput(t__45, yk__sdsnewlen("-fPIC", 5));
-                    yk__arrput(t__45, yk__sdsnewlen("-Wno-parentheses-equality", 25));
-                    yy__building_args = t__45;
+                    yk__sds* t__98 = NULL;
+                    yk__arrsetcap(t__98, 8);
+                    yk__arrput(t__98, yk__sdsdup(yy__building_alt_compiler));
+                    yk__arrput(t__98, yk__sdsnewlen("-std=c99", 8));
+                    yk__arrput(t__98, yk__sdsnewlen("-O1", 3));
+                    yk__arrput(t__98, yk__sdsnewlen("-pedantic", 9));
+                    yk__arrput(t__98, yk__sdsnewlen("-Wall", 5));
+                    yk__arrput(t__98, yk__sdsnewlen("-Wno-newline-eof", 16));
+                    yk__arrput(t__98, yk__sdsnewlen("-fPIC", 5));
+                    yk__arrput(t__98, yk__sdsnewlen("-Wno-parentheses-equality", 25));
+                    yy__building_args = t__98;
                 }
                 else
                 {
-                    yk__sds* t__46 = NULL;
-                    yk__arrsetcap(t__46, 9);
-                    yk__arrput(t__46, yk__sdsdup(yy__building_c->yy__configuration_zig_compiler_path));
-                    yk__arrput(t__46, yk__sdsnewlen("cc", 2));
-                    yk__arrput(t__46, yk__sdsnewlen("-std=c99", 8));
-                    yk__arrput(t__46, yk__sdsnewlen("-O1", 3));
-                    yk__arrput(t__46, yk__sdsnewlen("-pedantic", 9));
-                    yk__arrput(t__46, yk__sdsnewlen("-Wall", 5));
-                    yk__arrput(t__46, yk__sdsnewlen("-Wno-newline-eof", 16));
-                    yk__arrput(t__46, yk__sdsnewlen("-fPIC", 5));
-                    yk__arrput(t__46, yk__sdsnewlen("-Wno-parentheses-equality", 25));
-                    yy__building_args = t__46;
+                    yk__sds* t__99 = NULL;
+                    yk__arrsetcap(t__99, 9);
+                    yk__arrput(t__99, yk__sdsdup(yy__building_c->yy__configuration_zig_compiler_path));
+                    yk__arrput(t__99, yk__sdsnewlen("cc", 2));
+                    yk__arrput(t__99, yk__sdsnewlen("-std=c99", 8));
+                    yk__arrput(t__99, yk__sdsnewlen("-O1", 3));
+                    yk__arrput(t__99, yk__sdsnewlen("-pedantic", 9));
+                    yk__arrput(t__99, yk__sdsnewlen("-Wall", 5));
+                    yk__arrput(t__99, yk__sdsnewlen("-Wno-newline-eof", 16));
+                    yk__arrput(t__99, yk__sdsnewlen("-fPIC", 5));
+                    yk__arrput(t__99, yk__sdsnewlen("-Wno-parentheses-equality", 25));
+                    yy__building_args = t__99;
                 }
             }
             else
@@ -1346,57 +2232,53 @@ yk__sds* yy__building_create_args(struct yy__configuration_Config* yy__building_
                 {
                     if (yy__building_c->yy__configuration_use_alt_compiler)
                     {
-                        yk__sds* t__47 = NULL;
-                        yk__arrsetcap(t__47, 4);
-                        yk__arrput(t__47, yk__sdsdup(yy__building_alt_compiler));
-                        yk__arrput(t__47, yk__sdsnewlen("-std=c99", 8));
-                        yk__arrput(t__47, yk__sdsnewlen("-O0", 3));
-                        yk__arrput(t__47, yk__sdsnewlen("-fPIC", 5));
-                        yy__building_args = t__47;
+                        yk__sds* t__100 = NULL;
+                        yk__arrsetcap(t__100, 4);
+                        yk__arrput(t__100, yk__sdsdup(yy__building_alt_compiler));
+                        yk__arrput(t__100, yk__sdsnewlen("-std=c99", 8));
+                        yk__arrput(t__100, yk__sdsnewlen("-O0", 3));
+                        yk__arrput(t__100, yk__sdsnewlen("-fPIC", 5));
+                        yy__building_args = t__100;
                     }
                     else
                     {
-                        yk__sds* t__48 = NULL;
-                        yk__arrsetcap(t__48, 5);
-                        yk__arrput(t__48, yk__sdsdup(yy__building_c->yy__configuration_zig_compiler_path));
-                        yk__arrput(t__48, yk__sdsnewlen("cc", 2));
-                        yk__arrput(t__48, yk__sdsnewlen("-std=c99", 8));
-                        yk__arrput(t__48, yk__sdsnewlen("-O0", 3));
-                        yk__arrput(t__48, yk__sdsnewlen("-fPIC", 5));
-                        yy__building_args = t__48;
+                        yk__sds* t__101 = NULL;
+                        yk__arrsetcap(t__101, 5);
+                        yk__arrput(t__101, yk__sdsdup(yy__building_c->yy__configuration_zig_compiler_path));
+                        yk__arrput(t__101, yk__sdsnewlen("cc", 2));
+                        yk__arrput(t__101, yk__sdsnewlen("-std=c99", 8));
+                        yk__arrput(t__101, yk__sdsnewlen("-O0", 3));
+                        yk__arrput(t__101, yk__sdsnewlen("-fPIC", 5));
+                        yy__building_args = t__101;
                     }
                 }
                 else
                 {
                     if (yy__building_c->yy__configuration_use_alt_compiler)
                     {
-                        yk__sds* t__49 = NULL;
-                        yk__arrsetcap(t__49, 8);
-                        yk__arrput(t__49, yk__sdsdup(yy__building_alt_compiler));
-                        yk__arrput(t__49, yk__sdsnewlen("-std=c99", 8));
-                        yk__arrput(t__49, yk__sdsnewlen("-Oz", 3));
-                        yk__arrput(t__49, yk__sdsnewlen("-pedantic", 9));
-                        yk__arrput(t__49, yk__sdsnewlen("-Wall", 5));
-                        yk__arrput(t__49, yk__sdsnewlen("-Wno-newline-eof", 16));
-                        yk__arrput(t__49, yk__sdsnewlen("-fPIC", 5));
-                        yk__arrput(t__49, yk__sdsnewlen("-Wno-parentheses-equality", 25));
-                        yy__building_args = t__49;
+                        yk__sds* t__102 = NULL;
+                        yk__arrsetcap(t__102, 2);
+                        yk__arrput(t__102, yk__sdsdup(yy__building_alt_compiler));
+                        yk__arrput(t__102, yk__sdsnewlen("-std=c99", 8));
+                        yy__building_args = t__102;
                     }
                     else
                     {
-                        yk__sds* t__50 = NULL;
-                        yk__arrsetcap(t__50, 9);
-                        yk__arrput(t__50, yk__sdsdup(yy__building_c->yy__configuration_zig_compiler_path));
-                        yk__arrput(t__50, yk__sdsnewlen("cc", 2));
-                        yk__arrput(t__50, yk__sdsnewlen("-std=c99", 8));
-                        yk__arrput(t__50, yk__sdsnewlen("-Oz", 3));
-                        yk__arrput(t__50, yk__sdsnewlen("-pedantic", 9));
-                        yk__arrput(t__50, yk__sdsnewlen("-Wall", 5));
-                        yk__arrput(t__50, yk__sdsnewlen("-Wno-newline-eof", 16));
-                        yk__arrput(t__50, yk__sdsnewlen("-fPIC", 5));
-                        yk__arrput(t__50, yk__sdsnewlen("-Wno-parentheses-equality", 25));
-                        yy__building_args = t__50;
+                        yk__sds* t__103 = NULL;
+                        yk__arrsetcap(t__103, 3);
+                        yk__arrput(t__103, yk__sdsdup(yy__building_c->yy__configuration_zig_compiler_path));
+                        yk__arrput(t__103, yk__sdsnewlen("cc", 2));
+                        yk__arrput(t__103, yk__sdsnewlen("-std=c99", 8));
+                        yy__building_args = t__103;
                     }
+                    yk__sds* yy__building_opt_args = yy__building_optimization_args(yy__building_c, yk__sdsdup(yy__building_target), yk__sdsdup(yy__building_build_path));
+                    yy__building_args = yy__array_extend(yy__building_args, yy__building_opt_args);
+                    yy__array_del_str_array(yy__building_opt_args);
+                    yk__arrput(yy__building_args, yk__sdsnewlen("-pedantic", 9));
+                    yk__arrput(yy__building_args, yk__sdsnewlen("-Wall", 5));
+                    yk__arrput(yy__building_args, yk__sdsnewlen("-Wno-newline-eof", 16));
+                    yk__arrput(yy__building_args, yk__sdsnewlen("-fPIC", 5));
+                    yk__arrput(yy__building_args, yk__sdsnewlen("-Wno-parentheses-equality", 25));
                 }
             }
         }
@@ -1420,12 +2302,12 @@ yk__sds* yy__building_create_args(struct yy__configuration_Config* yy__building_
         {
             break;
         }
-        yk__sds t__51 = yk__concat_lit_sds("-I", 2, yy__building_c->yy__configuration_c_code->yy__configuration_include_paths[yy__building_x]);
-        yk__sds yy__building_include = yk__sdsdup(t__51);
+        yk__sds t__104 = yk__concat_lit_sds("-I", 2, yy__building_c->yy__configuration_c_code->yy__configuration_include_paths[yy__building_x]);
+        yk__sds yy__building_include = yk__sdsdup(t__104);
         yk__arrput(yy__building_args, yk__sdsdup(yy__building_include));
         yy__building_x = (yy__building_x + INT32_C(1));
         yk__sdsfree(yy__building_include);
-        yk__sdsfree(t__51);
+        yk__sdsfree(t__104);
     }
     yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_compiler_defines);
     yy__building_x = INT32_C(0);
@@ -1435,12 +2317,12 @@ yk__sds* yy__building_create_args(struct yy__configuration_Config* yy__building_
         {
             break;
         }
-        yk__sds t__52 = yk__concat_lit_sds("-D", 2, yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_compiler_defines[yy__building_x]);
-        yk__sds yy__building_cdefine = yk__sdsdup(t__52);
+        yk__sds t__105 = yk__concat_lit_sds("-D", 2, yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_compiler_defines[yy__building_x]);
+        yk__sds yy__building_cdefine = yk__sdsdup(t__105);
         yk__arrput(yy__building_args, yk__sdsdup(yy__building_cdefine));
         yy__building_x = (yy__building_x + INT32_C(1));
         yk__sdsfree(yy__building_cdefine);
-        yk__sdsfree(t__52);
+        yk__sdsfree(t__105);
     }
     yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_compiler_defines);
     yy__building_x = INT32_C(0);
@@ -1450,12 +2332,12 @@ yk__sds* yy__building_create_args(struct yy__configuration_Config* yy__building_
         {
             break;
         }
-        yk__sds t__53 = yk__concat_lit_sds("-D", 2, yy__building_c->yy__configuration_c_code->yy__configuration_compiler_defines[yy__building_x]);
-        yk__sds yy__building_cdefine = yk__sdsdup(t__53);
+        yk__sds t__106 = yk__concat_lit_sds("-D", 2, yy__building_c->yy__configuration_c_code->yy__configuration_compiler_defines[yy__building_x]);
+        yk__sds yy__building_cdefine = yk__sdsdup(t__106);
         yk__arrput(yy__building_args, yk__sdsdup(yy__building_cdefine));
         yy__building_x = (yy__building_x + INT32_C(1));
         yk__sdsfree(yy__building_cdefine);
-        yk__sdsfree(t__53);
+        yk__sdsfree(t__106);
     }
     if ((!yy__building_native && (yk__cmp_sds_lit(yy__building_target, "web", 3) != 0)) && (yk__cmp_sds_lit(yy__building_target, "wasm4", 5) != 0))
     {
@@ -1467,6 +2349,8 @@ yk__sds* yy__building_create_args(struct yy__configuration_Config* yy__building_
         yk__arrput(yy__building_args, yk__sdsnewlen("-target", 7));
         yk__arrput(yy__building_args, yk__sdsnewlen("wasm32-wasi-musl", 16));
     }
+    yy__object_cache_detect_compiler(yy__building_cache, yy__building_args);
+    yy__building_tb->yy__building_compile_args = yy__array_dup(yy__building_args);
     yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code);
     yy__building_x = INT32_C(0);
     while (true)
@@ -1476,12 +2360,12 @@ yk__sds* yy__building_create_args(struct yy__configuration_Config* yy__building_
             break;
         }
         yk__sds yy__building_rfc = yk__sdsdup(yy__building_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code[yy__building_x]);
-        yk__sds t__54 = yy__building_core_object(yy__building_args, yk__sdsdup(yy__building_rfc), yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), false, (&(yy__building_buildable_objects)));
+        yk__sds t__107 = yy__building_core_object(yk__sdsdup(yy__building_rfc), yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), (yy__building_c->yy__configuration_pgo_stage != yy__configuration_PGO_NONE), yy__building_cache, yy__building_tb);
         yk__sdsfree(yy__building_rfc);
-        yy__building_rfc = yk__sdsdup(t__54);
+        yy__building_rfc = yk__sdsdup(t__107);
         yk__arrput(yy__building_objects, yk__sdsdup(yy__building_rfc));
         yy__building_x = (yy__building_x + INT32_C(1));
-        yk__sdsfree(t__54);
+        yk__sdsfree(t__107);
         yk__sdsfree(yy__building_rfc);
     }
     yy__building_length = yk__arrlen(yy__building_c->yy__configuration_c_code->yy__configuration_c_code);
@@ -1493,57 +2377,60 @@ yk__sds* yy__building_create_args(struct yy__configuration_Config* yy__building_
             break;
         }
         yk__sds yy__building_cc = yk__sdsdup(yy__building_c->yy__configuration_c_code->yy__configuration_c_code[yy__building_x]);
-        yk__sds t__55 = yy__building_core_object(yy__building_args, yk__sdsdup(yy__building_cc), yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), true, (&(yy__building_buildable_objects)));
+        yk__sds t__108 = yy__building_core_object(yk__sdsdup(yy__building_cc), yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), true, yy__building_cache, yy__building_tb);
         yk__sdsfree(yy__building_cc);
-        yy__building_cc = yk__sdsdup(t__55);
+        yy__building_cc = yk__sdsdup(t__108);
         yk__arrput(yy__building_objects, yk__sdsdup(yy__building_cc));
         yy__building_x = (yy__building_x + INT32_C(1));
-        yk__sdsfree(t__55);
+        yk__sdsfree(t__108);
         yk__sdsfree(yy__building_cc);
     }
-    yk__sds t__56 = yy__building_core_object(yy__building_args, yk__sdsdup(yy__building_code_path), yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), true, (&(yy__building_buildable_objects)));
-    yk__sds yy__building_program_object = yk__sdsdup(t__56);
-    yk__arrput(yy__building_objects, yk__sdsdup(yy__building_program_object));
-    yk__sds t__57 = yy__path_join(yk__bstr_h(yy__building_c->yy__configuration_runtime_path), yk__bstr_s("yk__main.c", 10));
-    yk__sds yy__building_the_yk_main = yk__sdsdup(t__57);
-    yk__sds t__58 = yy__building_core_object(yy__building_args, yk__sdsdup(yy__building_the_yk_main), yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), false, (&(yy__building_buildable_objects)));
-    yk__sdsfree(yy__building_the_yk_main);
-    yy__building_the_yk_main = yk__sdsdup(t__58);
-    yk__arrput(yy__building_objects, yk__sdsdup(yy__building_the_yk_main));
-    if (yy__building_c->yy__configuration_compilation->yy__configuration_disable_parallel_build)
-    {
-        yy__building_build_objects_sequential(yy__building_buildable_objects);
-    }
-    else
+    yy__building_length = yk__arrlen(yy__building_code_paths);
+    yy__building_x = INT32_C(0);
+    while (true)
     {
-        yy__building_build_objects(yy__building_buildable_objects);
+        if (!(yy__building_x < yy__building_length))
+        {
+            break;
+        }
+        yk__sds t__109 = yy__building_core_object(yk__sdsdup(yy__building_code_paths[yy__building_x]), yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), true, yy__building_cache, yy__building_tb);
+        yk__sds yy__building_program_object = yk__sdsdup(t__109);
+        yk__arrput(yy__building_objects, yk__sdsdup(yy__building_program_object));
+        yy__building_x = (yy__building_x + INT32_C(1));
+        yk__sdsfree(yy__building_program_object);
+        yk__sdsfree(t__109);
     }
-    yy__building_cleanup_buildables(yy__building_buildable_objects);
+    yk__sds t__110 = yy__path_join(yk__bstr_h(yy__building_c->yy__configuration_runtime_path), yk__bstr_s("yk__main.c", 10));
+    yk__sds yy__building_the_yk_main = yk__sdsdup(t__110);
+    yk__sds t__111 = yy__building_core_object(yk__sdsdup(yy__building_the_yk_main), yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), (yy__building_c->yy__configuration_pgo_stage != yy__configuration_PGO_NONE), yy__building_cache, yy__building_tb);
+    yk__sdsfree(yy__building_the_yk_main);
+    yy__building_the_yk_main = yk__sdsdup(t__111);
+    yk__arrput(yy__building_objects, yk__sdsdup(yy__building_the_yk_main));
     if (yy__building_c->yy__configuration_compilation->yy__configuration_wasm4)
     {
         yy__array_del_str_array(yy__building_args);
-        yk__sds* t__59 = NULL;
-        yk__arrsetcap(t__59, 19);
-        yk__arrput(t__59, yk__sdsdup(yy__building_c->yy__configuration_zig_compiler_path));
-        yk__arrput(t__59, yk__sdsnewlen("build-lib", 9));
-        yk__arrput(t__59, yk__sdsnewlen("-dynamic", 8));
-        yk__arrput(t__59, yk__sdsnewlen("-flto", 5));
-        yk__arrput(t__59, yk__sdsnewlen("-mexec-model=reactor", 20));
-        yk__arrput(t__59, yk__sdsnewlen("-O", 2));
-        yk__arrput(t__59, yk__sdsnewlen("ReleaseSmall", 12));
-        yk__arrput(t__59, yk__sdsnewlen("-target", 7));
-        yk__arrput(t__59, yk__sdsnewlen("wasm32-wasi-musl", 16));
-        yk__arrput(t__59, yk__sdsnewlen("--strip", 7));
-        yk__arrput(t__59, yk__sdsnewlen("--stack", 7));
-        yk__arrput(t__59, yk__sdsnewlen("50784", 5));
-        yk__arrput(t__59, yk__sdsnewlen("--global-base=6560", 18));
-        yk__arrput(t__59, yk__sdsnewlen("--import-memory", 15));
-        yk__arrput(t__59, yk__sdsnewlen("--initial-memory=65536", 22));
-        yk__arrput(t__59, yk__sdsnewlen("--max-memory=65536", 18));
-        yk__arrput(t__59, yk__sdsnewlen("-ofmt=wasm", 10));
-        yk__arrput(t__59, yk__sdsnewlen("--export=start", 14));
-        yk__arrput(t__59, yk__sdsnewlen("--export=update", 15));
-        yy__building_args = t__59;
+        yk__sds* t__112 = NULL;
+        yk__arrsetcap(t__112, 19);
+        yk__arrput(t__112, yk__sdsdup(yy__building_c->yy__configuration_zig_compiler_path));
+        yk__arrput(t__112, yk__sdsnewlen("build-lib", 9));
+        yk__arrput(t__112, yk__sdsnewlen("-dynamic", 8));
+        yk__arrput(t__112, yk__sdsnewlen("-flto", 5));
+        yk__arrput(t__112, yk__sdsnewlen("-mexec-model=reactor", 20));
+        yk__arrput(t__112, yk__sdsnewlen("-O", 2));
+        yk__arrput(t__112, yk__sdsnewlen("ReleaseSmall", 12));
+        yk__arrput(t__112, yk__sdsnewlen("-target", 7));
+        yk__arrput(t__112, yk__sdsnewlen("wasm32-wasi-musl", 16));
+        yk__arrput(t__112, yk__sdsnewlen("--strip", 7));
+        yk__arrput(t__112, yk__sdsnewlen("--stack", 7));
+        yk__arrput(t__112, yk__sdsnewlen("50784", 5));
+        yk__arrput(t__112, yk__sdsnewlen("--global-base=6560", 18));
+        yk__arrput(t__112, yk__sdsnewlen("--import-memory", 15));
+        yk__arrput(t__112, yk__sdsnewlen("--initial-memory=65536", 22));
+        yk__arrput(t__112, yk__sdsnewlen("--max-memory=65536", 18));
+        yk__arrput(t__112, yk__sdsnewlen("-ofmt=wasm", 10));
+        yk__arrput(t__112, yk__sdsnewlen("--export=start", 14));
+        yk__arrput(t__112, yk__sdsnewlen("--export=update", 15));
+        yy__building_args = t__112;
     }
     yy__building_args = yy__array_extend(yy__building_args, yy__building_objects);
     yy__building_args = yy__array_extend(yy__building_args, yy__building_ray_objects);
@@ -1569,41 +2456,41 @@ yk__sds* yy__building_create_args(struct yy__configuration_Config* yy__building_
     yk__sds yy__building_binary = yk__sdsdup(yy__building_c->yy__configuration_project->yy__configuration_name);
     if ((!yy__building_native && (yk__cmp_sds_lit(yy__building_target, "web", 3) != 0)) && (yk__cmp_sds_lit(yy__building_target, "wasm4", 5) != 0))
     {
-        yk__sds t__60 = yk__concat_sds_lit(yy__building_binary, "-", 1);
-        yk__sds t__61 = yk__sdscatsds(yk__sdsdup(t__60), yy__building_target);
+        yk__sds t__113 = yk__concat_sds_lit(yy__building_binary, "-", 1);
+        yk__sds t__114 = yk__sdscatsds(yk__sdsdup(t__113), yy__building_target);
         yk__sdsfree(yy__building_binary);
-        yy__building_binary = yk__sdsdup(t__61);
-        yk__sdsfree(t__61);
-        yk__sdsfree(t__60);
+        yy__building_binary = yk__sdsdup(t__114);
+        yk__sdsfree(t__114);
+        yk__sdsfree(t__113);
     }
     if (yy__building_c->yy__configuration_compilation->yy__configuration_raylib_hot_reloading_dll)
     {
         if (yy__building_is_target_windows(yk__sdsdup(yy__building_target)))
         {
-            yk__sds t__62 = yk__concat_sds_lit(yy__building_binary, ".dll", 4);
+            yk__sds t__115 = yk__concat_sds_lit(yy__building_binary, ".dll", 4);
             yk__sdsfree(yy__building_binary);
-            yy__building_binary = yk__sdsdup(t__62);
-            yk__sdsfree(t__62);
+            yy__building_binary = yk__sdsdup(t__115);
+            yk__sdsfree(t__115);
         }
         else
         {
             if (yy__building_is_target_macos(yk__sdsdup(yy__building_target)))
             {
-                yk__sds t__63 = yk__concat_lit_sds("lib", 3, yy__building_binary);
-                yk__sds t__64 = yk__concat_sds_lit(t__63, ".dylib", 6);
+                yk__sds t__116 = yk__concat_lit_sds("lib", 3, yy__building_binary);
+                yk__sds t__117 = yk__concat_sds_lit(t__116, ".dylib", 6);
                 yk__sdsfree(yy__building_binary);
-                yy__building_binary = yk__sdsdup(t__64);
-                yk__sdsfree(t__64);
-                yk__sdsfree(t__63);
+                yy__building_binary = yk__sdsdup(t__117);
+                yk__sdsfree(t__117);
+                yk__sdsfree(t__116);
             }
             else
             {
-                yk__sds t__65 = yk__concat_lit_sds("lib", 3, yy__building_binary);
-                yk__sds t__66 = yk__concat_sds_lit(t__65, ".so", 3);
+                yk__sds t__118 = yk__concat_lit_sds("lib", 3, yy__building_binary);
+                yk__sds t__119 = yk__concat_sds_lit(t__118, ".so", 3);
                 yk__sdsfree(yy__building_binary);
-                yy__building_binary = yk__sdsdup(t__66);
-                yk__sdsfree(t__66);
-                yk__sdsfree(t__65);
+                yy__building_binary = yk__sdsdup(t__119);
+                yk__sdsfree(t__119);
+                yk__sdsfree(t__118);
             }
         }
     }
@@ -1611,54 +2498,51 @@ yk__sds* yy__building_create_args(struct yy__configuration_Config* yy__building_
     {
         if (yy__building_is_target_windows(yk__sdsdup(yy__building_target)))
         {
-            yk__sds t__67 = yk__concat_sds_lit(yy__building_binary, ".exe", 4);
+            yk__sds t__120 = yk__concat_sds_lit(yy__building_binary, ".exe", 4);
             yk__sdsfree(yy__building_binary);
-            yy__building_binary = yk__sdsdup(t__67);
-            yk__sdsfree(t__67);
+            yy__building_binary = yk__sdsdup(t__120);
+            yk__sdsfree(t__120);
         }
     }
     if (yk__cmp_sds_lit(yy__building_target, "web", 3) == 0)
     {
-        yk__sds t__68 = yk__concat_sds_lit(yy__building_binary, ".html", 5);
+        yk__sds t__121 = yk__concat_sds_lit(yy__building_binary, ".html", 5);
         yk__sdsfree(yy__building_binary);
-        yy__building_binary = yk__sdsdup(t__68);
-        yk__sdsfree(t__68);
+        yy__building_binary = yk__sdsdup(t__121);
+        yk__sdsfree(t__121);
     }
     if (yk__cmp_sds_lit(yy__building_target, "wasm4", 5) == 0)
     {
-        yk__sds t__69 = yk__concat_sds_lit(yy__building_binary, ".wasm", 5);
+        yk__sds t__122 = yk__concat_sds_lit(yy__building_binary, ".wasm", 5);
         yk__sdsfree(yy__building_binary);
-        yy__building_binary = yk__sdsdup(t__69);
-        yk__sdsfree(t__69);
+        yy__building_binary = yk__sdsdup(t__122);
+        yk__sdsfree(t__122);
     }
-    yk__sds t__70 = yy__path_join(yk__bstr_h(yy__building_build_path), yk__bstr_h(yy__building_binary));
+    yk__sds t__123 = yy__path_join(yk__bstr_h(yy__building_build_path), yk__bstr_h(yy__building_binary));
     yk__sdsfree(yy__building_binary);
-    yy__building_binary = yk__sdsdup(t__70);
+    yy__building_binary = yk__sdsdup(t__123);
     if (yk__cmp_sds_lit(yy__building_target, "wasm4", 5) == 0)
     {
-        yk__sds t__71 = yk__concat_lit_sds("-femit-bin=", 11, yy__building_binary);
-        yk__arrput(yy__building_args, yk__sdsdup(t__71));
-        yk__sdsfree(t__71);
+        yk__sds t__124 = yk__concat_lit_sds("-femit-bin=", 11, yy__building_binary);
+        yk__arrput(yy__building_args, yk__sdsdup(t__124));
+        yk__sdsfree(t__124);
     }
     else
     {
         yk__arrput(yy__building_args, yk__sdsdup(yy__building_binary));
     }
-    yk__sds* t__72 = yy__building_args;
+    yk__sds* t__125 = yy__building_args;
     yy__array_del_str_array(yy__building_ray_other_args);
     yy__array_del_str_array(yy__building_ray_objects);
-    yk__sdsfree(t__70);
+    yk__sdsfree(t__123);
     yk__sdsfree(yy__building_binary);
-    yk__sdsfree(t__58);
+    yk__sdsfree(t__111);
     yk__sdsfree(yy__building_the_yk_main);
-    yk__sdsfree(t__57);
-    yk__sdsfree(yy__building_program_object);
-    yk__sdsfree(t__56);
+    yk__sdsfree(t__110);
     yk__sdsfree(yy__building_alt_compiler);
     yk__sdsfree(yy__building_target);
     yk__sdsfree(yy__building_build_path);
-    yk__sdsfree(yy__building_code_path);
-    return t__72;
+    return t__125;
 }
 void yy__building_print_target_eq(yk__sds yy__building_target, bool yy__building_native) 
 {
@@ -1674,54 +2558,297 @@ void yy__building_print_target_eq(yk__sds yy__building_target, bool yy__building
     yk__sdsfree(yy__building_target);
     return;
 }
-int32_t yy__building_build_target(struct yy__configuration_Config* yy__building_c, yk__sds yy__building_code_path, yk__sds yy__building_build_path, yk__sds yy__building_target, yk__sds* yy__building_raylib_args, bool yy__building_silent) 
+struct yy__building_TargetBuild* yy__building_new_target_build(struct yy__configuration_Config* yy__building_c, yk__sds* yy__building_code_paths, yk__sds yy__building_build_path, yk__sds yy__building_target, yk__sds* yy__building_raylib_args, struct yy__object_cache_ObjectCache* yy__building_cache, struct yy__building_JobState* yy__building_state) 
 {
-    bool yy__building_native = (yk__sdslen(yy__building_target) == INT32_C(0));
-    yk__sds* yy__building_a = yy__building_create_args(yy__building_c, yk__sdsdup(yy__building_code_path), yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), yy__building_raylib_args);
-    yy__os_ProcessResult yy__building_result = yy__os_run(yy__building_a);
-    if (yy__building_result->ok)
+    struct yy__building_TargetBuild* yy__building_tb = yk__obj_alloc(struct yy__building_TargetBuild);
+    yy__building_tb->yy__building_target = yk__sdsdup(yy__building_target);
+    yy__building_tb->yy__building_state = yy__building_state;
+    yy__building_tb->yy__building_remaining = INT32_C(0);
+    yy__building_tb->yy__building_link_ok = false;
+    yy__building_tb->yy__building_link_output = yk__sdsnewlen("", 0);
+    yy__building_tb->yy__building_link_args = yy__building_create_args(yy__building_c, yy__building_code_paths, yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), yy__building_raylib_args, yy__building_cache, yy__building_tb);
+    struct yy__building_TargetBuild* t__126 = yy__building_tb;
+    yk__sdsfree(yy__building_target);
+    yk__sdsfree(yy__building_build_path);
+    return t__126;
+}
+void yy__building_del_target_build(struct yy__building_TargetBuild* yy__building_tb) 
+{
+    yy__building_cleanup_buildables(yy__building_tb->yy__building_buildables);
+    yy__array_del_str_array(yy__building_tb->yy__building_compile_args);
+    yy__array_del_str_array(yy__building_tb->yy__building_link_args);
+    yk__sdsfree(yy__building_tb->yy__building_target);
+    yk__sdsfree(yy__building_tb->yy__building_link_output);
+    yk__obj_free(yy__building_tb);
+    return;
+}
+int32_t yy__building_report_target(struct yy__building_TargetBuild* yy__building_tb, bool yy__building_silent) 
+{
+    bool yy__building_native = (yk__sdslen(yy__building_tb->yy__building_target) == INT32_C(0));
+    if (yy__building_tb->yy__building_link_ok)
     {
         if (!yy__building_silent)
         {
-            yy__building_print_target_eq(yk__sdsdup(yy__building_target), yy__building_native);
+            yy__building_print_target_eq(yk__sdsdup(yy__building_tb->yy__building_target), yy__building_native);
             yy__console_green(yk__bstr_s("done.\n", 6));
         }
-        yy__os_del_process_result(yy__building_result);
-        yy__array_del_str_array(yy__building_a);
+        return INT32_C(0);
+    }
+    else
+    {
+        yy__building_print_target_eq(yk__sdsdup(yy__building_tb->yy__building_target), yy__building_native);
+        yy__console_red(yk__bstr_s("failed.\n", 8));
+        yy__console_cyan(yk__bstr_s("-------\n", 8));
+        yy__console_red(yk__bstr_s("command := ", 11));
+        yk__sds t__127 = yy__array_join(yy__building_tb->yy__building_link_args, yk__sdsnewlen(" ", 1));
+        yy__console_yellow(yk__bstr_h(t__127));
+        yy__console_cyan(yk__bstr_s("\n-------\n", 9));
+        yy__console_red(yk__bstr_h(yy__building_tb->yy__building_link_output));
+        yk__sdsfree(t__127);
+        return INT32_C(1);
+        yk__sdsfree(t__127);
+    }
+}
+void yy__building_print_timings(struct yy__building_TargetBuild** yy__building_builds) 
+{
+    yy__console_cyan(yk__bstr_s("timings:\n", 9));
+    int32_t yy__building_build_count = yk__arrlen(yy__building_builds);
+    int32_t yy__building_pos = INT32_C(0);
+    while (true)
+    {
+        if (!(yy__building_pos < yy__building_build_count))
+        {
+            break;
+        }
+        struct yy__building_TargetBuild* yy__building_tb = yy__building_builds[yy__building_pos];
+        yy__building_print_target_eq(yk__sdsdup(yy__building_tb->yy__building_target), (yk__sdslen(yy__building_tb->yy__building_target) == INT32_C(0)));
+        yk__printint((intmax_t)yk__arrlen(yy__building_tb->yy__building_buildables));
+        yy__console_green(yk__bstr_s(" object(s)", 10));
+        yy__console_cyan(yk__bstr_s(" in ", 4));
+        yk__printint((intmax_t)yy__building_tb->yy__building_compile_ms);
+        yy__console_cyan(yk__bstr_s("ms, linked in ", 14));
+        yk__printint((intmax_t)yy__building_tb->yy__building_link_ms);
+        yy__console_cyan(yk__bstr_s("ms (finished at ", 16));
+        yk__printint((intmax_t)yy__building_tb->yy__building_finished_ms);
+        yy__console_cyan(yk__bstr_s("ms)\n", 4));
+        yy__building_pos += INT32_C(1);
+    }
+    return;
+}
+int32_t yy__building_build_targets(struct yy__configuration_Config* yy__building_c, yk__sds* yy__building_code_paths, yk__sds yy__building_build_path, yk__sds* yy__building_targets, yk__sds* yy__building_raylib_args, struct yy__object_cache_ObjectCache* yy__building_cache, bool yy__building_silent, bool yy__building_timings) 
+{
+    struct yy__building_JobState* yy__building_state = yk__obj_alloc(struct yy__building_JobState);
+    if (yy__mutex_init((&(yy__building_state->yy__building_lock)), yy__mutex_PLAIN) != yy__thread_SUCCESS)
+    {
+        yy__console_red(yk__bstr_s("Failed to create a mutex\n", 25));
+        int32_t t__128 = yk__arrlen(yy__building_targets);
+        yk__obj_free(yy__building_state);
+        yk__sdsfree(yy__building_build_path);
+        return t__128;
+    }
+    if (yy__condition_init((&(yy__building_state->yy__building_objects_done))) != yy__thread_SUCCESS)
+    {
+        yy__console_red(yk__bstr_s("Failed to create a condition\n", 29));
+        int32_t t__129 = yk__arrlen(yy__building_targets);
+        yy__mutex_destroy((&(yy__building_state->yy__building_lock)));
+        yk__obj_free(yy__building_state);
+        yk__sdsfree(yy__building_build_path);
+        return t__129;
+    }
+    yy__building_state->yy__building_start_ms = yy__timespec_millis();
+    struct yy__building_TargetBuild** yy__building_builds = NULL;
+    int32_t yy__building_target_count = yk__arrlen(yy__building_targets);
+    int32_t yy__building_pos = INT32_C(0);
+    while (true)
+    {
+        if (!(yy__building_pos < yy__building_target_count))
+        {
+            break;
+        }
+        yk__arrput(yy__building_builds, yy__building_new_target_build(yy__building_c, yy__building_code_paths, yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_targets[yy__building_pos]), yy__building_raylib_args, yy__building_cache, yy__building_state));
+        yy__building_pos += INT32_C(1);
+    }
+    yy__building_run_jobs(yy__building_c, yy__building_builds);
+    int32_t yy__building_failed_count = INT32_C(0);
+    yy__building_pos = INT32_C(0);
+    while (true)
+    {
+        if (!(yy__building_pos < yy__building_target_count))
+        {
+            break;
+        }
+        yy__building_failed_count += yy__building_report_target(yy__building_builds[yy__building_pos], yy__building_silent);
+        yy__building_pos += INT32_C(1);
+    }
+    if (yy__building_timings && !yy__building_silent)
+    {
+        yy__building_print_timings(yy__building_builds);
+    }
+    yy__building_pos = INT32_C(0);
+    while (true)
+    {
+        if (!(yy__building_pos < yy__building_target_count))
+        {
+            break;
+        }
+        yy__building_del_target_build(yy__building_builds[yy__building_pos]);
+        yy__building_pos += INT32_C(1);
+    }
+    int32_t t__130 = yy__building_failed_count;
+    yk__arrfree(yy__building_builds);
+    yy__condition_destroy((&(yy__building_state->yy__building_objects_done)));
+    yy__mutex_destroy((&(yy__building_state->yy__building_lock)));
+    yk__obj_free(yy__building_state);
+    yk__sdsfree(yy__building_build_path);
+    return t__130;
+}
+bool yy__building_print_error(yk__sds yy__building_error, int32_t yy__building_ignored) 
+{
+    yy__console_red(yk__bstr_s("error", 5));
+    yy__console_yellow(yk__bstr_s(":", 1));
+    yk__printlnstr(yy__building_error);
+    yk__sdsfree(yy__building_error);
+    return true;
+}
+void yy__building_clear_dir(yk__sds yy__building_dir_path) 
+{
+    yk__sds* yy__building_names = yy__path_list_dir(yk__sdsdup(yy__building_dir_path));
+    int32_t yy__building_length = yk__arrlen(yy__building_names);
+    int32_t yy__building_x = INT32_C(0);
+    while (true)
+    {
+        if (!(yy__building_x < yy__building_length))
+        {
+            break;
+        }
+        yk__sds t__131 = yy__path_join(yk__bstr_h(yy__building_dir_path), yk__bstr_h(yy__building_names[yy__building_x]));
+        yy__path_remove(yk__sdsdup(t__131));
+        yy__building_x = (yy__building_x + INT32_C(1));
+        yk__sdsfree(t__131);
+    }
+    yy__array_del_str_array(yy__building_names);
+    yk__sdsfree(yy__building_dir_path);
+    return;
+}
+bool yy__building_train_pgo(struct yy__configuration_Config* yy__building_c, yk__sds* yy__building_code_paths, yk__sds yy__building_build_path, yk__sds yy__building_target, yk__sds* yy__building_raylib_args, struct yy__object_cache_ObjectCache* yy__building_cache) 
+{
+    if (yk__arrlen(yy__building_c->yy__configuration_compilation->yy__configuration_pgo_train) == INT32_C(0))
+    {
+        yy__building_print_error(yk__sdsnewlen("pgo profile requires a training command in [compilation].pgo_train", 66), INT32_C(0));
+        yk__sdsfree(yy__building_target);
+        yk__sdsfree(yy__building_build_path);
+        return false;
+    }
+    yk__sds t__132 = yy__path_join(yk__bstr_h(yy__building_build_path), yk__bstr_s("pgo", 3));
+    yk__sds yy__building_pgo_path = yk__sdsdup(t__132);
+    yy__path_mkdir(yk__sdsdup(yy__building_pgo_path));
+    yy__building_clear_dir(yk__sdsdup(yy__building_pgo_path));
+    yy__console_cyan(yk__bstr_s("pgo := ", 7));
+    yy__console_yellow(yk__bstr_s("instrumented build\n", 19));
+    yy__building_c->yy__configuration_pgo_stage = yy__configuration_PGO_GENERATE;
+    yk__sds* t__133 = NULL;
+    yk__arrsetcap(t__133, 1);
+    yk__arrput(t__133, yk__sdsdup(yy__building_target));
+    yk__sds* yy__building_targets = t__133;
+    if (yy__building_build_targets(yy__building_c, yy__building_code_paths, yk__sdsdup(yy__building_build_path), yy__building_targets, yy__building_raylib_args, yy__building_cache, false, false) > INT32_C(0))
+    {
+        yy__array_del_str_array(yy__building_targets);
+        yk__sdsfree(yy__building_pgo_path);
+        yk__sdsfree(t__132);
+        yk__sdsfree(yy__building_target);
+        yk__sdsfree(yy__building_build_path);
+        return false;
+    }
+    yy__console_cyan(yk__bstr_s("pgo := ", 7));
+    yy__console_yellow(yk__bstr_s("training\n", 9));
+    yy__os_ProcessResult yy__building_trained = yy__os_run(yy__building_c->yy__configuration_compilation->yy__configuration_pgo_train);
+    if (!(yy__building_trained->ok))
+    {
+        yy__console_red(yk__bstr_s("training failed.\n", 17));
+        yy__console_cyan(yk__bstr_s("-------\n", 8));
+        yy__console_red(yk__bstr_s("command := ", 11));
+        yk__sds t__134 = yy__array_join(yy__building_c->yy__configuration_compilation->yy__configuration_pgo_train, yk__sdsnewlen(" ", 1));
+        yy__console_yellow(yk__bstr_h(t__134));
+        yy__console_cyan(yk__bstr_s("\n-------\n", 9));
+        yy__console_red(yk__bstr_h(yy__building_trained->output));
+        yy__os_del_process_result(yy__building_trained);
+        yy__array_del_str_array(yy__building_targets);
+        yk__sdsfree(t__134);
+        yk__sdsfree(yy__building_pgo_path);
+        yk__sdsfree(t__132);
+        yk__sdsfree(yy__building_target);
+        yk__sdsfree(yy__building_build_path);
+        return false;
+        yk__sdsfree(t__134);
+    }
+    if (yy__building_c->yy__configuration_use_alt_compiler && (yy__building_c->yy__configuration_alt_compiler == yy__configuration_GCC))
+    {
+        yy__os_del_process_result(yy__building_trained);
+        yy__array_del_str_array(yy__building_targets);
+        yk__sdsfree(yy__building_pgo_path);
+        yk__sdsfree(t__132);
+        yk__sdsfree(yy__building_target);
+        yk__sdsfree(yy__building_build_path);
+        return true;
+    }
+    yk__sds t__135 = yy__os_which(yk__sdsnewlen("llvm-profdata", 13));
+    yk__sds yy__building_profdata = yk__sdsdup(t__135);
+    if (yk__sdslen(yy__building_profdata) == INT32_C(0))
+    {
+        yy__building_print_error(yk__sdsnewlen("Failed to find llvm-profdata in PATH (required to merge pgo profile data)", 73), INT32_C(0));
+        yy__os_del_process_result(yy__building_trained);
+        yy__array_del_str_array(yy__building_targets);
+        yk__sdsfree(yy__building_profdata);
+        yk__sdsfree(t__135);
+        yk__sdsfree(yy__building_pgo_path);
+        yk__sdsfree(t__132);
         yk__sdsfree(yy__building_target);
         yk__sdsfree(yy__building_build_path);
-        yk__sdsfree(yy__building_code_path);
-        return INT32_C(0);
+        return false;
     }
-    else
-    {
-        yy__building_print_target_eq(yk__sdsdup(yy__building_target), yy__building_native);
-        yy__console_red(yk__bstr_s("failed.\n", 8));
-        yy__console_cyan(yk__bstr_s("-------\n", 8));
-        yy__console_red(yk__bstr_s("command := ", 11));
-        yk__sds t__73 = yy__array_join(yy__building_a, yk__sdsnewlen(" ", 1));
-        yy__console_yellow(yk__bstr_h(t__73));
-        yy__console_cyan(yk__bstr_s("\n-------\n", 9));
-        yy__console_red(yk__bstr_h(yy__building_result->output));
-        yy__os_del_process_result(yy__building_result);
-        yy__array_del_str_array(yy__building_a);
-        yk__sdsfree(t__73);
+    yk__sds t__136 = yy__path_join(yk__bstr_h(yy__building_pgo_path), yk__bstr_s("default.profdata", 16));
+    yk__sds t__137 = yk__concat_lit_sds("-output=", 8, t__136);
+    yk__sds* t__138 = NULL;
+    yk__arrsetcap(t__138, 4);
+    yk__arrput(t__138, yk__sdsdup(yy__building_profdata));
+    yk__arrput(t__138, yk__sdsnewlen("merge", 5));
+    yk__arrput(t__138, yk__sdsdup(t__137));
+    yk__arrput(t__138, yk__sdsdup(yy__building_pgo_path));
+    yk__sds* yy__building_merge_args = t__138;
+    yy__os_ProcessResult yy__building_merged = yy__os_run(yy__building_merge_args);
+    if (!(yy__building_merged->ok))
+    {
+        yy__console_red(yk__bstr_s("merging profile data failed.\n", 29));
+        yy__console_red(yk__bstr_h(yy__building_merged->output));
+        yy__os_del_process_result(yy__building_merged);
+        yy__array_del_str_array(yy__building_merge_args);
+        yy__os_del_process_result(yy__building_trained);
+        yy__array_del_str_array(yy__building_targets);
+        yk__sdsfree(t__137);
+        yk__sdsfree(t__136);
+        yk__sdsfree(yy__building_profdata);
+        yk__sdsfree(t__135);
+        yk__sdsfree(yy__building_pgo_path);
+        yk__sdsfree(t__132);
         yk__sdsfree(yy__building_target);
         yk__sdsfree(yy__building_build_path);
-        yk__sdsfree(yy__building_code_path);
-        return INT32_C(1);
-        yk__sdsfree(t__73);
+        return false;
     }
-}
-bool yy__building_print_error(yk__sds yy__building_error, int32_t yy__building_ignored) 
-{
-    yy__console_red(yk__bstr_s("error", 5));
-    yy__console_yellow(yk__bstr_s(":", 1));
-    yk__printlnstr(yy__building_error);
-    yk__sdsfree(yy__building_error);
+    yy__os_del_process_result(yy__building_merged);
+    yy__array_del_str_array(yy__building_merge_args);
+    yy__os_del_process_result(yy__building_trained);
+    yy__array_del_str_array(yy__building_targets);
+    yk__sdsfree(t__137);
+    yk__sdsfree(t__136);
+    yk__sdsfree(yy__building_profdata);
+    yk__sdsfree(t__135);
+    yk__sdsfree(yy__building_pgo_path);
+    yk__sdsfree(t__132);
+    yk__sdsfree(yy__building_target);
+    yk__sdsfree(yy__building_build_path);
     return true;
 }
-int32_t yy__building_build(struct yy__configuration_Config* yy__building_c, yk__sds yy__building_code) 
+int32_t yy__building_build(struct yy__configuration_Config* yy__building_c, yk__sds yy__building_code, yy__in_process_Compilation yy__building_comp) 
 {
     yy__configuration_load_runtime_features(yy__building_c, yk__sdsdup(yy__building_code), false);
     if (yy__building_c->yy__configuration_compilation->yy__configuration_wasm4 && (yy__building_c->yy__configuration_compilation->yy__configuration_web || yy__building_c->yy__configuration_compilation->yy__configuration_raylib))
@@ -1731,16 +2858,16 @@ int32_t yy__building_build(struct yy__configuration_Config* yy__building_c, yk__
     yk__sds yy__building_target = yk__sdsnewlen("" , 0);
     if (yk__arrlen(yy__building_c->yy__configuration_errors) > INT32_C(0))
     {
-        yk__sds* t__76 = yy__building_c->yy__configuration_errors;
-        int32_t t__78 = INT32_C(0);
-        size_t t__75 = yk__arrlenu(t__76);
-        bool t__79 = true;
-        for (size_t t__74 = 0; t__74 < t__75; t__74++) { 
-            yk__sds t__77 = yk__sdsdup(t__76[t__74]);
-            bool t__80 = yy__building_print_error(t__77, t__78);
-            if (!t__80) {t__79 = false; break; }
+        yk__sds* t__141 = yy__building_c->yy__configuration_errors;
+        int32_t t__143 = INT32_C(0);
+        size_t t__140 = yk__arrlenu(t__141);
+        bool t__144 = true;
+        for (size_t t__139 = 0; t__139 < t__140; t__139++) { 
+            yk__sds t__142 = yk__sdsdup(t__141[t__139]);
+            bool t__145 = yy__building_print_error(t__142, t__143);
+            if (!t__145) {t__144 = false; break; }
         }
-        t__79;
+        t__144;
         yk__sdsfree(yy__building_target);
         yk__sdsfree(yy__building_code);
         return INT32_C(-1);
@@ -1779,9 +2906,9 @@ int32_t yy__building_build(struct yy__configuration_Config* yy__building_c, yk__
         yk__sdsfree(yy__building_code);
         return INT32_C(-1);
     }
-    yk__sds t__81 = yy__os_cwd();
-    yk__sds t__82 = yy__path_join(yk__bstr_h(t__81), yk__bstr_s("build", 5));
-    yk__sds yy__building_build_path = yk__sdsdup(t__82);
+    yk__sds t__146 = yy__os_cwd();
+    yk__sds t__147 = yy__path_join(yk__bstr_h(t__146), yk__bstr_s("build", 5));
+    yk__sds yy__building_build_path = yk__sdsdup(t__147);
     if (yy__building_c->yy__configuration_compilation->yy__configuration_raylib)
     {
         yy__building_raylib_args = yy__raylib_support_get_raylib_args(yy__building_c, yk__sdsdup(yy__building_build_path));
@@ -1790,26 +2917,40 @@ int32_t yy__building_build(struct yy__configuration_Config* yy__building_c, yk__
     yk__printint((intmax_t)(yy__building_target_count + INT32_C(1)));
     yk__printlnstr(" target(s) ...");
     yy__path_mkdir(yk__sdsdup(yy__building_build_path));
-    yk__sds t__83 = yy__path_join(yk__bstr_h(yy__building_build_path), yk__bstr_s("program_code.c", 14));
-    yk__sds yy__building_code_path = yk__sdsdup(t__83);
-    yk__sds t__84 = yy__building_prepare_code(yy__building_c, yk__sdsdup(yy__building_code));
-    if (!(yy__io_writefile(yk__bstr_h(yy__building_code_path), yk__bstr_h(t__84))))
+    yk__sds* yy__building_code_paths = yy__building_write_code(yy__building_c, yk__sdsdup(yy__building_code), yy__building_comp, yk__sdsdup(yy__building_build_path), yk__sdsnewlen("program_code", 12));
+    if (yk__arrlen(yy__building_code_paths) == INT32_C(0))
     {
-        yy__console_red(yk__bstr_s("Failed to write file:", 21));
-        yk__printlnstr(yy__building_code_path);
+        yy__array_del_str_array(yy__building_code_paths);
         yy__array_del_str_array(yy__building_raylib_args);
-        yk__sdsfree(t__84);
-        yk__sdsfree(yy__building_code_path);
-        yk__sdsfree(t__83);
         yk__sdsfree(yy__building_build_path);
-        yk__sdsfree(t__82);
-        yk__sdsfree(t__81);
+        yk__sdsfree(t__147);
+        yk__sdsfree(t__146);
         yk__sdsfree(yy__building_target);
         yk__sdsfree(yy__building_code);
         return INT32_C(-1);
     }
-    int32_t yy__building_failed_count = INT32_C(0);
-    yy__building_failed_count = (yy__building_failed_count + yy__building_build_target(yy__building_c, yk__sdsdup(yy__building_code_path), yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), yy__building_raylib_args, false));
+    struct yy__object_cache_ObjectCache* yy__building_cache = yy__object_cache_create();
+    if (yk__cmp_sds_bstr(yy__building_c->yy__configuration_compilation->yy__configuration_profile, yy__configuration_PROFILE_PGO) == 0)
+    {
+        yy__building_cache->yy__object_cache_enabled = false;
+        if (!(yy__building_train_pgo(yy__building_c, yy__building_code_paths, yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), yy__building_raylib_args, yy__building_cache)))
+        {
+            yy__object_cache_del_cache(yy__building_cache);
+            yy__array_del_str_array(yy__building_code_paths);
+            yy__array_del_str_array(yy__building_raylib_args);
+            yk__sdsfree(yy__building_build_path);
+            yk__sdsfree(t__147);
+            yk__sdsfree(t__146);
+            yk__sdsfree(yy__building_target);
+            yk__sdsfree(yy__building_code);
+            return INT32_C(-1);
+        }
+        yy__building_c->yy__configuration_pgo_stage = yy__configuration_PGO_USE;
+    }
+    yk__sds* t__148 = NULL;
+    yk__arrsetcap(t__148, 1);
+    yk__arrput(t__148, yk__sdsdup(yy__building_target));
+    yk__sds* yy__building_targets = t__148;
     int32_t yy__building_cnt = INT32_C(0);
     while (true)
     {
@@ -1817,69 +2958,70 @@ int32_t yy__building_build(struct yy__configuration_Config* yy__building_c, yk__
         {
             break;
         }
-        yk__sdsfree(yy__building_target);
-        yy__building_target = yk__sdsdup(yy__building_c->yy__configuration_compilation->yy__configuration_targets[yy__building_cnt]);
-        yy__building_failed_count = (yy__building_failed_count + yy__building_build_target(yy__building_c, yk__sdsdup(yy__building_code_path), yk__sdsdup(yy__building_build_path), yk__sdsdup(yy__building_target), yy__building_raylib_args, false));
+        yk__arrput(yy__building_targets, yk__sdsdup(yy__building_c->yy__configuration_compilation->yy__configuration_targets[yy__building_cnt]));
         yy__building_cnt = (yy__building_cnt + INT32_C(1));
     }
+    int32_t yy__building_failed_count = yy__building_build_targets(yy__building_c, yy__building_code_paths, yk__sdsdup(yy__building_build_path), yy__building_targets, yy__building_raylib_args, yy__building_cache, false, true);
+    yy__object_cache_trim(yy__building_cache);
+    yy__object_cache_print_stats(yy__building_cache);
     yk__printstr("\n");
     if (yy__building_failed_count > INT32_C(0))
     {
+        yy__array_del_str_array(yy__building_targets);
+        yy__object_cache_del_cache(yy__building_cache);
+        yy__array_del_str_array(yy__building_code_paths);
         yy__array_del_str_array(yy__building_raylib_args);
-        yk__sdsfree(t__84);
-        yk__sdsfree(yy__building_code_path);
-        yk__sdsfree(t__83);
         yk__sdsfree(yy__building_build_path);
-        yk__sdsfree(t__82);
-        yk__sdsfree(t__81);
+        yk__sdsfree(t__147);
+        yk__sdsfree(t__146);
         yk__sdsfree(yy__building_target);
         yk__sdsfree(yy__building_code);
         return INT32_C(-1);
     }
+    yy__array_del_str_array(yy__building_targets);
+    yy__object_cache_del_cache(yy__building_cache);
+    yy__array_del_str_array(yy__building_code_paths);
     yy__array_del_str_array(yy__building_raylib_args);
-    yk__sdsfree(t__84);
-    yk__sdsfree(yy__building_code_path);
-    yk__sdsfree(t__83);
     yk__sdsfree(yy__building_build_path);
-    yk__sdsfree(t__82);
-    yk__sdsfree(t__81);
+    yk__sdsfree(t__147);
+    yk__sdsfree(t__146);
     yk__sdsfree(yy__building_target);
     yk__sdsfree(yy__building_code);
     return INT32_C(0);
 }
-int32_t yy__building_build_simple(struct yy__configuration_Config* yy__building_c, yk__sds yy__building_code, bool yy__building_silent) 
+int32_t yy__building_build_simple(struct yy__configuration_Config* yy__building_c, yk__sds yy__building_code, yy__in_process_Compilation yy__building_comp, bool yy__building_silent) 
 {
     yy__configuration_load_runtime_features(yy__building_c, yk__sdsdup(yy__building_code), yy__building_silent);
     if (yy__building_c->yy__configuration_compilation->yy__configuration_wasm4 && (yy__building_c->yy__configuration_compilation->yy__configuration_web || yy__building_c->yy__configuration_compilation->yy__configuration_raylib))
     {
         yk__arrput(yy__building_c->yy__configuration_errors, yk__sdsnewlen("WASM4 builds are not compatible with raylib/web builds", 54));
     }
+    if (yk__cmp_sds_bstr(yy__building_c->yy__configuration_compilation->yy__configuration_profile, yy__configuration_PROFILE_PGO) == 0)
+    {
+        yk__arrput(yy__building_c->yy__configuration_errors, yk__sdsnewlen("pgo profile is only supported for project builds", 48));
+    }
     if (yk__arrlen(yy__building_c->yy__configuration_errors) > INT32_C(0))
     {
-        yk__sds* t__87 = yy__building_c->yy__configuration_errors;
-        int32_t t__89 = INT32_C(0);
-        size_t t__86 = yk__arrlenu(t__87);
-        bool t__90 = true;
-        for (size_t t__85 = 0; t__85 < t__86; t__85++) { 
-            yk__sds t__88 = yk__sdsdup(t__87[t__85]);
-            bool t__91 = yy__building_print_error(t__88, t__89);
-            if (!t__91) {t__90 = false; break; }
+        yk__sds* t__151 = yy__building_c->yy__configuration_errors;
+        int32_t t__153 = INT32_C(0);
+        size_t t__150 = yk__arrlenu(t__151);
+        bool t__154 = true;
+        for (size_t t__149 = 0; t__149 < t__150; t__149++) { 
+            yk__sds t__152 = yk__sdsdup(t__151[t__149]);
+            bool t__155 = yy__building_print_error(t__152, t__153);
+            if (!t__155) {t__154 = false; break; }
         }
-        t__90;
+        t__154;
         yk__sdsfree(yy__building_code);
         return INT32_C(-1);
     }
-    yk__sds t__92 = yy__os_cwd();
-    yk__sds t__93 = yk__concat_sds_lit(yy__building_c->yy__configuration_project->yy__configuration_name, ".c", 2);
-    yk__sds t__94 = yy__path_join(yk__bstr_h(t__92), yk__bstr_h(t__93));
-    yk__sds yy__building_code_path = yk__sdsdup(t__94);
     yk__sds* yy__building_raylib_args = NULL;
     yk__sds yy__building_target = yk__sdsnewlen("" , 0);
     if (yy__building_c->yy__configuration_compilation->yy__configuration_raylib)
     {
-        yk__sds t__95 = yy__os_cwd();
-        yy__building_raylib_args = yy__raylib_support_get_raylib_args(yy__building_c, yk__sdsdup(t__95));
-        yk__sdsfree(t__95);
+        yk__sds t__156 = yy__os_cwd();
+        yy__building_raylib_args = yy__raylib_support_get_raylib_args(yy__building_c, yk__sdsdup(t__156));
+        yk__sdsfree(t__156);
     }
     if (yy__building_c->yy__configuration_compilation->yy__configuration_wasm4)
     {
@@ -1891,47 +3033,270 @@ int32_t yy__building_build_simple(struct yy__configuration_Config* yy__building_
         yk__sdsfree(yy__building_target);
         yy__building_target = yk__sdsnewlen("web", 3);
     }
-    yk__sds t__96 = yy__building_prepare_code(yy__building_c, yk__sdsdup(yy__building_code));
-    if (!(yy__io_writefile(yk__bstr_h(yy__building_code_path), yk__bstr_h(t__96))))
+    yk__sds t__157 = yy__os_cwd();
+    yk__sds* yy__building_code_paths = yy__building_write_code(yy__building_c, yk__sdsdup(yy__building_code), yy__building_comp, yk__sdsdup(t__157), yk__sdsdup(yy__building_c->yy__configuration_project->yy__configuration_name));
+    if (yk__arrlen(yy__building_code_paths) == INT32_C(0))
     {
-        yy__console_red(yk__bstr_s("Failed to write file:", 21));
-        yk__printlnstr(yy__building_code_path);
+        yy__array_del_str_array(yy__building_code_paths);
         yy__array_del_str_array(yy__building_raylib_args);
-        yk__sdsfree(t__96);
+        yk__sdsfree(t__157);
         yk__sdsfree(yy__building_target);
-        yk__sdsfree(yy__building_code_path);
-        yk__sdsfree(t__94);
-        yk__sdsfree(t__93);
-        yk__sdsfree(t__92);
         yk__sdsfree(yy__building_code);
         return INT32_C(-1);
     }
-    yk__sds t__97 = yy__os_cwd();
-    int32_t yy__building_failed_count = yy__building_build_target(yy__building_c, yk__sdsdup(yy__building_code_path), yk__sdsdup(t__97), yk__sdsdup(yy__building_target), yy__building_raylib_args, yy__building_silent);
+    struct yy__object_cache_ObjectCache* yy__building_cache = yy__object_cache_create();
+    yk__sds* t__158 = NULL;
+    yk__arrsetcap(t__158, 1);
+    yk__arrput(t__158, yk__sdsdup(yy__building_target));
+    yk__sds* yy__building_targets = t__158;
+    yk__sds t__159 = yy__os_cwd();
+    int32_t yy__building_failed_count = yy__building_build_targets(yy__building_c, yy__building_code_paths, yk__sdsdup(t__159), yy__building_targets, yy__building_raylib_args, yy__building_cache, yy__building_silent, false);
+    yy__object_cache_trim(yy__building_cache);
+    if (!yy__building_silent)
+    {
+        yy__object_cache_print_stats(yy__building_cache);
+    }
     if (yy__building_failed_count > INT32_C(0))
     {
+        yy__array_del_str_array(yy__building_targets);
+        yy__object_cache_del_cache(yy__building_cache);
+        yy__array_del_str_array(yy__building_code_paths);
         yy__array_del_str_array(yy__building_raylib_args);
-        yk__sdsfree(t__97);
-        yk__sdsfree(t__96);
+        yk__sdsfree(t__159);
+        yk__sdsfree(t__157);
         yk__sdsfree(yy__building_target);
-        yk__sdsfree(yy__building_code_path);
-        yk__sdsfree(t__94);
-        yk__sdsfree(t__93);
-        yk__sdsfree(t__92);
         yk__sdsfree(yy__building_code);
         return INT32_C(-1);
     }
-    yy__array_del_str_array(yy__building_raylib_args);
-    yk__sdsfree(t__97);
-    yk__sdsfree(t__96);
-    yk__sdsfree(yy__building_target);
-    yk__sdsfree(yy__building_code_path);
-    yk__sdsfree(t__94);
-    yk__sdsfree(t__93);
-    yk__sdsfree(t__92);
-    yk__sdsfree(yy__building_code);
+    yy__array_del_str_array(yy__building_targets);
+    yy__object_cache_del_cache(yy__building_cache);
+    yy__array_del_str_array(yy__building_code_paths);
+    yy__array_del_str_array(yy__building_raylib_args);
+    yk__sdsfree(t__159);
+    yk__sdsfree(t__157);
+    yk__sdsfree(yy__building_target);
+    yk__sdsfree(yy__building_code);
+    return INT32_C(0);
+}
+int32_t yy__mutex_init(yy__mutex_Mutex* nn__mtx, int32_t nn__type) { return mtx_init(nn__mtx, nn__type); }
+void yy__mutex_destroy(yy__mutex_Mutex* nn__mtx) { mtx_destroy(nn__mtx); }
+int32_t yy__mutex_lock(yy__mutex_Mutex* nn__mtx) { return mtx_lock(nn__mtx); }
+int32_t yy__mutex_unlock(yy__mutex_Mutex* nn__mtx) { return mtx_unlock(nn__mtx); }
+int32_t yy__condition_init(yy__condition_Condition* nn__cnd) { return cnd_init(nn__cnd); }
+void yy__condition_destroy(yy__condition_Condition* nn__cnd) { cnd_destroy(nn__cnd); }
+int32_t yy__condition_signal(yy__condition_Condition* nn__cnd) { return cnd_signal(nn__cnd); }
+int32_t yy__condition_broadcast(yy__condition_Condition* nn__cnd) { return cnd_broadcast(nn__cnd); }
+int32_t yy__condition_wait(yy__condition_Condition* nn__cnd, yy__mutex_Mutex* nn__mtx) { return cnd_wait(nn__cnd, nn__mtx); }
+int64_t yy__timespec_millis() 
+{
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return ((int64_t) now.tv_sec) * 1000 + ((int64_t) now.tv_nsec) / 1000000;
+}
+int32_t yy__thread_create_with_data(yy__thread_Thread* nn__thr, yt_fn_in_any_ptr_out_i32 nn__func, void* nn__data) { return thrd_create(nn__thr, nn__func, nn__data); }
+void yy__thread_exit(int32_t nn__res) { thrd_exit(nn__res); }
+int32_t yy__thread_join(yy__thread_Thread nn__thr) 
+{
+    return thrd_join(nn__thr, NULL);
+}
+struct yy__pool_ThreadPool* yy__pool_create(uint8_t yy__pool_thread_count, uint32_t yy__pool_queue_size) 
+{
+    if ((((yy__pool_thread_count == UINT8_C(0)) || (yy__pool_queue_size == UINT32_C(0))) || (yy__pool_thread_count > yy__pool_MAX_THREAD_SIZE)) || (yy__pool_queue_size > yy__pool_MAX_QUEUE_SIZE))
+    {
+        struct yy__pool_ThreadPool* t__0 = NULL;
+        return t__0;
+    }
+    struct yy__pool_ThreadPool* yy__pool_tpool = yk__obj_alloc(struct yy__pool_ThreadPool);
+    if (yy__pool_tpool == NULL)
+    {
+        struct yy__pool_ThreadPool* t__1 = yy__pool_tpool;
+        return t__1;
+    }
+    yy__pool_tpool->yy__pool_thread_count = INT32_C(0);
+    yy__pool_tpool->yy__pool_queue_size = ((int32_t)yy__pool_queue_size);
+    yy__pool_tpool->yy__pool_head = INT32_C(0);
+    yy__pool_tpool->yy__pool_tail = INT32_C(0);
+    yy__pool_tpool->yy__pool_count = INT32_C(0);
+    yy__pool_tpool->yy__pool_shutdown = INT32_C(0);
+    yy__pool_tpool->yy__pool_started = INT32_C(0);
+    yk__arrsetlen(yy__pool_tpool->yy__pool_threads, yy__pool_thread_count);
+    yk__arrsetlen(yy__pool_tpool->yy__pool_queue, yy__pool_queue_size);
+    bool yy__pool_locks_ok = ((yy__mutex_init((&(yy__pool_tpool->yy__pool_lock)), yy__mutex_PLAIN) == yy__thread_SUCCESS) && (yy__condition_init((&(yy__pool_tpool->yy__pool_notify))) == yy__thread_SUCCESS));
+    bool yy__pool_arrays_ok = ((yy__pool_tpool->yy__pool_threads != NULL) && (yy__pool_tpool->yy__pool_queue != NULL));
+    if (!yy__pool_locks_ok || !yy__pool_arrays_ok)
+    {
+        yy__pool_internal_del_pool(yy__pool_tpool);
+        struct yy__pool_ThreadPool* t__2 = NULL;
+        return t__2;
+    }
+    int32_t yy__pool_i = INT32_C(0);
+    int32_t yy__pool_thread_count_i = ((int32_t)yy__pool_thread_count);
+    while (true)
+    {
+        if (!(yy__pool_i < yy__pool_thread_count_i))
+        {
+            break;
+        }
+        bool yy__pool_ok = (yy__thread_create_with_data((&(yy__pool_tpool->yy__pool_threads[yy__pool_i])), yy__pool_internal_tpool_work, yy__pool_tpool) == yy__thread_SUCCESS);
+        if (!yy__pool_ok)
+        {
+            yy__pool_destroy(yy__pool_tpool, true);
+            struct yy__pool_ThreadPool* t__3 = NULL;
+            return t__3;
+        }
+        yy__pool_i += INT32_C(1);
+        yy__pool_tpool->yy__pool_thread_count += INT32_C(1);
+        yy__pool_tpool->yy__pool_started += INT32_C(1);
+    }
+    struct yy__pool_ThreadPool* t__4 = yy__pool_tpool;
+    return t__4;
+}
+int32_t yy__pool_add(struct yy__pool_ThreadPool* yy__pool_tpool, yt_fn_in_any_ptr_out yy__pool_func, void* yy__pool_arg) 
+{
+    int32_t yy__pool_err = yy__pool_SUCCESS;
+    int32_t yy__pool_next = INT32_C(0);
+    if (yy__pool_tpool == NULL)
+    {
+        int32_t const  t__5 = yy__pool_ERROR_INVALID;
+        return t__5;
+    }
+    if (yy__mutex_lock((&(yy__pool_tpool->yy__pool_lock))) != yy__thread_SUCCESS)
+    {
+        int32_t const  t__6 = yy__pool_ERROR_LOCK_FAILURE;
+        return t__6;
+    }
+    yy__pool_next = (((yy__pool_tpool->yy__pool_tail + INT32_C(1))) % yy__pool_tpool->yy__pool_queue_size);
+    while (true)
+    {
+        if (yy__pool_tpool->yy__pool_count == yy__pool_tpool->yy__pool_queue_size)
+        {
+            yy__pool_err = yy__pool_ERROR_QUEUE_FULL;
+            break;
+        }
+        if (yy__pool_tpool->yy__pool_shutdown != yy__pool_NO_SHUTDOWN)
+        {
+            yy__pool_err = yy__pool_ERROR_SHUTDOWN;
+            break;
+        }
+        yy__pool_tpool->yy__pool_queue[yy__pool_tpool->yy__pool_tail].e1 = yy__pool_func;
+        yy__pool_tpool->yy__pool_queue[yy__pool_tpool->yy__pool_tail].e2 = yy__pool_arg;
+        yy__pool_tpool->yy__pool_tail = yy__pool_next;
+        yy__pool_tpool->yy__pool_count += INT32_C(1);
+        if (yy__condition_signal((&(yy__pool_tpool->yy__pool_notify))) != yy__thread_SUCCESS)
+        {
+            yy__pool_err = yy__pool_ERROR_LOCK_FAILURE;
+        }
+        break;
+    }
+    if (yy__mutex_unlock((&(yy__pool_tpool->yy__pool_lock))) != yy__thread_SUCCESS)
+    {
+        yy__pool_err = yy__pool_ERROR_LOCK_FAILURE;
+    }
+    int32_t t__7 = yy__pool_err;
+    return t__7;
+}
+int32_t yy__pool_destroy(struct yy__pool_ThreadPool* yy__pool_tpool, bool yy__pool_graceful) 
+{
+    if (yy__pool_tpool == NULL)
+    {
+        int32_t const  t__8 = yy__pool_ERROR_INVALID;
+        return t__8;
+    }
+    if (yy__mutex_lock((&(yy__pool_tpool->yy__pool_lock))) != yy__thread_SUCCESS)
+    {
+        int32_t const  t__9 = yy__pool_ERROR_LOCK_FAILURE;
+        return t__9;
+    }
+    int32_t yy__pool_err = yy__pool_SUCCESS;
+    while (true)
+    {
+        if (yy__pool_tpool->yy__pool_shutdown != yy__pool_NO_SHUTDOWN)
+        {
+            yy__pool_err = yy__pool_ERROR_SHUTDOWN;
+            break;
+        }
+        yy__pool_tpool->yy__pool_shutdown = (yy__pool_graceful ? yy__pool_GRACEFUL_SHUTDOWN : yy__pool_IMMEDIATE_SHUTDOWN);
+        if ((yy__condition_broadcast((&(yy__pool_tpool->yy__pool_notify))) != yy__thread_SUCCESS) || (yy__mutex_unlock((&(yy__pool_tpool->yy__pool_lock))) != yy__thread_SUCCESS))
+        {
+            yy__pool_err = yy__pool_ERROR_LOCK_FAILURE;
+            break;
+        }
+        int32_t yy__pool_i = INT32_C(0);
+        while (true)
+        {
+            if (!(yy__pool_i < yy__pool_tpool->yy__pool_thread_count))
+            {
+                break;
+            }
+            bool yy__pool_ok = (yy__thread_join(yy__pool_tpool->yy__pool_threads[yy__pool_i]) == yy__thread_SUCCESS);
+            if (!yy__pool_ok)
+            {
+                yy__pool_err = yy__pool_ERROR_THREAD_FAILURE;
+            }
+            yy__pool_i += INT32_C(1);
+        }
+        break;
+    }
+    if (yy__pool_err == yy__pool_SUCCESS)
+    {
+        yy__pool_internal_del_pool(yy__pool_tpool);
+    }
+    int32_t t__10 = yy__pool_err;
+    return t__10;
+}
+int32_t yy__pool_internal_del_pool(struct yy__pool_ThreadPool* yy__pool_tpool) 
+{
+    if ((yy__pool_tpool == NULL) || (yy__pool_tpool->yy__pool_started > INT32_C(0)))
+    {
+        int32_t const  t__11 = yy__pool_ERROR_INVALID;
+        return t__11;
+    }
+    if ((yy__pool_tpool->yy__pool_threads != NULL) || (yy__pool_tpool->yy__pool_queue != NULL))
+    {
+        yk__arrfree(yy__pool_tpool->yy__pool_threads);
+        yk__arrfree(yy__pool_tpool->yy__pool_queue);
+        yy__mutex_lock((&(yy__pool_tpool->yy__pool_lock)));
+        yy__mutex_unlock((&(yy__pool_tpool->yy__pool_lock)));
+        yy__mutex_destroy((&(yy__pool_tpool->yy__pool_lock)));
+        yy__condition_destroy((&(yy__pool_tpool->yy__pool_notify)));
+    }
+    yk__obj_free(yy__pool_tpool);
+    int32_t const  t__12 = yy__pool_SUCCESS;
+    return t__12;
+}
+int32_t yy__pool_internal_tpool_work(void* yy__pool_tpool_obj) 
+{
+    struct yy__pool_ThreadPool* yy__pool_tpool = ((struct yy__pool_ThreadPool*)yy__pool_tpool_obj);
+    struct yt_tuple_fn_in_any_ptr_out_any_ptr yy__pool_task;
+    while (true)
+    {
+        yy__mutex_lock((&(yy__pool_tpool->yy__pool_lock)));
+        while (true)
+        {
+            if (!((((yy__pool_tpool->yy__pool_count == INT32_C(0)) && (yy__pool_tpool->yy__pool_shutdown == yy__pool_NO_SHUTDOWN)))))
+            {
+                break;
+            }
+            yy__condition_wait((&(yy__pool_tpool->yy__pool_notify)), (&(yy__pool_tpool->yy__pool_lock)));
+        }
+        if ((((yy__pool_tpool->yy__pool_shutdown == yy__pool_GRACEFUL_SHUTDOWN) && (yy__pool_tpool->yy__pool_count == INT32_C(0)))) || (yy__pool_tpool->yy__pool_shutdown == yy__pool_IMMEDIATE_SHUTDOWN))
+        {
+            break;
+        }
+        yy__pool_task.e1 = yy__pool_tpool->yy__pool_queue[yy__pool_tpool->yy__pool_head].e1;
+        yy__pool_task.e2 = yy__pool_tpool->yy__pool_queue[yy__pool_tpool->yy__pool_head].e2;
+        yy__pool_tpool->yy__pool_head = (((yy__pool_tpool->yy__pool_head + INT32_C(1))) % yy__pool_tpool->yy__pool_queue_size);
+        yy__pool_tpool->yy__pool_count -= INT32_C(1);
+        yy__mutex_unlock((&(yy__pool_tpool->yy__pool_lock)));
+        yt_fn_in_any_ptr_out yy__pool_fnc = yy__pool_task.e1;
+        yy__pool_fnc(yy__pool_task.e2);
+    }
+    yy__pool_tpool->yy__pool_started -= INT32_C(1);
+    yy__mutex_unlock((&(yy__pool_tpool->yy__pool_lock)));
+    yy__thread_exit(INT32_C(0));
     return INT32_C(0);
 }
+yy__cpu_Cpu yy__cpu_info() { return yk__get_cpu_count(); }
 void yy__configuration_find_runtime_path(struct yy__configuration_Config* yy__configuration_c) 
 {
     yk__sds t__0 = yy__os_exe_path();
@@ -2319,7 +3684,7 @@ void yy__configuration_find_w4(struct yy__configuration_Config* yy__configuratio
 }
 struct yy__configuration_Project* yy__configuration_load_project(yy__toml_Table yy__configuration_conf, struct yy__configuration_Config* yy__configuration_c) 
 {
-    struct yy__configuration_Project* yy__configuration_p = calloc(1, sizeof(struct yy__configuration_Project));
+    struct yy__configuration_Project* yy__configuration_p = yk__obj_alloc(struct yy__configuration_Project);
     yy__toml_Table yy__configuration_project = yy__toml_get_table(yy__configuration_conf, yk__bstr_s("project", 7));
     if (!(yy__toml_valid_table(yy__configuration_project)))
     {
@@ -2359,7 +3724,7 @@ struct yy__configuration_Project* yy__configuration_load_project(yy__toml_Table
 }
 struct yy__configuration_CCode* yy__configuration_load_c_code(yy__toml_Table yy__configuration_conf, struct yy__configuration_Config* yy__configuration_c) 
 {
-    struct yy__configuration_CCode* yy__configuration_cc = calloc(1, sizeof(struct yy__configuration_CCode));
+    struct yy__configuration_CCode* yy__configuration_cc = yk__obj_alloc(struct yy__configuration_CCode);
     yy__toml_Table yy__configuration_cc_data = yy__toml_get_table(yy__configuration_conf, yk__bstr_s("ccode", 5));
     if (!(yy__toml_valid_table(yy__configuration_cc_data)))
     {
@@ -2376,60 +3741,79 @@ struct yy__configuration_CCode* yy__configuration_load_c_code(yy__toml_Table yy_
     struct yy__configuration_CCode* t__49 = yy__configuration_cc;
     return t__49;
 }
+bool yy__configuration_valid_profile(yk__sds yy__configuration_profile) 
+{
+    bool t__50 = ((((yk__cmp_sds_bstr(yy__configuration_profile, yy__configuration_PROFILE_SIZE) == 0) || (yk__cmp_sds_bstr(yy__configuration_profile, yy__configuration_PROFILE_SPEED) == 0)) || (yk__cmp_sds_bstr(yy__configuration_profile, yy__configuration_PROFILE_NATIVE) == 0)) || (yk__cmp_sds_bstr(yy__configuration_profile, yy__configuration_PROFILE_PGO) == 0));
+    yk__sdsfree(yy__configuration_profile);
+    return t__50;
+}
 struct yy__configuration_Compilation* yy__configuration_load_compilation(yy__toml_Table yy__configuration_conf, struct yy__configuration_Config* yy__configuration_c) 
 {
-    struct yy__configuration_Compilation* yy__configuration_co = calloc(1, sizeof(struct yy__configuration_Compilation));
+    struct yy__configuration_Compilation* yy__configuration_co = yk__obj_alloc(struct yy__configuration_Compilation);
+    yy__configuration_co->yy__configuration_profile = yk__bstr_copy_to_sds(yy__configuration_PROFILE_SIZE);
     yy__toml_Table yy__configuration_co_data = yy__toml_get_table(yy__configuration_conf, yk__bstr_s("compilation", 11));
     if (!(yy__toml_valid_table(yy__configuration_co_data)))
     {
-        struct yy__configuration_Compilation* t__50 = yy__configuration_co;
-        return t__50;
+        struct yy__configuration_Compilation* t__51 = yy__configuration_co;
+        return t__51;
     }
     yy__configuration_co->yy__configuration_targets = yy__toml_get_string_array(yy__configuration_co_data, yk__bstr_s("targets", 7));
     yy__configuration_co->yy__configuration_raylib = yy__toml_get_bool_default(yy__configuration_co_data, yk__bstr_s("raylib", 6), false);
     yy__configuration_co->yy__configuration_raylib_hot_reloading_dll = yy__toml_get_bool_default(yy__configuration_co_data, yk__bstr_s("raylib_hot_reloading_dll", 24), false);
     yy__configuration_co->yy__configuration_disable_parallel_build = yy__toml_get_bool_default(yy__configuration_co_data, yk__bstr_s("disable_parallel_build", 22), false);
+    yy__configuration_co->yy__configuration_c_units = yy__toml_get_int_default(yy__configuration_co_data, yk__bstr_s("c_units", 7), INT32_C(0));
+    yy__configuration_co->yy__configuration_jobs = yy__toml_get_int_default(yy__configuration_co_data, yk__bstr_s("jobs", 4), INT32_C(0));
+    yk__sdsfree(yy__configuration_co->yy__configuration_profile);
+    yk__sds t__52 = yy__toml_get_string_default(yy__configuration_co_data, yk__bstr_s("profile", 7), yy__configuration_PROFILE_SIZE);
+    yy__configuration_co->yy__configuration_profile = yk__sdsdup(t__52);
+    if (!(yy__configuration_valid_profile(yk__sdsdup(yy__configuration_co->yy__configuration_profile))))
+    {
+        yk__arrput(yy__configuration_c->yy__configuration_errors, yk__sdsnewlen("Invalid [compilation].profile, use one of size, speed, native or pgo", 68));
+    }
+    yy__configuration_co->yy__configuration_pgo_train = yy__toml_get_string_array(yy__configuration_co_data, yk__bstr_s("pgo_train", 9));
+    yy__configuration_co->yy__configuration_slab_alloc = yy__toml_get_bool_default(yy__configuration_co_data, yk__bstr_s("slab_alloc", 10), false);
     yy__configuration_co->yy__configuration_web = yy__toml_get_bool_default(yy__configuration_co_data, yk__bstr_s("web", 3), false);
     yy__configuration_co->yy__configuration_wasm4 = yy__toml_get_bool_default(yy__configuration_co_data, yk__bstr_s("wasm4", 5), false);
-    yk__sds t__51 = yy__toml_get_string(yy__configuration_co_data, yk__bstr_s("web_shell", 9));
-    yy__configuration_co->yy__configuration_web_shell = yk__sdsdup(t__51);
-    yk__sds t__52 = yy__toml_get_string(yy__configuration_co_data, yk__bstr_s("web_assets", 10));
-    yy__configuration_co->yy__configuration_web_assets = yk__sdsdup(t__52);
-    struct yy__configuration_Compilation* t__53 = yy__configuration_co;
+    yk__sds t__53 = yy__toml_get_string(yy__configuration_co_data, yk__bstr_s("web_shell", 9));
+    yy__configuration_co->yy__configuration_web_shell = yk__sdsdup(t__53);
+    yk__sds t__54 = yy__toml_get_string(yy__configuration_co_data, yk__bstr_s("web_assets", 10));
+    yy__configuration_co->yy__configuration_web_assets = yk__sdsdup(t__54);
+    struct yy__configuration_Compilation* t__55 = yy__configuration_co;
+    yk__sdsfree(t__54);
+    yk__sdsfree(t__53);
     yk__sdsfree(t__52);
-    yk__sdsfree(t__51);
-    return t__53;
+    return t__55;
 }
 struct yy__configuration_CCode* yy__configuration_inject_c_code_defaults(struct yy__configuration_CCode* yy__configuration_cc, struct yy__configuration_Config* yy__configuration_c) 
 {
-    yk__sds t__54 = yy__os_cwd();
-    yk__sds t__55 = yy__path_dirname(yk__sdsdup(t__54));
-    yk__sds yy__configuration_current_dir = yk__sdsdup(t__55);
-    yk__sds t__56 = yy__path_join(yk__bstr_h(yy__configuration_current_dir), yk__bstr_s("build", 5));
-    yk__sds* t__57 = NULL;
-    yk__arrsetcap(t__57, 2);
-    yk__arrput(t__57, yk__sdsdup(yy__configuration_c->yy__configuration_runtime_path));
-    yk__arrput(t__57, yk__sdsdup(t__56));
-    yk__sds* yy__configuration_df_include_paths = t__57;
+    yk__sds t__56 = yy__os_cwd();
+    yk__sds t__57 = yy__path_dirname(yk__sdsdup(t__56));
+    yk__sds yy__configuration_current_dir = yk__sdsdup(t__57);
+    yk__sds t__58 = yy__path_join(yk__bstr_h(yy__configuration_current_dir), yk__bstr_s("build", 5));
+    yk__sds* t__59 = NULL;
+    yk__arrsetcap(t__59, 2);
+    yk__arrput(t__59, yk__sdsdup(yy__configuration_c->yy__configuration_runtime_path));
+    yk__arrput(t__59, yk__sdsdup(t__58));
+    yk__sds* yy__configuration_df_include_paths = t__59;
     yk__sds* yy__configuration_orig_include_paths = yy__configuration_cc->yy__configuration_include_paths;
     yy__configuration_cc->yy__configuration_include_paths = yy__array_extend(yy__configuration_df_include_paths, yy__configuration_cc->yy__configuration_include_paths);
-    yk__sds* t__58 = NULL;
-    yk__arrsetcap(t__58, 1);
-    yk__arrput(t__58, yk__sdsnewlen("yk__system.h", 12));
-    yy__configuration_cc->yy__configuration_runtime_feature_includes = t__58;
-    yk__sds t__59 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__system.c", 12));
     yk__sds* t__60 = NULL;
     yk__arrsetcap(t__60, 1);
-    yk__arrput(t__60, yk__sdsdup(t__59));
-    yy__configuration_cc->yy__configuration_runtime_feature_c_code = t__60;
-    struct yy__configuration_CCode* t__61 = yy__configuration_cc;
+    yk__arrput(t__60, yk__sdsnewlen("yk__system.h", 12));
+    yy__configuration_cc->yy__configuration_runtime_feature_includes = t__60;
+    yk__sds t__61 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__system.c", 12));
+    yk__sds* t__62 = NULL;
+    yk__arrsetcap(t__62, 1);
+    yk__arrput(t__62, yk__sdsdup(t__61));
+    yy__configuration_cc->yy__configuration_runtime_feature_c_code = t__62;
+    struct yy__configuration_CCode* t__63 = yy__configuration_cc;
     yy__array_del_str_array(yy__configuration_orig_include_paths);
-    yk__sdsfree(t__59);
-    yk__sdsfree(t__56);
+    yk__sdsfree(t__61);
+    yk__sdsfree(t__58);
     yk__sdsfree(yy__configuration_current_dir);
-    yk__sdsfree(t__55);
-    yk__sdsfree(t__54);
-    return t__61;
+    yk__sdsfree(t__57);
+    yk__sdsfree(t__56);
+    return t__63;
 }
 struct yy__configuration_Config* yy__configuration_load_runtime_features(struct yy__configuration_Config* yy__configuration_c, yk__sds yy__configuration_code, bool yy__configuration_silent) 
 {
@@ -2444,22 +3828,22 @@ struct yy__configuration_Config* yy__configuration_load_runtime_features(struct
             yy__console_green(yk__bstr_s("none!", 5));
             yk__printstr("\n");
         }
-        struct yy__configuration_Config* t__62 = yy__configuration_c;
+        struct yy__configuration_Config* t__64 = yy__configuration_c;
         yk__sdsfree(yy__configuration_header);
         yk__sdsfree(yy__configuration_code);
-        return t__62;
+        return t__64;
     }
     int32_t yy__configuration_until = yy__strings_find_char(yk__bstr_h(yy__configuration_code), yy__strings_ord(yk__bstr_s("#", 1)));
     if (yy__configuration_until == INT32_C(-1))
     {
         yk__arrput(yy__configuration_c->yy__configuration_errors, yk__sdsnewlen("Failed to extract runtime features. Cannot find # in compiled code first line.", 78));
-        struct yy__configuration_Config* t__63 = yy__configuration_c;
+        struct yy__configuration_Config* t__65 = yy__configuration_c;
         yk__sdsfree(yy__configuration_header);
         yk__sdsfree(yy__configuration_code);
-        return t__63;
+        return t__65;
     }
-    yk__sds t__64 = yy__strings_mid(yk__bstr_h(yy__configuration_code), yk__sdslen(yy__configuration_header), (yy__configuration_until - yk__sdslen(yy__configuration_header)));
-    yk__sds yy__configuration_temp_features = yk__sdsdup(t__64);
+    yk__sds t__66 = yy__strings_mid(yk__bstr_h(yy__configuration_code), yk__sdslen(yy__configuration_header), (yy__configuration_until - yk__sdslen(yy__configuration_header)));
+    yk__sds yy__configuration_temp_features = yk__sdsdup(t__66);
     if (!yy__configuration_silent)
     {
         yy__console_cyan(yk__bstr_s("runtime_features", 16));
@@ -2482,89 +3866,126 @@ struct yy__configuration_Config* yy__configuration_load_runtime_features(struct
         {
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("wasm4.h", 7));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("yk__wasm4_libc.h", 16));
-            yk__sds t__65 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__wasm4_libc.c", 16));
-            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__65));
+            yk__sds t__67 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__wasm4_libc.c", 16));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__67));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_compiler_defines, yk__sdsnewlen("YK__WASM4", 9));
             if (!(yy__configuration_c->yy__configuration_compilation->yy__configuration_wasm4))
             {
                 yk__arrput(yy__configuration_c->yy__configuration_errors, yk__sdsnewlen("wasm4 feature used without configuring it", 41));
             }
-            yk__sdsfree(t__65);
+            yk__sdsfree(t__67);
+            yk__sdsfree(yy__configuration_feature);
+            continue;
+            yk__sdsfree(t__67);
+        }
+        if (yk__cmp_sds_lit(yy__configuration_feature, "arena", 5) == 0)
+        {
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_compiler_defines, yk__sdsnewlen("YK__ARENA_ALLOC", 15));
             yk__sdsfree(yy__configuration_feature);
             continue;
-            yk__sdsfree(t__65);
         }
         if (yk__cmp_sds_lit(yy__configuration_feature, "argparse", 8) == 0)
         {
-            yk__sds t__66 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__argparse.c", 14));
-            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__66));
-            yk__sds t__67 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("argparse.c", 10));
-            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__67));
+            yk__sds t__68 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__argparse.c", 14));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__68));
+            yk__sds t__69 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("argparse.c", 10));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__69));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("yk__argparse.h", 14));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("argparse.h", 10));
-            yk__sdsfree(t__67);
-            yk__sdsfree(t__66);
+            yk__sdsfree(t__69);
+            yk__sdsfree(t__68);
             yk__sdsfree(yy__configuration_feature);
             continue;
-            yk__sdsfree(t__67);
-            yk__sdsfree(t__66);
+            yk__sdsfree(t__69);
+            yk__sdsfree(t__68);
         }
         if (yk__cmp_sds_lit(yy__configuration_feature, "arrayutils", 10) == 0)
         {
-            yk__sds t__68 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__arrayutils.c", 16));
-            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__68));
+            yk__sds t__70 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__arrayutils.c", 16));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__70));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("yk__arrayutils.h", 16));
-            yk__sdsfree(t__68);
+            yk__sdsfree(t__70);
             yk__sdsfree(yy__configuration_feature);
             continue;
-            yk__sdsfree(t__68);
+            yk__sdsfree(t__70);
+        }
+        if (yk__cmp_sds_lit(yy__configuration_feature, "containers", 10) == 0)
+        {
+            yk__sds t__71 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__containers.c", 16));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__71));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("yk__containers.h", 16));
+            yk__sdsfree(t__71);
+            yk__sdsfree(yy__configuration_feature);
+            continue;
+            yk__sdsfree(t__71);
+        }
+        if (yk__cmp_sds_lit(yy__configuration_feature, "csv", 3) == 0)
+        {
+            yk__sds t__72 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__csv.c", 9));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__72));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("yk__csv.h", 9));
+            yk__sdsfree(t__72);
+            yk__sdsfree(yy__configuration_feature);
+            continue;
+            yk__sdsfree(t__72);
         }
         if (yk__cmp_sds_lit(yy__configuration_feature, "console", 7) == 0)
         {
-            yk__sds t__69 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__console.c", 13));
-            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__69));
+            yk__sds t__73 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__console.c", 13));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__73));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("yk__console.h", 13));
-            yk__sdsfree(t__69);
+            yk__sdsfree(t__73);
             yk__sdsfree(yy__configuration_feature);
             continue;
-            yk__sdsfree(t__69);
+            yk__sdsfree(t__73);
         }
         if (yk__cmp_sds_lit(yy__configuration_feature, "graphicutils", 12) == 0)
         {
-            yk__sds t__70 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__graphic_utils.c", 19));
-            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__70));
+            yk__sds t__74 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__graphic_utils.c", 19));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__74));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("yk__graphic_utils.h", 19));
-            yk__sdsfree(t__70);
+            yk__sdsfree(t__74);
             yk__sdsfree(yy__configuration_feature);
             continue;
-            yk__sdsfree(t__70);
+            yk__sdsfree(t__74);
         }
         if (yk__cmp_sds_lit(yy__configuration_feature, "ini", 3) == 0)
         {
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_defines, yk__sdsnewlen("INI_IMPLEMENTATION", 18));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_implementations, yk__sdsnewlen("ini.h", 5));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("ini.h", 5));
             yk__sdsfree(yy__configuration_feature);
             continue;
         }
+        if (yk__cmp_sds_lit(yy__configuration_feature, "json", 4) == 0)
+        {
+            yk__sds t__75 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__json.c", 10));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__75));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("yk__json.h", 10));
+            yk__sdsfree(t__75);
+            yk__sdsfree(yy__configuration_feature);
+            continue;
+            yk__sdsfree(t__75);
+        }
         if (yk__cmp_sds_lit(yy__configuration_feature, "process", 7) == 0)
         {
-            yk__sds t__71 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__process.c", 13));
-            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__71));
+            yk__sds t__76 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__process.c", 13));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__76));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("yk__process.h", 13));
-            yk__sdsfree(t__71);
+            yk__sdsfree(t__76);
             yk__sdsfree(yy__configuration_feature);
             continue;
-            yk__sdsfree(t__71);
+            yk__sdsfree(t__76);
         }
         if (yk__cmp_sds_lit(yy__configuration_feature, "cpu", 3) == 0)
         {
-            yk__sds t__72 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__cpu.c", 9));
-            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__72));
+            yk__sds t__77 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__cpu.c", 9));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__77));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("yk__cpu.h", 9));
-            yk__sdsfree(t__72);
+            yk__sdsfree(t__77);
             yk__sdsfree(yy__configuration_feature);
             continue;
-            yk__sdsfree(t__72);
+            yk__sdsfree(t__77);
         }
         if (yk__cmp_sds_lit(yy__configuration_feature, "raylib", 6) == 0)
         {
@@ -2577,216 +3998,220 @@ struct yy__configuration_Config* yy__configuration_load_runtime_features(struct
         }
         if (yk__cmp_sds_lit(yy__configuration_feature, "tinycthread", 11) == 0)
         {
-            yk__sds t__73 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("tinycthread.c", 13));
-            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__73));
+            yk__sds t__78 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("tinycthread.c", 13));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__78));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("tinycthread.h", 13));
-            yk__sdsfree(t__73);
+            yk__sdsfree(t__78);
             yk__sdsfree(yy__configuration_feature);
             continue;
-            yk__sdsfree(t__73);
+            yk__sdsfree(t__78);
         }
         if (yk__cmp_sds_lit(yy__configuration_feature, "toml", 4) == 0)
         {
-            yk__sds t__74 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("toml.c", 6));
-            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__74));
+            yk__sds t__79 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("toml.c", 6));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__79));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("toml.h", 6));
-            yk__sdsfree(t__74);
+            yk__sdsfree(t__79);
             yk__sdsfree(yy__configuration_feature);
             continue;
-            yk__sdsfree(t__74);
+            yk__sdsfree(t__79);
         }
         if (yk__cmp_sds_lit(yy__configuration_feature, "utf8proc", 8) == 0)
         {
-            yk__sds t__75 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("utf8proc.c", 10));
-            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__75));
+            yk__sds t__80 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("utf8proc.c", 10));
+            yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__80));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_compiler_defines, yk__sdsnewlen("UTF8PROC_STATIC", 15));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("utf8proc.h", 10));
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("yk__utf8iter.h", 14));
-            yk__sdsfree(t__75);
+            yk__sdsfree(t__80);
             yk__sdsfree(yy__configuration_feature);
             continue;
-            yk__sdsfree(t__75);
+            yk__sdsfree(t__80);
         }
         if (yk__cmp_sds_lit(yy__configuration_feature, "whereami", 8) == 0)
         {
             if (yy__configuration_c->yy__configuration_compilation->yy__configuration_web)
             {
-                yk__sds t__76 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__fake_whereami.c", 19));
-                yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__76));
-                yk__sdsfree(t__76);
+                yk__sds t__81 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("yk__fake_whereami.c", 19));
+                yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__81));
+                yk__sdsfree(t__81);
             }
             else
             {
-                yk__sds t__77 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("whereami.c", 10));
-                yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__77));
-                yk__sdsfree(t__77);
+                yk__sds t__82 = yy__path_join(yk__bstr_h(yy__configuration_c->yy__configuration_runtime_path), yk__bstr_s("whereami.c", 10));
+                yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code, yk__sdsdup(t__82));
+                yk__sdsfree(t__82);
             }
             yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes, yk__sdsnewlen("whereami.h", 10));
             yk__sdsfree(yy__configuration_feature);
             continue;
         }
-        yk__sds t__78 = yk__concat_lit_sds("Invalid runtime feature: ", 25, yy__configuration_feature);
-        yk__arrput(yy__configuration_c->yy__configuration_errors, yk__sdsdup(t__78));
-        yk__sdsfree(t__78);
+        yk__sds t__83 = yk__concat_lit_sds("Invalid runtime feature: ", 25, yy__configuration_feature);
+        yk__arrput(yy__configuration_c->yy__configuration_errors, yk__sdsdup(t__83));
+        yk__sdsfree(t__83);
         yk__sdsfree(yy__configuration_feature);
         break;
-        yk__sdsfree(t__78);
+        yk__sdsfree(t__83);
         yk__sdsfree(yy__configuration_feature);
     }
-    struct yy__configuration_Config* t__79 = yy__configuration_c;
+    if (yy__configuration_c->yy__configuration_compilation->yy__configuration_slab_alloc)
+    {
+        yk__arrput(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_compiler_defines, yk__sdsnewlen("YK__SLAB_ALLOC", 14));
+    }
+    struct yy__configuration_Config* t__84 = yy__configuration_c;
     yy__array_del_str_array(yy__configuration_features);
     yk__sdsfree(yy__configuration_temp_features);
-    yk__sdsfree(t__64);
+    yk__sdsfree(t__66);
     yk__sdsfree(yy__configuration_header);
     yk__sdsfree(yy__configuration_code);
-    return t__79;
+    return t__84;
 }
 struct yy__configuration_Config* yy__configuration_load_config() 
 {
-    struct yy__configuration_Config* yy__configuration_c = calloc(1, sizeof(struct yy__configuration_Config));
-    yk__sds t__80 = yy__os_cwd();
-    yk__sds t__81 = yy__path_join(yk__bstr_h(t__80), yk__bstr_s("yaksha.toml", 11));
-    yk__sds yy__configuration_configf = yk__sdsdup(t__81);
-    yk__sds t__82 = yy__io_readfile(yk__bstr_h(yy__configuration_configf));
-    yk__sds yy__configuration_config_text = yk__sdsdup(t__82);
+    struct yy__configuration_Config* yy__configuration_c = yk__obj_alloc(struct yy__configuration_Config);
+    yk__sds t__85 = yy__os_cwd();
+    yk__sds t__86 = yy__path_join(yk__bstr_h(t__85), yk__bstr_s("yaksha.toml", 11));
+    yk__sds yy__configuration_configf = yk__sdsdup(t__86);
+    yk__sds t__87 = yy__io_readfile(yk__bstr_h(yy__configuration_configf));
+    yk__sds yy__configuration_config_text = yk__sdsdup(t__87);
     yy__toml_Table yy__configuration_conf = yy__toml_from_str(yk__bstr_h(yy__configuration_config_text));
     if (!(yy__toml_valid_table(yy__configuration_conf)))
     {
         yk__arrput(yy__configuration_c->yy__configuration_errors, yk__sdsnewlen("Failed to read config file", 26));
-        struct yy__configuration_Config* t__83 = yy__configuration_c;
+        struct yy__configuration_Config* t__88 = yy__configuration_c;
         yk__sdsfree(yy__configuration_config_text);
-        yk__sdsfree(t__82);
+        yk__sdsfree(t__87);
         yk__sdsfree(yy__configuration_configf);
-        yk__sdsfree(t__81);
-        yk__sdsfree(t__80);
-        return t__83;
+        yk__sdsfree(t__86);
+        yk__sdsfree(t__85);
+        return t__88;
     }
     yy__configuration_c->yy__configuration_compilation = yy__configuration_load_compilation(yy__configuration_conf, yy__configuration_c);
     yy__configuration_find_yaksha_compiler(yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__84 = yy__configuration_c;
+        struct yy__configuration_Config* t__89 = yy__configuration_c;
         yy__toml_del_table(yy__configuration_conf);
         yk__sdsfree(yy__configuration_config_text);
-        yk__sdsfree(t__82);
+        yk__sdsfree(t__87);
         yk__sdsfree(yy__configuration_configf);
-        yk__sdsfree(t__81);
-        yk__sdsfree(t__80);
-        return t__84;
+        yk__sdsfree(t__86);
+        yk__sdsfree(t__85);
+        return t__89;
     }
     yy__configuration_find_zig_compiler(yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__85 = yy__configuration_c;
+        struct yy__configuration_Config* t__90 = yy__configuration_c;
         yy__toml_del_table(yy__configuration_conf);
         yk__sdsfree(yy__configuration_config_text);
-        yk__sdsfree(t__82);
+        yk__sdsfree(t__87);
         yk__sdsfree(yy__configuration_configf);
-        yk__sdsfree(t__81);
-        yk__sdsfree(t__80);
-        return t__85;
+        yk__sdsfree(t__86);
+        yk__sdsfree(t__85);
+        return t__90;
     }
     yy__configuration_find_emsdk(yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__86 = yy__configuration_c;
+        struct yy__configuration_Config* t__91 = yy__configuration_c;
         yy__toml_del_table(yy__configuration_conf);
         yk__sdsfree(yy__configuration_config_text);
-        yk__sdsfree(t__82);
+        yk__sdsfree(t__87);
         yk__sdsfree(yy__configuration_configf);
-        yk__sdsfree(t__81);
-        yk__sdsfree(t__80);
-        return t__86;
+        yk__sdsfree(t__86);
+        yk__sdsfree(t__85);
+        return t__91;
     }
     yy__configuration_find_w4(yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__87 = yy__configuration_c;
+        struct yy__configuration_Config* t__92 = yy__configuration_c;
         yy__toml_del_table(yy__configuration_conf);
         yk__sdsfree(yy__configuration_config_text);
-        yk__sdsfree(t__82);
+        yk__sdsfree(t__87);
         yk__sdsfree(yy__configuration_configf);
-        yk__sdsfree(t__81);
-        yk__sdsfree(t__80);
-        return t__87;
+        yk__sdsfree(t__86);
+        yk__sdsfree(t__85);
+        return t__92;
     }
     yy__configuration_find_runtime_path(yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__88 = yy__configuration_c;
+        struct yy__configuration_Config* t__93 = yy__configuration_c;
         yy__toml_del_table(yy__configuration_conf);
         yk__sdsfree(yy__configuration_config_text);
-        yk__sdsfree(t__82);
+        yk__sdsfree(t__87);
         yk__sdsfree(yy__configuration_configf);
-        yk__sdsfree(t__81);
-        yk__sdsfree(t__80);
-        return t__88;
+        yk__sdsfree(t__86);
+        yk__sdsfree(t__85);
+        return t__93;
     }
     yy__configuration_find_libs_path(yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__89 = yy__configuration_c;
+        struct yy__configuration_Config* t__94 = yy__configuration_c;
         yy__toml_del_table(yy__configuration_conf);
         yk__sdsfree(yy__configuration_config_text);
-        yk__sdsfree(t__82);
+        yk__sdsfree(t__87);
         yk__sdsfree(yy__configuration_configf);
-        yk__sdsfree(t__81);
-        yk__sdsfree(t__80);
-        return t__89;
+        yk__sdsfree(t__86);
+        yk__sdsfree(t__85);
+        return t__94;
     }
     yy__configuration_c->yy__configuration_project = yy__configuration_load_project(yy__configuration_conf, yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__90 = yy__configuration_c;
+        struct yy__configuration_Config* t__95 = yy__configuration_c;
         yy__toml_del_table(yy__configuration_conf);
         yk__sdsfree(yy__configuration_config_text);
-        yk__sdsfree(t__82);
+        yk__sdsfree(t__87);
         yk__sdsfree(yy__configuration_configf);
-        yk__sdsfree(t__81);
-        yk__sdsfree(t__80);
-        return t__90;
+        yk__sdsfree(t__86);
+        yk__sdsfree(t__85);
+        return t__95;
     }
     if (!(yy__path_exists(yk__sdsdup(yy__configuration_c->yy__configuration_project->yy__configuration_main))))
     {
         yk__arrput(yy__configuration_c->yy__configuration_errors, yk__sdsnewlen("Project main file not found", 27));
-        struct yy__configuration_Config* t__91 = yy__configuration_c;
+        struct yy__configuration_Config* t__96 = yy__configuration_c;
         yy__toml_del_table(yy__configuration_conf);
         yk__sdsfree(yy__configuration_config_text);
-        yk__sdsfree(t__82);
+        yk__sdsfree(t__87);
         yk__sdsfree(yy__configuration_configf);
-        yk__sdsfree(t__81);
-        yk__sdsfree(t__80);
-        return t__91;
+        yk__sdsfree(t__86);
+        yk__sdsfree(t__85);
+        return t__96;
     }
     yy__configuration_c->yy__configuration_c_code = yy__configuration_inject_c_code_defaults(yy__configuration_load_c_code(yy__configuration_conf, yy__configuration_c), yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__92 = yy__configuration_c;
+        struct yy__configuration_Config* t__97 = yy__configuration_c;
         yy__toml_del_table(yy__configuration_conf);
         yk__sdsfree(yy__configuration_config_text);
-        yk__sdsfree(t__82);
+        yk__sdsfree(t__87);
         yk__sdsfree(yy__configuration_configf);
-        yk__sdsfree(t__81);
-        yk__sdsfree(t__80);
-        return t__92;
+        yk__sdsfree(t__86);
+        yk__sdsfree(t__85);
+        return t__97;
     }
-    struct yy__configuration_Config* t__93 = yy__configuration_c;
+    struct yy__configuration_Config* t__98 = yy__configuration_c;
     yy__toml_del_table(yy__configuration_conf);
     yk__sdsfree(yy__configuration_config_text);
-    yk__sdsfree(t__82);
+    yk__sdsfree(t__87);
     yk__sdsfree(yy__configuration_configf);
-    yk__sdsfree(t__81);
-    yk__sdsfree(t__80);
-    return t__93;
+    yk__sdsfree(t__86);
+    yk__sdsfree(t__85);
+    return t__98;
 }
 struct yy__configuration_Config* yy__configuration_create_adhoc_config(yk__sds yy__configuration_name, yk__sds yy__configuration_file_path, bool yy__configuration_use_raylib, bool yy__configuration_use_web, bool yy__configuration_wasm4, yk__sds yy__configuration_web_shell, yk__sds yy__configuration_web_assets, bool yy__configuration_crdll, bool yy__configuration_no_parallel) 
 {
-    struct yy__configuration_Config* yy__configuration_c = calloc(1, sizeof(struct yy__configuration_Config));
-    yy__configuration_c->yy__configuration_compilation = calloc(1, sizeof(struct yy__configuration_Compilation));
-    yk__sds* t__94 = NULL;
-    yk__arrsetcap(t__94, 1);
-    yk__arrput(t__94, yk__sdsnewlen("native", 6));
-    yy__configuration_c->yy__configuration_compilation->yy__configuration_targets = t__94;
+    struct yy__configuration_Config* yy__configuration_c = yk__obj_alloc(struct yy__configuration_Config);
+    yy__configuration_c->yy__configuration_compilation = yk__obj_alloc(struct yy__configuration_Compilation);
+    yk__sds* t__99 = NULL;
+    yk__arrsetcap(t__99, 1);
+    yk__arrput(t__99, yk__sdsnewlen("native", 6));
+    yy__configuration_c->yy__configuration_compilation->yy__configuration_targets = t__99;
     yy__configuration_c->yy__configuration_compilation->yy__configuration_raylib = yy__configuration_use_raylib;
     yy__configuration_c->yy__configuration_compilation->yy__configuration_raylib_hot_reloading_dll = yy__configuration_crdll;
     yy__configuration_c->yy__configuration_compilation->yy__configuration_web = yy__configuration_use_web;
@@ -2794,86 +4219,103 @@ struct yy__configuration_Config* yy__configuration_create_adhoc_config(yk__sds y
     yy__configuration_c->yy__configuration_compilation->yy__configuration_web_assets = yk__sdsdup(yy__configuration_web_assets);
     yy__configuration_c->yy__configuration_compilation->yy__configuration_wasm4 = yy__configuration_wasm4;
     yy__configuration_c->yy__configuration_compilation->yy__configuration_disable_parallel_build = yy__configuration_no_parallel;
+    yy__configuration_c->yy__configuration_compilation->yy__configuration_c_units = INT32_C(0);
+    yy__configuration_c->yy__configuration_compilation->yy__configuration_jobs = INT32_C(0);
+    yy__configuration_c->yy__configuration_compilation->yy__configuration_profile = yk__bstr_copy_to_sds(yy__configuration_PROFILE_SIZE);
+    yy__configuration_c->yy__configuration_compilation->yy__configuration_slab_alloc = false;
     yy__configuration_find_yaksha_compiler(yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__95 = yy__configuration_c;
+        struct yy__configuration_Config* t__100 = yy__configuration_c;
         yk__sdsfree(yy__configuration_web_assets);
         yk__sdsfree(yy__configuration_web_shell);
         yk__sdsfree(yy__configuration_file_path);
         yk__sdsfree(yy__configuration_name);
-        return t__95;
+        return t__100;
     }
     yy__configuration_find_zig_compiler(yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__96 = yy__configuration_c;
+        struct yy__configuration_Config* t__101 = yy__configuration_c;
         yk__sdsfree(yy__configuration_web_assets);
         yk__sdsfree(yy__configuration_web_shell);
         yk__sdsfree(yy__configuration_file_path);
         yk__sdsfree(yy__configuration_name);
-        return t__96;
+        return t__101;
     }
     yy__configuration_find_emsdk(yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__97 = yy__configuration_c;
+        struct yy__configuration_Config* t__102 = yy__configuration_c;
         yk__sdsfree(yy__configuration_web_assets);
         yk__sdsfree(yy__configuration_web_shell);
         yk__sdsfree(yy__configuration_file_path);
         yk__sdsfree(yy__configuration_name);
-        return t__97;
+        return t__102;
     }
     yy__configuration_find_w4(yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__98 = yy__configuration_c;
+        struct yy__configuration_Config* t__103 = yy__configuration_c;
         yk__sdsfree(yy__configuration_web_assets);
         yk__sdsfree(yy__configuration_web_shell);
         yk__sdsfree(yy__configuration_file_path);
         yk__sdsfree(yy__configuration_name);
-        return t__98;
+        return t__103;
     }
     yy__configuration_find_runtime_path(yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__99 = yy__configuration_c;
+        struct yy__configuration_Config* t__104 = yy__configuration_c;
         yk__sdsfree(yy__configuration_web_assets);
         yk__sdsfree(yy__configuration_web_shell);
         yk__sdsfree(yy__configuration_file_path);
         yk__sdsfree(yy__configuration_name);
-        return t__99;
+        return t__104;
     }
     yy__configuration_find_libs_path(yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__100 = yy__configuration_c;
+        struct yy__configuration_Config* t__105 = yy__configuration_c;
         yk__sdsfree(yy__configuration_web_assets);
         yk__sdsfree(yy__configuration_web_shell);
         yk__sdsfree(yy__configuration_file_path);
         yk__sdsfree(yy__configuration_name);
-        return t__100;
+        return t__105;
     }
-    yy__configuration_c->yy__configuration_project = calloc(1, sizeof(struct yy__configuration_Project));
+    yy__configuration_c->yy__configuration_project = yk__obj_alloc(struct yy__configuration_Project);
     yy__configuration_c->yy__configuration_project->yy__configuration_main = yk__sdsdup(yy__configuration_file_path);
     yy__configuration_c->yy__configuration_project->yy__configuration_author = yk__sdsnewlen("unknown", 7);
     yy__configuration_c->yy__configuration_project->yy__configuration_name = yk__sdsdup(yy__configuration_name);
-    yy__configuration_c->yy__configuration_c_code = yy__configuration_inject_c_code_defaults(calloc(1, sizeof(struct yy__configuration_CCode)), yy__configuration_c);
+    yy__configuration_c->yy__configuration_c_code = yy__configuration_inject_c_code_defaults(yk__obj_alloc(struct yy__configuration_CCode), yy__configuration_c);
     if (yk__arrlen(yy__configuration_c->yy__configuration_errors) > INT32_C(0))
     {
-        struct yy__configuration_Config* t__101 = yy__configuration_c;
+        struct yy__configuration_Config* t__106 = yy__configuration_c;
         yk__sdsfree(yy__configuration_web_assets);
         yk__sdsfree(yy__configuration_web_shell);
         yk__sdsfree(yy__configuration_file_path);
         yk__sdsfree(yy__configuration_name);
-        return t__101;
+        return t__106;
     }
-    struct yy__configuration_Config* t__102 = yy__configuration_c;
+    struct yy__configuration_Config* t__107 = yy__configuration_c;
     yk__sdsfree(yy__configuration_web_assets);
     yk__sdsfree(yy__configuration_web_shell);
     yk__sdsfree(yy__configuration_file_path);
     yk__sdsfree(yy__configuration_name);
-    return t__102;
+    return t__107;
+}
+uint8_t yy__configuration_job_count(struct yy__configuration_Config* yy__configuration_c) 
+{
+    int32_t yy__configuration_jobs = yy__configuration_c->yy__configuration_compilation->yy__configuration_jobs;
+    if (yy__configuration_jobs <= INT32_C(0))
+    {
+        yy__cpu_Cpu yy__configuration_cpu_data = yy__cpu_info();
+        yy__configuration_jobs = yy__configuration_cpu_data.n_processors;
+    }
+    yy__configuration_jobs = ((yy__configuration_jobs > ((int32_t)yy__pool_MAX_THREAD_SIZE)) ? ((int32_t)yy__pool_MAX_THREAD_SIZE) : yy__configuration_jobs);
+    yy__configuration_jobs = ((yy__configuration_jobs < INT32_C(1)) ? INT32_C(1) : yy__configuration_jobs);
+    uint8_t t__108 = ((uint8_t)yy__configuration_jobs);
+    return t__108;
 }
 void yy__configuration_del_config(struct yy__configuration_Config* yy__configuration_c) 
 {
@@ -2887,6 +4329,7 @@ void yy__configuration_del_config(struct yy__configuration_Config* yy__configura
         yy__array_del_str_array(yy__configuration_c->yy__configuration_c_code->yy__configuration_c_code);
         yy__array_del_str_array(yy__configuration_c->yy__configuration_c_code->yy__configuration_cpp_code);
         yy__array_del_str_array(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_defines);
+        yy__array_del_str_array(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_implementations);
         yy__array_del_str_array(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_includes);
         yy__array_del_str_array(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_c_code);
         yy__array_del_str_array(yy__configuration_c->yy__configuration_c_code->yy__configuration_runtime_feature_compiler_defines);
@@ -2895,6 +4338,8 @@ void yy__configuration_del_config(struct yy__configuration_Config* yy__configura
     if (yy__configuration_c->yy__configuration_compilation != NULL)
     {
         yy__array_del_str_array(yy__configuration_c->yy__configuration_compilation->yy__configuration_targets);
+        yy__array_del_str_array(yy__configuration_c->yy__configuration_compilation->yy__configuration_pgo_train);
+        yk__sdsfree(yy__configuration_c->yy__configuration_compilation->yy__configuration_profile);
         yk__sdsfree(yy__configuration_c->yy__configuration_compilation->yy__configuration_libc);
         yk__sdsfree(yy__configuration_c->yy__configuration_compilation->yy__configuration_compiler);
         yk__sdsfree(yy__configuration_c->yy__configuration_compilation->yy__configuration_web_shell);
@@ -2906,9 +4351,9 @@ void yy__configuration_del_config(struct yy__configuration_Config* yy__configura
         yk__sdsfree(yy__configuration_c->yy__configuration_project->yy__configuration_name);
         yk__sdsfree(yy__configuration_c->yy__configuration_project->yy__configuration_author);
     }
-    free(yy__configuration_c->yy__configuration_c_code);
-    free(yy__configuration_c->yy__configuration_project);
-    free(yy__configuration_c->yy__configuration_compilation);
+    yk__obj_free(yy__configuration_c->yy__configuration_c_code);
+    yk__obj_free(yy__configuration_c->yy__configuration_project);
+    yk__obj_free(yy__configuration_c->yy__configuration_compilation);
     yk__sdsfree(yy__configuration_c->yy__configuration_runtime_path);
     yk__sdsfree(yy__configuration_c->yy__configuration_compiler_path);
     yk__sdsfree(yy__configuration_c->yy__configuration_libs_path);
@@ -2918,7 +4363,7 @@ void yy__configuration_del_config(struct yy__configuration_Config* yy__configura
     yk__sdsfree(yy__configuration_c->yy__configuration_clang_compiler_path);
     yk__sdsfree(yy__configuration_c->yy__configuration_emrun_path);
     yk__sdsfree(yy__configuration_c->yy__configuration_w4_path);
-    free(yy__configuration_c);
+    yk__obj_free(yy__configuration_c);
     return;
 }
 yy__argparse_ArgParseWrapper yy__argparse_new_ex(yy__argparse_Option* nn__options, yk__sds* nn__usages, int32_t nn__flag) { return yk__newargparse(nn__options, nn__usages, nn__flag); }
@@ -2943,6 +4388,12 @@ yy__argparse_Option yy__argparse_opt_string(yk__sds nn__short, yk__sds nn__large
     yk__sdsfree(nn__short);
     return o;
 }
+yy__argparse_Option yy__argparse_opt_integer(yk__sds nn__short, yk__sds nn__large, int32_t* nn__result, yk__sds nn__help) 
+{
+    struct argparse_option o = ((struct argparse_option) OPT_INTEGER(nn__short[0], nn__large, nn__result, nn__help, NULL, 0, 0));
+    yk__sdsfree(nn__short);
+    return o;
+}
 yy__argparse_Option yy__argparse_opt_end() 
 {
     return (struct argparse_option) OPT_END();
@@ -2994,6 +4445,12 @@ void yy__console_cyan(struct yk__bstr yy__console_x)
     yy__console_color_print(INT32_C(7), yy__console_x);
     return;
 }
+int32_t yy__numbers_s2i(yk__sds yy__numbers_s) 
+{
+    int32_t t__0 = yy__numbers_cstr2i(((yy__c_CStr)yy__numbers_s));
+    yk__sdsfree(yy__numbers_s);
+    return t__0;
+}
 yk__sds yy__io_readfile(struct yk__bstr nn__fname) { return yk__io_readfile(nn__fname); }
 bool yy__io_writefile(struct yk__bstr nn__fname, struct yk__bstr nn__data) { return yk__io_writefile(nn__fname, nn__data); }
 yy__toml_Table yy__toml_from_str(struct yk__bstr nn__x) 
@@ -3027,6 +4484,16 @@ yk__sds yy__toml_get_string(yy__toml_Table nn__x, struct yk__bstr nn__name)
     }
     return yk__sdsempty();
 }
+yk__sds yy__toml_get_string_default(yy__toml_Table nn__x, struct yk__bstr nn__name, struct yk__bstr nn__default) 
+{
+    toml_datum_t v = toml_string_in(nn__x, yk__bstr_get_reference(nn__name));
+    if (v.ok) {
+        yk__sds s = yk__sdsnew(v.u.s);
+        free(v.u.s);
+        return s;
+    }
+    return yk__bstr_copy_to_sds(nn__default);
+}
 bool yy__toml_get_bool_default(yy__toml_Table nn__x, struct yk__bstr nn__name, bool nn__default) 
 {
     toml_datum_t v = toml_bool_in(nn__x, yk__bstr_get_reference(nn__name));
@@ -3035,6 +4502,14 @@ bool yy__toml_get_bool_default(yy__toml_Table nn__x, struct yk__bstr nn__name, b
     }
     return nn__default;
 }
+int32_t yy__toml_get_int_default(yy__toml_Table nn__x, struct yk__bstr nn__name, int32_t nn__default) 
+{
+    toml_datum_t v = toml_int_in(nn__x, yk__bstr_get_reference(nn__name));
+    if (v.ok) {
+        return v.u.i;
+    }
+    return nn__default;
+}
 yk__sds yy__toml_string_at(yy__toml_TomlArray nn__x, int32_t nn__pos) 
 {
     toml_datum_t v = toml_string_at(nn__x, nn__pos);
@@ -3310,7 +4785,7 @@ yk__sds* yy__strings_split(struct yk__bstr nn__value, struct yk__bstr nn__sep)
     for (int i = 0; i < count; i++) {
         yk__arrput(newarr, result[i]);
     }
-    free(result); // free array itself.
+    yk__sds_free(result); // free array itself.
     return newarr;
 }
 int32_t yy__strings_find_char(struct yk__bstr nn__value, int32_t nn__ch) 
@@ -3747,32 +5222,81 @@ void yy__print_config(struct yy__configuration_Config* yy__config)
     yy__printkv(yk__sdsnewlen("w4", 2), yk__sdsdup(yy__config->yy__configuration_w4_path));
     yk__sds t__1 = yy__libs_version();
     yy__printkv(yk__sdsnewlen("standard library version", 24), yk__sdsdup(t__1));
+    yy__printkv(yk__sdsnewlen("profile", 7), yk__sdsdup(yy__config->yy__configuration_compilation->yy__configuration_profile));
+    if (yy__config->yy__configuration_compilation->yy__configuration_slab_alloc)
+    {
+        yy__printkv(yk__sdsnewlen("slab allocator", 14), yk__sdsnewlen("enabled", 7));
+    }
     yk__sdsfree(t__1);
     return;
 }
+int32_t yy__build_in_process(struct yy__configuration_Config* yy__config, bool yy__simple, bool yy__silent) 
+{
+    int32_t yy__units = INT32_C(0);
+    if (!yy__simple && (yy__config->yy__configuration_compilation->yy__configuration_c_units > INT32_C(0)))
+    {
+        yy__units = yy__config->yy__configuration_compilation->yy__configuration_c_units;
+    }
+    yy__in_process_Compilation yy__comp = yy__in_process_compile(yk__sdsdup(yy__config->yy__configuration_project->yy__configuration_main), yk__sdsdup(yy__config->yy__configuration_libs_path), yy__units);
+    if (yy__comp == NULL)
+    {
+        yy__console_red(yk__bstr_s("Failed to compile: ", 19));
+        yy__console_yellow(yk__bstr_h(yy__config->yy__configuration_project->yy__configuration_main));
+        yk__printstr("\n");
+        return INT32_C(-1);
+    }
+    yk__sds t__2 = yy__in_process_header(yy__comp);
+    yk__sds yy__header = yk__sdsdup(t__2);
+    if (yy__simple)
+    {
+        int32_t t__3 = yy__building_build_simple(yy__config, yk__sdsdup(yy__header), yy__comp, yy__silent);
+        yy__in_process_del_compilation(yy__comp);
+        yk__sdsfree(yy__header);
+        yk__sdsfree(t__2);
+        return t__3;
+    }
+    int32_t t__4 = yy__building_build(yy__config, yk__sdsdup(yy__header), yy__comp);
+    yy__in_process_del_compilation(yy__comp);
+    yk__sdsfree(yy__header);
+    yk__sdsfree(t__2);
+    return t__4;
+}
 int32_t yy__build_from_config(struct yy__configuration_Config* yy__config, bool yy__simple, bool yy__silent) 
 {
+    if (yy__in_process_available())
+    {
+        int32_t t__5 = yy__build_in_process(yy__config, yy__simple, yy__silent);
+        return t__5;
+    }
     int32_t yy__return_val = INT32_C(0);
-    yk__sds* t__2 = NULL;
-    yk__arrsetcap(t__2, 4);
-    yk__arrput(t__2, yk__sdsdup(yy__config->yy__configuration_compiler_path));
-    yk__arrput(t__2, yk__sdsnewlen("compile", 7));
-    yk__arrput(t__2, yk__sdsdup(yy__config->yy__configuration_project->yy__configuration_main));
-    yk__arrput(t__2, yk__sdsdup(yy__config->yy__configuration_libs_path));
-    yk__sds* yy__yk_args = t__2;
+    yy__in_process_Compilation yy__no_comp = NULL;
+    yk__sds* t__6 = NULL;
+    yk__arrsetcap(t__6, 4);
+    yk__arrput(t__6, yk__sdsdup(yy__config->yy__configuration_compiler_path));
+    yk__arrput(t__6, yk__sdsnewlen("compile", 7));
+    yk__arrput(t__6, yk__sdsdup(yy__config->yy__configuration_project->yy__configuration_main));
+    yk__arrput(t__6, yk__sdsdup(yy__config->yy__configuration_libs_path));
+    yk__sds* yy__yk_args = t__6;
+    if (!yy__simple && (yy__config->yy__configuration_compilation->yy__configuration_c_units > INT32_C(0)))
+    {
+        yk__arrput(yy__yk_args, yk__sdsnewlen("--units", 7));
+        yk__sds t__7 = yy__numbers_i2s(yy__config->yy__configuration_compilation->yy__configuration_c_units);
+        yk__arrput(yy__yk_args, yk__sdsdup(t__7));
+        yk__sdsfree(t__7);
+    }
     yy__os_ProcessResult yy__result = yy__os_run(yy__yk_args);
     if (!(yy__result->ok))
     {
         yy__console_cyan(yk__bstr_s("---- running Yaksha compiler ---\n", 33));
         yy__console_red(yk__bstr_s("Failed to execute: ", 19));
-        yk__sds t__3 = yy__array_join(yy__yk_args, yk__sdsnewlen(" ", 1));
-        yy__console_yellow(yk__bstr_h(t__3));
+        yk__sds t__8 = yy__array_join(yy__yk_args, yk__sdsnewlen(" ", 1));
+        yy__console_yellow(yk__bstr_h(t__8));
         yk__printstr("\n");
         yy__console_red(yk__bstr_h(yy__result->output));
         yk__printstr("\n");
         yy__return_val = INT32_C(-1);
         yy__console_cyan(yk__bstr_s("---- end of compiler run ---\n", 29));
-        yk__sdsfree(t__3);
+        yk__sdsfree(t__8);
     }
     else
     {
@@ -3780,11 +5304,11 @@ int32_t yy__build_from_config(struct yy__configuration_Config* yy__config, bool
         {
             if (yy__simple)
             {
-                yy__return_val = yy__building_build_simple(yy__config, yk__sdsdup(yy__result->output), yy__silent);
+                yy__return_val = yy__building_build_simple(yy__config, yk__sdsdup(yy__result->output), yy__no_comp, yy__silent);
             }
             else
             {
-                yy__return_val = yy__building_build(yy__config, yk__sdsdup(yy__result->output));
+                yy__return_val = yy__building_build(yy__config, yk__sdsdup(yy__result->output), yy__no_comp);
             }
         }
         else
@@ -3796,31 +5320,42 @@ int32_t yy__build_from_config(struct yy__configuration_Config* yy__config, bool
             yy__console_cyan(yk__bstr_s("---- end of compiler run ---\n", 29));
         }
     }
-    int32_t t__4 = yy__return_val;
+    int32_t t__9 = yy__return_val;
     yy__os_del_process_result(yy__result);
     yy__array_del_str_array(yy__yk_args);
-    return t__4;
+    return t__9;
 }
-int32_t yy__perform_build() 
+int32_t yy__perform_build(int32_t yy__jobs, yk__sds yy__profile) 
 {
     struct yy__configuration_Config* yy__config = yy__configuration_load_config();
     if (yk__arrlen(yy__config->yy__configuration_errors) > INT32_C(0))
     {
         yy__print_errors(yy__config->yy__configuration_errors);
         yy__configuration_del_config(yy__config);
+        yk__sdsfree(yy__profile);
         return INT32_C(-1);
     }
+    if (yy__jobs > INT32_C(0))
+    {
+        yy__config->yy__configuration_compilation->yy__configuration_jobs = yy__jobs;
+    }
+    if (yk__sdslen(yy__profile) > INT32_C(0))
+    {
+        yk__sdsfree(yy__config->yy__configuration_compilation->yy__configuration_profile);
+        yy__config->yy__configuration_compilation->yy__configuration_profile = yk__sdsdup(yy__profile);
+    }
     yy__print_config(yy__config);
     int32_t yy__ret = yy__build_from_config(yy__config, false, false);
-    int32_t t__5 = yy__ret;
+    int32_t t__10 = yy__ret;
     yy__configuration_del_config(yy__config);
-    return t__5;
+    yk__sdsfree(yy__profile);
+    return t__10;
 }
-int32_t yy__perform_mini_build(yk__sds yy__filename, bool yy__use_raylib, bool yy__use_web, bool yy__wasm4, yk__sds yy__web_shell, yk__sds yy__asset_path, bool yy__silent, bool yy__actually_run, bool yy__crdll, bool yy__no_parallel, int32_t yy__comp) 
+int32_t yy__perform_mini_build(yk__sds yy__filename, bool yy__use_raylib, bool yy__use_web, bool yy__wasm4, yk__sds yy__web_shell, yk__sds yy__asset_path, bool yy__silent, bool yy__actually_run, bool yy__crdll, bool yy__no_parallel, int32_t yy__comp, int32_t yy__jobs, yk__sds yy__profile) 
 {
-    yk__sds t__6 = yy__path_basename(yk__sdsdup(yy__filename));
-    yk__sds t__7 = yy__path_remove_extension(yk__sdsdup(t__6));
-    yk__sds yy__name = yk__sdsdup(t__7);
+    yk__sds t__11 = yy__path_basename(yk__sdsdup(yy__filename));
+    yk__sds t__12 = yy__path_remove_extension(yk__sdsdup(t__11));
+    yk__sds yy__name = yk__sdsdup(t__12);
     struct yy__configuration_Config* yy__config = yy__configuration_create_adhoc_config(yk__sdsdup(yy__name), yk__sdsdup(yy__filename), yy__use_raylib, yy__use_web, yy__wasm4, yk__sdsdup(yy__web_shell), yk__sdsdup(yy__asset_path), yy__crdll, yy__no_parallel);
     if (yy__comp == 0)
     {
@@ -3830,8 +5365,9 @@ int32_t yy__perform_mini_build(yk__sds yy__filename, bool yy__use_raylib, bool y
         {
             yk__printlnstr("GCC compiler not found.");
             yk__sdsfree(yy__name);
-            yk__sdsfree(t__7);
-            yk__sdsfree(t__6);
+            yk__sdsfree(t__12);
+            yk__sdsfree(t__11);
+            yk__sdsfree(yy__profile);
             yk__sdsfree(yy__asset_path);
             yk__sdsfree(yy__web_shell);
             yk__sdsfree(yy__filename);
@@ -3848,8 +5384,9 @@ int32_t yy__perform_mini_build(yk__sds yy__filename, bool yy__use_raylib, bool y
             {
                 yk__printlnstr("Clang compiler not found.");
                 yk__sdsfree(yy__name);
-                yk__sdsfree(t__7);
-                yk__sdsfree(t__6);
+                yk__sdsfree(t__12);
+                yk__sdsfree(t__11);
+                yk__sdsfree(yy__profile);
                 yk__sdsfree(yy__asset_path);
                 yk__sdsfree(yy__web_shell);
                 yk__sdsfree(yy__filename);
@@ -3862,13 +5399,23 @@ int32_t yy__perform_mini_build(yk__sds yy__filename, bool yy__use_raylib, bool y
         yy__print_errors(yy__config->yy__configuration_errors);
         yy__configuration_del_config(yy__config);
         yk__sdsfree(yy__name);
-        yk__sdsfree(t__7);
-        yk__sdsfree(t__6);
+        yk__sdsfree(t__12);
+        yk__sdsfree(t__11);
+        yk__sdsfree(yy__profile);
         yk__sdsfree(yy__asset_path);
         yk__sdsfree(yy__web_shell);
         yk__sdsfree(yy__filename);
         return INT32_C(-1);
     }
+    if (yy__jobs > INT32_C(0))
+    {
+        yy__config->yy__configuration_compilation->yy__configuration_jobs = yy__jobs;
+    }
+    if (yk__sdslen(yy__profile) > INT32_C(0))
+    {
+        yk__sdsfree(yy__config->yy__configuration_compilation->yy__configuration_profile);
+        yy__config->yy__configuration_compilation->yy__configuration_profile = yk__sdsdup(yy__profile);
+    }
     if (!yy__silent)
     {
         yy__print_config(yy__config);
@@ -3876,22 +5423,24 @@ int32_t yy__perform_mini_build(yk__sds yy__filename, bool yy__use_raylib, bool y
     int32_t yy__ret = yy__build_from_config(yy__config, true, yy__silent);
     if (yy__ret != INT32_C(0))
     {
-        int32_t t__8 = yy__ret;
+        int32_t t__13 = yy__ret;
         yy__configuration_del_config(yy__config);
         yk__sdsfree(yy__name);
-        yk__sdsfree(t__7);
-        yk__sdsfree(t__6);
+        yk__sdsfree(t__12);
+        yk__sdsfree(t__11);
+        yk__sdsfree(yy__profile);
         yk__sdsfree(yy__asset_path);
         yk__sdsfree(yy__web_shell);
         yk__sdsfree(yy__filename);
-        return t__8;
+        return t__13;
     }
     if (!yy__actually_run)
     {
         yy__configuration_del_config(yy__config);
         yk__sdsfree(yy__name);
-        yk__sdsfree(t__7);
-        yk__sdsfree(t__6);
+        yk__sdsfree(t__12);
+        yk__sdsfree(t__11);
+        yk__sdsfree(yy__profile);
         yk__sdsfree(yy__asset_path);
         yk__sdsfree(yy__web_shell);
         yk__sdsfree(yy__filename);
@@ -3905,60 +5454,60 @@ int32_t yy__perform_mini_build(yk__sds yy__filename, bool yy__use_raylib, bool y
     yk__sds yy__binary = yk__sdsdup(yy__name);
     if (yy__use_web)
     {
-        yk__sds t__9 = yk__concat_sds_lit(yy__binary, ".html", 5);
+        yk__sds t__14 = yk__concat_sds_lit(yy__binary, ".html", 5);
         yk__sdsfree(yy__binary);
-        yy__binary = yk__sdsdup(t__9);
-        yk__sds t__10 = yy__os_cwd();
-        yk__sds t__11 = yy__path_join(yk__bstr_h(t__10), yk__bstr_h(yy__binary));
-        yk__sds* t__12 = NULL;
-        yk__arrsetcap(t__12, 2);
-        yk__arrput(t__12, yk__sdsdup(yy__config->yy__configuration_emrun_path));
-        yk__arrput(t__12, yk__sdsdup(t__11));
-        yk__sds* yy__em_args = t__12;
+        yy__binary = yk__sdsdup(t__14);
+        yk__sds t__15 = yy__os_cwd();
+        yk__sds t__16 = yy__path_join(yk__bstr_h(t__15), yk__bstr_h(yy__binary));
+        yk__sds* t__17 = NULL;
+        yk__arrsetcap(t__17, 2);
+        yk__arrput(t__17, yk__sdsdup(yy__config->yy__configuration_emrun_path));
+        yk__arrput(t__17, yk__sdsdup(t__16));
+        yk__sds* yy__em_args = t__17;
         yy__os_ProcessResult yy__r = yy__os_run(yy__em_args);
         yy__array_del_str_array(yy__em_args);
         yy__os_del_process_result(yy__r);
-        yk__sdsfree(t__11);
-        yk__sdsfree(t__10);
-        yk__sdsfree(t__9);
+        yk__sdsfree(t__16);
+        yk__sdsfree(t__15);
+        yk__sdsfree(t__14);
     }
     else
     {
         if (yy__wasm4)
         {
-            yk__sds t__13 = yk__concat_sds_lit(yy__binary, ".wasm", 5);
+            yk__sds t__18 = yk__concat_sds_lit(yy__binary, ".wasm", 5);
             yk__sdsfree(yy__binary);
-            yy__binary = yk__sdsdup(t__13);
-            yk__sds t__14 = yy__os_cwd();
-            yk__sds t__15 = yy__path_join(yk__bstr_h(t__14), yk__bstr_h(yy__binary));
-            yk__sds* t__16 = NULL;
-            yk__arrsetcap(t__16, 3);
-            yk__arrput(t__16, yk__sdsdup(yy__config->yy__configuration_w4_path));
-            yk__arrput(t__16, yk__sdsnewlen("run-native", 10));
-            yk__arrput(t__16, yk__sdsdup(t__15));
-            yk__sds* yy__em_args = t__16;
+            yy__binary = yk__sdsdup(t__18);
+            yk__sds t__19 = yy__os_cwd();
+            yk__sds t__20 = yy__path_join(yk__bstr_h(t__19), yk__bstr_h(yy__binary));
+            yk__sds* t__21 = NULL;
+            yk__arrsetcap(t__21, 3);
+            yk__arrput(t__21, yk__sdsdup(yy__config->yy__configuration_w4_path));
+            yk__arrput(t__21, yk__sdsnewlen("run-native", 10));
+            yk__arrput(t__21, yk__sdsdup(t__20));
+            yk__sds* yy__em_args = t__21;
             yy__os_ProcessResult yy__r = yy__os_run(yy__em_args);
             yy__array_del_str_array(yy__em_args);
             yy__os_del_process_result(yy__r);
-            yk__sdsfree(t__15);
-            yk__sdsfree(t__14);
-            yk__sdsfree(t__13);
+            yk__sdsfree(t__20);
+            yk__sdsfree(t__19);
+            yk__sdsfree(t__18);
         }
         else
         {
             if (yy__os_is_windows())
             {
-                yk__sds t__17 = yk__concat_sds_lit(yy__binary, ".exe", 4);
+                yk__sds t__22 = yk__concat_sds_lit(yy__binary, ".exe", 4);
                 yk__sdsfree(yy__binary);
-                yy__binary = yk__sdsdup(t__17);
-                yk__sdsfree(t__17);
+                yy__binary = yk__sdsdup(t__22);
+                yk__sdsfree(t__22);
             }
             else
             {
-                yk__sds t__18 = yk__concat_lit_sds("./", 2, yy__binary);
+                yk__sds t__23 = yk__concat_lit_sds("./", 2, yy__binary);
                 yk__sdsfree(yy__binary);
-                yy__binary = yk__sdsdup(t__18);
-                yk__sdsfree(t__18);
+                yy__binary = yk__sdsdup(t__23);
+                yk__sdsfree(t__23);
             }
             yy__c_CStr yy__binary_cstr = yy__strings_to_cstr(yk__sdsdup(yy__binary));
             yy__c_system(yy__binary_cstr);
@@ -3968,8 +5517,9 @@ int32_t yy__perform_mini_build(yk__sds yy__filename, bool yy__use_raylib, bool y
     yy__configuration_del_config(yy__config);
     yk__sdsfree(yy__binary);
     yk__sdsfree(yy__name);
-    yk__sdsfree(t__7);
-    yk__sdsfree(t__6);
+    yk__sdsfree(t__12);
+    yk__sdsfree(t__11);
+    yk__sdsfree(yy__profile);
     yk__sdsfree(yy__asset_path);
     yk__sdsfree(yy__web_shell);
     yk__sdsfree(yy__filename);
@@ -3979,11 +5529,12 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
 {
     yk__sds* yy__arguments = yy__array_dup(yy__args->argv);
     yy__argparse_Option* yy__options = NULL;
-    yk__sds* t__19 = NULL;
-    yk__arrsetcap(t__19, 2);
-    yk__arrput(t__19, yk__sdsnewlen("carpntr", 7));
-    yk__arrput(t__19, yk__sdsnewlen("carpntr [options] file", 22));
-    yk__sds* yy__usages = t__19;
+    yk__sds* t__24 = NULL;
+    yk__arrsetcap(t__24, 3);
+    yk__arrput(t__24, yk__sdsnewlen("carpntr", 7));
+    yk__arrput(t__24, yk__sdsnewlen("carpntr [options] file", 22));
+    yk__arrput(t__24, yk__sdsnewlen("carpntr [-j N] [-p profile]", 27));
+    yk__sds* yy__usages = t__24;
     int32_t yy__help = INT32_C(0);
     int32_t yy__run = INT32_C(0);
     int32_t yy__just_compile = INT32_C(0);
@@ -3996,6 +5547,9 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
     int32_t yy__use_gcc = INT32_C(0);
     int32_t yy__use_clang = INT32_C(0);
     int32_t yy__use_zig = INT32_C(0);
+    int32_t yy__jobs = INT32_C(0);
+    yy__c_CStr yy__profile_cstr = yy__strings_null_cstr();
+    yk__sds yy__profile = yk__sdsnewlen("" , 0);
     yy__c_CStr yy__file_path = yy__strings_null_cstr();
     yy__c_CStr yy__assets_path = yy__strings_null_cstr();
     yk__sds yy__web_shell = yk__sdsnewlen("" , 0);
@@ -4011,6 +5565,8 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
     yk__arrput(yy__options, yy__argparse_opt_boolean(yk__sdsnewlen("4", 1), yk__sdsnewlen("wasm4", 5), (&(yy__wasm4)), yk__sdsnewlen("wasm4 build", 11)));
     yk__arrput(yy__options, yy__argparse_opt_boolean(yk__sdsnewlen("S", 1), yk__sdsnewlen("silent", 6), (&(yy__silent_mode)), yk__sdsnewlen("do not print anything except errors", 35)));
     yk__arrput(yy__options, yy__argparse_opt_boolean(yk__sdsnewlen("N", 1), yk__sdsnewlen("nothread", 8), (&(yy__no_parallel)), yk__sdsnewlen("no parallel build & disable optimization (for debugging)", 56)));
+    yk__arrput(yy__options, yy__argparse_opt_integer(yk__sdsnewlen("j", 1), yk__sdsnewlen("jobs", 4), (&(yy__jobs)), yk__sdsnewlen("number of parallel jobs (default: number of cpus)", 49)));
+    yk__arrput(yy__options, yy__argparse_opt_string(yk__sdsnewlen("p", 1), yk__sdsnewlen("profile", 7), (&(yy__profile_cstr)), yk__sdsnewlen("optimization profile: size (default), speed, native or pgo", 58)));
     yk__arrput(yy__options, yy__argparse_opt_boolean(yk__sdsnewlen("\0", 1), yk__sdsnewlen("gcc", 3), (&(yy__use_gcc)), yk__sdsnewlen("use gcc", 7)));
     yk__arrput(yy__options, yy__argparse_opt_boolean(yk__sdsnewlen("\0", 1), yk__sdsnewlen("clang", 5), (&(yy__use_clang)), yk__sdsnewlen("use clang", 9)));
     yk__arrput(yy__options, yy__argparse_opt_boolean(yk__sdsnewlen("\0", 1), yk__sdsnewlen("zig", 3), (&(yy__use_zig)), yk__sdsnewlen("use zig (this is the default behavior)", 38)));
@@ -4032,8 +5588,59 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
         yy__array_del_str_array(yy__arguments);
         yk__sdsfree(yy__assets_path_s);
         yk__sdsfree(yy__web_shell);
+        yk__sdsfree(yy__profile);
         return INT32_C(0);
     }
+    if (yy__jobs < INT32_C(0))
+    {
+        yk__printlnstr("Number of jobs must be a positive number");
+        yy__strings_del_cstr(yy__file_path);
+        yy__argparse_del_remainder(yy__remainder);
+        yy__argparse_del_argparse(yy__a);
+        yy__array_del_str_array(yy__usages);
+        yk__arrfree(yy__options);
+        yy__array_del_str_array(yy__arguments);
+        yk__sdsfree(yy__assets_path_s);
+        yk__sdsfree(yy__web_shell);
+        yk__sdsfree(yy__profile);
+        return INT32_C(1);
+    }
+    if (yy__strings_valid_cstr(yy__profile_cstr))
+    {
+        yk__sds t__25 = yy__strings_from_cstr(yy__profile_cstr);
+        yk__sdsfree(yy__profile);
+        yy__profile = yk__sdsdup(t__25);
+        if (!(yy__configuration_valid_profile(yk__sdsdup(yy__profile))))
+        {
+            yk__printlnstr("Invalid profile. Please use one of size, speed, native or pgo");
+            yy__strings_del_cstr(yy__file_path);
+            yy__argparse_del_remainder(yy__remainder);
+            yy__argparse_del_argparse(yy__a);
+            yy__array_del_str_array(yy__usages);
+            yk__arrfree(yy__options);
+            yy__array_del_str_array(yy__arguments);
+            yk__sdsfree(t__25);
+            yk__sdsfree(yy__assets_path_s);
+            yk__sdsfree(yy__web_shell);
+            yk__sdsfree(yy__profile);
+            return INT32_C(1);
+        }
+        yk__sdsfree(t__25);
+    }
+    if (((yy__remainder->argc == INT32_C(0)) && (yy__run != INT32_C(1))) && (yy__just_compile != INT32_C(1)))
+    {
+        int32_t t__26 = yy__perform_build(yy__jobs, yk__sdsdup(yy__profile));
+        yy__strings_del_cstr(yy__file_path);
+        yy__argparse_del_remainder(yy__remainder);
+        yy__argparse_del_argparse(yy__a);
+        yy__array_del_str_array(yy__usages);
+        yk__arrfree(yy__options);
+        yy__array_del_str_array(yy__arguments);
+        yk__sdsfree(yy__assets_path_s);
+        yk__sdsfree(yy__web_shell);
+        yk__sdsfree(yy__profile);
+        return t__26;
+    }
     if (yy__remainder->argc != INT32_C(1))
     {
         yk__printlnstr("One file must be preset for excution");
@@ -4045,6 +5652,7 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
         yy__array_del_str_array(yy__arguments);
         yk__sdsfree(yy__assets_path_s);
         yk__sdsfree(yy__web_shell);
+        yk__sdsfree(yy__profile);
         return INT32_C(1);
     }
     yk__sds yy__single_file = yk__sdsdup(yy__remainder->remainder[INT32_C(0)]);
@@ -4060,6 +5668,7 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
         yk__sdsfree(yy__single_file);
         yk__sdsfree(yy__assets_path_s);
         yk__sdsfree(yy__web_shell);
+        yk__sdsfree(yy__profile);
         return INT32_C(1);
     }
     int32_t yy__comp = 2;
@@ -4086,6 +5695,7 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
         yk__sdsfree(yy__single_file);
         yk__sdsfree(yy__assets_path_s);
         yk__sdsfree(yy__web_shell);
+        yk__sdsfree(yy__profile);
         return INT32_C(1);
     }
     if ((yy__web == INT32_C(1)) && (yy__raylib != INT32_C(1)))
@@ -4100,6 +5710,7 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
         yk__sdsfree(yy__single_file);
         yk__sdsfree(yy__assets_path_s);
         yk__sdsfree(yy__web_shell);
+        yk__sdsfree(yy__profile);
         return INT32_C(1);
     }
     if ((yy__web != INT32_C(1)) && yy__strings_valid_cstr(yy__file_path))
@@ -4114,6 +5725,7 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
         yk__sdsfree(yy__single_file);
         yk__sdsfree(yy__assets_path_s);
         yk__sdsfree(yy__web_shell);
+        yk__sdsfree(yy__profile);
         return INT32_C(1);
     }
     if ((yy__web != INT32_C(1)) && yy__strings_valid_cstr(yy__file_path))
@@ -4128,6 +5740,7 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
         yk__sdsfree(yy__single_file);
         yk__sdsfree(yy__assets_path_s);
         yk__sdsfree(yy__web_shell);
+        yk__sdsfree(yy__profile);
         return INT32_C(1);
     }
     if ((yy__run == INT32_C(1)) && (yy__crdll == INT32_C(1)))
@@ -4142,29 +5755,30 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
         yk__sdsfree(yy__single_file);
         yk__sdsfree(yy__assets_path_s);
         yk__sdsfree(yy__web_shell);
+        yk__sdsfree(yy__profile);
         return INT32_C(1);
     }
     if ((yy__run == INT32_C(1)) || (yy__just_compile == INT32_C(1)))
     {
         if (yy__strings_valid_cstr(yy__file_path))
         {
-            yk__sds t__20 = yy__strings_from_cstr(yy__file_path);
+            yk__sds t__27 = yy__strings_from_cstr(yy__file_path);
             yk__sdsfree(yy__web_shell);
-            yy__web_shell = yk__sdsdup(t__20);
+            yy__web_shell = yk__sdsdup(t__27);
             yk__printstr("Using web-shell:");
             yk__printlnstr(yy__web_shell);
-            yk__sdsfree(t__20);
+            yk__sdsfree(t__27);
         }
         if (yy__strings_valid_cstr(yy__assets_path))
         {
-            yk__sds t__21 = yy__strings_from_cstr(yy__assets_path);
+            yk__sds t__28 = yy__strings_from_cstr(yy__assets_path);
             yk__sdsfree(yy__assets_path_s);
-            yy__assets_path_s = yk__sdsdup(t__21);
+            yy__assets_path_s = yk__sdsdup(t__28);
             yk__printstr("Using asset-path:");
             yk__printlnstr(yy__assets_path_s);
-            yk__sdsfree(t__21);
+            yk__sdsfree(t__28);
         }
-        int32_t t__22 = yy__perform_mini_build(yk__sdsdup(yy__single_file), (yy__raylib == INT32_C(1)), (yy__web == INT32_C(1)), (yy__wasm4 == INT32_C(1)), yk__sdsdup(yy__web_shell), yk__sdsdup(yy__assets_path_s), (yy__silent_mode == INT32_C(1)), (yy__run == INT32_C(1)), (yy__crdll == INT32_C(1)), (yy__no_parallel == INT32_C(1)), yy__comp);
+        int32_t t__29 = yy__perform_mini_build(yk__sdsdup(yy__single_file), (yy__raylib == INT32_C(1)), (yy__web == INT32_C(1)), (yy__wasm4 == INT32_C(1)), yk__sdsdup(yy__web_shell), yk__sdsdup(yy__assets_path_s), (yy__silent_mode == INT32_C(1)), (yy__run == INT32_C(1)), (yy__crdll == INT32_C(1)), (yy__no_parallel == INT32_C(1)), yy__comp, yy__jobs, yk__sdsdup(yy__profile));
         yy__strings_del_cstr(yy__file_path);
         yy__argparse_del_remainder(yy__remainder);
         yy__argparse_del_argparse(yy__a);
@@ -4174,7 +5788,8 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
         yk__sdsfree(yy__single_file);
         yk__sdsfree(yy__assets_path_s);
         yk__sdsfree(yy__web_shell);
-        return t__22;
+        yk__sdsfree(yy__profile);
+        return t__29;
     }
     yy__console_red(yk__bstr_s("Invalid usage. Please use \'-R\' option if you want to run a program. Try \'carpntr --help\' for more information.\n", 111));
     yy__strings_del_cstr(yy__file_path);
@@ -4186,6 +5801,7 @@ int32_t yy__handle_args(yy__os_Arguments yy__args)
     yk__sdsfree(yy__single_file);
     yk__sdsfree(yy__assets_path_s);
     yk__sdsfree(yy__web_shell);
+    yk__sdsfree(yy__profile);
     return INT32_C(0);
 }
 int32_t yy__main() 
@@ -4194,11 +5810,11 @@ int32_t yy__main()
     if (yy__args->argc <= INT32_C(1))
     {
         yy__print_banner();
-        int32_t t__23 = yy__perform_build();
-        return t__23;
+        int32_t t__30 = yy__perform_build(INT32_C(0), yk__sdsnewlen("", 0));
+        return t__30;
     }
-    int32_t t__24 = yy__handle_args(yy__args);
-    return t__24;
+    int32_t t__31 = yy__handle_args(yy__args);
+    return t__31;
 }
 #if defined(YK__MINIMAL_MAIN)
 int main(void) { return yy__main(); }
@@ -1,8 +1,13 @@
 // ----- This file is to be directly included at the top of raylib game ---
-void *yk__raylib_game_state = (void *) 0;
+// Definitions are only added where YK__RAYEXTRAS_IMPLEMENTATION is defined
+// (one translation unit includes this file again after defining it)
+#ifndef YK__RAYEXTRAS_H
+#define YK__RAYEXTRAS_H
+#include "yk__raymath_simd.h"
+extern void *yk__raylib_game_state;
 void yy__game_step(void *);
-void *yk__get_game_state() { return yk__raylib_game_state; }
-void yk__set_game_state(void *gs) { yk__raylib_game_state = gs; }
+void *yk__get_game_state();
+void yk__set_game_state(void *gs);
 #if defined(YK__CR_DLL)
 #define yk__rungameloop(nn__fps, nn__state)                                    \
   do {                                                                         \
@@ -16,7 +21,7 @@ void yk__set_game_state(void *gs) { yk__raylib_game_state = gs; }
     yk__raylib_game_state = nn__state;                                         \
     emscripten_set_main_loop(yk__game_loop_wrapper, nn__fps, 1);               \
   } while (0)
-void yk__game_loop_wrapper() { yy__game_step(yk__raylib_game_state); }
+void yk__game_loop_wrapper();
 #else
 #define yk__rungameloop(nn__fps, nn__state)                                    \
   do {                                                                         \
@@ -25,4 +30,14 @@ void yk__game_loop_wrapper() { yy__game_step(yk__raylib_game_state); }
     while (!WindowShouldClose()) { yy__game_step(yk__raylib_game_state); }     \
   } while (0)
 #endif
+#endif
+#if defined(YK__RAYEXTRAS_IMPLEMENTATION)
+#undef YK__RAYEXTRAS_IMPLEMENTATION
+void *yk__raylib_game_state = (void *) 0;
+void *yk__get_game_state() { return yk__raylib_game_state; }
+void yk__set_game_state(void *gs) { yk__raylib_game_state = gs; }
+#if !defined(YK__CR_DLL) && defined(PLATFORM_WEB)
+void yk__game_loop_wrapper() { yy__game_step(yk__raylib_game_state); }
+#endif
+#endif
 // Copyright (C) 2022 Bhathiya Perera
@@ -0,0 +1,180 @@
+/**
+ * SSE2/NEON versions of hot raymath functions used by libs/raylib/math.yaka
+ * Must be included after raymath.h (included from rayextras.h)
+ *
+ * Operations are done in same order as raymath, so results are bit equal to
+ *   raymath versions, unless C compiler fuses multiply + add (FMA) in one of
+ *   them (-march=native, etc), then only rounding is different
+ *   (use -ffp-contract=off if bit equal results are required)
+ * Platforms without SSE2/NEON (web, wasm) use raymath functions directly
+ */
+#ifndef YK__RAYMATH_SIMD_H
+#define YK__RAYMATH_SIMD_H
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define YK__RAYMATH_SSE2
+typedef __m128 yk__f4;
+typedef __m128 yk__f4_mask;
+#define yk__f4_load(p) _mm_loadu_ps(p)
+#define yk__f4_store(p, v) _mm_storeu_ps(p, v)
+#define yk__f4_set1(x) _mm_set1_ps(x)
+#define yk__f4_set(a, b, c, d) _mm_setr_ps(a, b, c, d)
+#define yk__f4_add(a, b) _mm_add_ps(a, b)
+#define yk__f4_sub(a, b) _mm_sub_ps(a, b)
+#define yk__f4_mul(a, b) _mm_mul_ps(a, b)
+#define yk__f4_div(a, b) _mm_div_ps(a, b)
+#define yk__f4_sqrt(a) _mm_sqrt_ps(a)
+// mask ? a : b, where mask is all zeros or all ones for each lane
+#define yk__f4_not_zero(a) _mm_cmpneq_ps(a, _mm_setzero_ps())
+#define yk__f4_select(mask, a, b)                                              \
+  _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b))
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define YK__RAYMATH_NEON
+typedef float32x4_t yk__f4;
+typedef uint32x4_t yk__f4_mask;
+static inline yk__f4 yk__f4_set(float a, float b, float c, float d) {
+  float v[4] = {a, b, c, d};
+  return vld1q_f32(v);
+}
+#define yk__f4_load(p) vld1q_f32(p)
+#define yk__f4_store(p, v) vst1q_f32(p, v)
+#define yk__f4_set1(x) vdupq_n_f32(x)
+#define yk__f4_add(a, b) vaddq_f32(a, b)
+#define yk__f4_sub(a, b) vsubq_f32(a, b)
+#define yk__f4_mul(a, b) vmulq_f32(a, b)
+// Division and square root are IEEE correct only on aarch64
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define yk__f4_div(a, b) vdivq_f32(a, b)
+#define yk__f4_sqrt(a) vsqrtq_f32(a)
+#else
+#define YK__RAYMATH_NO_SIMD_NORMALIZE
+#endif
+#define yk__f4_not_zero(a) vmvnq_u32(vceqq_f32(a, vdupq_n_f32(0.0f)))
+#define yk__f4_select(mask, a, b) vbslq_f32(mask, a, b)
+#endif
+#if defined(YK__RAYMATH_SSE2) || defined(YK__RAYMATH_NEON)
+// Matrix is stored as m0, m4, m8, m12, m1, m5, ... so each 4 floats in
+//   memory is a column of raymath's row major formulas
+static inline Matrix yk__matrix_multiply(Matrix left, Matrix right) {
+  const float *l = &left.m0;
+  const float *r = &right.m0;
+  Matrix result;
+  float *out = &result.m0;
+  const yk__f4 l0 = yk__f4_load(l), l1 = yk__f4_load(l + 4),
+               l2 = yk__f4_load(l + 8), l3 = yk__f4_load(l + 12);
+  for (int c = 0; c < 4; c++) {
+    const float *rc = r + c * 4;
+    yk__f4 v = yk__f4_mul(l0, yk__f4_set1(rc[0]));
+    v = yk__f4_add(v, yk__f4_mul(l1, yk__f4_set1(rc[1])));
+    v = yk__f4_add(v, yk__f4_mul(l2, yk__f4_set1(rc[2])));
+    v = yk__f4_add(v, yk__f4_mul(l3, yk__f4_set1(rc[3])));
+    yk__f4_store(out + c * 4, v);
+  }
+  return result;
+}
+static inline Quaternion yk__quaternion_multiply(Quaternion q1,
+                                                 Quaternion q2) {
+  // Lanes are x, y, z, w (minus signs of w lane are moved to left side)
+  yk__f4 v = yk__f4_mul(yk__f4_set(q1.x, q1.y, q1.z, q1.w), yk__f4_set1(q2.w));
+  v = yk__f4_add(v, yk__f4_mul(yk__f4_set(q1.w, q1.w, q1.w, -q1.x),
+                               yk__f4_set(q2.x, q2.y, q2.z, q2.x)));
+  v = yk__f4_add(v, yk__f4_mul(yk__f4_set(q1.y, q1.z, q1.x, -q1.y),
+                               yk__f4_set(q2.z, q2.x, q2.y, q2.y)));
+  v = yk__f4_sub(v, yk__f4_mul(yk__f4_set(q1.z, q1.x, q1.y, q1.z),
+                               yk__f4_set(q2.y, q2.z, q2.x, q2.z)));
+  Quaternion result;
+  yk__f4_store(&result.x, v);
+  return result;
+}
+static inline Vector4 yk__vector4_lerp(Vector4 v1, Vector4 v2, float amount) {
+  const yk__f4 a = yk__f4_load(&v1.x);
+  const yk__f4 d = yk__f4_sub(yk__f4_load(&v2.x), a);
+  Vector4 result;
+  yk__f4_store(&result.x, yk__f4_add(a, yk__f4_mul(yk__f4_set1(amount), d)));
+  return result;
+}
+#define yk__quaternion_lerp yk__vector4_lerp
+static inline Quaternion yk__quaternion_nlerp(Quaternion q1, Quaternion q2,
+                                              float amount) {
+  const yk__f4 a = yk__f4_load(&q1.x);
+  const yk__f4 d = yk__f4_sub(yk__f4_load(&q2.x), a);
+  const yk__f4 q = yk__f4_add(a, yk__f4_mul(yk__f4_set1(amount), d));
+  float sq[4];
+  yk__f4_store(sq, yk__f4_mul(q, q));
+  // Sum is done in raymath's order so length is the same
+  float length = sqrtf(sq[0] + sq[1] + sq[2] + sq[3]);
+  if (length == 0.0f) length = 1.0f;
+  Quaternion result;
+  yk__f4_store(&result.x, yk__f4_mul(q, yk__f4_set1(1.0f / length)));
+  return result;
+}
+/**
+ * Transform count vectors in place with given matrix (Vector3Transform)
+ */
+static inline void yk__vector3_transform_array(Vector3 *values, size_t count,
+                                               Matrix mat) {
+  const yk__f4 c0 = yk__f4_set(mat.m0, mat.m1, mat.m2, mat.m3);
+  const yk__f4 c1 = yk__f4_set(mat.m4, mat.m5, mat.m6, mat.m7);
+  const yk__f4 c2 = yk__f4_set(mat.m8, mat.m9, mat.m10, mat.m11);
+  const yk__f4 c3 = yk__f4_set(mat.m12, mat.m13, mat.m14, mat.m15);
+  float out[4];
+  for (size_t i = 0; i < count; i++) {
+    yk__f4 v = yk__f4_mul(c0, yk__f4_set1(values[i].x));
+    v = yk__f4_add(v, yk__f4_mul(c1, yk__f4_set1(values[i].y)));
+    v = yk__f4_add(v, yk__f4_mul(c2, yk__f4_set1(values[i].z)));
+    v = yk__f4_add(v, c3);
+    yk__f4_store(out, v);
+    memcpy(&values[i], out, sizeof(Vector3));
+  }
+}
+#else
+#define yk__matrix_multiply MatrixMultiply
+#define yk__quaternion_multiply QuaternionMultiply
+#define yk__vector4_lerp Vector4Lerp
+#define yk__quaternion_lerp QuaternionLerp
+#define yk__quaternion_nlerp QuaternionNlerp
+static inline void yk__vector3_transform_array(Vector3 *values, size_t count,
+                                               Matrix mat) {
+  for (size_t i = 0; i < count; i++) {
+    values[i] = Vector3Transform(values[i], mat);
+  }
+}
+#endif
+/**
+ * Normalize count vectors in place (Vector3Normalize)
+ */
+static inline void yk__vector3_normalize_array(Vector3 *values, size_t count) {
+  size_t i = 0;
+#if (defined(YK__RAYMATH_SSE2) || defined(YK__RAYMATH_NEON)) &&                \
+    !defined(YK__RAYMATH_NO_SIMD_NORMALIZE)
+  // 4 vectors at a time, one lane per vector
+  const size_t simd_count = count - count % 4;
+  for (; i < simd_count; i += 4) {
+    Vector3 *v = values + i;
+    const yk__f4 x = yk__f4_set(v[0].x, v[1].x, v[2].x, v[3].x);
+    const yk__f4 y = yk__f4_set(v[0].y, v[1].y, v[2].y, v[3].y);
+    const yk__f4 z = yk__f4_set(v[0].z, v[1].z, v[2].z, v[3].z);
+    const yk__f4 length = yk__f4_sqrt(yk__f4_add(
+        yk__f4_add(yk__f4_mul(x, x), yk__f4_mul(y, y)), yk__f4_mul(z, z)));
+    // Zero length vectors are kept as they are
+    const yk__f4_mask ok = yk__f4_not_zero(length);
+    const yk__f4 ilength = yk__f4_div(yk__f4_set1(1.0f), length);
+    float nx[4], ny[4], nz[4];
+    yk__f4_store(nx, yk__f4_select(ok, yk__f4_mul(x, ilength), x));
+    yk__f4_store(ny, yk__f4_select(ok, yk__f4_mul(y, ilength), y));
+    yk__f4_store(nz, yk__f4_select(ok, yk__f4_mul(z, ilength), z));
+    for (int j = 0; j < 4; j++) {
+      v[j].x = nx[j];
+      v[j].y = ny[j];
+      v[j].z = nz[j];
+    }
+  }
+#endif
+  for (; i < count; i++) { values[i] = Vector3Normalize(values[i]); }
+}
+#endif
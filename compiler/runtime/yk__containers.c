@@ -0,0 +1,697 @@
+#include "yk__containers.h"
+#include <stdlib.h>
+#include <string.h>
+// ---------------- hash sets ----------------
+struct yk__i64set_entry {
+  int64_t key;
+};
+struct yk__i64set {
+  struct yk__i64set_entry *table;
+};
+struct yk__i64set *yk__i64set_new(void) {
+  struct yk__i64set *set = malloc(sizeof(struct yk__i64set));
+  if (set != NULL) { set->table = NULL; }
+  return set;
+}
+void yk__i64set_del(struct yk__i64set *set) {
+  if (set == NULL) return;
+  yk__hmfree(set->table);
+  free(set);
+}
+bool yk__i64set_add(struct yk__i64set *set, int64_t key) {
+  // Single lookup, put does nothing new if key is already there
+  size_t before = yk__hmlenu(set->table);
+  struct yk__i64set_entry entry = {key};
+  yk__hmputs(set->table, entry);
+  return yk__hmlenu(set->table) != before;
+}
+bool yk__i64set_has(struct yk__i64set *set, int64_t key) {
+  return yk__hmgeti(set->table, key) >= 0;
+}
+bool yk__i64set_remove(struct yk__i64set *set, int64_t key) {
+  return yk__hmdel(set->table, key) != 0;
+}
+int64_t yk__i64set_len(struct yk__i64set *set) {
+  return (int64_t) yk__hmlenu(set->table);
+}
+int64_t yk__i64set_key_at(struct yk__i64set *set, int64_t index) {
+  return set->table[index].key;
+}
+void yk__i64set_clear(struct yk__i64set *set) {
+  yk__hmfree(set->table);
+  set->table = NULL;
+}
+struct yk__strset_entry {
+  yk__sds key;
+};
+struct yk__strset {
+  struct yk__strset_entry *table;
+};
+// Keys of string hash maps must be sds
+static yk__sds yk__strset_sds(struct yk__bstr key) {
+  if (key.t == yk__bstr_str) return key.data.h;
+  return yk__sdsnewlen(yk__bstr_get_reference(key), yk__bstr_len(key));
+}
+static void yk__strset_sds_done(struct yk__bstr key, yk__sds s) {
+  if (key.t != yk__bstr_str) { yk__sdsfree(s); }
+}
+struct yk__strset *yk__strset_new(void) {
+  struct yk__strset *set = malloc(sizeof(struct yk__strset));
+  if (set != NULL) {
+    set->table = NULL;
+    yk__sh_new_strdup(set->table);
+  }
+  return set;
+}
+void yk__strset_del(struct yk__strset *set) {
+  if (set == NULL) return;
+  yk__shfree(set->table);
+  free(set);
+}
+bool yk__strset_add(struct yk__strset *set, struct yk__bstr key) {
+  size_t before = yk__shlenu(set->table);
+  struct yk__strset_entry entry = {yk__strset_sds(key)};
+  yk__shputs(set->table, entry);
+  yk__strset_sds_done(key, entry.key);
+  return yk__shlenu(set->table) != before;
+}
+bool yk__strset_has(struct yk__strset *set, struct yk__bstr key) {
+  yk__sds s = yk__strset_sds(key);
+  bool found = yk__shgeti(set->table, s) >= 0;
+  yk__strset_sds_done(key, s);
+  return found;
+}
+bool yk__strset_remove(struct yk__strset *set, struct yk__bstr key) {
+  yk__sds s = yk__strset_sds(key);
+  bool removed = yk__shdel(set->table, s) != 0;
+  yk__strset_sds_done(key, s);
+  return removed;
+}
+int64_t yk__strset_len(struct yk__strset *set) {
+  return (int64_t) yk__shlenu(set->table);
+}
+yk__sds yk__strset_key_at(struct yk__strset *set, int64_t index) {
+  return set->table[index].key;
+}
+void yk__strset_clear(struct yk__strset *set) {
+  yk__shfree(set->table);
+  set->table = NULL;
+  yk__sh_new_strdup(set->table);
+}
+// ---------------- ordered map ----------------
+// B-tree with minimum degree T, every node except root has T-1 .. 2T-1 keys
+// Reference -- Introduction to Algorithms (CLRS), chapter 18
+#define YK__BTREE_T 16
+#define YK__BTREE_MAX_KEYS (2 * YK__BTREE_T - 1)
+// Minimum degree of 16 keeps depth below 16 for any 64bit key count
+#define YK__BTREE_MAX_DEPTH 32
+struct yk__btree_node {
+  int32_t count;
+  bool leaf;
+  int64_t keys[YK__BTREE_MAX_KEYS];
+  int64_t values[YK__BTREE_MAX_KEYS];
+  // Only allocated for internal nodes
+  struct yk__btree_node *children[YK__BTREE_MAX_KEYS + 1];
+};
+struct yk__ordmap {
+  struct yk__btree_node *root;
+  int64_t len;
+};
+struct yk__ordmap_iter {
+  int64_t high;
+  int64_t key;
+  int64_t value;
+  int32_t depth;
+  struct yk__btree_node *nodes[YK__BTREE_MAX_DEPTH];
+  int32_t positions[YK__BTREE_MAX_DEPTH];
+};
+static struct yk__btree_node *yk__btree_node_new(bool leaf) {
+  size_t size = leaf ? offsetof(struct yk__btree_node, children)
+                     : sizeof(struct yk__btree_node);
+  struct yk__btree_node *node = malloc(size);
+  if (node != NULL) {
+    node->count = 0;
+    node->leaf = leaf;
+  }
+  return node;
+}
+static void yk__btree_node_del(struct yk__btree_node *node) {
+  if (node == NULL) return;
+  if (!node->leaf) {
+    for (int32_t i = 0; i <= node->count; i++) {
+      yk__btree_node_del(node->children[i]);
+    }
+  }
+  free(node);
+}
+// Index of first key >= key (count if there is none)
+static int32_t yk__btree_lower_bound(const struct yk__btree_node *node,
+                                     int64_t key) {
+  int32_t low = 0;
+  int32_t high = node->count;
+  while (low < high) {
+    int32_t mid = (low + high) / 2;
+    if (node->keys[mid] < key) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+// Move items [from, count) of node by offset (keys, values and children)
+static void yk__btree_shift(struct yk__btree_node *node, int32_t from,
+                            int32_t offset) {
+  int32_t moved = node->count - from;
+  memmove(&node->keys[from + offset], &node->keys[from],
+          sizeof(int64_t) * moved);
+  memmove(&node->values[from + offset], &node->values[from],
+          sizeof(int64_t) * moved);
+  if (!node->leaf) {
+    memmove(&node->children[from + 1 + offset], &node->children[from + 1],
+            sizeof(struct yk__btree_node *) * moved);
+  }
+}
+// Split full child at index of parent (parent must not be full)
+static bool yk__btree_split_child(struct yk__btree_node *parent,
+                                  int32_t index) {
+  struct yk__btree_node *left = parent->children[index];
+  struct yk__btree_node *right = yk__btree_node_new(left->leaf);
+  if (right == NULL) return false;
+  right->count = YK__BTREE_T - 1;
+  memcpy(right->keys, &left->keys[YK__BTREE_T],
+         sizeof(int64_t) * (YK__BTREE_T - 1));
+  memcpy(right->values, &left->values[YK__BTREE_T],
+         sizeof(int64_t) * (YK__BTREE_T - 1));
+  if (!left->leaf) {
+    memcpy(right->children, &left->children[YK__BTREE_T],
+           sizeof(struct yk__btree_node *) * YK__BTREE_T);
+  }
+  left->count = YK__BTREE_T - 1;
+  yk__btree_shift(parent, index, 1);
+  parent->keys[index] = left->keys[YK__BTREE_T - 1];
+  parent->values[index] = left->values[YK__BTREE_T - 1];
+  parent->children[index + 1] = right;
+  parent->count++;
+  return true;
+}
+// Merge child at index + 1 and separator key at index to child at index
+static void yk__btree_merge(struct yk__btree_node *parent, int32_t index) {
+  struct yk__btree_node *left = parent->children[index];
+  struct yk__btree_node *right = parent->children[index + 1];
+  left->keys[left->count] = parent->keys[index];
+  left->values[left->count] = parent->values[index];
+  memcpy(&left->keys[left->count + 1], right->keys,
+         sizeof(int64_t) * right->count);
+  memcpy(&left->values[left->count + 1], right->values,
+         sizeof(int64_t) * right->count);
+  if (!left->leaf) {
+    memcpy(&left->children[left->count + 1], right->children,
+           sizeof(struct yk__btree_node *) * (right->count + 1));
+  }
+  left->count += right->count + 1;
+  yk__btree_shift(parent, index + 1, -1);
+  parent->count--;
+  free(right);
+}
+// Make sure child at index has at least T keys before we go down to it
+// returns the child to continue with (index may change after a merge)
+static struct yk__btree_node *yk__btree_fill_child(struct yk__btree_node *node,
+                                                   int32_t index) {
+  struct yk__btree_node *child = node->children[index];
+  if (child->count >= YK__BTREE_T) return child;
+  if (index > 0 && node->children[index - 1]->count >= YK__BTREE_T) {
+    // Borrow last key of left sibling through parent
+    struct yk__btree_node *left = node->children[index - 1];
+    yk__btree_shift(child, 0, 1);
+    if (!child->leaf) { child->children[1] = child->children[0]; }
+    child->keys[0] = node->keys[index - 1];
+    child->values[0] = node->values[index - 1];
+    if (!child->leaf) { child->children[0] = left->children[left->count]; }
+    child->count++;
+    node->keys[index - 1] = left->keys[left->count - 1];
+    node->values[index - 1] = left->values[left->count - 1];
+    left->count--;
+    return child;
+  }
+  if (index < node->count && node->children[index + 1]->count >= YK__BTREE_T) {
+    // Borrow first key of right sibling through parent
+    struct yk__btree_node *right = node->children[index + 1];
+    child->keys[child->count] = node->keys[index];
+    child->values[child->count] = node->values[index];
+    if (!child->leaf) {
+      child->children[child->count + 1] = right->children[0];
+    }
+    child->count++;
+    node->keys[index] = right->keys[0];
+    node->values[index] = right->values[0];
+    if (!right->leaf) { right->children[0] = right->children[1]; }
+    yk__btree_shift(right, 1, -1);
+    right->count--;
+    return child;
+  }
+  if (index < node->count) {
+    yk__btree_merge(node, index);
+    return node->children[index];
+  }
+  yk__btree_merge(node, index - 1);
+  return node->children[index - 1];
+}
+struct yk__ordmap *yk__ordmap_new(void) {
+  struct yk__ordmap *map = malloc(sizeof(struct yk__ordmap));
+  if (map != NULL) {
+    map->root = NULL;
+    map->len = 0;
+  }
+  return map;
+}
+void yk__ordmap_del(struct yk__ordmap *map) {
+  if (map == NULL) return;
+  yk__btree_node_del(map->root);
+  free(map);
+}
+bool yk__ordmap_put(struct yk__ordmap *map, int64_t key, int64_t value) {
+  if (map->root == NULL) {
+    map->root = yk__btree_node_new(true);
+    if (map->root == NULL) return false;
+  }
+  if (map->root->count == YK__BTREE_MAX_KEYS) {
+    // Grow in height by splitting a full root
+    struct yk__btree_node *new_root = yk__btree_node_new(false);
+    if (new_root == NULL) return false;
+    new_root->children[0] = map->root;
+    if (!yk__btree_split_child(new_root, 0)) {
+      free(new_root);
+      return false;
+    }
+    map->root = new_root;
+  }
+  // Full nodes are split on the way down so there is always room to insert
+  struct yk__btree_node *node = map->root;
+  while (true) {
+    int32_t i = yk__btree_lower_bound(node, key);
+    if (i < node->count && node->keys[i] == key) {
+      node->values[i] = value;
+      return false;
+    }
+    if (node->leaf) {
+      yk__btree_shift(node, i, 1);
+      node->keys[i] = key;
+      node->values[i] = value;
+      node->count++;
+      map->len++;
+      return true;
+    }
+    if (node->children[i]->count == YK__BTREE_MAX_KEYS) {
+      if (!yk__btree_split_child(node, i)) return false;
+      if (node->keys[i] == key) {
+        node->values[i] = value;
+        return false;
+      }
+      if (node->keys[i] < key) { i++; }
+    }
+    node = node->children[i];
+  }
+}
+static struct yk__btree_node *yk__ordmap_find(struct yk__ordmap *map,
+                                              int64_t key, int32_t *index) {
+  struct yk__btree_node *node = map->root;
+  while (node != NULL) {
+    int32_t i = yk__btree_lower_bound(node, key);
+    if (i < node->count && node->keys[i] == key) {
+      *index = i;
+      return node;
+    }
+    node = node->leaf ? NULL : node->children[i];
+  }
+  return NULL;
+}
+int64_t yk__ordmap_get(struct yk__ordmap *map, int64_t key,
+                       int64_t default_value) {
+  int32_t i;
+  struct yk__btree_node *node = yk__ordmap_find(map, key, &i);
+  return node == NULL ? default_value : node->values[i];
+}
+bool yk__ordmap_has(struct yk__ordmap *map, int64_t key) {
+  int32_t i;
+  return yk__ordmap_find(map, key, &i) != NULL;
+}
+bool yk__ordmap_remove(struct yk__ordmap *map, int64_t key) {
+  struct yk__btree_node *node = map->root;
+  if (node == NULL) return false;
+  bool found = false;
+  // Nodes are refilled to at least T keys on the way down so a key can
+  // always be removed from a leaf without walking back up
+  while (true) {
+    int32_t i = yk__btree_lower_bound(node, key);
+    if (i < node->count && node->keys[i] == key) {
+      found = true;
+      if (node->leaf) {
+        yk__btree_shift(node, i + 1, -1);
+        node->count--;
+        break;
+      }
+      struct yk__btree_node *left = node->children[i];
+      struct yk__btree_node *right = node->children[i + 1];
+      if (left->count >= YK__BTREE_T) {
+        // Replace with predecessor, then remove predecessor from left
+        struct yk__btree_node *p = left;
+        while (!p->leaf) { p = p->children[p->count]; }
+        key = p->keys[p->count - 1];
+        node->keys[i] = key;
+        node->values[i] = p->values[p->count - 1];
+        node = left;
+      } else if (right->count >= YK__BTREE_T) {
+        // Replace with successor, then remove successor from right
+        struct yk__btree_node *s = right;
+        while (!s->leaf) { s = s->children[0]; }
+        key = s->keys[0];
+        node->keys[i] = key;
+        node->values[i] = s->values[0];
+        node = right;
+      } else {
+        // Both have T-1 keys, merge them with key and continue in merged node
+        yk__btree_merge(node, i);
+        node = left;
+      }
+      continue;
+    }
+    if (node->leaf) break;
+    node = yk__btree_fill_child(node, i);
+  }
+  if (map->root->count == 0) {
+    // Root became empty, tree shrinks in height
+    struct yk__btree_node *old_root = map->root;
+    map->root = old_root->leaf ? NULL : old_root->children[0];
+    free(old_root);
+  }
+  if (found) { map->len--; }
+  return found;
+}
+int64_t yk__ordmap_len(struct yk__ordmap *map) { return map->len; }
+int64_t yk__ordmap_min_key(struct yk__ordmap *map) {
+  struct yk__btree_node *node = map->root;
+  while (!node->leaf) { node = node->children[0]; }
+  return node->keys[0];
+}
+int64_t yk__ordmap_max_key(struct yk__ordmap *map) {
+  struct yk__btree_node *node = map->root;
+  while (!node->leaf) { node = node->children[node->count]; }
+  return node->keys[node->count - 1];
+}
+static void yk__ordmap_iter_push(struct yk__ordmap_iter *iter,
+                                 struct yk__btree_node *node,
+                                 int32_t position) {
+  iter->nodes[iter->depth] = node;
+  iter->positions[iter->depth] = position;
+  iter->depth++;
+}
+struct yk__ordmap_iter *yk__ordmap_range(struct yk__ordmap *map, int64_t low,
+                                         int64_t high) {
+  struct yk__ordmap_iter *iter = malloc(sizeof(struct yk__ordmap_iter));
+  if (iter == NULL) return NULL;
+  iter->high = high;
+  iter->key = 0;
+  iter->value = 0;
+  iter->depth = 0;
+  // Stack holds (node, position of next key to visit) from root to leaf
+  struct yk__btree_node *node = low <= high ? map->root : NULL;
+  while (node != NULL) {
+    int32_t i = yk__btree_lower_bound(node, low);
+    yk__ordmap_iter_push(iter, node, i);
+    if (node->leaf || (i < node->count && node->keys[i] == low)) break;
+    node = node->children[i];
+  }
+  return iter;
+}
+void yk__ordmap_iter_del(struct yk__ordmap_iter *iter) { free(iter); }
+bool yk__ordmap_iter_next(struct yk__ordmap_iter *iter) {
+  // Go up until we find a node with keys left to visit
+  while (iter->depth > 0 && iter->positions[iter->depth - 1] >=
+                                iter->nodes[iter->depth - 1]->count) {
+    iter->depth--;
+  }
+  if (iter->depth == 0) return false;
+  struct yk__btree_node *node = iter->nodes[iter->depth - 1];
+  int32_t i = iter->positions[iter->depth - 1];
+  if (node->keys[i] > iter->high) {
+    iter->depth = 0;
+    return false;
+  }
+  iter->key = node->keys[i];
+  iter->value = node->values[i];
+  iter->positions[iter->depth - 1] = i + 1;
+  // Next key is the smallest key of subtree right of current key
+  if (!node->leaf) {
+    struct yk__btree_node *child = node->children[i + 1];
+    while (true) {
+      yk__ordmap_iter_push(iter, child, 0);
+      if (child->leaf) break;
+      child = child->children[0];
+    }
+  }
+  return true;
+}
+int64_t yk__ordmap_iter_key(struct yk__ordmap_iter *iter) { return iter->key; }
+int64_t yk__ordmap_iter_value(struct yk__ordmap_iter *iter) {
+  return iter->value;
+}
+// ---------------- priority queue ----------------
+struct yk__heap {
+  int64_t *values;
+  yk__heap_before_fn before;
+  bool max;
+};
+static inline bool yk__heap_is_before(const struct yk__heap *heap, int64_t a,
+                                      int64_t b) {
+  if (heap->before != NULL) return heap->before(a, b);
+  return heap->max ? a > b : a < b;
+}
+struct yk__heap *yk__heap_new(yk__heap_before_fn before) {
+  struct yk__heap *heap = malloc(sizeof(struct yk__heap));
+  if (heap != NULL) {
+    heap->values = NULL;
+    heap->before = before;
+    heap->max = false;
+  }
+  return heap;
+}
+struct yk__heap *yk__heap_new_max(void) {
+  struct yk__heap *heap = yk__heap_new(NULL);
+  if (heap != NULL) { heap->max = true; }
+  return heap;
+}
+void yk__heap_del(struct yk__heap *heap) {
+  if (heap == NULL) return;
+  yk__arrfree(heap->values);
+  free(heap);
+}
+void yk__heap_push(struct yk__heap *heap, int64_t value) {
+  yk__arrput(heap->values, value);
+  int64_t *values = heap->values;
+  size_t i = yk__arrlenu(values) - 1;
+  // Sift up, moving parents down instead of swapping
+  while (i > 0) {
+    size_t parent = (i - 1) / 2;
+    if (!yk__heap_is_before(heap, value, values[parent])) break;
+    values[i] = values[parent];
+    i = parent;
+  }
+  values[i] = value;
+}
+int64_t yk__heap_pop(struct yk__heap *heap) {
+  int64_t *values = heap->values;
+  int64_t top = values[0];
+  int64_t last = yk__arrpop(heap->values);
+  size_t count = yk__arrlenu(values);
+  if (count == 0) return top;
+  // Sift last value down from the root
+  size_t i = 0;
+  while (true) {
+    size_t child = i * 2 + 1;
+    if (child >= count) break;
+    if (child + 1 < count &&
+        yk__heap_is_before(heap, values[child + 1], values[child])) {
+      child++;
+    }
+    if (!yk__heap_is_before(heap, values[child], last)) break;
+    values[i] = values[child];
+    i = child;
+  }
+  values[i] = last;
+  return top;
+}
+int64_t yk__heap_peek(struct yk__heap *heap) { return heap->values[0]; }
+int64_t yk__heap_len(struct yk__heap *heap) {
+  return (int64_t) yk__arrlenu(heap->values);
+}
+void yk__heap_clear(struct yk__heap *heap) {
+  if (heap->values != NULL) { yk__arrsetlen(heap->values, 0); }
+}
+// ---------------- deque ----------------
+struct yk__deque {
+  int64_t *data;
+  // Capacity is always a power of 2 so index can be masked
+  size_t capacity;
+  size_t head;
+  size_t len;
+};
+struct yk__deque *yk__deque_new(void) {
+  struct yk__deque *deque = malloc(sizeof(struct yk__deque));
+  if (deque != NULL) {
+    deque->data = NULL;
+    deque->capacity = 0;
+    deque->head = 0;
+    deque->len = 0;
+  }
+  return deque;
+}
+void yk__deque_del(struct yk__deque *deque) {
+  if (deque == NULL) return;
+  free(deque->data);
+  free(deque);
+}
+static bool yk__deque_grow(struct yk__deque *deque) {
+  size_t capacity = deque->capacity == 0 ? 16 : deque->capacity * 2;
+  int64_t *data = malloc(sizeof(int64_t) * capacity);
+  if (data == NULL) return false;
+  // Unwrap ring so items start at 0 again
+  size_t first = deque->capacity - deque->head;
+  if (first > deque->len) { first = deque->len; }
+  if (deque->len > 0) {
+    memcpy(data, &deque->data[deque->head], sizeof(int64_t) * first);
+    memcpy(&data[first], deque->data, sizeof(int64_t) * (deque->len - first));
+  }
+  free(deque->data);
+  deque->data = data;
+  deque->capacity = capacity;
+  deque->head = 0;
+  return true;
+}
+void yk__deque_push_back(struct yk__deque *deque, int64_t value) {
+  if (deque->len == deque->capacity && !yk__deque_grow(deque)) return;
+  deque->data[(deque->head + deque->len) & (deque->capacity - 1)] = value;
+  deque->len++;
+}
+void yk__deque_push_front(struct yk__deque *deque, int64_t value) {
+  if (deque->len == deque->capacity && !yk__deque_grow(deque)) return;
+  deque->head = (deque->head - 1) & (deque->capacity - 1);
+  deque->data[deque->head] = value;
+  deque->len++;
+}
+int64_t yk__deque_pop_back(struct yk__deque *deque) {
+  deque->len--;
+  return deque->data[(deque->head + deque->len) & (deque->capacity - 1)];
+}
+int64_t yk__deque_pop_front(struct yk__deque *deque) {
+  int64_t value = deque->data[deque->head];
+  deque->head = (deque->head + 1) & (deque->capacity - 1);
+  deque->len--;
+  return value;
+}
+int64_t yk__deque_get(struct yk__deque *deque, int64_t index) {
+  return deque->data[(deque->head + (size_t) index) & (deque->capacity - 1)];
+}
+void yk__deque_set(struct yk__deque *deque, int64_t index, int64_t value) {
+  deque->data[(deque->head + (size_t) index) & (deque->capacity - 1)] = value;
+}
+int64_t yk__deque_len(struct yk__deque *deque) { return (int64_t) deque->len; }
+void yk__deque_clear(struct yk__deque *deque) {
+  deque->head = 0;
+  deque->len = 0;
+}
+// ---------------- bitset ----------------
+#if defined(__GNUC__) || defined(__clang__)
+#define yk__popcount64(x) __builtin_popcountll(x)
+#define yk__ctz64(x) __builtin_ctzll(x)
+#else
+// Portable versions (MSVC popcnt instruction is not available on all CPUs)
+static inline int yk__popcount64(uint64_t x) {
+  x = x - ((x >> 1) & 0x5555555555555555ULL);
+  x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+  x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return (int) ((x * 0x0101010101010101ULL) >> 56);
+}
+// x must not be 0
+static inline int yk__ctz64(uint64_t x) {
+  static const int debruijn[64] = {
+      0,  1,  48, 2,  57, 49, 28, 3,  61, 58, 50, 42, 38, 29, 17, 4,
+      62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+      63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+      46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6};
+  return debruijn[((x & (~x + 1)) * 0x03F79D71B4CB0A89ULL) >> 58];
+}
+#endif
+// Mask of valid bits in last word
+static inline uint64_t yk__bitset_tail_mask(const struct yk__bitset *bitset) {
+  unsigned rest = (unsigned) (bitset->bits % 64);
+  return rest == 0 ? ~0ULL : (1ULL << rest) - 1;
+}
+struct yk__bitset *yk__bitset_new(int64_t bits) {
+  if (bits < 0) { bits = 0; }
+  size_t word_count = (size_t) ((bits + 63) / 64);
+  struct yk__bitset *bitset =
+      calloc(1, sizeof(struct yk__bitset) + sizeof(uint64_t) * word_count);
+  if (bitset != NULL) {
+    bitset->bits = bits;
+    bitset->word_count = word_count;
+  }
+  return bitset;
+}
+void yk__bitset_del(struct yk__bitset *bitset) { free(bitset); }
+int64_t yk__bitset_size(struct yk__bitset *bitset) { return bitset->bits; }
+void yk__bitset_set_all(struct yk__bitset *bitset) {
+  if (bitset->word_count == 0) return;
+  memset(bitset->words, 0xFF, sizeof(uint64_t) * bitset->word_count);
+  bitset->words[bitset->word_count - 1] &= yk__bitset_tail_mask(bitset);
+}
+void yk__bitset_clear_all(struct yk__bitset *bitset) {
+  memset(bitset->words, 0, sizeof(uint64_t) * bitset->word_count);
+}
+static inline size_t yk__bitset_common(const struct yk__bitset *dst,
+                                       const struct yk__bitset *src) {
+  return dst->word_count < src->word_count ? dst->word_count
+                                           : src->word_count;
+}
+void yk__bitset_and(struct yk__bitset *dst, struct yk__bitset *src) {
+  size_t common = yk__bitset_common(dst, src);
+  for (size_t i = 0; i < common; i++) { dst->words[i] &= src->words[i]; }
+  for (size_t i = common; i < dst->word_count; i++) { dst->words[i] = 0; }
+}
+void yk__bitset_or(struct yk__bitset *dst, struct yk__bitset *src) {
+  size_t common = yk__bitset_common(dst, src);
+  for (size_t i = 0; i < common; i++) { dst->words[i] |= src->words[i]; }
+  if (common == dst->word_count && common > 0) {
+    dst->words[common - 1] &= yk__bitset_tail_mask(dst);
+  }
+}
+void yk__bitset_xor(struct yk__bitset *dst, struct yk__bitset *src) {
+  size_t common = yk__bitset_common(dst, src);
+  for (size_t i = 0; i < common; i++) { dst->words[i] ^= src->words[i]; }
+  if (common == dst->word_count && common > 0) {
+    dst->words[common - 1] &= yk__bitset_tail_mask(dst);
+  }
+}
+void yk__bitset_andnot(struct yk__bitset *dst, struct yk__bitset *src) {
+  size_t common = yk__bitset_common(dst, src);
+  for (size_t i = 0; i < common; i++) { dst->words[i] &= ~src->words[i]; }
+}
+int64_t yk__bitset_count(struct yk__bitset *bitset) {
+  int64_t count = 0;
+  for (size_t i = 0; i < bitset->word_count; i++) {
+    count += yk__popcount64(bitset->words[i]);
+  }
+  return count;
+}
+int64_t yk__bitset_next_set(struct yk__bitset *bitset, int64_t from) {
+  if (from < 0) { from = 0; }
+  if (from >= bitset->bits) return -1;
+  size_t i = (size_t) (from >> 6);
+  // Drop bits before from in first word
+  uint64_t word = bitset->words[i] & (~0ULL << (from & 63));
+  while (word == 0) {
+    if (++i >= bitset->word_count) return -1;
+    word = bitset->words[i];
+  }
+  return (int64_t) (i * 64 + (size_t) yk__ctz64(word));
+}
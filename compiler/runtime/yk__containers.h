@@ -0,0 +1,213 @@
+// Containers used by libs.containers.*
+// Library created by Bhathiya Perera
+#ifndef YK__CONTAINERS_H
+#define YK__CONTAINERS_H
+#include "yk__lib.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+// ---------------- hash sets ----------------
+/**
+ * Hash set of 64bit integers (stb_ds hash map with key only entries)
+ * Keys are stored in a dense array, index 0 .. len - 1 can be used to
+ * iterate, adding/removing keys changes the order
+ */
+struct yk__i64set;
+/**
+ * Create a new set (free with yk__i64set_del)
+ * @return set or NULL if we are out of memory
+ */
+struct yk__i64set *yk__i64set_new(void);
+void yk__i64set_del(struct yk__i64set *set);
+/**
+ * Add key to set
+ * @return true if key was not in set before
+ */
+bool yk__i64set_add(struct yk__i64set *set, int64_t key);
+bool yk__i64set_has(struct yk__i64set *set, int64_t key);
+/**
+ * Remove key from set
+ * @return true if key was in set
+ */
+bool yk__i64set_remove(struct yk__i64set *set, int64_t key);
+int64_t yk__i64set_len(struct yk__i64set *set);
+/**
+ * Key at given index (0 .. len - 1), does not do a length check
+ */
+int64_t yk__i64set_key_at(struct yk__i64set *set, int64_t index);
+void yk__i64set_clear(struct yk__i64set *set);
+/**
+ * Hash set of strings (stb_ds string hash map), keys are copied to the set
+ * Heap strings are looked up without a copy, other strings are copied to a
+ * temporary sds first
+ */
+struct yk__strset;
+struct yk__strset *yk__strset_new(void);
+void yk__strset_del(struct yk__strset *set);
+bool yk__strset_add(struct yk__strset *set, struct yk__bstr key);
+bool yk__strset_has(struct yk__strset *set, struct yk__bstr key);
+bool yk__strset_remove(struct yk__strset *set, struct yk__bstr key);
+int64_t yk__strset_len(struct yk__strset *set);
+/**
+ * Key at given index (0 .. len - 1), owned by the set
+ * does not do a length check
+ */
+yk__sds yk__strset_key_at(struct yk__strset *set, int64_t index);
+void yk__strset_clear(struct yk__strset *set);
+// ---------------- ordered map ----------------
+/**
+ * B-tree map of 64bit integer keys to 64bit integer values, kept in key order
+ */
+struct yk__ordmap;
+struct yk__ordmap *yk__ordmap_new(void);
+void yk__ordmap_del(struct yk__ordmap *map);
+/**
+ * Set value of key (replaces current value)
+ * @return true if key was added, false if key was already in map
+ * (or we are out of memory)
+ */
+bool yk__ordmap_put(struct yk__ordmap *map, int64_t key, int64_t value);
+/**
+ * Get value of key, or default_value if key is not in map
+ */
+int64_t yk__ordmap_get(struct yk__ordmap *map, int64_t key,
+                       int64_t default_value);
+bool yk__ordmap_has(struct yk__ordmap *map, int64_t key);
+/**
+ * Remove key from map
+ * @return true if key was in map
+ */
+bool yk__ordmap_remove(struct yk__ordmap *map, int64_t key);
+int64_t yk__ordmap_len(struct yk__ordmap *map);
+/**
+ * Smallest/largest key, map must not be empty
+ */
+int64_t yk__ordmap_min_key(struct yk__ordmap *map);
+int64_t yk__ordmap_max_key(struct yk__ordmap *map);
+/**
+ * Iterator over keys in [low, high] in ascending order
+ * Map must not be modified while iterating
+ */
+struct yk__ordmap_iter;
+/**
+ * Create iterator (free with yk__ordmap_iter_del)
+ * Call yk__ordmap_iter_next before reading first key/value
+ * @return iterator or NULL if we are out of memory
+ */
+struct yk__ordmap_iter *yk__ordmap_range(struct yk__ordmap *map, int64_t low,
+                                         int64_t high);
+void yk__ordmap_iter_del(struct yk__ordmap_iter *iter);
+/**
+ * Move to next key
+ * @return false if there are no more keys in range
+ */
+bool yk__ordmap_iter_next(struct yk__ordmap_iter *iter);
+int64_t yk__ordmap_iter_key(struct yk__ordmap_iter *iter);
+int64_t yk__ordmap_iter_value(struct yk__ordmap_iter *iter);
+// ---------------- priority queue ----------------
+/**
+ * Should a come out of the heap before b
+ */
+typedef bool (*yk__heap_before_fn)(int64_t a, int64_t b);
+/**
+ * Binary heap of 64bit integers
+ */
+struct yk__heap;
+/**
+ * Create a new heap
+ * @param before comparator, NULL for a min heap
+ * @return heap or NULL if we are out of memory
+ */
+struct yk__heap *yk__heap_new(yk__heap_before_fn before);
+/**
+ * Create a max heap (largest value comes out first)
+ */
+struct yk__heap *yk__heap_new_max(void);
+void yk__heap_del(struct yk__heap *heap);
+void yk__heap_push(struct yk__heap *heap, int64_t value);
+/**
+ * Remove and return top value, heap must not be empty
+ */
+int64_t yk__heap_pop(struct yk__heap *heap);
+/**
+ * Top value, heap must not be empty
+ */
+int64_t yk__heap_peek(struct yk__heap *heap);
+int64_t yk__heap_len(struct yk__heap *heap);
+void yk__heap_clear(struct yk__heap *heap);
+// ---------------- deque ----------------
+/**
+ * Double ended queue of 64bit integers (ring buffer)
+ */
+struct yk__deque;
+struct yk__deque *yk__deque_new(void);
+void yk__deque_del(struct yk__deque *deque);
+void yk__deque_push_back(struct yk__deque *deque, int64_t value);
+void yk__deque_push_front(struct yk__deque *deque, int64_t value);
+/**
+ * Remove and return a value from either end, deque must not be empty
+ */
+int64_t yk__deque_pop_back(struct yk__deque *deque);
+int64_t yk__deque_pop_front(struct yk__deque *deque);
+/**
+ * Value at index (0 is front), does not do a length check
+ */
+int64_t yk__deque_get(struct yk__deque *deque, int64_t index);
+void yk__deque_set(struct yk__deque *deque, int64_t index, int64_t value);
+int64_t yk__deque_len(struct yk__deque *deque);
+void yk__deque_clear(struct yk__deque *deque);
+// ---------------- bitset ----------------
+/**
+ * Fixed size set of bits stored in 64bit words
+ * Bits after size in last word are always kept as zero
+ * Single bit operations are inline, so sieves/visited sets do not pay for
+ * a function call per bit
+ */
+struct yk__bitset {
+  int64_t bits;
+  size_t word_count;
+  uint64_t words[];
+};
+/**
+ * Create a bitset with given number of bits, all zero
+ * @return bitset or NULL if we are out of memory
+ */
+struct yk__bitset *yk__bitset_new(int64_t bits);
+void yk__bitset_del(struct yk__bitset *bitset);
+int64_t yk__bitset_size(struct yk__bitset *bitset);
+/**
+ * Single bit operations, index must be in 0 .. size - 1 (not checked)
+ */
+static inline void yk__bitset_set(struct yk__bitset *bitset, int64_t index) {
+  bitset->words[index >> 6] |= 1ULL << (index & 63);
+}
+static inline void yk__bitset_clear(struct yk__bitset *bitset,
+                                    int64_t index) {
+  bitset->words[index >> 6] &= ~(1ULL << (index & 63));
+}
+static inline void yk__bitset_flip(struct yk__bitset *bitset, int64_t index) {
+  bitset->words[index >> 6] ^= 1ULL << (index & 63);
+}
+static inline bool yk__bitset_test(struct yk__bitset *bitset, int64_t index) {
+  return (bitset->words[index >> 6] >> (index & 63)) & 1;
+}
+void yk__bitset_set_all(struct yk__bitset *bitset);
+void yk__bitset_clear_all(struct yk__bitset *bitset);
+/**
+ * Word at a time dst = dst op src
+ * If sizes are different only common bits are used (and clears rest of dst)
+ */
+void yk__bitset_and(struct yk__bitset *dst, struct yk__bitset *src);
+void yk__bitset_or(struct yk__bitset *dst, struct yk__bitset *src);
+void yk__bitset_xor(struct yk__bitset *dst, struct yk__bitset *src);
+void yk__bitset_andnot(struct yk__bitset *dst, struct yk__bitset *src);
+/**
+ * Number of bits that are set
+ */
+int64_t yk__bitset_count(struct yk__bitset *bitset);
+/**
+ * Index of first set bit at or after from
+ * @return index or -1 if there are no set bits
+ */
+int64_t yk__bitset_next_set(struct yk__bitset *bitset, int64_t from);
+#endif
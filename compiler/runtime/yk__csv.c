@@ -0,0 +1,171 @@
+#include "yk__csv.h"
+#include "yk__scan64.h"
+#include <stdlib.h>
+#include <string.h>
+// Buffer is padded so blocks can always be loaded as full 64 bytes
+#define YK__CSV_PADDING 64
+struct yk__csv_span {
+  uint32_t start;
+  uint32_t end;
+};
+struct yk__csv {
+  // Copy of input, followed by YK__CSV_PADDING zeros
+  uint8_t *buf;
+  size_t len;
+  struct yk__csv_span *fields;
+  size_t field_count;
+  size_t field_cap;
+  // Index of first field of each row, followed by field_count
+  uint32_t *rows;
+  size_t row_count;
+  size_t row_cap;
+};
+static bool yk__csv_reserve(void **items, size_t *cap, size_t needed,
+                            size_t item_size) {
+  if (needed <= *cap) return true;
+  size_t new_cap = *cap * 2;
+  if (new_cap < needed) { new_cap = needed; }
+  void *grown = realloc(*items, item_size * new_cap);
+  if (grown == NULL) return false;
+  *items = grown;
+  *cap = new_cap;
+  return true;
+}
+// Add last field of a row
+static void yk__csv_add_last_field(struct yk__csv *csv, size_t start,
+                                   size_t end) {
+  // \r of a \r\n line ending is not part of the field
+  if (end > start && csv->buf[end - 1] == '\r') { end--; }
+  csv->fields[csv->field_count].start = (uint32_t) start;
+  csv->fields[csv->field_count].end = (uint32_t) end;
+  csv->field_count++;
+}
+static bool yk__csv_index(struct yk__csv *csv, uint8_t delimiter) {
+  const uint8_t *buf = csv->buf;
+  const size_t len = csv->len;
+  csv->field_cap = len / 8 + 64;
+  csv->fields = malloc(sizeof(struct yk__csv_span) * csv->field_cap);
+  csv->row_cap = len / 64 + 64;
+  csv->rows = malloc(sizeof(uint32_t) * csv->row_cap);
+  if (csv->fields == NULL || csv->rows == NULL) return false;
+  csv->rows[csv->row_count++] = 0;
+  size_t field_start = 0;
+  // all ones if block starts inside quotes
+  uint64_t prev_in_quotes = 0;
+  for (size_t base = 0; base < len; base += 64) {
+    const yk__block64 block = yk__block64_load(buf + base);
+    const uint64_t quote = yk__block64_eq(&block, '"');
+    const uint64_t newline = yk__block64_eq(&block, '\n');
+    const uint64_t delim = yk__block64_eq(&block, delimiter);
+    // "" toggles twice, so escaped quotes do not change the state
+    const uint64_t in_quotes = yk__prefix_xor64(quote) ^ prev_in_quotes;
+    prev_in_quotes = (uint64_t) ((int64_t) in_quotes >> 63);
+    uint64_t ends = (delim | newline) & ~in_quotes;
+    if (len - base < 64) { ends &= (1ULL << (len - base)) - 1; }
+    if (ends == 0) continue;
+    if (!yk__csv_reserve((void **) &csv->fields, &csv->field_cap,
+                         csv->field_count + 64, sizeof(struct yk__csv_span)) ||
+        !yk__csv_reserve((void **) &csv->rows, &csv->row_cap,
+                         csv->row_count + 65, sizeof(uint32_t))) {
+      return false;
+    }
+    const uint64_t row_ends = ends & newline;
+    while (ends != 0) {
+      const int bit = yk__scan64_ctz(ends);
+      const size_t p = base + (size_t) bit;
+      if ((row_ends >> bit) & 1) {
+        yk__csv_add_last_field(csv, field_start, p);
+        csv->rows[csv->row_count++] = (uint32_t) csv->field_count;
+      } else {
+        csv->fields[csv->field_count].start = (uint32_t) field_start;
+        csv->fields[csv->field_count].end = (uint32_t) p;
+        csv->field_count++;
+      }
+      field_start = p + 1;
+      ends &= ends - 1;
+    }
+  }
+  // Last row without a new line at the end
+  const bool open_row = csv->field_count > csv->rows[csv->row_count - 1];
+  if (field_start < len || open_row) {
+    if (!yk__csv_reserve((void **) &csv->fields, &csv->field_cap,
+                         csv->field_count + 1, sizeof(struct yk__csv_span)) ||
+        !yk__csv_reserve((void **) &csv->rows, &csv->row_cap,
+                         csv->row_count + 1, sizeof(uint32_t))) {
+      return false;
+    }
+    yk__csv_add_last_field(csv, field_start, len);
+    csv->rows[csv->row_count++] = (uint32_t) csv->field_count;
+  }
+  // rows has one extra item at the end
+  csv->row_count--;
+  return true;
+}
+struct yk__csv *yk__csv_parse(const char *data, size_t length,
+                              char delimiter) {
+  // Positions are stored as 32bit
+  if (length >= UINT32_MAX - YK__CSV_PADDING) return NULL;
+  struct yk__csv *csv = calloc(1, sizeof(struct yk__csv));
+  if (csv == NULL) return NULL;
+  csv->buf = malloc(length + YK__CSV_PADDING);
+  if (csv->buf == NULL) {
+    free(csv);
+    return NULL;
+  }
+  if (length > 0) { memcpy(csv->buf, data, length); }
+  memset(csv->buf + length, 0, YK__CSV_PADDING);
+  csv->len = length;
+  if (!yk__csv_index(csv, (uint8_t) delimiter)) {
+    yk__csv_del(csv);
+    return NULL;
+  }
+  return csv;
+}
+void yk__csv_del(struct yk__csv *csv) {
+  if (csv == NULL) return;
+  free(csv->buf);
+  free(csv->fields);
+  free(csv->rows);
+  free(csv);
+}
+int64_t yk__csv_rows(struct yk__csv *csv) { return (int64_t) csv->row_count; }
+int64_t yk__csv_columns(struct yk__csv *csv, int64_t row) {
+  if (row < 0 || (size_t) row >= csv->row_count) return 0;
+  return (int64_t) (csv->rows[row + 1] - csv->rows[row]);
+}
+static bool yk__csv_span_of(struct yk__csv *csv, int64_t row, int64_t column,
+                            struct yk__csv_span *span) {
+  if (column < 0 || column >= yk__csv_columns(csv, row)) return false;
+  *span = csv->fields[csv->rows[row] + (size_t) column];
+  // Drop surrounding quotes
+  if (span->end - span->start >= 2 && csv->buf[span->start] == '"' &&
+      csv->buf[span->end - 1] == '"') {
+    span->start++;
+    span->end--;
+  }
+  return true;
+}
+struct yk__bstr yk__csv_field(struct yk__csv *csv, int64_t row,
+                              int64_t column) {
+  struct yk__csv_span span;
+  if (!yk__csv_span_of(csv, row, column, &span)) return yk__bstr_s(NULL, 0);
+  return yk__bstr_s((const char *) csv->buf + span.start,
+                    span.end - span.start);
+}
+yk__sds yk__csv_field_str(struct yk__csv *csv, int64_t row, int64_t column) {
+  struct yk__csv_span span;
+  if (!yk__csv_span_of(csv, row, column, &span)) return yk__sdsempty();
+  const uint8_t *s = csv->buf + span.start;
+  size_t len = span.end - span.start;
+  yk__sds out = yk__sdsMakeRoomFor(yk__sdsempty(), len);
+  size_t i = 0;
+  while (i < len) {
+    const uint8_t *quote = memchr(s + i, '"', len - i);
+    size_t run = quote == NULL ? len - i : (size_t) (quote - s) - i + 1;
+    out = yk__sdscatlen(out, s + i, run);
+    i += run;
+    // Skip second quote of ""
+    if (quote != NULL && i < len && s[i] == '"') { i++; }
+  }
+  return out;
+}
@@ -0,0 +1,40 @@
+// CSV reader used by libs.fileformats.csv
+// Library created by Bhathiya Perera
+#ifndef YK__CSV_H
+#define YK__CSV_H
+#include "yk__lib.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+/**
+ * Input is copied once to a padded buffer, then delimiters, new lines and
+ *   quotes are found 64 bytes at a time (SSE2/NEON when available)
+ * Quoted fields (RFC 4180) may contain delimiters, new lines and "" for a
+ *   quote, \r\n line endings are supported
+ * Only start and end of each field is stored, yk__csv_field returns a view
+ *   into the document buffer
+ */
+struct yk__csv;
+/**
+ * Parse given data (data is copied, it does not need to outlive result)
+ * @return parsed csv or NULL if we are out of memory
+ */
+struct yk__csv *yk__csv_parse(const char *data, size_t length, char delimiter);
+void yk__csv_del(struct yk__csv *csv);
+int64_t yk__csv_rows(struct yk__csv *csv);
+/**
+ * Number of fields in given row, 0 if row is out of range
+ */
+int64_t yk__csv_columns(struct yk__csv *csv, int64_t row);
+/**
+ * View of a field without surrounding quotes, valid until csv is deleted
+ * "" inside quoted fields is not decoded
+ * Empty string is returned if row/column is out of range
+ */
+struct yk__bstr yk__csv_field(struct yk__csv *csv, int64_t row,
+                              int64_t column);
+/**
+ * New string of a field with "" decoded to "
+ */
+yk__sds yk__csv_field_str(struct yk__csv *csv, int64_t row, int64_t column);
+#endif
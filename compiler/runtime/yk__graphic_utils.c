@@ -1,6 +1,8 @@
 #include "yk__graphic_utils.h"
+#include "yk__lib.h"
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 // Reference -- https://mrl.cs.nyu.edu/~perlin/noise/
 const int p[512] = {
@@ -149,61 +151,249 @@ double yk__perlin2d(double x, double y) {
 }
 #endif
 double yk__perlin1d(double x) { return yk__perlin3d(x, 1.34345, 3.412); }
-uint64_t yk__init_random() {
-#if defined(YK__WASM4)
-  uint64_t seed_value = 0xDEADBEEF;
-#else
-  uint64_t seed_value = time(NULL);
-#endif
-  srand((unsigned) seed_value);
-  return seed_value;
-
+// ---------------- batched noise ----------------
+// Work that only depends on x, y or z is done once per column/row/layer,
+// inner loops are branch free so compilers can vectorize them
+// Gradient directions of yk__grad, (x + y) is same as (1 * x + 1 * y + 0 * z)
+static const double yk__grad_x[16] = {1, -1, 1, -1, 1, -1, 1, -1,
+                                      0, 0,  0, 0,  1, 0,  -1, 0};
+static const double yk__grad_y[16] = {1, 1, -1, -1, 0, 0, 0, 0,
+                                      1, -1, 1, -1, 1, -1, 1, -1};
+static const double yk__grad_z[16] = {0, 0, 0, 0, 1, 1, -1, -1,
+                                      1, 1, -1, -1, 0, 1, 0, -1};
+#define YK__GRAD(hash, x, y, z)                                                \
+  (yk__grad_x[(hash) & 15] * (x) + yk__grad_y[(hash) & 15] * (y) +           \
+   yk__grad_z[(hash) & 15] * (z))
+// Cell index, offset in cell and fade curve of each coordinate on an axis
+static void yk__perlin_axis(int *cell, double *offset, double *fade,
+                            size_t count, double start, double step) {
+  for (size_t i = 0; i < count; i++) {
+    double v = start + (double) i * step;
+    double fl = floor(v);
+    cell[i] = (int) fl & 255;
+    offset[i] = v - fl;
+    fade[i] = yk__fade(offset[i]);
+  }
+}
+void yk__perlin3d_fill(double *out, size_t width, size_t height, size_t depth,
+                       double x0, double y0, double z0, double step) {
+  size_t total = width + height + depth;
+  int *cells = malloc(sizeof(int) * total);
+  double *offsets = malloc(sizeof(double) * total * 2);
+  if (cells == NULL || offsets == NULL) {
+    free(cells);
+    free(offsets);
+    for (size_t k = 0; k < depth; k++) {
+      for (size_t j = 0; j < height; j++) {
+        for (size_t i = 0; i < width; i++) {
+          *out++ = yk__perlin3d(x0 + (double) i * step, y0 + (double) j * step,
+                                z0 + (double) k * step);
+        }
+      }
+    }
+    return;
+  }
+  int *cx = cells, *cy = cells + width, *cz = cells + width + height;
+  double *fx = offsets, *fy = offsets + width, *fz = offsets + width + height;
+  double *ux = offsets + total, *uy = ux + width, *uz = ux + width + height;
+  yk__perlin_axis(cx, fx, ux, width, x0, step);
+  yk__perlin_axis(cy, fy, uy, height, y0, step);
+  yk__perlin_axis(cz, fz, uz, depth, z0, step);
+  for (size_t k = 0; k < depth; k++) {
+    const int Z = cz[k];
+    const double z = fz[k], w = uz[k];
+    for (size_t j = 0; j < height; j++) {
+      const int Y = cy[j];
+      const double y = fy[j], v = uy[j];
+      for (size_t i = 0; i < width; i++) {
+        const double x = fx[i], u = ux[i];
+        const int A = p[cx[i]] + Y, AA = p[A] + Z, AB = p[A + 1] + Z,
+                  B = p[cx[i] + 1] + Y, BA = p[B] + Z, BB = p[B + 1] + Z;
+        out[i] = yk__lerp(
+            w,
+            yk__lerp(v,
+                     yk__lerp(u, YK__GRAD(p[AA], x, y, z),
+                              YK__GRAD(p[BA], x - 1, y, z)),
+                     yk__lerp(u, YK__GRAD(p[AB], x, y - 1, z),
+                              YK__GRAD(p[BB], x - 1, y - 1, z))),
+            yk__lerp(v,
+                     yk__lerp(u, YK__GRAD(p[AA + 1], x, y, z - 1),
+                              YK__GRAD(p[BA + 1], x - 1, y, z - 1)),
+                     yk__lerp(u, YK__GRAD(p[AB + 1], x, y - 1, z - 1),
+                              YK__GRAD(p[BB + 1], x - 1, y - 1, z - 1))));
+      }
+      out += width;
+    }
+  }
+  free(cells);
+  free(offsets);
 }
-// Reference - https://stackoverflow.com/a/33021408
 #if defined(YK__WASM4)
-uint64_t yk__random_u64_impl(void) {
-  uint64_t r = 0;
-  for (int i = 5; i > 0; i--) {
-    r = r * (32767 + (uint64_t) 1) + rand();
+void yk__perlin2d_fill(double *out, size_t width, size_t height, double x0,
+                       double y0, double step) {
+  for (size_t j = 0; j < height; j++) {
+    for (size_t i = 0; i < width; i++) {
+      *out++ = yk__perlin2d(x0 + (double) i * step, y0 + (double) j * step);
+    }
   }
-  return r;
 }
 #else
-#define IMAX_BITS(m)                                                           \
-  ((m) / ((m) % 255 + 1) / 255 % 255 * 8 + 7 - 86 / ((m) % 255 + 12))
-#define RAND_MAX_WIDTH IMAX_BITS(RAND_MAX)
-uint64_t yk__rand64_mersenne(void) {
-  uint64_t r = 0;
-  for (int i = 0; i < 64; i += RAND_MAX_WIDTH) {
-    r <<= RAND_MAX_WIDTH;
-    r ^= (unsigned) rand();
+// Gradients of lattice points (ix, iy) for ix in [first, first + count)
+static void yk__perlin_gradient_row(double *gx, double *gy, int first,
+                                    size_t count, int iy) {
+  for (size_t c = 0; c < count; c++) {
+    perlin_vector2 g = yk__random_gradient(first + (int) c, iy);
+    gx[c] = g.x;
+    gy[c] = g.y;
   }
-  return r;
-}
-#if RAND_MAX / 256 >= 0xFFFFFFFFFFFFFF
-#define LOOP_COUNT 1
-#elif RAND_MAX / 256 >= 0xFFFFFF
-#define LOOP_COUNT 2
-#elif RAND_MAX / 256 >= 0x3FFFF
-#define LOOP_COUNT 3
-#elif RAND_MAX / 256 >= 0x1FF
-#define LOOP_COUNT 4
-#else
-#define LOOP_COUNT 5
+}
+void yk__perlin2d_fill(double *out, size_t width, size_t height, double x0,
+                       double y0, double step) {
+  if (width == 0 || height == 0) { return; }
+  // Columns -> cell (relative to left most cell) and distances to its corners
+  int *cx = malloc(sizeof(int) * width);
+  double *dx = malloc(sizeof(double) * width * 2);
+  int first = 0, last = 0;
+  size_t count = 0;
+  if (cx != NULL && dx != NULL) {
+    for (size_t i = 0; i < width; i++) {
+      double x = x0 + (double) i * step;
+      int ix = (int) x;
+      cx[i] = ix;
+      dx[i] = x - (double) ix;
+      dx[width + i] = x - (double) (ix + 1);
+      if (i == 0 || ix < first) { first = ix; }
+      if (i == 0 || ix > last) { last = ix; }
+    }
+    count = (size_t) last - (size_t) first + 2;
+  }
+  // Large steps skip most lattice points, gradient table does not help there
+  double *grad = count <= width * 2 + 2 ? malloc(sizeof(double) * count * 4)
+                                        : NULL;
+  if (grad == NULL) {
+    free(cx);
+    free(dx);
+    for (size_t j = 0; j < height; j++) {
+      for (size_t i = 0; i < width; i++) {
+        *out++ = yk__perlin2d(x0 + (double) i * step, y0 + (double) j * step);
+      }
+    }
+    return;
+  }
+  for (size_t i = 0; i < width; i++) { cx[i] -= first; }
+  double *g0x = grad, *g0y = grad + count;
+  double *g1x = grad + count * 2, *g1y = grad + count * 3;
+  int cached_row = 0;
+  for (size_t j = 0; j < height; j++) {
+    double y = y0 + (double) j * step;
+    int iy = (int) y;
+    if (j == 0 || iy != cached_row) {
+      // Sin/cos are only calculated when we move to a new row of cells
+      yk__perlin_gradient_row(g0x, g0y, first, count, iy);
+      yk__perlin_gradient_row(g1x, g1y, first, count, iy + 1);
+      cached_row = iy;
+    }
+    const double dy0 = y - (double) iy;
+    const double dy1 = y - (double) (iy + 1);
+    for (size_t i = 0; i < width; i++) {
+      const int c = cx[i];
+      const double sx = dx[i], dx1 = dx[width + i];
+      double n0 = sx * g0x[c] + dy0 * g0y[c];
+      double n1 = dx1 * g0x[c + 1] + dy0 * g0y[c + 1];
+      const double ix0 = (n1 - n0) * sx + n0;
+      n0 = sx * g1x[c] + dy1 * g1y[c];
+      n1 = dx1 * g1x[c + 1] + dy1 * g1y[c + 1];
+      const double ix1 = (n1 - n0) * sx + n0;
+      out[i] = (ix1 - ix0) * dy0 + ix0;
+    }
+    out += width;
+  }
+  free(cx);
+  free(dx);
+  free(grad);
+}
 #endif
-uint64_t yk__rand64(void) {
-  uint64_t r = 0;
-  for (int i = LOOP_COUNT; i > 0; i--) {
-    r = r * (RAND_MAX + (uint64_t) 1) + rand();
+// xoshiro256** - https://prng.di.unimi.it/xoshiro256starstar.c
+// State is seeded with splitmix64, so a seed gives the same sequence everywhere
+static uint64_t yk__splitmix64(uint64_t *x) {
+  uint64_t z = (*x += UINT64_C(0x9E3779B97F4A7C15));
+  z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+  z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+  return z ^ (z >> 31);
+}
+static inline uint64_t yk__rotl64(uint64_t x, int k) {
+  return (x << k) | (x >> (64 - k));
+}
+static inline uint64_t yk__xoshiro256ss(uint64_t *s) {
+  const uint64_t result = yk__rotl64(s[1] * 5, 7) * 9;
+  const uint64_t t = s[1] << 17;
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = yk__rotl64(s[3], 45);
+  return result;
+}
+// Top 53 bits -> [0, 1)
+#define YK__U64_TO_F64(x) ((double) ((x) >> 11) * (1.0 / 9007199254740992.0))
+#define YK__U64_TO_F32(x) ((float) ((x) >> 40) * (1.0f / 16777216.0f))
+void yk__rng_seed(struct yk__rng *rng, uint64_t seed) {
+  uint64_t x = seed;
+  for (int i = 0; i < 4; i++) { rng->s[i] = yk__splitmix64(&x); }
+}
+struct yk__rng *yk__rng_new(uint64_t seed) {
+  struct yk__rng *rng = malloc(sizeof(struct yk__rng));
+  if (rng != NULL) { yk__rng_seed(rng, seed); }
+  return rng;
+}
+void yk__rng_del(struct yk__rng *rng) { free(rng); }
+uint64_t yk__rng_u64(struct yk__rng *rng) { return yk__xoshiro256ss(rng->s); }
+double yk__rng_f64(struct yk__rng *rng) {
+  return YK__U64_TO_F64(yk__xoshiro256ss(rng->s));
+}
+float yk__rng_f32(struct yk__rng *rng) {
+  return YK__U64_TO_F32(yk__xoshiro256ss(rng->s));
+}
+void yk__rng_fill_u64(struct yk__rng *rng, uint64_t *values, size_t count) {
+  // Work on a local copy so state stays in registers
+  uint64_t s[4] = {rng->s[0], rng->s[1], rng->s[2], rng->s[3]};
+  for (size_t i = 0; i < count; i++) { values[i] = yk__xoshiro256ss(s); }
+  memcpy(rng->s, s, sizeof(s));
+}
+void yk__rng_fill_f64(struct yk__rng *rng, double *values, size_t count) {
+  uint64_t s[4] = {rng->s[0], rng->s[1], rng->s[2], rng->s[3]};
+  for (size_t i = 0; i < count; i++) {
+    values[i] = YK__U64_TO_F64(yk__xoshiro256ss(s));
+  }
+  memcpy(rng->s, s, sizeof(s));
+}
+// Generator used by libs.random functions, each thread has its own
+static YK__THREAD_LOCAL struct yk__rng yk__thread_rng;
+static YK__THREAD_LOCAL int yk__thread_rng_seeded = 0;
+struct yk__rng *yk__random_rng(void) {
+  if (!yk__thread_rng_seeded) {
+    // Threads that never set a seed should not share a sequence,
+    // each thread has its own stack so use an address from it as the seed
+    int stack_marker = 0;
+    yk__rng_seed(&yk__thread_rng, (uint64_t) (uintptr_t) &stack_marker);
+    yk__thread_rng_seeded = 1;
   }
-  return r;
+  return &yk__thread_rng;
 }
-#if ((RAND_MAX & (RAND_MAX + 1u)) == 0)
-#define yk__random_u64_impl yk__rand64_mersenne
+void yk__set_random_seed(uint64_t seed) {
+  yk__rng_seed(&yk__thread_rng, seed);
+  yk__thread_rng_seeded = 1;
+}
+uint64_t yk__init_random() {
+#if defined(YK__WASM4)
+  uint64_t seed_value = 0xDEADBEEF;
 #else
-#define yk__random_u64_impl yk__rand64
-#endif
+  uint64_t seed_value = time(NULL);
 #endif
-uint64_t yk__random_u64() {
-  return yk__random_u64_impl();
-}
\ No newline at end of file
+  yk__set_random_seed(seed_value);
+  return seed_value;
+}
+uint64_t yk__random_u64() { return yk__rng_u64(yk__random_rng()); }
+double yk__random_f64() { return yk__rng_f64(yk__random_rng()); }
+float yk__random_f32() { return yk__rng_f32(yk__random_rng()); }
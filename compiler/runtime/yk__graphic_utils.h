@@ -1,6 +1,9 @@
 // Reference -- https://mrl.cs.nyu.edu/~perlin/noise/
 // Library created by Bhathiya Perera
 // This is used for random.yaka and perlin.yaka
+#ifndef YK__GRAPHIC_UTILS_H
+#define YK__GRAPHIC_UTILS_H
+#include <stddef.h>
 #include <stdint.h>
 /**
  * Get perlin noise in 3 dimensions
@@ -24,12 +27,84 @@ double yk__perlin2d(double x, double y);
  */
 double yk__perlin1d(double x);
 /**
- * Initialize random number generation with time(NULL) and return as a uint64
- * @return
+ * Fill out with a width x height grid of 2d noise (row by row)
+ * out[j * width + i] = yk__perlin2d(x0 + i * step, y0 + j * step)
+ * Gradients are calculated once per lattice point instead of 4 times per
+ * point, results match yk__perlin2d within 1e-9 (compiler may fuse
+ * multiply/add differently in vectorized loop, otherwise they are equal)
+ * @param out buffer of at least width * height items
+ */
+void yk__perlin2d_fill(double *out, size_t width, size_t height, double x0,
+                       double y0, double step);
+/**
+ * Fill out with a width x height x depth grid of 3d noise (layer by layer)
+ * out[(k * height + j) * width + i] =
+ *          yk__perlin3d(x0 + i * step, y0 + j * step, z0 + k * step)
+ * Results match yk__perlin3d within 1e-9
+ * @param out buffer of at least width * height * depth items
+ */
+void yk__perlin3d_fill(double *out, size_t width, size_t height, size_t depth,
+                       double x0, double y0, double z0, double step);
+/**
+ * Random number generator state (xoshiro256**)
+ * Same seed produces the same sequence on every platform (crypto unsafe)
+ */
+struct yk__rng {
+  uint64_t s[4];
+};
+/**
+ * Seed given generator
+ * @param rng generator
+ * @param seed any value (including 0)
+ */
+void yk__rng_seed(struct yk__rng *rng, uint64_t seed);
+/**
+ * Create a new seeded generator (free with yk__rng_del)
+ * @param seed any value (including 0)
+ * @return generator or NULL if we are out of memory
+ */
+struct yk__rng *yk__rng_new(uint64_t seed);
+void yk__rng_del(struct yk__rng *rng);
+/**
+ * Next unsigned 64bit number from given generator
+ */
+uint64_t yk__rng_u64(struct yk__rng *rng);
+/**
+ * Next number in range [0, 1) from given generator
+ */
+double yk__rng_f64(struct yk__rng *rng);
+float yk__rng_f32(struct yk__rng *rng);
+/**
+ * Fill given buffer with random numbers (same as calling yk__rng_u64/f64
+ * count times, but faster)
+ * @param rng generator
+ * @param values buffer to fill
+ * @param count number of values in buffer
+ */
+void yk__rng_fill_u64(struct yk__rng *rng, uint64_t *values, size_t count);
+void yk__rng_fill_f64(struct yk__rng *rng, double *values, size_t count);
+/**
+ * Generator of current thread used by libs.random functions
+ * If a seed is not set, it is seeded differently for each thread
+ */
+struct yk__rng *yk__random_rng(void);
+/**
+ * Set seed of current thread's generator
+ */
+void yk__set_random_seed(uint64_t seed);
+/**
+ * Initialize random number generation of current thread with time(NULL)
+ * @return seed that was used
  */
 uint64_t yk__init_random();
 /**
  * Get a random -> unsigned 64bit number
  * @return
  */
-uint64_t yk__random_u64();
\ No newline at end of file
+uint64_t yk__random_u64();
+/**
+ * Get a random number in range [0, 1)
+ */
+double yk__random_f64();
+float yk__random_f32();
+#endif
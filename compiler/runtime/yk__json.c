@@ -0,0 +1,516 @@
+#include "yk__json.h"
+#include "yk__scan64.h"
+#include <stdlib.h>
+#include <string.h>
+// Buffer is padded so blocks can always be loaded as full 64 bytes
+#define YK__JSON_PADDING 64
+// Objects/arrays nested deeper than this are rejected
+#define YK__JSON_MAX_DEPTH 1024
+struct yk__json {
+  // Copy of input, followed by YK__JSON_PADDING nulls
+  uint8_t *buf;
+  size_t len;
+  // Byte position of each structural character (value id -> position)
+  uint32_t *pos;
+  // Value id after the end of each value (only set for value ids)
+  uint32_t *skip;
+  size_t count;
+  const char *error;
+  size_t error_offset;
+};
+static inline bool yk__json_is_delim(uint8_t c) {
+  switch (c) {
+    case ' ':
+    case '\t':
+    case '\n':
+    case '\r':
+    case ',':
+    case ':':
+    case '{':
+    case '}':
+    case '[':
+    case ']':
+    case '"':
+      return true;
+    default:
+      return false;
+  }
+}
+static inline uint8_t yk__json_ch(const struct yk__json *doc, int64_t value) {
+  if (value < 0 || (size_t) value >= doc->count) return 0;
+  return doc->buf[doc->pos[value]];
+}
+static void yk__json_fail(struct yk__json *doc, const char *error,
+                          size_t value) {
+  doc->error = error;
+  doc->error_offset = value < doc->count ? doc->pos[value] : doc->len;
+}
+// ---------------- pass 1: structural index ----------------
+static bool yk__json_index(struct yk__json *doc) {
+  const uint8_t *buf = doc->buf;
+  size_t len = doc->len;
+  size_t cap = len / 3 + 128;
+  uint32_t *pos = malloc(sizeof(uint32_t) * cap);
+  if (pos == NULL) {
+    doc->error = "out of memory";
+    return false;
+  }
+  size_t count = 0;
+  // State carried over from previous block
+  uint64_t prev_escaped = 0;  // first byte is escaped
+  uint64_t prev_in_string = 0;// all ones if block starts inside a string
+  uint64_t prev_scalar = 0;   // last byte was part of a number/literal
+  for (size_t base = 0; base < len; base += 64) {
+    const yk__block64 block = yk__block64_load(buf + base);
+    uint64_t quote = yk__block64_eq(&block, '"');
+    const uint64_t backslash = yk__block64_eq(&block, '\\');
+    const uint64_t ws = yk__block64_eq_any(&block, " \t\n\r", 4);
+    const uint64_t ops = yk__block64_eq_any(&block, "{}[]:,", 6);
+    // Bytes after an unescaped backslash are escaped
+    // (backslashes are rare, so they are walked one at a time)
+    uint64_t escaped = prev_escaped;
+    prev_escaped = 0;
+    uint64_t escapes = backslash & ~escaped;
+    while (escapes != 0) {
+      int i = yk__scan64_ctz(escapes);
+      if (i == 63) {
+        prev_escaped = 1;
+      } else {
+        escaped |= 1ULL << (i + 1);
+        escapes &= ~(1ULL << (i + 1));
+      }
+      escapes &= escapes - 1;
+    }
+    quote &= ~escaped;
+    // Opening quote and string content are set, closing quote is not
+    const uint64_t in_string = yk__prefix_xor64(quote) ^ prev_in_string;
+    prev_in_string = (uint64_t) ((int64_t) in_string >> 63);
+    const uint64_t outside = ~(in_string | quote);
+    const uint64_t scalar = ~(ws | ops) & outside;
+    const uint64_t scalar_start = scalar & ~((scalar << 1) | prev_scalar);
+    prev_scalar = scalar >> 63;
+    uint64_t structural = (ops & outside) | (quote & in_string) | scalar_start;
+    if (len - base < 64) { structural &= (1ULL << (len - base)) - 1; }
+    // Room for 64 positions, 3 extra writes and 2 sentinels at the end
+    if (count + 64 + 5 > cap) {
+      cap *= 2;
+      uint32_t *grown = realloc(pos, sizeof(uint32_t) * cap);
+      if (grown == NULL) {
+        free(pos);
+        doc->error = "out of memory";
+        return false;
+      }
+      pos = grown;
+    }
+    count += (size_t) yk__scan64_positions(structural, (uint32_t) base,
+                                           pos + count);
+  }
+  // Two sentinels pointing to the null after input, so pass 2 can look at
+  //   next character without a bounds check
+  pos[count] = (uint32_t) len;
+  pos[count + 1] = (uint32_t) len;
+  doc->pos = pos;
+  doc->count = count;
+  if (prev_in_string != 0) {
+    doc->error = "unterminated string";
+    doc->error_offset = len;
+    return false;
+  }
+  return true;
+}
+// ---------------- pass 2: tape ----------------
+// Position after the end of number/literal starting at p
+static size_t yk__json_token_end(const struct yk__json *doc, size_t p) {
+  while (p < doc->len && !yk__json_is_delim(doc->buf[p])) { p++; }
+  return p;
+}
+static bool yk__json_check_scalar(const struct yk__json *doc, size_t p) {
+  const uint8_t *s = doc->buf + p;
+  size_t len = yk__json_token_end(doc, p) - p;
+  switch (s[0]) {
+    case 't':
+      return len == 4 && memcmp(s, "true", 4) == 0;
+    case 'f':
+      return len == 5 && memcmp(s, "false", 5) == 0;
+    case 'n':
+      return len == 4 && memcmp(s, "null", 4) == 0;
+    default:
+      break;
+  }
+  if (s[0] != '-' && (s[0] < '0' || s[0] > '9')) return false;
+  for (size_t i = 1; i < len; i++) {
+    uint8_t c = s[i];
+    if ((c < '0' || c > '9') && c != '.' && c != 'e' && c != 'E' &&
+        c != '+' && c != '-') {
+      return false;
+    }
+  }
+  return true;
+}
+enum yk__json_expect { yk__json_value_next, yk__json_key_next, yk__json_end };
+static bool yk__json_tape(struct yk__json *doc) {
+  const size_t n = doc->count;
+  const uint8_t *buf = doc->buf;
+  const uint32_t *pos = doc->pos;
+  uint32_t *skip = calloc(n + 1, sizeof(uint32_t));
+  if (skip == NULL) {
+    doc->error = "out of memory";
+    return false;
+  }
+  doc->skip = skip;
+  // Value ids of open objects/arrays
+  uint32_t stack[YK__JSON_MAX_DEPTH];
+  size_t depth = 0;
+  enum yk__json_expect expect = yk__json_value_next;
+  size_t i = 0;
+  // i is at most n here, so i + 1 is a sentinel at worst
+  for (;;) {
+    const uint8_t c = buf[pos[i]];
+    if (expect == yk__json_value_next) {
+      if (c == '{' || c == '[') {
+        if (depth == YK__JSON_MAX_DEPTH) {
+          yk__json_fail(doc, "too deeply nested", i);
+          break;
+        }
+        const uint8_t close = c == '{' ? '}' : ']';
+        if (buf[pos[i + 1]] == close) {
+          skip[i] = (uint32_t) (i + 2);
+          i += 2;
+          expect = yk__json_end;
+        } else {
+          stack[depth++] = (uint32_t) i;
+          i++;
+          expect = c == '{' ? yk__json_key_next : yk__json_value_next;
+        }
+        continue;
+      }
+      if (c == 0 || c == '}' || c == ']' || c == ':' || c == ',') {
+        yk__json_fail(doc, "expected a value", i);
+        break;
+      }
+      if (c != '"' && !yk__json_check_scalar(doc, pos[i])) {
+        yk__json_fail(doc, "invalid number or literal", i);
+        break;
+      }
+      skip[i] = (uint32_t) (i + 1);
+      i++;
+      expect = yk__json_end;
+    } else if (expect == yk__json_key_next) {
+      if (c != '"') {
+        yk__json_fail(doc, "expected a string key", i);
+        break;
+      }
+      skip[i] = (uint32_t) (i + 1);
+      if (buf[pos[i + 1]] != ':') {
+        yk__json_fail(doc, "expected ':'", i + 1);
+        break;
+      }
+      i += 2;
+      expect = yk__json_value_next;
+    } else {
+      if (depth == 0) {
+        if (i != n) { yk__json_fail(doc, "unexpected data after value", i); }
+        break;
+      }
+      const uint32_t top = stack[depth - 1];
+      const uint8_t open = buf[pos[top]];
+      if (c == ',') {
+        i++;
+        expect = open == '{' ? yk__json_key_next : yk__json_value_next;
+      } else if (c == (open == '{' ? '}' : ']')) {
+        skip[top] = (uint32_t) (i + 1);
+        depth--;
+        i++;
+      } else {
+        yk__json_fail(doc,
+                      open == '{' ? "expected ',' or '}'" : "expected ',' or ']'",
+                      i);
+        break;
+      }
+    }
+  }
+  return doc->error == NULL;
+}
+struct yk__json *yk__json_parse(const char *data, size_t length) {
+  struct yk__json *doc = calloc(1, sizeof(struct yk__json));
+  if (doc == NULL) return NULL;
+  // Positions are stored as 32bit
+  if (length >= UINT32_MAX - YK__JSON_PADDING) {
+    doc->error = "input is too large";
+    return doc;
+  }
+  doc->buf = malloc(length + YK__JSON_PADDING);
+  if (doc->buf == NULL) {
+    doc->error = "out of memory";
+    return doc;
+  }
+  if (length > 0) { memcpy(doc->buf, data, length); }
+  memset(doc->buf + length, 0, YK__JSON_PADDING);
+  doc->len = length;
+  if (yk__json_index(doc)) { yk__json_tape(doc); }
+  return doc;
+}
+void yk__json_del(struct yk__json *doc) {
+  if (doc == NULL) return;
+  free(doc->buf);
+  free(doc->pos);
+  free(doc->skip);
+  free(doc);
+}
+const char *yk__json_error(struct yk__json *doc) { return doc->error; }
+int64_t yk__json_error_offset(struct yk__json *doc) {
+  return (int64_t) doc->error_offset;
+}
+// ---------------- navigation ----------------
+int64_t yk__json_root(struct yk__json *doc) {
+  return doc->error == NULL ? 0 : -1;
+}
+static inline bool yk__json_valid_id(const struct yk__json *doc,
+                                     int64_t value) {
+  return doc->error == NULL && value >= 0 && (size_t) value < doc->count;
+}
+int yk__json_kind(struct yk__json *doc, int64_t value) {
+  if (!yk__json_valid_id(doc, value)) return YK__JSON_INVALID;
+  switch (yk__json_ch(doc, value)) {
+    case '{':
+      return YK__JSON_OBJECT;
+    case '[':
+      return YK__JSON_ARRAY;
+    case '"':
+      return YK__JSON_STRING;
+    case 't':
+      return YK__JSON_TRUE;
+    case 'f':
+      return YK__JSON_FALSE;
+    case 'n':
+      return YK__JSON_NULL;
+    case '}':
+    case ']':
+    case ':':
+    case ',':
+      return YK__JSON_INVALID;
+    default:
+      return YK__JSON_NUMBER;
+  }
+}
+int64_t yk__json_first(struct yk__json *doc, int64_t value) {
+  if (!yk__json_valid_id(doc, value)) return -1;
+  uint8_t c = yk__json_ch(doc, value);
+  if (c == '{') { return yk__json_ch(doc, value + 1) == '}' ? -1 : value + 1; }
+  if (c == '[') { return yk__json_ch(doc, value + 1) == ']' ? -1 : value + 1; }
+  return -1;
+}
+static inline bool yk__json_is_key(const struct yk__json *doc, int64_t value) {
+  return yk__json_ch(doc, value) == '"' && yk__json_ch(doc, value + 1) == ':';
+}
+int64_t yk__json_next(struct yk__json *doc, int64_t value) {
+  if (!yk__json_valid_id(doc, value)) return -1;
+  int64_t after = yk__json_is_key(doc, value) ? doc->skip[value + 2]
+                                               : doc->skip[value];
+  return yk__json_ch(doc, after) == ',' ? after + 1 : -1;
+}
+int64_t yk__json_value(struct yk__json *doc, int64_t key) {
+  if (!yk__json_valid_id(doc, key) || !yk__json_is_key(doc, key)) return -1;
+  return key + 2;
+}
+int64_t yk__json_length(struct yk__json *doc, int64_t value) {
+  int64_t length = 0;
+  for (int64_t item = yk__json_first(doc, value); item >= 0;
+       item = yk__json_next(doc, item)) {
+    length++;
+  }
+  return length;
+}
+// Position of closing quote of string starting at p
+static size_t yk__json_string_end(const struct yk__json *doc, size_t p) {
+  const uint8_t *buf = doc->buf;
+  size_t from = p + 1;
+  for (;;) {
+    const uint8_t *quote = memchr(buf + from, '"', doc->len - from);
+    if (quote == NULL) return doc->len;
+    size_t end = (size_t) (quote - buf);
+    // Quote is escaped if there are odd number of backslashes before it
+    size_t backslashes = 0;
+    while (end - backslashes > p + 1 && buf[end - backslashes - 1] == '\\') {
+      backslashes++;
+    }
+    if ((backslashes & 1) == 0) return end;
+    from = end + 1;
+  }
+}
+int64_t yk__json_get(struct yk__json *doc, int64_t object, const char *key,
+                     size_t key_length) {
+  if (!yk__json_valid_id(doc, object) || yk__json_ch(doc, object) != '{') {
+    return -1;
+  }
+  for (int64_t k = yk__json_first(doc, object); k >= 0;
+       k = yk__json_next(doc, k)) {
+    size_t p = doc->pos[k];
+    size_t end = p + 1 + key_length;
+    if (end < doc->len && doc->buf[end] == '"' &&
+        memcmp(doc->buf + p + 1, key, key_length) == 0 &&
+        yk__json_string_end(doc, p) == end) {
+      return k + 2;
+    }
+  }
+  return -1;
+}
+int64_t yk__json_at(struct yk__json *doc, int64_t array, int64_t index) {
+  if (yk__json_ch(doc, array) != '[' || index < 0) return -1;
+  int64_t item = yk__json_first(doc, array);
+  while (item >= 0 && index > 0) {
+    item = yk__json_next(doc, item);
+    index--;
+  }
+  return item;
+}
+// ---------------- values ----------------
+struct yk__bstr yk__json_raw(struct yk__json *doc, int64_t value) {
+  if (!yk__json_valid_id(doc, value)) return yk__bstr_s(NULL, 0);
+  size_t p = doc->pos[value];
+  const char *start = (const char *) doc->buf + p;
+  switch (doc->buf[p]) {
+    case '"':
+      return yk__bstr_s(start + 1, yk__json_string_end(doc, p) - p - 1);
+    case '{':
+    case '[':
+      return yk__bstr_s(start,
+                        doc->pos[doc->skip[value] - 1] + (size_t) 1 - p);
+    default:
+      return yk__bstr_s(start, yk__json_token_end(doc, p) - p);
+  }
+}
+static int yk__json_hex4(const uint8_t *s, uint32_t *code) {
+  uint32_t v = 0;
+  for (int i = 0; i < 4; i++) {
+    uint8_t c = s[i];
+    v <<= 4;
+    if (c >= '0' && c <= '9') {
+      v |= (uint32_t) (c - '0');
+    } else if (c >= 'a' && c <= 'f') {
+      v |= (uint32_t) (c - 'a' + 10);
+    } else if (c >= 'A' && c <= 'F') {
+      v |= (uint32_t) (c - 'A' + 10);
+    } else {
+      return 0;
+    }
+  }
+  *code = v;
+  return 1;
+}
+static yk__sds yk__json_append_utf8(yk__sds out, uint32_t code) {
+  char b[4];
+  size_t n;
+  if (code < 0x80) {
+    b[0] = (char) code;
+    n = 1;
+  } else if (code < 0x800) {
+    b[0] = (char) (0xC0 | (code >> 6));
+    b[1] = (char) (0x80 | (code & 0x3F));
+    n = 2;
+  } else if (code < 0x10000) {
+    b[0] = (char) (0xE0 | (code >> 12));
+    b[1] = (char) (0x80 | ((code >> 6) & 0x3F));
+    b[2] = (char) (0x80 | (code & 0x3F));
+    n = 3;
+  } else {
+    b[0] = (char) (0xF0 | (code >> 18));
+    b[1] = (char) (0x80 | ((code >> 12) & 0x3F));
+    b[2] = (char) (0x80 | ((code >> 6) & 0x3F));
+    b[3] = (char) (0x80 | (code & 0x3F));
+    n = 4;
+  }
+  return yk__sdscatlen(out, b, n);
+}
+static yk__sds yk__json_unescape(const uint8_t *s, size_t len) {
+  yk__sds out = yk__sdsMakeRoomFor(yk__sdsempty(), len);
+  size_t i = 0;
+  while (i < len) {
+    const uint8_t *backslash = memchr(s + i, '\\', len - i);
+    size_t run = backslash == NULL ? len - i : (size_t) (backslash - s) - i;
+    out = yk__sdscatlen(out, s + i, run);
+    i += run;
+    if (i + 1 >= len) break;
+    uint8_t c = s[i + 1];
+    i += 2;
+    char single = 0;
+    switch (c) {
+      case '"':
+      case '\\':
+      case '/':
+        single = (char) c;
+        break;
+      case 'b':
+        single = '\b';
+        break;
+      case 'f':
+        single = '\f';
+        break;
+      case 'n':
+        single = '\n';
+        break;
+      case 'r':
+        single = '\r';
+        break;
+      case 't':
+        single = '\t';
+        break;
+      case 'u': {
+        uint32_t code;
+        if (i + 4 > len || !yk__json_hex4(s + i, &code)) {
+          out = yk__sdscatlen(out, "\\u", 2);
+          continue;
+        }
+        i += 4;
+        // Surrogate pair
+        uint32_t low;
+        if (code >= 0xD800 && code <= 0xDBFF && i + 6 <= len &&
+            s[i] == '\\' && s[i + 1] == 'u' && yk__json_hex4(s + i + 2, &low) &&
+            low >= 0xDC00 && low <= 0xDFFF) {
+          code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+          i += 6;
+        }
+        out = yk__json_append_utf8(out, code);
+        continue;
+      }
+      default:
+        // Unknown escape, keep it as it is
+        out = yk__sdscatlen(out, s + i - 2, 2);
+        continue;
+    }
+    out = yk__sdscatlen(out, &single, 1);
+  }
+  return out;
+}
+yk__sds yk__json_str(struct yk__json *doc, int64_t value) {
+  if (yk__json_kind(doc, value) == YK__JSON_STRING) {
+    size_t p = doc->pos[value];
+    return yk__json_unescape(doc->buf + p + 1,
+                             yk__json_string_end(doc, p) - p - 1);
+  }
+  struct yk__bstr raw = yk__json_raw(doc, value);
+  return yk__sdsnewlen(yk__bstr_get_reference(raw), yk__bstr_len(raw));
+}
+double yk__json_f64(struct yk__json *doc, int64_t value) {
+  if (yk__json_kind(doc, value) != YK__JSON_NUMBER) return 0.0;
+  // Buffer is padded with nulls, so strtod stops at end of number
+  return strtod((const char *) doc->buf + doc->pos[value], NULL);
+}
+int64_t yk__json_i64(struct yk__json *doc, int64_t value) {
+  if (yk__json_kind(doc, value) != YK__JSON_NUMBER) return 0;
+  const uint8_t *s = doc->buf + doc->pos[value];
+  bool negative = s[0] == '-';
+  if (negative) { s++; }
+  uint64_t result = 0;
+  while (*s >= '0' && *s <= '9') {
+    result = result * 10 + (uint64_t) (*s - '0');
+    s++;
+  }
+  if (*s == '.' || *s == 'e' || *s == 'E') {
+    return (int64_t) yk__json_f64(doc, value);
+  }
+  return negative ? (int64_t) (0 - result) : (int64_t) result;
+}
+bool yk__json_bool(struct yk__json *doc, int64_t value) {
+  return yk__json_kind(doc, value) == YK__JSON_TRUE;
+}
@@ -0,0 +1,101 @@
+// JSON reader used by libs.fileformats.json
+// Library created by Bhathiya Perera
+#ifndef YK__JSON_H
+#define YK__JSON_H
+#include "yk__lib.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+/**
+ * Input is copied once to a padded buffer, then parsed in two passes
+ *   1) Structural index: 64 bytes at a time (SSE2/NEON when available) find
+ *      positions of {}[]:, outside strings, start of each string and start
+ *      of each number/true/false/null
+ *   2) Tape: walk the index once to check nesting and to store where each
+ *      value ends, so skipping an object/array is a single lookup
+ * Values are referred to with their position in the index (a value id)
+ *   -1 is used for missing values and every function accepts it
+ * Strings/numbers are not copied while parsing, yk__json_raw returns a view
+ *   into the document buffer
+ */
+struct yk__json;
+#define YK__JSON_INVALID 0
+#define YK__JSON_OBJECT 1
+#define YK__JSON_ARRAY 2
+#define YK__JSON_STRING 3
+#define YK__JSON_NUMBER 4
+#define YK__JSON_TRUE 5
+#define YK__JSON_FALSE 6
+#define YK__JSON_NULL 7
+/**
+ * Parse given data (data is copied, it does not need to outlive document)
+ * @return document (check yk__json_error) or NULL if we are out of memory
+ */
+struct yk__json *yk__json_parse(const char *data, size_t length);
+void yk__json_del(struct yk__json *doc);
+/**
+ * Error message or NULL if document was parsed without errors
+ */
+const char *yk__json_error(struct yk__json *doc);
+/**
+ * Byte offset of error in input
+ */
+int64_t yk__json_error_offset(struct yk__json *doc);
+/**
+ * Value id of top level value (-1 if there was an error)
+ */
+int64_t yk__json_root(struct yk__json *doc);
+/**
+ * One of YK__JSON_* kinds (object keys are strings)
+ */
+int yk__json_kind(struct yk__json *doc, int64_t value);
+/**
+ * Number of items in an array/object, 0 for everything else
+ */
+int64_t yk__json_length(struct yk__json *doc, int64_t value);
+/**
+ * First item of an array, first key of an object
+ * @return value id or -1 if empty/not an array or object
+ */
+int64_t yk__json_first(struct yk__json *doc, int64_t value);
+/**
+ * Next item of an array (or next key if given value is a key)
+ * @return value id or -1 if there are no more items
+ */
+int64_t yk__json_next(struct yk__json *doc, int64_t value);
+/**
+ * Value of given object key (use with yk__json_first/yk__json_next)
+ */
+int64_t yk__json_value(struct yk__json *doc, int64_t key);
+/**
+ * Value of key in object, keys are compared as they are in input (escape
+ *   sequences are not decoded)
+ * @return value id or -1 if key is not found
+ */
+int64_t yk__json_get(struct yk__json *doc, int64_t object, const char *key,
+                     size_t key_length);
+/**
+ * Item at index of an array
+ * @return value id or -1 if index is out of range
+ */
+int64_t yk__json_at(struct yk__json *doc, int64_t array, int64_t index);
+/**
+ * View of value in document buffer, valid until document is deleted
+ * Strings are returned without quotes and escape sequences are not decoded
+ * Objects and arrays are returned as they are in input
+ */
+struct yk__bstr yk__json_raw(struct yk__json *doc, int64_t value);
+/**
+ * New string with escape sequences decoded (same as raw for non strings)
+ */
+yk__sds yk__json_str(struct yk__json *doc, int64_t value);
+/**
+ * Number value, 0 if this is not a number
+ */
+int64_t yk__json_i64(struct yk__json *doc, int64_t value);
+double yk__json_f64(struct yk__json *doc, int64_t value);
+/**
+ * true only for true values
+ */
+bool yk__json_bool(struct yk__json *doc, int64_t value);
+#endif
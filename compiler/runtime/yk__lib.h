@@ -1,3 +1,207 @@
+/**
+ * Arena (region) allocator
+ * Copyright (C) 2024 Bhathiya Perera (JaDogg)
+ *
+ * yk__arena_begin starts an arena for the current thread and yk__arena_end
+ *  releases everything allocated from it in one go.
+ * If YK__ARENA_ALLOC is defined, strings (sds), arrays/maps (stb_ds) and class
+ *  objects are allocated from the active arena instead of malloc. Freeing
+ *  memory owned by an active arena does nothing.
+ * Every allocation made through these functions (heap ones included) starts
+ *  with a small header that records its owner arena, so freeing does not
+ *  need to search the arena chunks.
+ * Memory that was allocated before the arena started stays on the heap, it can
+ *  be freed or grown while the arena is active.
+ * Arena memory must not be kept after yk__arena_end. Compiler only allows
+ *  @arena functions to return values that do not need memory, and rejects
+ *  storing values that need memory in to parameters, objects or arrays
+ *  reached through parameters, or containers passed to other functions
+ *  along with them. Objects and containers reached through parameters can
+ *  only be passed to other @arena functions, as the active arena is used by
+ *  any function that is called. C code (ccode, inlinec, native functions) is
+ *  not checked.
+ */
+#ifndef YK__ARENA
+#define YK__ARENA
+#include <stddef.h>
+#if defined(YK__WASM4)
+#define YK__THREAD_LOCAL
+#elif defined(_MSC_VER)
+#define YK__THREAD_LOCAL __declspec(thread)
+#else
+#define YK__THREAD_LOCAL __thread
+#endif
+struct yk__arena;
+// Header before each allocation, this keeps 16 byte alignment
+#define YK__ARENA_ALIGN 16
+struct yk__arena_header {
+  size_t size;
+  struct yk__arena *owner;// NULL for heap memory
+};
+/**
+ * Start a new arena, this becomes the active arena of current thread
+ * @return arena or NULL if we are out of memory
+ */
+struct yk__arena *yk__arena_begin(void);
+/**
+ * Release all memory of given arena, previous arena becomes active again
+ * @param arena arena returned by yk__arena_begin (can be NULL)
+ */
+void yk__arena_end(struct yk__arena *arena);
+/**
+ * Allocate zero initialized memory from active arena
+ * @param size size in bytes
+ * @return memory or NULL if no arena is active
+ */
+void *yk__arena_calloc(size_t size);
+/**
+ * Check if given pointer is owned by an arena
+ * @param ptr pointer returned by one of yk__arena_* allocation functions
+ * @return 1 if owned by an arena, 0 otherwise
+ */
+int yk__arena_owns(void *ptr);
+// malloc, realloc and free that use active arena if present
+void *yk__arena_malloc(size_t size);
+void *yk__arena_realloc(void *ptr, size_t size);
+void yk__arena_free(void *ptr);
+#ifdef YK__ARENA_IMPLEMENTATION
+#include <stdlib.h>// malloc
+#include <string.h>// memcpy, memset
+#define YK__ARENA_FIRST_CHUNK (64 * 1024)
+#define YK__ARENA_MAX_CHUNK (4 * 1024 * 1024)
+#define YK__ARENA_ROUND(x)                                                     \
+  (((x) + (YK__ARENA_ALIGN - 1)) & ~((size_t) YK__ARENA_ALIGN - 1))
+struct yk__arena_chunk {
+  struct yk__arena_chunk *next;
+  char *end;
+};
+struct yk__arena {
+  struct yk__arena *previous;
+  struct yk__arena_chunk *chunks;// newest first
+  char *top;
+  char *end;
+  size_t next_chunk_size;
+  char *last;// last allocation, can be grown in place
+};
+#define YK__ARENA_CHUNK_HEADER YK__ARENA_ROUND(sizeof(struct yk__arena_chunk))
+#define YK__ARENA_HEADER YK__ARENA_ROUND(sizeof(struct yk__arena))
+static YK__THREAD_LOCAL struct yk__arena *yk__arena_active = NULL;
+// First chunk of last ended arena, reused so short lived arenas do not malloc
+static YK__THREAD_LOCAL struct yk__arena_chunk *yk__arena_spare = NULL;
+static int yk__arena_grow(struct yk__arena *arena, size_t needed) {
+  size_t size = arena->next_chunk_size;
+  while (size < needed + YK__ARENA_CHUNK_HEADER) { size *= 2; }
+  struct yk__arena_chunk *chunk = (struct yk__arena_chunk *) malloc(size);
+  if (chunk == NULL) return 0;
+  chunk->end = (char *) chunk + size;
+  chunk->next = arena->chunks;
+  arena->chunks = chunk;
+  arena->top = (char *) chunk + YK__ARENA_CHUNK_HEADER;
+  arena->end = chunk->end;
+  arena->last = NULL;
+  if (arena->next_chunk_size < YK__ARENA_MAX_CHUNK) {
+    arena->next_chunk_size *= 2;
+  }
+  return 1;
+}
+static void *yk__arena_bump(struct yk__arena *arena, size_t size) {
+  size_t needed = YK__ARENA_ALIGN + YK__ARENA_ROUND(size);
+  if ((size_t) (arena->end - arena->top) < needed) {
+    if (!yk__arena_grow(arena, needed)) return NULL;
+  }
+  struct yk__arena_header *header = (struct yk__arena_header *) arena->top;
+  arena->top += needed;
+  header->size = YK__ARENA_ROUND(size);
+  header->owner = arena;
+  arena->last = (char *) header + YK__ARENA_ALIGN;
+  return arena->last;
+}
+#define YK__ARENA_HEADER_OF(ptr)                                               \
+  ((struct yk__arena_header *) ((char *) (ptr) - YK__ARENA_ALIGN))
+static void *yk__arena_heap(struct yk__arena_header *header, size_t size) {
+  if (header == NULL) return NULL;
+  header->size = size;
+  header->owner = NULL;
+  return (char *) header + YK__ARENA_ALIGN;
+}
+struct yk__arena *yk__arena_begin(void) {
+  struct yk__arena_chunk *chunk = yk__arena_spare;
+  yk__arena_spare = NULL;
+  if (chunk == NULL) {
+    chunk = (struct yk__arena_chunk *) malloc(YK__ARENA_FIRST_CHUNK);
+    if (chunk == NULL) return NULL;
+    chunk->end = (char *) chunk + YK__ARENA_FIRST_CHUNK;
+  }
+  chunk->next = NULL;
+  // Arena itself lives at the start of its first chunk
+  struct yk__arena *arena =
+      (struct yk__arena *) ((char *) chunk + YK__ARENA_CHUNK_HEADER);
+  arena->previous = yk__arena_active;
+  arena->chunks = chunk;
+  arena->top = (char *) arena + YK__ARENA_HEADER;
+  arena->end = chunk->end;
+  arena->next_chunk_size = YK__ARENA_FIRST_CHUNK * 2;
+  arena->last = NULL;
+  yk__arena_active = arena;
+  return arena;
+}
+void yk__arena_end(struct yk__arena *arena) {
+  if (arena == NULL) return;
+  yk__arena_active = arena->previous;
+  struct yk__arena_chunk *chunk = arena->chunks;
+  while (chunk != NULL) {
+    struct yk__arena_chunk *next = chunk->next;
+    if (next == NULL && yk__arena_spare == NULL) {
+      yk__arena_spare = chunk;// first chunk, arena is inside it
+    } else {
+      free(chunk);
+    }
+    chunk = next;
+  }
+}
+int yk__arena_owns(void *ptr) {
+  return ptr != NULL && YK__ARENA_HEADER_OF(ptr)->owner != NULL;
+}
+void *yk__arena_calloc(size_t size) {
+  if (yk__arena_active == NULL) return NULL;
+  void *ptr = yk__arena_bump(yk__arena_active, size);
+  if (ptr != NULL) { memset(ptr, 0, size); }
+  return ptr;
+}
+void *yk__arena_malloc(size_t size) {
+  if (yk__arena_active != NULL) return yk__arena_bump(yk__arena_active, size);
+  return yk__arena_heap(
+      (struct yk__arena_header *) malloc(YK__ARENA_ALIGN + size), size);
+}
+void *yk__arena_realloc(void *ptr, size_t size) {
+  if (ptr == NULL) return yk__arena_malloc(size);
+  struct yk__arena_header *header = YK__ARENA_HEADER_OF(ptr);
+  struct yk__arena *arena = header->owner;
+  if (arena == NULL) {
+    return yk__arena_heap((struct yk__arena_header *) realloc(
+                              header, YK__ARENA_ALIGN + size),
+                          size);
+  }
+  if (size <= header->size) return ptr;
+  // Grow last allocation in place if there is room
+  size_t extra = YK__ARENA_ROUND(size) - header->size;
+  if (arena->last == ptr && (size_t) (arena->end - arena->top) >= extra) {
+    arena->top += extra;
+    header->size += extra;
+    return ptr;
+  }
+  // Stay in the arena that owns this memory
+  void *moved = yk__arena_bump(arena, size);
+  if (moved != NULL) { memcpy(moved, ptr, header->size); }
+  return moved;
+}
+void yk__arena_free(void *ptr) {
+  if (ptr == NULL) return;
+  struct yk__arena_header *header = YK__ARENA_HEADER_OF(ptr);
+  if (header->owner == NULL) { free(header); }
+}
+#endif
+#endif
 
 /*
 Copyright (c) 2006-2014, Salvatore Sanfilippo <antirez at gmail dot com>
@@ -263,9 +467,15 @@ int yk__sdsTest(int argc, char *argv[]);
  * Just define the following defines to what you want to use. Also add
  * the include of your alternate allocator if needed (not needed in order
  * to use the default libc allocator). */
+#if defined(YK__ARENA_ALLOC)
+#define yk__s_malloc yk__arena_malloc
+#define yk__s_realloc yk__arena_realloc
+#define yk__s_free yk__arena_free
+#else
 #define yk__s_malloc malloc
 #define yk__s_realloc realloc
 #define yk__s_free free
+#endif
 #include <assert.h>
 #include <ctype.h>
 #include <limits.h>
@@ -1886,6 +2096,11 @@ CREDITS
     !defined(YK__STBDS_REALLOC) && defined(YK__STBDS_FREE)
 #error "You must define both YK__STBDS_REALLOC and YK__STBDS_FREE, or neither."
 #endif
+#if !defined(YK__STBDS_REALLOC) && !defined(YK__STBDS_FREE) &&               \
+    defined(YK__ARENA_ALLOC)
+#define YK__STBDS_REALLOC(c, p, s) yk__arena_realloc(p, s)
+#define YK__STBDS_FREE(c, p) yk__arena_free(p)
+#endif
 #if !defined(YK__STBDS_REALLOC) && !defined(YK__STBDS_FREE)
 #include <stdlib.h>
 #define YK__STBDS_REALLOC(c, p, s) realloc(p, s)
@@ -3572,6 +3787,291 @@ int yk__quicksort(void *arr, size_t item_size, size_t elements,
 }
 #endif
 #endif
+/**
+ * Slab allocator for class objects
+ * Copyright (C) 2024 Bhathiya Perera (JaDogg)
+ *
+ * Compiled code allocates and deletes class objects with yk__obj_alloc and
+ *  yk__obj_free, these use calloc/free unless YK__SLAB_ALLOC is defined.
+ * yk__obj_free takes the size from the struct pointer it is given, so
+ *  freeing never depends on the compiler knowing the class name.
+ * With YK__SLAB_ALLOC, objects up to YK__SLAB_MAX_SIZE bytes come from
+ *  per thread free lists of fixed size slots (one list per 16 byte size
+ *  class), so there is no per object malloc header.
+ * A thread keeps at most 2 * YK__SLAB_BATCH free slots per size class, more
+ *  are moved in batches to a shared depot (under a lock) and threads take
+ *  batches from there before allocating a new chunk. A thread created
+ *  with pthreads, tinycthread or CreateThread gives all its free slots to
+ *  the depot when it exits.
+ * Objects may be freed from a different thread than the one that allocated
+ *  them (eg: producer/consumer), slots go back to the allocating thread
+ *  through the depot.
+ * Slots are reused but never given back to the system.
+ */
+#ifndef YK__SLAB
+#define YK__SLAB
+#include <stddef.h>
+#define YK__SLAB_ALIGN 16
+#define YK__SLAB_MAX_SIZE 512
+#define YK__SLAB_CLASSES (YK__SLAB_MAX_SIZE / YK__SLAB_ALIGN)
+#define YK__SLAB_CHUNK_SIZE (64 * 1024)
+#define YK__SLAB_BATCH 64
+/**
+ * Allocate zero initialized memory of given size
+ * @param size size in bytes
+ * @return allocated memory or NULL if we are out of memory
+ */
+void *yk__slab_alloc(size_t size);
+/**
+ * Free memory allocated with yk__slab_alloc
+ * @param ptr pointer (can be NULL)
+ * @param size size in bytes, same as what was passed to yk__slab_alloc
+ */
+void yk__slab_free(void *ptr, size_t size);
+#if defined(YK__SLAB_ALLOC)
+#define yk__obj_heap_alloc(size) yk__slab_alloc(size)
+#define yk__obj_heap_free(ptr, size) yk__slab_free((ptr), (size))
+#else
+#define yk__obj_heap_alloc(size) calloc(1, (size))
+#define yk__obj_heap_free(ptr, size) free(ptr)
+#endif
+#if defined(YK__ARENA_ALLOC)
+// Objects created while an arena is active belong to that arena
+void *yk__arena_obj_alloc(size_t size);
+void yk__arena_obj_free(void *ptr, size_t size);
+#define yk__obj_alloc(T) yk__arena_obj_alloc(sizeof(T))
+#define yk__obj_free(ptr) yk__arena_obj_free((ptr), sizeof(*(ptr)))
+#else
+#define yk__obj_alloc(T) yk__obj_heap_alloc(sizeof(T))
+#define yk__obj_free(ptr) yk__obj_heap_free((ptr), sizeof(*(ptr)))
+#endif
+#ifdef YK__SLAB_IMPLEMENTATION
+#include <stdlib.h>// malloc
+#include <string.h>// memset
+#if defined(YK__WASM4)
+// Single threaded, no locking or thread exit callback
+#define yk__slab_lock()
+#define yk__slab_unlock()
+#define yk__slab_register_thread()
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+static SRWLOCK yk__slab_depot_lock = SRWLOCK_INIT;
+#define yk__slab_lock() AcquireSRWLockExclusive(&yk__slab_depot_lock)
+#define yk__slab_unlock() ReleaseSRWLockExclusive(&yk__slab_depot_lock)
+#else
+#include <pthread.h>
+static pthread_mutex_t yk__slab_depot_lock = PTHREAD_MUTEX_INITIALIZER;
+#define yk__slab_lock() pthread_mutex_lock(&yk__slab_depot_lock)
+#define yk__slab_unlock() pthread_mutex_unlock(&yk__slab_depot_lock)
+#endif
+struct yk__slab_slot {
+  struct yk__slab_slot *next;
+};
+// A list of free slots
+struct yk__slab_batch {
+  struct yk__slab_slot *head;
+  size_t count;
+};
+// Slots are freed to and allocated from current, when it has
+//  YK__SLAB_BATCH slots it becomes full (previous full batch goes to depot)
+static YK__THREAD_LOCAL struct yk__slab_batch
+    yk__slab_current[YK__SLAB_CLASSES];
+static YK__THREAD_LOCAL struct yk__slab_slot *yk__slab_full[YK__SLAB_CLASSES];
+// Batches shared by all threads, protected by the depot lock
+static struct yk__slab_batch *yk__slab_depot[YK__SLAB_CLASSES];
+static size_t yk__slab_depot_count[YK__SLAB_CLASSES];
+static size_t yk__slab_depot_capacity[YK__SLAB_CLASSES];
+/**
+ * Put a batch in to the depot
+ * @param size_class size class index
+ * @param batch batch to give (must not be empty)
+ * @return 1 if successful, 0 if we are out of memory
+ */
+static int yk__slab_give_batch(size_t size_class, struct yk__slab_batch batch) {
+  int given = 1;
+  yk__slab_lock();
+  if (yk__slab_depot_count[size_class] == yk__slab_depot_capacity[size_class]) {
+    size_t capacity = yk__slab_depot_capacity[size_class] * 2 + 8;
+    struct yk__slab_batch *depot = (struct yk__slab_batch *) realloc(
+        yk__slab_depot[size_class], capacity * sizeof(struct yk__slab_batch));
+    if (depot == NULL) {
+      given = 0;
+    } else {
+      yk__slab_depot[size_class] = depot;
+      yk__slab_depot_capacity[size_class] = capacity;
+    }
+  }
+  if (given) {
+    yk__slab_depot[size_class][yk__slab_depot_count[size_class]++] = batch;
+  }
+  yk__slab_unlock();
+  return given;
+}
+/**
+ * Take a batch from the depot
+ * @param size_class size class index
+ * @param batch taken batch is written here
+ * @return 1 if successful, 0 if depot is empty
+ */
+static int yk__slab_take_batch(size_t size_class,
+                               struct yk__slab_batch *batch) {
+  int taken = 0;
+  yk__slab_lock();
+  if (yk__slab_depot_count[size_class] > 0) {
+    *batch = yk__slab_depot[size_class][--yk__slab_depot_count[size_class]];
+    taken = 1;
+  }
+  yk__slab_unlock();
+  return taken;
+}
+#if !defined(YK__WASM4)
+// Give free slots of an exiting thread to the depot
+static void yk__slab_thread_exit(void) {
+  for (size_t i = 0; i < YK__SLAB_CLASSES; i++) {
+    if (yk__slab_full[i] != NULL) {
+      struct yk__slab_batch full = {yk__slab_full[i], YK__SLAB_BATCH};
+      yk__slab_give_batch(i, full);
+      yk__slab_full[i] = NULL;
+    }
+    if (yk__slab_current[i].head != NULL) {
+      yk__slab_give_batch(i, yk__slab_current[i]);
+      yk__slab_current[i].head = NULL;
+      yk__slab_current[i].count = 0;
+    }
+  }
+}
+static YK__THREAD_LOCAL int yk__slab_thread_registered = 0;
+#if defined(_WIN32) || defined(_WIN64)
+static DWORD yk__slab_fls_index = FLS_OUT_OF_INDEXES;
+static INIT_ONCE yk__slab_fls_once = INIT_ONCE_STATIC_INIT;
+static void WINAPI yk__slab_fls_callback(PVOID data) {
+  if (data != NULL) { yk__slab_thread_exit(); }
+}
+static BOOL CALLBACK yk__slab_fls_init(PINIT_ONCE once, PVOID param,
+                                      PVOID *context) {
+  yk__slab_fls_index = FlsAlloc(yk__slab_fls_callback);
+  return TRUE;
+}
+static void yk__slab_register_thread(void) {
+  if (yk__slab_thread_registered) return;
+  yk__slab_thread_registered = 1;
+  InitOnceExecuteOnce(&yk__slab_fls_once, yk__slab_fls_init, NULL, NULL);
+  if (yk__slab_fls_index != FLS_OUT_OF_INDEXES) {
+    FlsSetValue(yk__slab_fls_index, (PVOID) 1);
+  }
+}
+#else
+static pthread_key_t yk__slab_key;
+static pthread_once_t yk__slab_key_once = PTHREAD_ONCE_INIT;
+static int yk__slab_key_created = 0;
+static void yk__slab_key_destructor(void *data) {
+  if (data != NULL) { yk__slab_thread_exit(); }
+}
+static void yk__slab_key_init(void) {
+  yk__slab_key_created =
+      pthread_key_create(&yk__slab_key, yk__slab_key_destructor) == 0;
+}
+static void yk__slab_register_thread(void) {
+  if (yk__slab_thread_registered) return;
+  yk__slab_thread_registered = 1;
+  pthread_once(&yk__slab_key_once, yk__slab_key_init);
+  if (yk__slab_key_created) { pthread_setspecific(yk__slab_key, (void *) 1); }
+}
+#endif
+#endif
+/**
+ * Fill current list of a size class, from full batch of this thread, the
+ *  depot or a new chunk (other batches of a new chunk go to the depot)
+ * @param size_class size class index
+ * @return 1 if successful, 0 if we are out of memory
+ */
+static int yk__slab_refill(size_t size_class) {
+  struct yk__slab_batch *current = &yk__slab_current[size_class];
+  if (yk__slab_full[size_class] != NULL) {
+    current->head = yk__slab_full[size_class];
+    current->count = YK__SLAB_BATCH;
+    yk__slab_full[size_class] = NULL;
+    return 1;
+  }
+  yk__slab_register_thread();
+  if (yk__slab_take_batch(size_class, current)) return 1;
+  size_t slot_size = (size_class + 1) * YK__SLAB_ALIGN;
+  size_t slots = YK__SLAB_CHUNK_SIZE / slot_size;
+  char *chunk = (char *) malloc(slots * slot_size);
+  if (chunk == NULL) return 0;
+  struct yk__slab_batch batch = {NULL, 0};
+  // Link backwards so slots are handed out in address order
+  for (size_t i = slots; i > 0; i--) {
+    struct yk__slab_slot *slot =
+        (struct yk__slab_slot *) (chunk + (i - 1) * slot_size);
+    slot->next = batch.head;
+    batch.head = slot;
+    batch.count++;
+    if ((i - 1) % YK__SLAB_BATCH == 0 && i > 1) {
+      // If depot cannot hold it, keep it in current list
+      if (!yk__slab_give_batch(size_class, batch)) { continue; }
+      batch.head = NULL;
+      batch.count = 0;
+    }
+  }
+  *current = batch;
+  return 1;
+}
+void *yk__slab_alloc(size_t size) {
+  if (size == 0 || size > YK__SLAB_MAX_SIZE) return calloc(1, size);
+  size_t size_class = (size - 1) / YK__SLAB_ALIGN;
+  struct yk__slab_batch *current = &yk__slab_current[size_class];
+  if (current->head == NULL) {
+    if (!yk__slab_refill(size_class)) return NULL;
+  }
+  struct yk__slab_slot *slot = current->head;
+  current->head = slot->next;
+  current->count--;
+  memset(slot, 0, size);
+  return slot;
+}
+void yk__slab_free(void *ptr, size_t size) {
+  if (ptr == NULL) return;
+  if (size == 0 || size > YK__SLAB_MAX_SIZE) {
+    free(ptr);
+    return;
+  }
+  size_t size_class = (size - 1) / YK__SLAB_ALIGN;
+  struct yk__slab_batch *current = &yk__slab_current[size_class];
+  // A thread that only frees (eg: consumer) has to give these back as well
+  if (current->count == 0) { yk__slab_register_thread(); }
+  struct yk__slab_slot *slot = (struct yk__slab_slot *) ptr;
+  slot->next = current->head;
+  current->head = slot;
+  if (++current->count < YK__SLAB_BATCH) return;
+  if (yk__slab_full[size_class] != NULL) {
+    struct yk__slab_batch full = {yk__slab_full[size_class], YK__SLAB_BATCH};
+    // If depot cannot hold it, keep it (with current) in this thread
+    if (!yk__slab_give_batch(size_class, full)) return;
+  }
+  yk__slab_full[size_class] = current->head;
+  current->head = NULL;
+  current->count = 0;
+}
+#if defined(YK__ARENA_ALLOC)
+void *yk__arena_obj_alloc(size_t size) {
+  void *ptr = yk__arena_calloc(size);
+  if (ptr != NULL) return ptr;
+  // Objects on heap have an arena header too, see yk__arena_owns
+  struct yk__arena_header *header = (struct yk__arena_header *)
+      yk__obj_heap_alloc(YK__ARENA_ALIGN + size);
+  if (header == NULL) return NULL;
+  header->size = size;
+  header->owner = NULL;
+  return (char *) header + YK__ARENA_ALIGN;
+}
+void yk__arena_obj_free(void *ptr, size_t size) {
+  if (ptr == NULL || yk__arena_owns(ptr)) return;
+  yk__obj_heap_free((char *) ptr - YK__ARENA_ALIGN, YK__ARENA_ALIGN + size);
+}
+#endif
+#endif
+#endif
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
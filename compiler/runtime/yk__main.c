@@ -3,6 +3,8 @@
 #define YK__STB_DS_IMPLEMENTATION
 #define YK__SORT_IMPLEMENTATION
 #define YK__IO_BSTR_IMPLEMENTATION
+#define YK__SLAB_IMPLEMENTATION
+#define YK__ARENA_IMPLEMENTATION
 #include "yk__system.h"
 #if defined(_WIN32) || defined(_WIN64)
 #include <fcntl.h>
@@ -13,8 +15,14 @@
 static struct yk__arguments *yk__arguments_copy;
 struct yk__arguments *yk__get_args() { return yk__arguments_copy; }
 // ---------------- standard main ---------------------
+// YK__EMBEDDED_MAIN -> program is linked in to another executable
+//   which calls yk__embedded_main() (eg: carpntr in yaksha)
 #if !defined(YK__MINIMAL_MAIN) && !defined(YK__WASM4) && !defined(YK__CR_DLL)
+#if defined(YK__EMBEDDED_MAIN)
+int yk__embedded_main(int argc, char *argv[]) {
+#else
 int main(int argc, char *argv[]) {
+#endif
 #if defined(_WIN32) || defined(_WIN64)
   int result_mode;
   result_mode = _setmode(_fileno(stdout), _O_U16TEXT);
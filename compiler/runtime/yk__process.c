@@ -1,12 +1,26 @@
-#include "yk__process.h"
 #if defined(__linux__) || (defined(__APPLE__) && defined(__MACH__)) ||         \
     defined(__unix__)
-// clang-format off
 #ifndef _POSIX_C_SOURCE
 #define _POSIX_C_SOURCE 200809L
 #endif
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE// pipe2
+#endif
+#endif
+#include "yk__process.h"
+#if defined(__linux__) || (defined(__APPLE__) && defined(__MACH__)) ||         \
+    defined(__unix__)
+// clang-format off
 #include <stdio.h>
 #include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <time.h>
 #include "subprocess.h"
 #else
 #include <stdio.h>
@@ -259,4 +273,423 @@ void yk__free_process_result(struct yk__process_result* result) {
   if (NULL == result) return;
   yk__sdsfree(result->output);
   free(result);
-}
\ No newline at end of file
+}
+// ---- Non-blocking processes ----
+#if defined(__linux__) || (defined(__APPLE__) && defined(__MACH__)) ||         \
+    defined(__unix__)
+extern char **environ;
+#if !defined(__linux__)
+// Without pipe2, a fork from another thread between pipe and fcntl would leak
+// pipe ends in to that child, so pipes are created and handed to the child
+// while holding this lock
+static pthread_mutex_t yk__process_spawn_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+struct yk__process {
+  pid_t pid;
+  int output;// read end of the pipe, -1 once closed
+  bool exited;
+  int32_t return_code;
+};
+struct yk__process *yk__process_spawn(yk__sds *args) {
+  if (args == NULL || yk__arrlenu(args) == 0) { return NULL; }
+  int fds[2];
+#if defined(__linux__)
+  if (0 != pipe2(fds, O_CLOEXEC)) { return NULL; }
+#else
+  pthread_mutex_lock(&yk__process_spawn_lock);
+  if (0 != pipe(fds)) {
+    pthread_mutex_unlock(&yk__process_spawn_lock);
+    return NULL;
+  }
+  fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+  fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+#endif
+  yk__sds *argv = NULL;
+  size_t args_size = yk__arrlenu(args);
+  for (size_t i = 0; i < args_size; i++) { yk__arrput(argv, args[i]); }
+  yk__arrput(argv, (yk__sds) NULL);
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+  posix_spawn_file_actions_adddup2(&actions, fds[1], STDERR_FILENO);
+  pid_t pid;
+  int result = posix_spawnp(&pid, argv[0], &actions, NULL, argv, environ);
+  posix_spawn_file_actions_destroy(&actions);
+#if !defined(__linux__)
+  pthread_mutex_unlock(&yk__process_spawn_lock);
+#endif
+  yk__arrfree(argv);
+  close(fds[1]);
+  if (0 != result) {
+    close(fds[0]);
+    return NULL;
+  }
+  fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+  struct yk__process *p = calloc(1, sizeof(struct yk__process));
+  if (NULL == p) {
+    close(fds[0]);
+    kill(pid, SIGKILL);
+    waitpid(pid, NULL, 0);
+    return NULL;
+  }
+  p->pid = pid;
+  p->output = fds[0];
+  p->exited = false;
+  p->return_code = -1;
+  return p;
+}
+static void yk__process_close_output(struct yk__process *p) {
+  if (p->output != -1) {
+    close(p->output);
+    p->output = -1;
+  }
+}
+int32_t yk__process_read(struct yk__process *p, uint8_t *buffer) {
+  if (NULL == p || p->output == -1) { return -1; }
+  size_t size = yk__arrlenu(buffer);
+  if (size == 0) { return 0; }
+  if (size > INT32_MAX) { size = INT32_MAX; }
+  for (;;) {
+    ssize_t count = read(p->output, buffer, size);
+    if (count > 0) { return (int32_t) count; }
+    if (count < 0 && errno == EINTR) { continue; }
+    if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) { return 0; }
+    // End of output (or a read error)
+    yk__process_close_output(p);
+    return -1;
+  }
+}
+bool yk__process_poll(struct yk__process *p) {
+  if (NULL == p) { return true; }
+  if (p->exited) { return true; }
+  int status;
+  pid_t result = waitpid(p->pid, &status, WNOHANG);
+  if (result == 0) { return false; }
+  p->exited = true;
+  if (result == p->pid && WIFEXITED(status)) {
+    p->return_code = WEXITSTATUS(status);
+  }
+  return true;
+}
+static int64_t yk__process_now_ms(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((int64_t) now.tv_sec) * 1000 + ((int64_t) now.tv_nsec) / 1000000;
+}
+int32_t yk__process_wait_any(struct yk__process **processes,
+                             int32_t timeout_ms) {
+  size_t count = yk__arrlenu(processes);
+  if (count == 0) { return -1; }
+  struct pollfd *fds = calloc(count, sizeof(struct pollfd));
+  size_t *indexes = calloc(count, sizeof(size_t));
+  int32_t ready = -1;
+  if (NULL == fds || NULL == indexes) { goto done; }
+  int64_t deadline = yk__process_now_ms() + timeout_ms;
+  for (;;) {
+    nfds_t nfds = 0;
+    bool waiting_for_exit = false;
+    for (size_t i = 0; i < count; i++) {
+      struct yk__process *p = processes[i];
+      if (NULL == p) { continue; }
+      if (p->output != -1) {
+        fds[nfds].fd = p->output;
+        fds[nfds].events = POLLIN;
+        fds[nfds].revents = 0;
+        indexes[nfds] = i;
+        nfds++;
+      } else if (!p->exited) {
+        // Output is closed, but child is not reaped yet
+        if (yk__process_poll(p)) {
+          ready = (int32_t) i;
+          goto done;
+        }
+        waiting_for_exit = true;
+      }
+    }
+    if (nfds == 0 && !waiting_for_exit) { goto done; }
+    int wait_ms = -1;
+    if (timeout_ms >= 0) {
+      int64_t remaining = deadline - yk__process_now_ms();
+      wait_ms = remaining > 0 ? (int) remaining : 0;
+    }
+    // There is nothing to poll for an exit, so check again shortly
+    if (waiting_for_exit && (wait_ms < 0 || wait_ms > 10)) { wait_ms = 10; }
+    int result = poll(fds, nfds, wait_ms);
+    if (result > 0) {
+      for (nfds_t i = 0; i < nfds; i++) {
+        if (fds[i].revents != 0) {
+          ready = (int32_t) indexes[i];
+          goto done;
+        }
+      }
+    }
+    if (result < 0 && errno != EINTR) { goto done; }
+    if (timeout_ms >= 0 && yk__process_now_ms() >= deadline) { goto done; }
+  }
+done:
+  free(fds);
+  free(indexes);
+  return ready;
+}
+void yk__process_kill(struct yk__process *p) {
+  if (NULL == p || yk__process_poll(p)) { return; }
+  kill(p->pid, SIGKILL);
+}
+void yk__process_free(struct yk__process *p) {
+  if (NULL == p) { return; }
+  yk__process_close_output(p);
+  if (!yk__process_poll(p)) {
+    kill(p->pid, SIGKILL);
+    waitpid(p->pid, NULL, 0);
+  }
+  free(p);
+}
+#else
+struct yk__process {
+  HANDLE process;
+  HANDLE output;// read end of the pipe (overlapped), NULL once closed
+  OVERLAPPED overlapped;// hEvent is signalled when a pending read completes
+  bool reading;// a read into pending is in flight
+  uint8_t pending[4096];// completed read, handed out by yk__process_read
+  DWORD pending_size;
+  DWORD pending_offset;
+  bool exited;
+  int32_t return_code;
+};
+static volatile LONG yk__process_pipe_counter = 0;
+// Anonymous pipes do not support overlapped reads, so a uniquely named pipe
+//   is used instead, read end is returned (not inherited) and write end is
+//   stored to write_end (inherited by the child)
+static HANDLE yk__process_create_pipe(HANDLE *write_end) {
+  char name[128];
+  snprintf(name, sizeof(name), "\\\\.\\pipe\\yk__process.%lu.%ld",
+           (unsigned long) GetCurrentProcessId(),
+           (long) InterlockedIncrement(&yk__process_pipe_counter));
+  HANDLE read_end = CreateNamedPipeA(
+      name, PIPE_ACCESS_INBOUND | FILE_FLAG_OVERLAPPED |
+                FILE_FLAG_FIRST_PIPE_INSTANCE,
+      PIPE_TYPE_BYTE | PIPE_WAIT, 1, 4096, 4096, 0, NULL);
+  if (INVALID_HANDLE_VALUE == read_end) { return NULL; }
+  SECURITY_ATTRIBUTES sa = {sizeof(SECURITY_ATTRIBUTES)};
+  sa.bInheritHandle = TRUE;
+  sa.lpSecurityDescriptor = NULL;
+  *write_end = CreateFileA(name, GENERIC_WRITE, 0, &sa, OPEN_EXISTING,
+                           FILE_ATTRIBUTE_NORMAL, NULL);
+  if (INVALID_HANDLE_VALUE == *write_end) {
+    CloseHandle(read_end);
+    return NULL;
+  }
+  return read_end;
+}
+struct yk__process *yk__process_spawn(yk__sds *args) {
+  yk__sds joined = yk__windows_join_args(args);
+  if (NULL == joined || 0 == yk__sdslen(joined)) {
+    yk__sdsfree(joined);
+    return NULL;
+  }
+  wchar_t *cmd = yk__utf8_to_utf16_null_terminated(joined);
+  yk__sdsfree(joined);
+  if (NULL == cmd) { return NULL; }
+  struct yk__process *p = calloc(1, sizeof(struct yk__process));
+  if (NULL == p) {
+    free(cmd);
+    return NULL;
+  }
+  p->overlapped.hEvent = CreateEventW(NULL, TRUE, FALSE, NULL);
+  HANDLE write_end = NULL;
+  HANDLE read_end = NULL;
+  if (NULL != p->overlapped.hEvent) {
+    read_end = yk__process_create_pipe(&write_end);
+  }
+  if (NULL == read_end) {
+    if (NULL != p->overlapped.hEvent) { CloseHandle(p->overlapped.hEvent); }
+    free(p);
+    free(cmd);
+    return NULL;
+  }
+  STARTUPINFOW si = {sizeof(STARTUPINFOW)};
+  si.dwFlags = STARTF_USESHOWWINDOW | STARTF_USESTDHANDLES;
+  si.hStdOutput = write_end;
+  si.hStdError = write_end;
+  si.wShowWindow = SW_HIDE;
+  PROCESS_INFORMATION pi = {0};
+  BOOL started = CreateProcessW(NULL, cmd, NULL, NULL, TRUE, CREATE_NEW_CONSOLE,
+                                NULL, NULL, &si, &pi);
+  free(cmd);
+  // Child has its own copy, so we see end of output once it exits
+  CloseHandle(write_end);
+  if (!started) {
+    CloseHandle(read_end);
+    CloseHandle(p->overlapped.hEvent);
+    free(p);
+    return NULL;
+  }
+  CloseHandle(pi.hThread);
+  p->process = pi.hProcess;
+  p->output = read_end;
+  p->exited = false;
+  p->return_code = -1;
+  return p;
+}
+static void yk__process_close_output(struct yk__process *p) {
+  if (NULL == p->output) { return; }
+  if (p->reading) {
+    // Wait for the cancellation, so the read no longer writes to pending
+    DWORD count = 0;
+    CancelIoEx(p->output, &p->overlapped);
+    GetOverlappedResult(p->output, &p->overlapped, &count, TRUE);
+    p->reading = false;
+  }
+  CloseHandle(p->output);
+  p->output = NULL;
+}
+// Collect a completed read to pending, or start a new read if everything in
+//   pending is already handed out (this keeps a read in flight, so
+//   overlapped.hEvent can be waited on)
+static void yk__process_fill(struct yk__process *p) {
+  for (;;) {
+    if (NULL == p->output || p->pending_offset < p->pending_size) { return; }
+    if (!p->reading) {
+      p->pending_offset = 0;
+      p->pending_size = 0;
+      if (!ReadFile(p->output, p->pending, sizeof(p->pending), NULL,
+                    &p->overlapped) &&
+          GetLastError() != ERROR_IO_PENDING) {
+        // End of output (or a read error)
+        yk__process_close_output(p);
+        return;
+      }
+      p->reading = true;
+    }
+    DWORD count = 0;
+    if (!GetOverlappedResult(p->output, &p->overlapped, &count, FALSE)) {
+      if (GetLastError() != ERROR_IO_INCOMPLETE) {
+        p->reading = false;
+        yk__process_close_output(p);
+      }
+      return;
+    }
+    p->reading = false;
+    // Zero byte reads start another read
+    p->pending_size = count;
+  }
+}
+// 1 if output can be read, 0 if not yet and -1 if output is closed
+static int yk__process_output_state(struct yk__process *p) {
+  if (p->pending_offset < p->pending_size) { return 1; }
+  return NULL == p->output ? -1 : 0;
+}
+int32_t yk__process_read(struct yk__process *p, uint8_t *buffer) {
+  if (NULL == p) { return -1; }
+  yk__process_fill(p);
+  int state = yk__process_output_state(p);
+  if (state != 1) { return state; }
+  size_t size = yk__arrlenu(buffer);
+  DWORD available = p->pending_size - p->pending_offset;
+  DWORD count = (DWORD) (available < size ? available : size);
+  memcpy(buffer, p->pending + p->pending_offset, count);
+  p->pending_offset += count;
+  return (int32_t) count;
+}
+bool yk__process_poll(struct yk__process *p) {
+  if (NULL == p) { return true; }
+  if (p->exited) { return true; }
+  if (WaitForSingleObject(p->process, 0) != WAIT_OBJECT_0) { return false; }
+  p->exited = true;
+  DWORD exit_code;
+  if (GetExitCodeProcess(p->process, &exit_code)) {
+    p->return_code = (int32_t) exit_code;
+  }
+  return true;
+}
+int32_t yk__process_wait_any(struct yk__process **processes,
+                             int32_t timeout_ms) {
+  size_t count = yk__arrlenu(processes);
+  if (count == 0) { return -1; }
+  HANDLE *handles = calloc(count, sizeof(HANDLE));
+  size_t *indexes = calloc(count, sizeof(size_t));
+  int32_t ready = -1;
+  if (NULL == handles || NULL == indexes) { goto done; }
+  ULONGLONG deadline = GetTickCount64() + (ULONGLONG) timeout_ms;
+  for (;;) {
+    DWORD nhandles = 0;
+    for (size_t i = 0; i < count; i++) {
+      struct yk__process *p = processes[i];
+      if (NULL == p) { continue; }
+      if (NULL != p->output) {
+        yk__process_fill(p);
+        if (yk__process_output_state(p) != 0) {
+          ready = (int32_t) i;
+          goto done;
+        }
+        handles[nhandles] = p->overlapped.hEvent;
+      } else if (!p->exited) {
+        // Output is closed, but child has not exited yet
+        if (yk__process_poll(p)) {
+          ready = (int32_t) i;
+          goto done;
+        }
+        handles[nhandles] = p->process;
+      } else {
+        continue;
+      }
+      indexes[nhandles] = i;
+      nhandles++;
+    }
+    if (nhandles == 0) { goto done; }
+    DWORD wait_ms = INFINITE;
+    if (timeout_ms >= 0) {
+      ULONGLONG now = GetTickCount64();
+      wait_ms = now < deadline ? (DWORD) (deadline - now) : 0;
+    }
+    DWORD result;
+    if (nhandles <= MAXIMUM_WAIT_OBJECTS) {
+      result = WaitForMultipleObjects(nhandles, handles, FALSE, wait_ms);
+    } else {
+      // Only MAXIMUM_WAIT_OBJECTS handles can be waited on at once, so check
+      //   each group without blocking, and then block briefly on the first
+      result = WAIT_TIMEOUT;
+      for (DWORD offset = MAXIMUM_WAIT_OBJECTS;
+           offset < nhandles && result == WAIT_TIMEOUT;
+           offset += MAXIMUM_WAIT_OBJECTS) {
+        DWORD group = nhandles - offset;
+        if (group > MAXIMUM_WAIT_OBJECTS) { group = MAXIMUM_WAIT_OBJECTS; }
+        result = WaitForMultipleObjects(group, handles + offset, FALSE, 0);
+      }
+      if (result == WAIT_TIMEOUT) {
+        result = WaitForMultipleObjects(MAXIMUM_WAIT_OBJECTS, handles, FALSE,
+                                        wait_ms < 10 ? wait_ms : 10);
+      }
+    }
+    // Signalled handles are picked up at the top of the loop
+    if (result == WAIT_FAILED) { goto done; }
+    if (result == WAIT_TIMEOUT && timeout_ms >= 0 &&
+        GetTickCount64() >= deadline) {
+      goto done;
+    }
+  }
+done:
+  free(handles);
+  free(indexes);
+  return ready;
+}
+void yk__process_kill(struct yk__process *p) {
+  if (NULL == p || yk__process_poll(p)) { return; }
+  TerminateProcess(p->process, 1);
+}
+void yk__process_free(struct yk__process *p) {
+  if (NULL == p) { return; }
+  yk__process_close_output(p);
+  if (!yk__process_poll(p)) {
+    TerminateProcess(p->process, 1);
+    WaitForSingleObject(p->process, INFINITE);
+  }
+  CloseHandle(p->process);
+  CloseHandle(p->overlapped.hEvent);
+  free(p);
+}
+#endif
+int32_t yk__process_return_code(struct yk__process *p) {
+  if (NULL == p) { return -1; }
+  return p->return_code;
+}
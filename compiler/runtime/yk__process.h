@@ -1,6 +1,7 @@
 #if !defined(YK__PROCESS)
 #define YK__PROCESS
 #include <stdbool.h>
+#include <stdint.h>
 struct yk__process_result {
   /**
    * If return code is 0 and we did not encounter any error
@@ -12,4 +13,30 @@ struct yk__process_result {
 // Note this char* assumed to be yk__sds, so do not pass in without wrapping up first.
 struct yk__process_result *yk__run(char **args);
 void yk__free_process_result(struct yk__process_result* result);
+// ---- Non-blocking processes ----
+// A spawned child process, combined stdout/stderr is read through a pipe
+//   as it arrives instead of waiting for the child to exit.
+struct yk__process;
+// Start given command line (args[0] is searched in PATH), NULL if failed
+// Note args are yk__sds (same as yk__run)
+struct yk__process *yk__process_spawn(char **args);
+// Read output that is already available to buffer, up to yk__arrlen(buffer)
+//   returns number of bytes read, 0 if nothing is available yet
+//   and -1 when all output is read (child closed its side of the pipe)
+int32_t yk__process_read(struct yk__process *p, uint8_t *buffer);
+// Check if child has exited (does not block)
+bool yk__process_poll(struct yk__process *p);
+// Exit code of child, -1 if not exited yet (or exited abnormally)
+int32_t yk__process_return_code(struct yk__process *p);
+// Wait until one of the processes has output to read, closed its output or
+//   exited, for at most timeout_ms (-1 = no timeout)
+// Index of that process is returned, -1 if timed out or all processes are
+//   done (exited and all output is read)
+// Note processes is a yk__arr of handles
+int32_t yk__process_wait_any(struct yk__process **processes,
+                             int32_t timeout_ms);
+// Kill child if it is still running
+void yk__process_kill(struct yk__process *p);
+// Kill (if still running) and free given process
+void yk__process_free(struct yk__process *p);
 #endif// YK__PROCESS
\ No newline at end of file
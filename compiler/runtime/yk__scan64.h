@@ -0,0 +1,152 @@
+/**
+ * 64 byte block scanning helpers used by yk__json.c and yk__csv.c
+ * Each byte of a block is compared against characters and result is a
+ *   64bit mask (bit i is set if byte i matched)
+ * SSE2 (x64) and NEON (aarch64) are used when available, otherwise bytes
+ *   are compared one at a time
+ * Blocks are always loaded as full 64 bytes, so callers pad their buffers
+ */
+#ifndef YK__SCAN64_H
+#define YK__SCAN64_H
+#include <stdint.h>
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define YK__SCAN64_SSE2
+typedef struct yk__block64 {
+  __m128i v[4];
+} yk__block64;
+static inline yk__block64 yk__block64_load(const uint8_t *p) {
+  yk__block64 b;
+  for (int i = 0; i < 4; i++) {
+    b.v[i] = _mm_loadu_si128((const __m128i *) (p + i * 16));
+  }
+  return b;
+}
+/**
+ * Bytes equal to any of given characters (count is usually a constant, so
+ *   loops are unrolled and only one movemask is done per 16 bytes)
+ */
+static inline uint64_t yk__block64_eq_any(const yk__block64 *b,
+                                          const char *chars, int count) {
+  uint64_t mask = 0;
+  for (int i = 0; i < 4; i++) {
+    __m128i r = _mm_cmpeq_epi8(b->v[i], _mm_set1_epi8(chars[0]));
+    for (int c = 1; c < count; c++) {
+      r = _mm_or_si128(r, _mm_cmpeq_epi8(b->v[i], _mm_set1_epi8(chars[c])));
+    }
+    mask |= (uint64_t) (uint32_t) _mm_movemask_epi8(r) << (i * 16);
+  }
+  return mask;
+}
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define YK__SCAN64_NEON
+typedef struct yk__block64 {
+  uint8x16_t v[4];
+} yk__block64;
+static inline yk__block64 yk__block64_load(const uint8_t *p) {
+  yk__block64 b;
+  for (int i = 0; i < 4; i++) { b.v[i] = vld1q_u8(p + i * 16); }
+  return b;
+}
+// NEON has no movemask, keep one bit per byte and add neighbours together
+static inline uint64_t yk__block64_eq_any(const yk__block64 *b,
+                                          const char *chars, int count) {
+  static const uint8_t bits[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                   1, 2, 4, 8, 16, 32, 64, 128};
+  const uint8x16_t bit_mask = vld1q_u8(bits);
+  uint8x16_t r[4];
+  for (int i = 0; i < 4; i++) {
+    r[i] = vceqq_u8(b->v[i], vdupq_n_u8((uint8_t) chars[0]));
+    for (int c = 1; c < count; c++) {
+      r[i] = vorrq_u8(r[i], vceqq_u8(b->v[i], vdupq_n_u8((uint8_t) chars[c])));
+    }
+    r[i] = vandq_u8(r[i], bit_mask);
+  }
+  uint8x16_t sum = vpaddq_u8(vpaddq_u8(r[0], r[1]), vpaddq_u8(r[2], r[3]));
+  sum = vpaddq_u8(sum, sum);
+  return vgetq_lane_u64(vreinterpretq_u64_u8(sum), 0);
+}
+#else
+typedef struct yk__block64 {
+  const uint8_t *p;
+} yk__block64;
+static inline yk__block64 yk__block64_load(const uint8_t *p) {
+  yk__block64 b;
+  b.p = p;
+  return b;
+}
+static inline uint64_t yk__block64_eq_any(const yk__block64 *b,
+                                          const char *chars, int count) {
+  uint64_t mask = 0;
+  for (int i = 0; i < 64; i++) {
+    for (int c = 0; c < count; c++) {
+      if (b->p[i] == (uint8_t) chars[c]) {
+        mask |= 1ULL << i;
+        break;
+      }
+    }
+  }
+  return mask;
+}
+#endif
+static inline uint64_t yk__block64_eq(const yk__block64 *b, char c) {
+  return yk__block64_eq_any(b, &c, 1);
+}
+/**
+ * Bit i of result is xor of bits 0 .. i of x
+ * (turns a mask of quotes into a mask of bytes inside quotes)
+ */
+static inline uint64_t yk__prefix_xor64(uint64_t x) {
+  x ^= x << 1;
+  x ^= x << 2;
+  x ^= x << 4;
+  x ^= x << 8;
+  x ^= x << 16;
+  x ^= x << 32;
+  return x;
+}
+#if defined(__GNUC__) || defined(__clang__)
+#define yk__scan64_ctz(x) __builtin_ctzll(x)
+#define yk__scan64_popcount(x) __builtin_popcountll(x)
+#else
+// x must not be 0
+static inline int yk__scan64_ctz(uint64_t x) {
+  int n = 0;
+  while ((x & 1) == 0) {
+    x >>= 1;
+    n++;
+  }
+  return n;
+}
+static inline int yk__scan64_popcount(uint64_t x) {
+  x = x - ((x >> 1) & 0x5555555555555555ULL);
+  x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+  x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return (int) ((x * 0x0101010101010101ULL) >> 56);
+}
+#endif
+/**
+ * Write base + position of each set bit of mask to out
+ * Writes are done 4 at a time, so out must have room for 3 extra items
+ * @return number of positions
+ */
+static inline int yk__scan64_positions(uint64_t mask, uint32_t base,
+                                       uint32_t *out) {
+  const int count = yk__scan64_popcount(mask);
+  // Top bit keeps ctz defined once mask runs out (extra writes are ignored)
+  const uint64_t top = 1ULL << 63;
+  for (int i = 0; i < count; i += 4) {
+    out[i] = base + (uint32_t) yk__scan64_ctz(mask | top);
+    mask &= mask - 1;
+    out[i + 1] = base + (uint32_t) yk__scan64_ctz(mask | top);
+    mask &= mask - 1;
+    out[i + 2] = base + (uint32_t) yk__scan64_ctz(mask | top);
+    mask &= mask - 1;
+    out[i + 3] = base + (uint32_t) yk__scan64_ctz(mask | top);
+    mask &= mask - 1;
+  }
+  return count;
+}
+#endif
@@ -8,9 +8,14 @@
 #include <windows.h>
 #include <shellapi.h>
 #include <wchar.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/utime.h>
 #else
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <dirent.h>
+#include <utime.h>
 #endif
 #ifndef ssize_t
 #define ssize_t intmax_t
@@ -291,6 +296,155 @@ bool yk__mkdir(yk__sds path) {
   yk__sdsfree(path);
   return value;
 }
+////// Files ///////
+int64_t yk__file_size(yk__sds path) {
+  if (path == NULL || !yk__sdslen(path)) {
+    yk__sdsfree(path);
+    return -1;
+  }
+#if defined(_WIN32) || defined(_WIN64)
+  wchar_t *wpath = yk__utf8_to_utf16_null_terminated(path);
+  if (wpath == NULL) {
+    yk__sdsfree(path);
+    return -1;
+  }
+  struct __stat64 st;
+  int64_t value = (_wstat64(wpath, &st) == 0) ? (int64_t) st.st_size : -1;
+  free(wpath);
+#else
+  struct stat st;
+  int64_t value = (stat(path, &st) == 0) ? (int64_t) st.st_size : -1;
+#endif
+  yk__sdsfree(path);
+  return value;
+}
+int64_t yk__file_mtime(yk__sds path) {
+  if (path == NULL || !yk__sdslen(path)) {
+    yk__sdsfree(path);
+    return -1;
+  }
+#if defined(_WIN32) || defined(_WIN64)
+  wchar_t *wpath = yk__utf8_to_utf16_null_terminated(path);
+  if (wpath == NULL) {
+    yk__sdsfree(path);
+    return -1;
+  }
+  struct __stat64 st;
+  int64_t value = (_wstat64(wpath, &st) == 0) ? (int64_t) st.st_mtime : -1;
+  free(wpath);
+#else
+  struct stat st;
+  int64_t value = (stat(path, &st) == 0) ? (int64_t) st.st_mtime : -1;
+#endif
+  yk__sdsfree(path);
+  return value;
+}
+bool yk__touch(yk__sds path) {
+  if (path == NULL || !yk__sdslen(path)) {
+    yk__sdsfree(path);
+    return false;
+  }
+#if defined(_WIN32) || defined(_WIN64)
+  wchar_t *wpath = yk__utf8_to_utf16_null_terminated(path);
+  if (wpath == NULL) {
+    yk__sdsfree(path);
+    return false;
+  }
+  bool value = (_wutime(wpath, NULL) == 0);
+  free(wpath);
+#else
+  bool value = utime(path, NULL) == 0;
+#endif
+  yk__sdsfree(path);
+  return value;
+}
+bool yk__remove_file(yk__sds path) {
+  if (path == NULL || !yk__sdslen(path)) {
+    yk__sdsfree(path);
+    return false;
+  }
+#if defined(_WIN32) || defined(_WIN64)
+  wchar_t *wpath = yk__utf8_to_utf16_null_terminated(path);
+  if (wpath == NULL) {
+    yk__sdsfree(path);
+    return false;
+  }
+  bool value = (_wremove(wpath) == 0);
+  free(wpath);
+#else
+  bool value = remove(path) == 0;
+#endif
+  yk__sdsfree(path);
+  return value;
+}
+bool yk__rename(yk__sds from, yk__sds to) {
+  if (from == NULL || !yk__sdslen(from) || to == NULL || !yk__sdslen(to)) {
+    yk__sdsfree(from);
+    yk__sdsfree(to);
+    return false;
+  }
+#if defined(_WIN32) || defined(_WIN64)
+  wchar_t *wfrom = yk__utf8_to_utf16_null_terminated(from);
+  wchar_t *wto = yk__utf8_to_utf16_null_terminated(to);
+  bool value = (wfrom != NULL && wto != NULL &&
+                MoveFileExW(wfrom, wto, MOVEFILE_REPLACE_EXISTING) != 0);
+  free(wfrom);
+  free(wto);
+#else
+  // rename() atomically replaces an existing file
+  bool value = rename(from, to) == 0;
+#endif
+  yk__sdsfree(from);
+  yk__sdsfree(to);
+  return value;
+}
+yk__sds *yk__list_dir(yk__sds path) {
+  // Names of entries in given directory (excluding . and ..)
+  yk__sds *names = NULL;
+  if (path == NULL || !yk__sdslen(path)) {
+    yk__sdsfree(path);
+    return names;
+  }
+#if defined(_WIN32) || defined(_WIN64)
+  yk__sds pattern = yk__sdscat(yk__sdsdup(path), "\\*");
+  wchar_t *wpattern = yk__utf8_to_utf16_null_terminated(pattern);
+  yk__sdsfree(pattern);
+  if (wpattern == NULL) {
+    yk__sdsfree(path);
+    return names;
+  }
+  WIN32_FIND_DATAW data;
+  HANDLE handle = FindFirstFileW(wpattern, &data);
+  free(wpattern);
+  if (handle != INVALID_HANDLE_VALUE) {
+    do {
+      if (wcscmp(data.cFileName, L".") == 0 ||
+          wcscmp(data.cFileName, L"..") == 0) {
+        continue;
+      }
+      char *name = yk__utf16_to_utf8_null_terminated(data.cFileName);
+      if (name == NULL) { continue; }
+      yk__arrput(names, yk__sdsnew(name));
+      free(name);
+    } while (FindNextFileW(handle, &data) != 0);
+    FindClose(handle);
+  }
+#else
+  DIR *dir = opendir(path);
+  if (dir != NULL) {
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+      if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+        continue;
+      }
+      yk__arrput(names, yk__sdsnew(entry->d_name));
+    }
+    closedir(dir);
+  }
+#endif
+  yk__sdsfree(path);
+  return names;
+}
 ////// Environ ///////
 yk__sds yk__getenv(yk__sds name) {
   if (name == NULL || !yk__sdslen(name)) {
@@ -27,6 +27,12 @@ bool yk__readable(yk__sds path);
 bool yk__writable(yk__sds path);
 bool yk__executable(yk__sds path);
 bool yk__mkdir(yk__sds path);
+int64_t yk__file_size(yk__sds path);
+int64_t yk__file_mtime(yk__sds path);
+bool yk__touch(yk__sds path);
+bool yk__remove_file(yk__sds path);
+bool yk__rename(yk__sds from, yk__sds to);
+yk__sds *yk__list_dir(yk__sds path);
 yk__sds yk__getenv(yk__sds name);
 yk__sds yk__io_readfile(struct yk__bstr name);
 bool yk__io_writefile(struct yk__bstr name, struct yk__bstr data);
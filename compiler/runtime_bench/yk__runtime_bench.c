@@ -0,0 +1,925 @@
+#include "yk__runtime_bench.h"
+#include "tinycthread.h"
+#include "yk__containers.h"
+#include "yk__csv.h"
+#include "yk__graphic_utils.h"
+#include "yk__json.h"
+#include "yk__system.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(_WIN32) || defined(_WIN64)
+#define YK__RB_NULL_DEVICE "NUL"
+#else
+#define YK__RB_NULL_DEVICE "/dev/null"
+#endif
+// Each benchmark is run at all of these sizes
+static const size_t yk__rb_sizes[] = {16, 1024, 65536};
+#define YK__RB_SIZE_COUNT (sizeof(yk__rb_sizes) / sizeof(yk__rb_sizes[0]))
+// Comparisons/concatenations are too fast to time alone, do them in batches
+#define YK__RB_BATCH 64
+// Sink for results so the optimizer does not remove benchmarked code
+static volatile int64_t yk__rb_sink = 0;
+struct yk__rb_case {
+  const char *name;
+  const char *unit;
+  // Create state for given size (not timed), may return NULL
+  void *(*setup)(size_t n);
+  // Timed section, returns number of items processed
+  size_t (*run)(void *state, size_t n);
+  // Free state created by setup (not timed)
+  void (*teardown)(void *state);
+};
+struct yk__rb_result {
+  yk__sds name;
+  const char *unit;
+  int64_t iterations;
+  int64_t min_ns;
+  int64_t mean_ns;
+  size_t items;
+};
+static int64_t yk__rb_now_ns(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (int64_t) ts.tv_sec * 1000000000 + (int64_t) ts.tv_nsec;
+}
+static uint64_t yk__rb_rand(uint64_t *state) {
+  // xorshift64, good enough to shuffle keys
+  uint64_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 7;
+  x ^= x << 17;
+  *state = x;
+  return x;
+}
+static void yk__rb_no_teardown(void *state) { (void) state; }
+static void *yk__rb_no_setup(size_t n) {
+  (void) n;
+  return NULL;
+}
+// ---------------- sds ----------------
+static size_t yk__rb_sds_append(void *state, size_t n) {
+  (void) state;
+  yk__sds s = yk__sdsempty();
+  for (size_t i = 0; i < n; i++) { s = yk__append_sds_lit(s, "abcdefgh", 8); }
+  yk__rb_sink += (int64_t) yk__sdslen(s);
+  yk__sdsfree(s);
+  return n;
+}
+static void *yk__rb_sds_setup(size_t n) {
+  yk__sds s = yk__sdsempty();
+  s = yk__sdsgrowzero(s, n);
+  memset(s, 'x', n);
+  return s;
+}
+static void yk__rb_sds_teardown(void *state) { yk__sdsfree((yk__sds) state); }
+static size_t yk__rb_sds_concat(void *state, size_t n) {
+  yk__sds lhs = (yk__sds) state;
+  for (size_t i = 0; i < YK__RB_BATCH; i++) {
+    yk__sds s = yk__concat_sds_lit(lhs, "abcdefgh", 8);
+    yk__rb_sink += (int64_t) yk__sdslen(s);
+    yk__sdsfree(s);
+  }
+  return YK__RB_BATCH * (n + 8);
+}
+// ---------------- stb_ds ----------------
+static size_t yk__rb_arrput(void *state, size_t n) {
+  (void) state;
+  int64_t *arr = NULL;
+  for (size_t i = 0; i < n; i++) { yk__arrput(arr, (int64_t) i); }
+  yk__rb_sink += arr[n - 1];
+  yk__arrfree(arr);
+  return n;
+}
+static size_t yk__rb_arrput_reserved(void *state, size_t n) {
+  (void) state;
+  int64_t *arr = NULL;
+  yk__arrsetcap(arr, n);
+  for (size_t i = 0; i < n; i++) { yk__arrput(arr, (int64_t) i); }
+  yk__rb_sink += arr[n - 1];
+  yk__arrfree(arr);
+  return n;
+}
+struct yk__rb_hm_item {
+  int64_t key;
+  int64_t value;
+};
+struct yk__rb_hm_state {
+  int64_t *keys;
+  struct yk__rb_hm_item *map;
+};
+static void *yk__rb_hm_setup(size_t n) {
+  struct yk__rb_hm_state *st = calloc(1, sizeof(struct yk__rb_hm_state));
+  uint64_t seed = 0x9E3779B97F4A7C15ULL;
+  for (size_t i = 0; i < n; i++) {
+    int64_t key = (int64_t) (yk__rb_rand(&seed) >> 1);
+    yk__arrput(st->keys, key);
+    yk__hmput(st->map, key, (int64_t) i);
+  }
+  return st;
+}
+static void yk__rb_hm_teardown(void *state) {
+  struct yk__rb_hm_state *st = state;
+  yk__arrfree(st->keys);
+  yk__hmfree(st->map);
+  free(st);
+}
+static size_t yk__rb_hmput(void *state, size_t n) {
+  struct yk__rb_hm_state *st = state;
+  struct yk__rb_hm_item *map = NULL;
+  for (size_t i = 0; i < n; i++) { yk__hmput(map, st->keys[i], (int64_t) i); }
+  yk__rb_sink += yk__hmlen(map);
+  yk__hmfree(map);
+  return n;
+}
+static size_t yk__rb_hmget(void *state, size_t n) {
+  struct yk__rb_hm_state *st = state;
+  int64_t total = 0;
+  for (size_t i = 0; i < n; i++) { total += yk__hmget(st->map, st->keys[i]); }
+  yk__rb_sink += total;
+  return n;
+}
+struct yk__rb_sh_item {
+  char *key;
+  int64_t value;
+};
+struct yk__rb_sh_state {
+  yk__sds *keys;
+  struct yk__rb_sh_item *map;
+};
+static void *yk__rb_sh_setup(size_t n) {
+  struct yk__rb_sh_state *st = calloc(1, sizeof(struct yk__rb_sh_state));
+  uint64_t seed = 0xD1B54A32D192ED03ULL;
+  yk__sh_new_strdup(st->map);
+  for (size_t i = 0; i < n; i++) {
+    yk__sds key = yk__sdsfromlonglong((long long) (yk__rb_rand(&seed) >> 1));
+    yk__arrput(st->keys, key);
+    yk__shput(st->map, key, (int64_t) i);
+  }
+  return st;
+}
+static void yk__rb_sh_teardown(void *state) {
+  struct yk__rb_sh_state *st = state;
+  for (size_t i = 0; i < (size_t) yk__arrlen(st->keys); i++) {
+    yk__sdsfree(st->keys[i]);
+  }
+  yk__arrfree(st->keys);
+  yk__shfree(st->map);
+  free(st);
+}
+static size_t yk__rb_shput(void *state, size_t n) {
+  struct yk__rb_sh_state *st = state;
+  struct yk__rb_sh_item *map = NULL;
+  yk__sh_new_strdup(map);
+  for (size_t i = 0; i < n; i++) { yk__shput(map, st->keys[i], (int64_t) i); }
+  yk__rb_sink += yk__shlen(map);
+  yk__shfree(map);
+  return n;
+}
+static size_t yk__rb_shget(void *state, size_t n) {
+  struct yk__rb_sh_state *st = state;
+  int64_t total = 0;
+  for (size_t i = 0; i < n; i++) { total += yk__shget(st->map, st->keys[i]); }
+  yk__rb_sink += total;
+  return n;
+}
+// ---------------- sort ----------------
+struct yk__rb_sort_state {
+  int32_t *source;
+  int32_t *work;
+};
+static int yk__rb_cmp_int32(const void *a, const void *b) {
+  int32_t x = *(const int32_t *) a;
+  int32_t y = *(const int32_t *) b;
+  return (x > y) - (x < y);
+}
+static void *yk__rb_sort_setup(size_t n) {
+  struct yk__rb_sort_state *st = calloc(1, sizeof(struct yk__rb_sort_state));
+  uint64_t seed = 0xA0761D6478BD642FULL;
+  st->source = malloc(n * sizeof(int32_t));
+  st->work = malloc(n * sizeof(int32_t));
+  for (size_t i = 0; i < n; i++) {
+    st->source[i] = (int32_t) (yk__rb_rand(&seed) >> 33);
+  }
+  return st;
+}
+static void yk__rb_sort_teardown(void *state) {
+  struct yk__rb_sort_state *st = state;
+  free(st->source);
+  free(st->work);
+  free(st);
+}
+static size_t yk__rb_quicksort(void *state, size_t n) {
+  struct yk__rb_sort_state *st = state;
+  // Copy is included in timing, it is negligible compared to sorting
+  memcpy(st->work, st->source, n * sizeof(int32_t));
+  yk__quicksort(st->work, sizeof(int32_t), n, yk__rb_cmp_int32);
+  yk__rb_sink += st->work[0];
+  return n;
+}
+// ---------------- bstr ----------------
+struct yk__rb_bstr_state {
+  yk__sds lhs;
+  yk__sds rhs;
+};
+static void *yk__rb_bstr_setup(size_t n) {
+  struct yk__rb_bstr_state *st = calloc(1, sizeof(struct yk__rb_bstr_state));
+  // Equal content in different buffers, so comparisons read everything
+  st->lhs = yk__rb_sds_setup(n);
+  st->rhs = yk__rb_sds_setup(n);
+  return st;
+}
+static void yk__rb_bstr_teardown(void *state) {
+  struct yk__rb_bstr_state *st = state;
+  yk__sdsfree(st->lhs);
+  yk__sdsfree(st->rhs);
+  free(st);
+}
+static size_t yk__rb_cmp_bstr_bstr(void *state, size_t n) {
+  struct yk__rb_bstr_state *st = state;
+  struct yk__bstr lhs = yk__bstr_h(st->lhs);
+  struct yk__bstr rhs = yk__bstr_s(st->rhs, n);
+  int64_t total = 0;
+  for (size_t i = 0; i < YK__RB_BATCH; i++) {
+    total += yk__cmp_bstr_bstr(lhs, rhs);
+  }
+  yk__rb_sink += total;
+  return YK__RB_BATCH * n;
+}
+static size_t yk__rb_cmp_sds_lit(void *state, size_t n) {
+  struct yk__rb_bstr_state *st = state;
+  int64_t total = 0;
+  for (size_t i = 0; i < YK__RB_BATCH; i++) {
+    total += yk__cmp_sds_lit(st->lhs, st->rhs, n);
+  }
+  yk__rb_sink += total;
+  return YK__RB_BATCH * n;
+}
+// ---------------- slab ----------------
+// Linked list of small objects, same shape as a compiled Yaksha class
+struct yk__rb_node {
+  int64_t value;
+  struct yk__rb_node *next;
+};
+static size_t yk__rb_node_list(size_t n, int slab) {
+  struct yk__rb_node *head = NULL;
+  for (size_t i = 0; i < n; i++) {
+    struct yk__rb_node *node =
+        slab ? yk__slab_alloc(sizeof(struct yk__rb_node))
+             : calloc(1, sizeof(struct yk__rb_node));
+    node->value = (int64_t) i;
+    node->next = head;
+    head = node;
+  }
+  int64_t total = 0;
+  while (head != NULL) {
+    struct yk__rb_node *next = head->next;
+    total += head->value;
+    if (slab) {
+      yk__slab_free(head, sizeof(struct yk__rb_node));
+    } else {
+      free(head);
+    }
+    head = next;
+  }
+  yk__rb_sink += total;
+  return n;
+}
+static size_t yk__rb_calloc_nodes(void *state, size_t n) {
+  (void) state;
+  return yk__rb_node_list(n, 0);
+}
+static size_t yk__rb_slab_nodes(void *state, size_t n) {
+  (void) state;
+  return yk__rb_node_list(n, 1);
+}
+// ---------------- random ----------------
+// Previous libs.random implementation, 64bits stitched from rand() calls
+static uint64_t yk__rb_libc_rand64(void) {
+  int width = 0;
+  for (uint64_t m = RAND_MAX; m != 0; m >>= 1) { width++; }
+  uint64_t r = 0;
+  for (int i = 0; i < 64; i += width) {
+    r <<= width;
+    r ^= (unsigned) rand();
+  }
+  return r;
+}
+static size_t yk__rb_libc_rand(void *state, size_t n) {
+  (void) state;
+  uint64_t total = 0;
+  for (size_t i = 0; i < n; i++) { total += yk__rb_libc_rand64(); }
+  yk__rb_sink += (int64_t) total;
+  return n;
+}
+static size_t yk__rb_random_u64(void *state, size_t n) {
+  (void) state;
+  uint64_t total = 0;
+  for (size_t i = 0; i < n; i++) { total += yk__random_u64(); }
+  yk__rb_sink += (int64_t) total;
+  return n;
+}
+static void *yk__rb_fill_setup(size_t n) {
+  return calloc(n, sizeof(uint64_t));
+}
+static void yk__rb_fill_teardown(void *state) { free(state); }
+static size_t yk__rb_rng_fill_u64(void *state, size_t n) {
+  uint64_t *values = (uint64_t *) state;
+  yk__rng_fill_u64(yk__random_rng(), values, n);
+  yk__rb_sink += (int64_t) values[n - 1];
+  return n;
+}
+// ---------------- perlin ----------------
+// n points as a grid, width is capped so multiple rows/layers are used
+#define YK__RB_NOISE_STEP 0.0173
+static size_t yk__rb_grid_width(size_t n, size_t cap) { return n < cap ? n : cap; }
+static size_t yk__rb_noise2d(void *state, size_t n) {
+  double *out = (double *) state;
+  size_t width = yk__rb_grid_width(n, 256), height = n / width;
+  for (size_t j = 0; j < height; j++) {
+    for (size_t i = 0; i < width; i++) {
+      out[j * width + i] = yk__perlin2d(0.5 + (double) i * YK__RB_NOISE_STEP,
+                                        0.5 + (double) j * YK__RB_NOISE_STEP);
+    }
+  }
+  yk__rb_sink += (int64_t) (out[n - 1] * 1000);
+  return width * height;
+}
+static size_t yk__rb_fill2d(void *state, size_t n) {
+  double *out = (double *) state;
+  size_t width = yk__rb_grid_width(n, 256), height = n / width;
+  yk__perlin2d_fill(out, width, height, 0.5, 0.5, YK__RB_NOISE_STEP);
+  yk__rb_sink += (int64_t) (out[n - 1] * 1000);
+  return width * height;
+}
+static size_t yk__rb_noise3d(void *state, size_t n) {
+  double *out = (double *) state;
+  size_t width = yk__rb_grid_width(n, 64);
+  size_t height = yk__rb_grid_width(n / width, 64);
+  size_t depth = n / (width * height);
+  for (size_t k = 0; k < depth; k++) {
+    for (size_t j = 0; j < height; j++) {
+      for (size_t i = 0; i < width; i++) {
+        *out++ = yk__perlin3d(0.5 + (double) i * YK__RB_NOISE_STEP,
+                              0.5 + (double) j * YK__RB_NOISE_STEP,
+                              0.5 + (double) k * YK__RB_NOISE_STEP);
+      }
+    }
+  }
+  yk__rb_sink += (int64_t) (out[-1] * 1000);
+  return width * height * depth;
+}
+static size_t yk__rb_fill3d(void *state, size_t n) {
+  double *out = (double *) state;
+  size_t width = yk__rb_grid_width(n, 64);
+  size_t height = yk__rb_grid_width(n / width, 64);
+  size_t depth = n / (width * height);
+  yk__perlin3d_fill(out, width, height, depth, 0.5, 0.5, 0.5,
+                    YK__RB_NOISE_STEP);
+  yk__rb_sink += (int64_t) (out[width * height * depth - 1] * 1000);
+  return width * height * depth;
+}
+static void *yk__rb_noise_setup(size_t n) { return calloc(n, sizeof(double)); }
+// ---------------- containers ----------------
+// Emulations re-sort or shift whole array on every update (O(n) or worse)
+// so they only process up to this many items
+#define YK__RB_EMULATION_CAP 2048
+static int yk__rb_cmp_int64_desc(const void *a, const void *b) {
+  int64_t x = *(const int64_t *) a;
+  int64_t y = *(const int64_t *) b;
+  return (x < y) - (x > y);
+}
+static int yk__rb_cmp_int64(const void *a, const void *b) {
+  return yk__rb_cmp_int64_desc(b, a);
+}
+// Set emulated with a hash map with dummy values
+static size_t yk__rb_hm_as_set(void *state, size_t n) {
+  struct yk__rb_hm_state *st = state;
+  struct yk__rb_hm_item *map = NULL;
+  int64_t found = 0;
+  for (size_t i = 0; i < n; i++) { yk__hmput(map, st->keys[i], 1); }
+  for (size_t i = 0; i < n; i++) {
+    found += yk__hmgeti(map, st->keys[i]) >= 0;
+  }
+  yk__rb_sink += found;
+  yk__hmfree(map);
+  return n;
+}
+static size_t yk__rb_intset(void *state, size_t n) {
+  struct yk__rb_hm_state *st = state;
+  struct yk__i64set *set = yk__i64set_new();
+  int64_t found = 0;
+  for (size_t i = 0; i < n; i++) { yk__i64set_add(set, st->keys[i]); }
+  for (size_t i = 0; i < n; i++) { found += yk__i64set_has(set, st->keys[i]); }
+  yk__rb_sink += found;
+  yk__i64set_del(set);
+  return n;
+}
+// Sorted keys emulated by sorting an array again after every insert
+static size_t yk__rb_qsort_per_insert(void *state, size_t n) {
+  struct yk__rb_hm_state *st = state;
+  size_t count = n < YK__RB_EMULATION_CAP ? n : YK__RB_EMULATION_CAP;
+  int64_t *sorted = NULL;
+  for (size_t i = 0; i < count; i++) {
+    yk__arrput(sorted, st->keys[i]);
+    yk__quicksort(sorted, sizeof(int64_t), yk__arrlenu(sorted),
+                  yk__rb_cmp_int64);
+  }
+  int64_t total = 0;
+  for (size_t i = 0; i < count; i++) { total += sorted[i] >> 8; }
+  yk__rb_sink += total;
+  yk__arrfree(sorted);
+  return count;
+}
+static size_t yk__rb_ordmap_put(void *state, size_t n) {
+  struct yk__rb_hm_state *st = state;
+  struct yk__ordmap *map = yk__ordmap_new();
+  for (size_t i = 0; i < n; i++) {
+    yk__ordmap_put(map, st->keys[i], (int64_t) i);
+  }
+  int64_t total = 0;
+  struct yk__ordmap_iter *iter = yk__ordmap_range(map, INT64_MIN, INT64_MAX);
+  while (yk__ordmap_iter_next(iter)) { total += yk__ordmap_iter_key(iter) >> 8; }
+  yk__ordmap_iter_del(iter);
+  yk__rb_sink += total;
+  yk__ordmap_del(map);
+  return n;
+}
+// Priority queue emulated by sorting (descending) after every push and
+// popping smallest value from the end
+static size_t yk__rb_qsort_queue(void *state, size_t n) {
+  struct yk__rb_hm_state *st = state;
+  size_t count = n < YK__RB_EMULATION_CAP ? n : YK__RB_EMULATION_CAP;
+  int64_t *queue = NULL;
+  int64_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    yk__arrput(queue, st->keys[i]);
+    yk__quicksort(queue, sizeof(int64_t), yk__arrlenu(queue),
+                  yk__rb_cmp_int64_desc);
+  }
+  for (size_t i = 0; i < count; i++) { total += yk__arrpop(queue) >> 8; }
+  yk__rb_sink += total;
+  yk__arrfree(queue);
+  return count;
+}
+static size_t yk__rb_heap(void *state, size_t n) {
+  struct yk__rb_hm_state *st = state;
+  struct yk__heap *heap = yk__heap_new(NULL);
+  int64_t total = 0;
+  for (size_t i = 0; i < n; i++) { yk__heap_push(heap, st->keys[i]); }
+  for (size_t i = 0; i < n; i++) { total += yk__heap_pop(heap) >> 8; }
+  yk__rb_sink += total;
+  yk__heap_del(heap);
+  return n;
+}
+// Queue emulated with an array, removing from front shifts all items
+static size_t yk__rb_arrdel_queue(void *state, size_t n) {
+  (void) state;
+  size_t count = n < YK__RB_EMULATION_CAP ? n : YK__RB_EMULATION_CAP;
+  int64_t *queue = NULL;
+  int64_t total = 0;
+  for (size_t i = 0; i < count; i++) { yk__arrput(queue, (int64_t) i); }
+  for (size_t i = 0; i < count; i++) {
+    total += queue[0];
+    yk__arrdel(queue, 0);
+  }
+  yk__rb_sink += total;
+  yk__arrfree(queue);
+  return count;
+}
+static size_t yk__rb_deque(void *state, size_t n) {
+  (void) state;
+  struct yk__deque *queue = yk__deque_new();
+  int64_t total = 0;
+  for (size_t i = 0; i < n; i++) { yk__deque_push_back(queue, (int64_t) i); }
+  for (size_t i = 0; i < n; i++) { total += yk__deque_pop_front(queue); }
+  yk__rb_sink += total;
+  yk__deque_del(queue);
+  return n;
+}
+// ---------------- bitset ----------------
+// Sieve of Eratosthenes, Array[bool] is an stb_ds array of bool
+static size_t yk__rb_sieve_bool_array(void *state, size_t n) {
+  (void) state;
+  bool *composite = NULL;
+  yk__arrsetlen(composite, n);
+  memset(composite, 0, n * sizeof(bool));
+  for (size_t i = 2; i * i < n; i++) {
+    if (composite[i]) continue;
+    for (size_t j = i * i; j < n; j += i) { composite[j] = true; }
+  }
+  int64_t primes = 0;
+  for (size_t i = 2; i < n; i++) { primes += !composite[i]; }
+  yk__rb_sink += primes;
+  yk__arrfree(composite);
+  return n;
+}
+static size_t yk__rb_sieve_bitset(void *state, size_t n) {
+  (void) state;
+  struct yk__bitset *composite = yk__bitset_new((int64_t) n);
+  for (size_t i = 2; i * i < n; i++) {
+    if (yk__bitset_test(composite, (int64_t) i)) continue;
+    for (size_t j = i * i; j < n; j += i) {
+      yk__bitset_set(composite, (int64_t) j);
+    }
+  }
+  int64_t primes = 0;
+  if (n > 2) { primes = (int64_t) n - 2 - yk__bitset_count(composite); }
+  yk__rb_sink += primes;
+  yk__bitset_del(composite);
+  return n;
+}
+// Intersection size of two random sets of n bits
+struct yk__rb_bits_state {
+  bool *a_bools;
+  bool *b_bools;
+  struct yk__bitset *a_bits;
+  struct yk__bitset *b_bits;
+  struct yk__bitset *scratch;
+  // About 1 in 16 bits set
+  bool *sparse_bools;
+  struct yk__bitset *sparse_bits;
+};
+static void *yk__rb_bits_setup(size_t n) {
+  struct yk__rb_bits_state *st = calloc(1, sizeof(struct yk__rb_bits_state));
+  st->a_bits = yk__bitset_new((int64_t) n);
+  st->b_bits = yk__bitset_new((int64_t) n);
+  st->scratch = yk__bitset_new((int64_t) n);
+  st->sparse_bits = yk__bitset_new((int64_t) n);
+  uint64_t seed = 0x9E3779B97F4A7C15ULL;
+  for (size_t i = 0; i < n; i++) {
+    uint64_t r = yk__rb_rand(&seed);
+    yk__arrput(st->a_bools, (r & 1) != 0);
+    yk__arrput(st->b_bools, (r & 2) != 0);
+    if (r & 1) yk__bitset_set(st->a_bits, (int64_t) i);
+    if (r & 2) yk__bitset_set(st->b_bits, (int64_t) i);
+    yk__arrput(st->sparse_bools, ((r >> 8) & 15) == 0);
+    if (((r >> 8) & 15) == 0) yk__bitset_set(st->sparse_bits, (int64_t) i);
+  }
+  return st;
+}
+static void yk__rb_bits_teardown(void *state) {
+  struct yk__rb_bits_state *st = state;
+  yk__arrfree(st->a_bools);
+  yk__arrfree(st->b_bools);
+  yk__bitset_del(st->a_bits);
+  yk__bitset_del(st->b_bits);
+  yk__bitset_del(st->scratch);
+  yk__arrfree(st->sparse_bools);
+  yk__bitset_del(st->sparse_bits);
+  free(st);
+}
+static size_t yk__rb_and_count_bool_array(void *state, size_t n) {
+  struct yk__rb_bits_state *st = state;
+  int64_t count = 0;
+  for (size_t i = 0; i < n; i++) {
+    count += st->a_bools[i] && st->b_bools[i];
+  }
+  yk__rb_sink += count;
+  return n;
+}
+static size_t yk__rb_and_count_bitset(void *state, size_t n) {
+  struct yk__rb_bits_state *st = state;
+  yk__bitset_clear_all(st->scratch);
+  yk__bitset_or(st->scratch, st->a_bits);
+  yk__bitset_and(st->scratch, st->b_bits);
+  yk__rb_sink += yk__bitset_count(st->scratch);
+  return n;
+}
+// Visit set bits of a sparse set in order (bool array checks every item)
+static size_t yk__rb_scan_bool_array(void *state, size_t n) {
+  struct yk__rb_bits_state *st = state;
+  int64_t total = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (st->sparse_bools[i]) total += (int64_t) i;
+  }
+  yk__rb_sink += total;
+  return n;
+}
+static size_t yk__rb_scan_bitset(void *state, size_t n) {
+  struct yk__rb_bits_state *st = state;
+  int64_t total = 0;
+  int64_t i = yk__bitset_next_set(st->sparse_bits, 0);
+  while (i >= 0) {
+    total += i;
+    i = yk__bitset_next_set(st->sparse_bits, i + 1);
+  }
+  yk__rb_sink += total;
+  return n;
+}
+// ---------------- json / csv ----------------
+// n generated records, each case reports bytes/s
+static void *yk__rb_json_setup(size_t n) {
+  yk__sds text = yk__sdsnew("[");
+  for (size_t i = 0; i < n; i++) {
+    text = yk__sdscatprintf(
+        text,
+        "%s\n  {\"id\": %zu, \"name\": \"user %zu\", \"score\": %zu.25, "
+        "\"tags\": [\"a\", \"b\\\"c\"], \"active\": %s}",
+        i == 0 ? "" : ",", i, i, i % 100, (i & 1) ? "true" : "false");
+  }
+  return yk__sdscat(text, "\n]\n");
+}
+static void *yk__rb_csv_setup(size_t n) {
+  yk__sds text = yk__sdsnew("id,name,score,tags,active\r\n");
+  for (size_t i = 0; i < n; i++) {
+    text = yk__sdscatprintf(text, "%zu,user %zu,%zu.25,\"a, \"\"b\"\"\",%s\r\n",
+                            i, i, i % 100, (i & 1) ? "true" : "false");
+  }
+  return text;
+}
+static void yk__rb_text_teardown(void *state) { yk__sdsfree(state); }
+// Byte at a time tokenizer that copies each string/number/literal to a new
+// sds (how data is parsed by hand with libs.strings)
+static size_t yk__rb_json_byte_loop_sds(void *state, size_t n) {
+  (void) n;
+  yk__sds text = state;
+  size_t len = yk__sdslen(text);
+  int64_t tokens = 0;
+  size_t i = 0;
+  while (i < len) {
+    char c = text[i];
+    if (c == '"') {
+      size_t start = ++i;
+      while (i < len && text[i] != '"') { i += text[i] == '\\' ? 2 : 1; }
+      yk__sds token = yk__sdsnewlen(text + start, i - start);
+      tokens += (int64_t) yk__sdslen(token);
+      yk__sdsfree(token);
+      i++;
+    } else if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' ||
+               c == 'n') {
+      size_t start = i;
+      while (i < len && text[i] != ',' && text[i] != '}' && text[i] != ']' &&
+             text[i] != ' ' && text[i] != '\n') {
+        i++;
+      }
+      yk__sds token = yk__sdsnewlen(text + start, i - start);
+      tokens += (int64_t) yk__sdslen(token);
+      yk__sdsfree(token);
+    } else {
+      i++;
+    }
+  }
+  yk__rb_sink += tokens;
+  return len;
+}
+static size_t yk__rb_json_parse(void *state, size_t n) {
+  (void) n;
+  yk__sds text = state;
+  struct yk__json *doc = yk__json_parse(text, yk__sdslen(text));
+  yk__rb_sink += yk__json_root(doc);
+  yk__json_del(doc);
+  return yk__sdslen(text);
+}
+// Parse and read one field of every record
+static size_t yk__rb_json_parse_walk(void *state, size_t n) {
+  (void) n;
+  yk__sds text = state;
+  struct yk__json *doc = yk__json_parse(text, yk__sdslen(text));
+  int64_t total = 0;
+  for (int64_t item = yk__json_first(doc, yk__json_root(doc)); item >= 0;
+       item = yk__json_next(doc, item)) {
+    total += yk__json_i64(doc, yk__json_get(doc, item, "id", 2));
+  }
+  yk__rb_sink += total;
+  yk__json_del(doc);
+  return yk__sdslen(text);
+}
+// Byte at a time field splitter that copies each field to a new sds
+static size_t yk__rb_csv_byte_loop_sds(void *state, size_t n) {
+  (void) n;
+  yk__sds text = state;
+  size_t len = yk__sdslen(text);
+  int64_t fields = 0;
+  bool in_quotes = false;
+  size_t start = 0;
+  for (size_t i = 0; i < len; i++) {
+    char c = text[i];
+    if (c == '"') {
+      in_quotes = !in_quotes;
+    } else if (!in_quotes && (c == ',' || c == '\n')) {
+      yk__sds field = yk__sdsnewlen(text + start, i - start);
+      fields += (int64_t) yk__sdslen(field);
+      yk__sdsfree(field);
+      start = i + 1;
+    }
+  }
+  yk__rb_sink += fields;
+  return len;
+}
+static size_t yk__rb_csv_parse(void *state, size_t n) {
+  (void) n;
+  yk__sds text = state;
+  struct yk__csv *csv = yk__csv_parse(text, yk__sdslen(text), ',');
+  yk__rb_sink += yk__csv_rows(csv);
+  yk__csv_del(csv);
+  return yk__sdslen(text);
+}
+// ---------------- printint ----------------
+static size_t yk__rb_printint(void *state, size_t n) {
+  (void) state;
+  for (size_t i = 0; i < n; i++) {
+    yk__printint((intmax_t) (i * 2654435761u) - INT32_MAX);
+  }
+  fflush(stdout);
+  return n;
+}
+static const struct yk__rb_case yk__rb_cases[] = {
+    {"sds/append_sds_lit", "appends", yk__rb_no_setup, yk__rb_sds_append,
+     yk__rb_no_teardown},
+    {"sds/concat_sds_lit", "bytes", yk__rb_sds_setup, yk__rb_sds_concat,
+     yk__rb_sds_teardown},
+    {"stbds/arrput", "items", yk__rb_no_setup, yk__rb_arrput,
+     yk__rb_no_teardown},
+    {"stbds/arrput_reserved", "items", yk__rb_no_setup, yk__rb_arrput_reserved,
+     yk__rb_no_teardown},
+    {"stbds/hmput", "items", yk__rb_hm_setup, yk__rb_hmput, yk__rb_hm_teardown},
+    {"stbds/hmget", "items", yk__rb_hm_setup, yk__rb_hmget, yk__rb_hm_teardown},
+    {"stbds/shput", "items", yk__rb_sh_setup, yk__rb_shput, yk__rb_sh_teardown},
+    {"stbds/shget", "items", yk__rb_sh_setup, yk__rb_shget, yk__rb_sh_teardown},
+    {"sort/quicksort", "items", yk__rb_sort_setup, yk__rb_quicksort,
+     yk__rb_sort_teardown},
+    {"bstr/cmp_bstr_bstr", "bytes", yk__rb_bstr_setup, yk__rb_cmp_bstr_bstr,
+     yk__rb_bstr_teardown},
+    {"bstr/cmp_sds_lit", "bytes", yk__rb_bstr_setup, yk__rb_cmp_sds_lit,
+     yk__rb_bstr_teardown},
+    {"slab/calloc_free_nodes", "objects", yk__rb_no_setup, yk__rb_calloc_nodes,
+     yk__rb_no_teardown},
+    {"slab/slab_alloc_free_nodes", "objects", yk__rb_no_setup,
+     yk__rb_slab_nodes, yk__rb_no_teardown},
+    {"random/libc_rand_u64", "numbers", yk__rb_no_setup, yk__rb_libc_rand,
+     yk__rb_no_teardown},
+    {"random/random_u64", "numbers", yk__rb_no_setup, yk__rb_random_u64,
+     yk__rb_no_teardown},
+    {"random/rng_fill_u64", "numbers", yk__rb_fill_setup, yk__rb_rng_fill_u64,
+     yk__rb_fill_teardown},
+    {"perlin/noise2d_per_point", "points", yk__rb_noise_setup, yk__rb_noise2d,
+     yk__rb_fill_teardown},
+    {"perlin/fill2d", "points", yk__rb_noise_setup, yk__rb_fill2d,
+     yk__rb_fill_teardown},
+    {"perlin/noise3d_per_point", "points", yk__rb_noise_setup, yk__rb_noise3d,
+     yk__rb_fill_teardown},
+    {"perlin/fill3d", "points", yk__rb_noise_setup, yk__rb_fill3d,
+     yk__rb_fill_teardown},
+    {"containers/hm_as_set", "items", yk__rb_hm_setup, yk__rb_hm_as_set,
+     yk__rb_hm_teardown},
+    {"containers/intset", "items", yk__rb_hm_setup, yk__rb_intset,
+     yk__rb_hm_teardown},
+    {"containers/qsort_per_insert", "items", yk__rb_hm_setup,
+     yk__rb_qsort_per_insert, yk__rb_hm_teardown},
+    {"containers/ordmap_put", "items", yk__rb_hm_setup, yk__rb_ordmap_put,
+     yk__rb_hm_teardown},
+    {"containers/qsort_queue", "items", yk__rb_hm_setup, yk__rb_qsort_queue,
+     yk__rb_hm_teardown},
+    {"containers/heap", "items", yk__rb_hm_setup, yk__rb_heap,
+     yk__rb_hm_teardown},
+    {"containers/arrdel_queue", "items", yk__rb_no_setup, yk__rb_arrdel_queue,
+     yk__rb_no_teardown},
+    {"containers/deque", "items", yk__rb_no_setup, yk__rb_deque,
+     yk__rb_no_teardown},
+    {"bitset/sieve_bool_array", "numbers", yk__rb_no_setup,
+     yk__rb_sieve_bool_array, yk__rb_no_teardown},
+    {"bitset/sieve_bitset", "numbers", yk__rb_no_setup, yk__rb_sieve_bitset,
+     yk__rb_no_teardown},
+    {"bitset/and_count_bool_array", "bits", yk__rb_bits_setup,
+     yk__rb_and_count_bool_array, yk__rb_bits_teardown},
+    {"bitset/and_count_bitset", "bits", yk__rb_bits_setup,
+     yk__rb_and_count_bitset, yk__rb_bits_teardown},
+    {"bitset/scan_bool_array", "bits", yk__rb_bits_setup,
+     yk__rb_scan_bool_array, yk__rb_bits_teardown},
+    {"bitset/scan_bitset", "bits", yk__rb_bits_setup, yk__rb_scan_bitset,
+     yk__rb_bits_teardown},
+    {"json/byte_loop_sds", "bytes", yk__rb_json_setup,
+     yk__rb_json_byte_loop_sds, yk__rb_text_teardown},
+    {"json/parse", "bytes", yk__rb_json_setup, yk__rb_json_parse,
+     yk__rb_text_teardown},
+    {"json/parse_walk", "bytes", yk__rb_json_setup, yk__rb_json_parse_walk,
+     yk__rb_text_teardown},
+    {"csv/byte_loop_sds", "bytes", yk__rb_csv_setup, yk__rb_csv_byte_loop_sds,
+     yk__rb_text_teardown},
+    {"csv/parse", "bytes", yk__rb_csv_setup, yk__rb_csv_parse,
+     yk__rb_text_teardown},
+    {"system/printint", "ints", yk__rb_no_setup, yk__rb_printint,
+     yk__rb_no_teardown},
+};
+#define YK__RB_CASE_COUNT (sizeof(yk__rb_cases) / sizeof(yk__rb_cases[0]))
+/**
+ * Run given case until min_ns has passed (at least 3 times)
+ */
+static struct yk__rb_result yk__rb_measure(const struct yk__rb_case *c,
+                                           size_t n, int64_t min_ns) {
+  struct yk__rb_result r = {NULL, c->unit, 0, INT64_MAX, 0, 0};
+  void *state = c->setup(n);
+  r.items = c->run(state, n);// warm up
+  int64_t total = 0;
+  while (total < min_ns || r.iterations < 3) {
+    int64_t start = yk__rb_now_ns();
+    c->run(state, n);
+    int64_t elapsed = yk__rb_now_ns() - start;
+    if (elapsed < r.min_ns) { r.min_ns = elapsed; }
+    total += elapsed;
+    r.iterations++;
+  }
+  c->teardown(state);
+  r.mean_ns = total / r.iterations;
+  if (r.min_ns < 1) { r.min_ns = 1; }
+  return r;
+}
+static double yk__rb_per_second(const struct yk__rb_result *r) {
+  return (double) r->items * 1e9 / (double) r->min_ns;
+}
+static void yk__rb_print_header(void) {
+  fprintf(stderr, "%-32s %9s %12s %12s %16s\n", "benchmark", "iters",
+          "min (us)", "mean (us)", "items/s");
+}
+static void yk__rb_print_result(const struct yk__rb_result *r) {
+  fprintf(stderr, "%-32s %9lld %12.3f %12.3f %16.0f %s/s\n", r->name,
+          (long long) r->iterations, (double) r->min_ns / 1e3,
+          (double) r->mean_ns / 1e3, yk__rb_per_second(r), r->unit);
+}
+// Same format as YakshaBench -o, one benchmark per line
+static int yk__rb_write_json(struct yk__rb_result *results, const char *path) {
+  FILE *out = fopen(path, "w");
+  if (out == NULL) { return 0; }
+  size_t count = (size_t) yk__arrlen(results);
+  fprintf(out, "{\"benchmarks\": [\n");
+  for (size_t i = 0; i < count; i++) {
+    struct yk__rb_result *r = &results[i];
+    fprintf(out,
+            "  {\"name\": \"%s\", \"iterations\": %lld, \"min_ns\": %lld, "
+            "\"mean_ns\": %lld, \"items\": %llu, \"unit\": \"%s\", "
+            "\"items_per_second\": %.0f}%s\n",
+            r->name, (long long) r->iterations, (long long) r->min_ns,
+            (long long) r->mean_ns, (unsigned long long) r->items, r->unit,
+            yk__rb_per_second(r), i + 1 < count ? "," : "");
+  }
+  fprintf(out, "]}\n");
+  fclose(out);
+  return 1;
+}
+static void yk__rb_usage(const char *program) {
+  fprintf(stderr,
+          "Usage: %s [-f FILTER] [-o FILE] [-m MS]\n"
+          "  -f FILTER  only run benchmarks with FILTER in their name\n"
+          "  -o FILE    write results as JSON\n"
+          "  -m MS      minimum time per benchmark in milliseconds "
+          "(default 200)\n",
+          program);
+}
+int32_t yk__runtime_bench_run(void) {
+  struct yk__arguments *args = yk__get_args();
+  const char *filter = NULL;
+  const char *json_path = NULL;
+  int64_t min_ms = 200;
+  for (int i = 1; i < args->argc; i++) {
+    const char *arg = args->argv[i];
+    int has_value = i + 1 < args->argc;
+    if (strcmp(arg, "-f") == 0 && has_value) {
+      filter = args->argv[++i];
+    } else if (strcmp(arg, "-o") == 0 && has_value) {
+      json_path = args->argv[++i];
+    } else if (strcmp(arg, "-m") == 0 && has_value) {
+      min_ms = strtoll(args->argv[++i], NULL, 10);
+    } else {
+      yk__rb_usage(args->argv[0]);
+      return 1;
+    }
+  }
+  // yk__printint benchmarks write to stdout, keep it out of the report
+  if (freopen(YK__RB_NULL_DEVICE, "w", stdout) == NULL) {
+    fprintf(stderr, "Failed to redirect stdout to %s\n", YK__RB_NULL_DEVICE);
+    return 1;
+  }
+  struct yk__rb_result *results = NULL;
+  yk__rb_print_header();
+  for (size_t c = 0; c < YK__RB_CASE_COUNT; c++) {
+    for (size_t s = 0; s < YK__RB_SIZE_COUNT; s++) {
+      yk__sds name = yk__sdscatprintf(yk__sdsempty(), "%s/%zu",
+                                      yk__rb_cases[c].name, yk__rb_sizes[s]);
+      if (filter != NULL && strstr(name, filter) == NULL) {
+        yk__sdsfree(name);
+        continue;
+      }
+      struct yk__rb_result r =
+          yk__rb_measure(&yk__rb_cases[c], yk__rb_sizes[s], min_ms * 1000000);
+      r.name = name;
+      yk__rb_print_result(&r);
+      yk__arrput(results, r);
+    }
+  }
+  int32_t exit_code = 0;
+  if (json_path != NULL && !yk__rb_write_json(results, json_path)) {
+    fprintf(stderr, "Failed to write: %s\n", json_path);
+    exit_code = 1;
+  }
+  for (size_t i = 0; i < (size_t) yk__arrlen(results); i++) {
+    yk__sdsfree(results[i].name);
+  }
+  yk__arrfree(results);
+  return exit_code;
+}
+#if defined(YK__RUNTIME_BENCH_STANDALONE)
+// CMake build does not go through yakshac, so provide the entry point here
+int32_t yy__main(void) { return yk__runtime_bench_run(); }
+#endif
@@ -0,0 +1,17 @@
+#ifndef YK__RUNTIME_BENCH_H
+#define YK__RUNTIME_BENCH_H
+#include <stdint.h>
+/**
+ * Run runtime micro-benchmarks
+ *
+ * Arguments are read from yk__get_args()
+ *   -f FILTER  only run benchmarks with FILTER in their name
+ *   -o FILE    write results as JSON (one benchmark per line)
+ *   -m MS      minimum time to spend on each benchmark (default 200)
+ *
+ * Results table is written to stderr, stdout is redirected to the null
+ * device as yk__printint benchmarks write to it.
+ * @return 0 on success
+ */
+int32_t yk__runtime_bench_run(void);
+#endif
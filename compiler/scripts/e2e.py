@@ -43,6 +43,7 @@ import glob
 import json
 import os
 import re
+import shutil
 import subprocess
 import sys
 from typing import Union, List
@@ -175,6 +176,23 @@ def perform_test(current: str, snapshot: str, path: str) -> bool:
     return not any_mismatches
 
 
+def run_project(project_dir: str) -> str:
+    # Build a project directory (with yaksha.toml) and run the binary it produces
+    os.chdir(project_dir)
+    preserve_build = os.path.exists("build")
+    with open("yaksha.toml", "r", encoding="utf-8") as h:
+        name = re.search(r'^name\s*=\s*"([^"]+)"', h.read(), re.MULTILINE).group(1)
+    so, se, ret = execute([CARPNTR, "-S"])
+    # Build output has paths and cache stats, only keep it if build failed
+    output = get_cleaned_output(so, se)
+    if ret == 0:
+        so, se, ret = execute([os.path.join("build", name + (".exe" if WINDOWS else ""))])
+        output = get_cleaned_output(so, se)
+    if not preserve_build:
+        shutil.rmtree("build", ignore_errors=True)
+    return output + "\n\nreturn := " + str(ret)
+
+
 def main(test_mode: bool) -> int:
     print(Colors.cyan("""    
 ███████ ██████  ███████ 
@@ -188,6 +206,10 @@ def main(test_mode: bool) -> int:
     with open(E2E_FILES, "r", encoding="utf-8") as h:
         for path in h:
             full_path = os.path.abspath(os.path.join(os.path.dirname(SCRIPT_DIR), path.strip()))
+            if os.path.isdir(full_path):
+                print(Colors.warning("Building:"), path.strip())
+                results[path.strip()] = run_project(full_path)
+                continue
             parent = os.path.dirname(full_path)
             filename = os.path.basename(full_path)
             filename_base, _ = os.path.splitext(filename)
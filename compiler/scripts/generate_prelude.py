@@ -36,18 +36,60 @@
 # to the licenses of linked runtime libraries (see compiler/runtime/README.md).
 # 
 # ==============================================================================================
+import json
 import os
 import os.path
+import subprocess
+import tempfile
 
 CPP_TEMPLATE = r"""
 #ifndef YAKSHA_LISP_PRELUDE_H
 #define YAKSHA_LISP_PRELUDE_H
+#include "yaksha_lisp/yaksha_lisp.h"
 #include <string>
 const std::string YAKSHA_LISP_PRELUDE = R"<><><><>(
 $CONTENT$
 )<><><><>";
+// Pre-tokenized YAKSHA_LISP_PRELUDE, used only if size and hash match
+const std::size_t YAKSHA_LISP_PRELUDE_SIZE = $SIZE$;
+const std::uint64_t YAKSHA_LISP_PRELUDE_HASH = $HASH$ULL;
+const yaksha::yaksha_lisp_token_snapshot YAKSHA_LISP_PRELUDE_TOKENS[] = {
+$TOKENS$
+};
 #endif
 """.strip()
+DUMPER = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), "bin", "yakshadmp")
+FNV_OFFSET = 0xcbf29ce484222325
+FNV_PRIME = 0x100000001b3
+
+
+def fnv1a(text: str) -> int:
+    h = FNV_OFFSET
+    for b in text.encode("utf-8"):
+        h = ((h ^ b) * FNV_PRIME) & 0xFFFFFFFFFFFFFFFF
+    return h
+
+
+def tokenize(code: str) -> list:
+    """
+    Tokenize prelude with yaksha_lisp_tokenizer (yakshadmp --lisp-tokens), so snapshot always matches C++ tokenizer
+    Each token is a list of [type, text, line, pos]
+    """
+    with tempfile.TemporaryDirectory() as temp_dir:
+        prelude_path = os.path.join(temp_dir, "prelude.yaksha_lisp")
+        with open(prelude_path, "w", encoding="utf-8", newline="\n") as f:
+            f.write(code)
+        output = subprocess.run([DUMPER, "--lisp-tokens", prelude_path], check=True, stdout=subprocess.PIPE,
+                                encoding="utf-8").stdout
+    return json.loads(output)
+
+
+def to_cpp_tokens(tokens: list) -> str:
+    lines = []
+    for (kind, text, line, pos) in tokens:
+        text = text.replace("\\", "\\\\").replace('"', '\\"')
+        lines.append("    {{yaksha::yaksha_lisp_token_type::{}, \"{}\", {}, {}}},".format(kind, text, line, pos))
+    return "\n".join(lines)
 
 
 def get_middle_text(s, start, end):
@@ -63,11 +105,17 @@ def main():
         tokens = tokens_f.read()
     with open(os.path.join(".", "src", "yaksha_lisp", "prelude_token_gen.yaka"), "r") as tg:
         token_gen = tg.read()
+    prelude_code = template.replace("    # $TOKEN_CONSTS$", tokens)
+    prelude_code = prelude_code.replace("    # $TOKEN_GENERATION$ #", token_gen)
+    # Must match the exact content of the raw string literal
+    raw_string = "\n" + prelude_code + "\n"
+    # Tokenize before opening prelude.h, so it is not truncated if yakshadmp fails
+    cpp_tokens = to_cpp_tokens(tokenize(raw_string))
     with open(os.path.join(".", "src", "yaksha_lisp", "prelude.h"), "w+") as prelude_f:
-        prelude_code = template.replace("    # $TOKEN_CONSTS$", tokens)
-        prelude_code = prelude_code.replace("    # $TOKEN_GENERATION$ #", token_gen)
-        prelude_f.write(CPP_TEMPLATE.replace("$CONTENT$", prelude_code))
-
+        prelude_f.write(CPP_TEMPLATE.replace("$CONTENT$", prelude_code)
+                        .replace("$SIZE$", str(len(raw_string.encode("utf-8"))))
+                        .replace("$HASH$", hex(fnv1a(raw_string)))
+                        .replace("$TOKENS$", cpp_tokens))
 
 if __name__ == "__main__":
     main()
@@ -252,8 +252,33 @@ S_DT = {
     "double": "f64",
 }
 S_DT_MUST_PREFIX = {"RAudioBufferPtr", "RAudioProcessorPtr"}
+# raymath functions with SIMD versions in runtime/raylib_additional/yk__raymath_simd.h
+RAYMATH_SIMD = {
+    "Vector4Lerp": "yk__vector4_lerp",
+    "MatrixMultiply": "yk__matrix_multiply",
+    "QuaternionMultiply": "yk__quaternion_multiply",
+    "QuaternionLerp": "yk__quaternion_lerp",
+    "QuaternionNlerp": "yk__quaternion_nlerp",
+}
+# Functions that work on whole arrays, added after given raymath function
+RAYMATH_ARRAY_FUNCTIONS = {
+    "Vector3Normalize": """@native
+def vector3_normalize_all(values: Array[rl.Vector3]) -> None:
+    # Normalize all vectors in given array in place (same as vector3_normalize, but uses SIMD)
+    ccode \"\"\"yk__vector3_normalize_array(nn__values, yk__arrlenu(nn__values))\"\"\"
+
+""",
+    "Vector3Transform": """@native
+def vector3_transform_all(values: Array[rl.Vector3], mat: rl.Matrix) -> None:
+    # Transform all vectors in given array in place (same as vector3_transform, but uses SIMD)
+    ccode \"\"\"yk__vector3_transform_array(nn__values, yk__arrlenu(nn__values), nn__mat)\"\"\"
+
+""",
+}
 
 NAMESPACE = set()
+# Names of imports in generated files, parameters with these names are renamed
+IMPORTED_MODULES = {"c", "rl"}
 KNOWN_STRUCTURES = set()
 KNOWN_FUNCTIONS = set()
 CANNOT_CONVERT = set()
@@ -527,7 +552,7 @@ def create_macro_function(s: dict) -> Optional[Code]:
     if s["description"]:
         c.comment(s["description"]).newline()
     c.append("ccode").dedent().append(' """')
-    c.append(s["name"]).append("(")
+    c.append(RAYMATH_SIMD.get(s["name"], s["name"])).append("(")
     for i, field in enumerate(s.get("params", [])):
         if i != 0:
             c.append(", ")
@@ -535,6 +560,8 @@ def create_macro_function(s: dict) -> Optional[Code]:
     c.append(")").append('"""')
     c.newline()
     c.newline()
+    if s["name"] in RAYMATH_ARRAY_FUNCTIONS:
+        c.append(RAYMATH_ARRAY_FUNCTIONS[s["name"]], do_indent=False)
     NAMESPACE.add(name)
     KNOWN_FUNCTIONS.add(name)
     return c
@@ -649,6 +676,7 @@ def build(header, target_file, define="RLAPI", add_base=False):
     print(Colors.green("==============="))
     print("Building:" + Colors.cyan(os.path.basename(target_file)))
     print(Colors.green("==============="))
+    NAMESPACE.update(IMPORTED_MODULES)
     if not add_base:
         CODE.buf = ["runtimefeature \"raylib\"\n\nimport libs.c\nimport raylib as rl\n\n"]
     else:
@@ -307,6 +307,8 @@ struct ast_pool {
   ~ast_pool();
 $CREATE_EXPR$
 $CREATE_STMT$
+  // number of expressions and statements created by this pool
+  [[nodiscard]] std::size_t size() const;
 
 private:
   std::vector<expr *> cleanup_expr_;
@@ -405,6 +407,9 @@ ast_pool::ast_pool() {
   cleanup_expr_.reserve(1000);
   cleanup_stmt_.reserve(1000);
 }
+std::size_t ast_pool::size() const {
+  return cleanup_expr_.size() + cleanup_stmt_.size();
+}
 """.strip()
 
 
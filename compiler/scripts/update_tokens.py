@@ -162,6 +162,8 @@ TEMPLATE = r"""
 // generated by update_tokens.py
 #ifndef TOKEN_H
 #define TOKEN_H
+#include <cstring>
+#include <iosfwd>
 #include <string>
 #include <filesystem>
 #include <vector>
@@ -299,11 +301,29 @@ static inline bool is_valid(const std::string& value, const token_type &t) {
 $SIMPLE_VALIDATIONS$
     return is_valid_complex(value, t);
 }
+/**
+ * File name of a token
+ * Names are interned and never freed, so tokens only hold a pointer and
+ * creating or copying a token does not copy the name
+ */
+struct token_file {
+  token_file();
+  token_file(const std::string& name);
+  token_file(const char* name);
+  const std::string& str() const { return *name_; }
+  operator const std::string&() const { return *name_; }
+  bool empty() const { return name_->empty(); }
+  bool operator==(const token_file& other) const { return name_ == other.name_; }
+  bool operator!=(const token_file& other) const { return name_ != other.name_; }
+private:
+  const std::string* name_;
+};
+std::ostream& operator<<(std::ostream& out, const token_file& file);
 /**
  * Single token
  */
 struct token {
-  std::string file_;  // filename
+  token_file file_;   // filename
   int line_;          // line in file
   int pos_;           // position in line
   std::string token_;
@@ -330,12 +350,14 @@ struct tokenizer;
 struct block_analyzer;
 struct type_checker;
 struct def_class_visitor;
+struct escape_analyser;
 struct file_data {
   parser* parser_{};
   tokenizer* tokenizer_{};
   block_analyzer* block_analyzer_{};
   type_checker* type_checker_{nullptr};
   def_class_visitor* dsv_{nullptr};
+  escape_analyser* escape_analyser_{nullptr};
 };
   enum class scanning_step {
     /** Step 0) At the begining when we scan main, or find import */
@@ -373,9 +395,14 @@ TOK_STR_TEMPLATE = r"""
     return "$K$";
 """.strip()
 KW_TO_TOKEN = r"""
-  if (t == "$K$")
+  if (std::memcmp(t.data(), "$K$", $L$) == 0)
     return token_type::KEYWORD_$KU$;
 """.strip()
+KW_LENGTH_CASE_TEMPLATE = r"""
+  case $L$:
+$KW_COMPARES$
+    break;
+""".strip()
 NUMBER_TO_TOKEN = r"""
   if (n == $C$)
     return token_type::$KU$;
@@ -419,8 +446,13 @@ if __name__ == "__main__":
         token_list = ",\n".join(["  " + x for x in TOKENS]) + ",\n  " + UNKNOWN
         str_to_tok = "\n".join(["  " + STR_TOK_TEMPLATE.replace("$K$", x) for x in TOKENS]) \
                      + "\n  return token_type::" + UNKNOWN + ";"
-        kw_to_tok = "\n".join(["  " + KW_TO_TOKEN.replace("$K$", x).replace("$KU$", x.upper()) for x in KEYWORDS]) \
-                    + "\n  return token_type::" + UNKNOWN + ";"
+        # Keywords are grouped by length, so a name is compared with only a few of them
+        kw_lengths = sorted(set(len(x) for x in KEYWORDS))
+        kw_to_tok = "switch (t.size()) {\n" + "\n".join(
+            [KW_LENGTH_CASE_TEMPLATE.replace("$KW_COMPARES$", "\n".join(
+                ["  " + KW_TO_TOKEN.replace("$K$", x).replace("$KU$", x.upper()) for x in KEYWORDS if len(x) == ln]))
+             .replace("$L$", str(ln)) for ln in kw_lengths]) \
+                    + "\n  default:\n    break;\n}\nreturn token_type::" + UNKNOWN + ";"
         num_to_tok = "\n".join(
             [NUMBER_TO_TOKEN.replace("$KU$", token).replace("$C$", str(count)) for token, count in tc.items() if
              token not in TEMP_TOKENS]) \
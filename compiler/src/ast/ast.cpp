@@ -632,4 +632,7 @@ ast_pool::~ast_pool() {
 ast_pool::ast_pool() {
   cleanup_expr_.reserve(1000);
   cleanup_stmt_.reserve(1000);
+}
+std::size_t ast_pool::size() const {
+  return cleanup_expr_.size() + cleanup_stmt_.size();
 }
\ No newline at end of file
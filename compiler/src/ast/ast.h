@@ -728,6 +728,8 @@ namespace yaksha {
     stmt *c_token_soup_stmt(std::vector<token *> soup);
     stmt *c_while_stmt(token *while_keyword, expr *expression,
                        stmt *while_body);
+    // number of expressions and statements created by this pool
+    [[nodiscard]] std::size_t size() const;
 
 private:
     std::vector<expr *> cleanup_expr_;
@@ -39,6 +39,7 @@
 // codefiles.cpp
 #include "codefiles.h"
 #include "ast/parser.h"
+#include "compiler/escape_analyser.h"
 #include "compiler/type_checker.h"
 #include "tokenizer/block_analyzer.h"
 #include "utilities/error_printer.h"
@@ -55,6 +56,7 @@ codefiles::~codefiles() {
     if (f->data_ != nullptr) {
       delete (f->data_->parser_);
       delete (f->data_->type_checker_);
+      delete (f->data_->escape_analyser_);
       delete (f->data_->dsv_);
       delete (f->data_->block_analyzer_);
       delete (f->data_->tokenizer_);
@@ -235,14 +237,20 @@ codefiles::scratch_file_path(const std::string &filename) const {
 file_data *codefiles::parse_or_null(const std::string &data,
                                     const std::string &file_name) {
   auto *t = new tokenizer{file_name, data, yaksha_macros_.get_yk_token_pool()};
-  t->tokenize();
+  {
+    scoped_timer timer{time_report_, "tokenize", file_name};
+    t->tokenize();
+  }
   if (!t->errors_.empty()) {
     ep_->print_errors(t->errors_);
     delete (t);
     return nullptr;
   }
   auto *b = new block_analyzer{t->tokens_, yaksha_macros_.get_yk_token_pool()};
-  b->analyze();
+  {
+    scoped_timer timer{time_report_, "block_analyze", file_name};
+    b->analyze();
+  }
   if (!b->errors_.empty()) {
     ep_->print_errors(b->errors_);
     delete (t);
@@ -250,7 +258,10 @@ file_data *codefiles::parse_or_null(const std::string &data,
     return nullptr;
   }
   auto *p = new parser(file_name, b->tokens_, &pool_);
-  p->step_1_parse_token_soup();
+  {
+    scoped_timer timer{time_report_, "parse_token_soup", file_name};
+    p->step_1_parse_token_soup();
+  }
   if (!b->errors_.empty()) {
     ep_->print_errors(b->errors_);
     delete (t);
@@ -43,6 +43,7 @@
 #include "compiler/entry_struct_func_compiler.h"
 #include "tokenizer/tokenizer.h"
 #include "utilities/error_printer.h"
+#include "utilities/time_report.h"
 #include "utilities/ykdt_pool.h"
 #include "yaksha_lisp/yaksha_lisp.h"
 #include <filesystem>
@@ -82,6 +83,7 @@ namespace yaksha {
     directives directives_{};
     std::filesystem::path libs_path_{};
     bool use_scratch_files_{false};
+    time_report *time_report_{nullptr};
 
 private:
     file_data *parse_or_null(std::filesystem::path &file_name);
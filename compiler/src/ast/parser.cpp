@@ -1190,7 +1190,7 @@ void parser::step_4_expand_macros(macro_processor *mp,
                   analyzer.errors_.front().message_);
     }
     // Update tokens_ for the parse() & inject EOF
-    tokens_ = analyzer.tokens_;
+    tokens_ = std::move(analyzer.tokens_);
     if (tokens_.empty() || tokens_.back()->type_ != token_type::END_OF_FILE) {
       tokens_.emplace_back(
           analyzer.c_token(filepath_, 0, 0, "", token_type::END_OF_FILE));
@@ -1584,4 +1584,6 @@ void parser::step_replace_decl_alias() {
                          err.tok_.pos_);
   }
 }
+std::size_t parser::ast_node_count() const { return pool_.size(); }
+std::size_t parser::token_count() const { return tokens_.size(); }
 #pragma clang diagnostic pop
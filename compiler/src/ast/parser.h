@@ -79,6 +79,10 @@ namespace yaksha {
     // parsing data types
     yk_datatype *parse_datatype();
     void rescan_datatypes();
+    // number of ast nodes created by this parser
+    [[nodiscard]] std::size_t ast_node_count() const;
+    // number of tokens after dsl macro expansion
+    [[nodiscard]] std::size_t token_count() const;
 
 private:
     std::vector<token *> macro_expand(macro_processor *mp,
@@ -53,6 +53,14 @@ static const int ERR_ALLOC = -4;
 static const int ERR_CREATE_SUB = -3;
 int execute_process(const std::filesystem::path &carpntr_path, int argc,
                     char **arguments);
+#if defined(YAKSHA_EMBEDDED_CARPNTR)
+// carpntr is linked in (see CMakeLists.txt), it calls the compiler C API
+//   instead of running `yaksha compile` in a separate process
+extern "C" int yk__embedded_main(int argc, char *argv[]);
+int execute_carpntr(int argc, char **arguments) {
+  return yk__embedded_main(argc, arguments);
+}
+#else
 int execute_carpntr(int argc, char **arguments) {
   std::string path_str = yaksha::get_my_exe_path();
   std::filesystem::path exe_path{path_str};
@@ -71,6 +79,7 @@ int execute_carpntr(int argc, char **arguments) {
   int result = execute_process(carpntr, argc, arguments);
   return result;
 }
+#endif
 #if defined(YAKSHA_OS_WINDOWS)
 // https://learn.microsoft.com/en-gb/archive/blogs/twistylittlepassagesallalike/everyone-quotes-command-line-arguments-the-wrong-way
 void ArgvQuote(const std::string &Argument, std::string &CommandLine,
@@ -39,12 +39,26 @@
 #include "compiler/codegen_c.h"
 #include "compiler/multifile_compiler.h"
 #include "utilities/error_printer.h"
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
 #ifndef PROGRAM_NAME
 #define PROGRAM_NAME "yakshac"
 #endif
 #include "utilities/argparser.h"
 using namespace yaksha;
+static void print_time_report(multifile_compiler &mc,
+                              const argparser::optional_arg &table,
+                              const argparser::optional_arg &trace) {
+  if (table.is_set_) { mc.time_report_.print_table(std::cerr); }
+  if (!trace.is_set_) { return; }
+  std::ofstream trace_file(trace.arg_value_);
+  if (!trace_file.good()) {
+    std::cerr << "Failed to write time trace:" << trace.arg_value_ << "\n";
+    return;
+  }
+  mc.time_report_.print_trace(trace_file);
+}
 int main(int argc, char *argv[]) {
   auto args =
       argparser::ARGS(PROGRAM_NAME, "Compile Yaksha code to C code", "");
@@ -57,7 +71,19 @@ int main(int argc, char *argv[]) {
       argparser::OP_BOOL('e', "--use-scratch-files",
                          "Use scratch files such as '_.main.yaka' if present "
                          "in the same directory instead of 'main.yaka'.");
-  args.optional_ = {&help, &no_main, &no_codegen, &use_scratch_files};
+  auto time_report = argparser::OP_BOOL(
+      't', "--time-report",
+      "Print time spent in each compiler phase and memory usage to stderr.");
+  auto time_trace = argparser::OP_VAL(
+      'T', "--time-trace",
+      "Write compiler phase timings to given file in Chrome trace-event "
+      "format (chrome://tracing).");
+  auto units = argparser::OP_VAL(
+      'u', "--units",
+      "Split generated C code to at most given number of translation units "
+      "(one per module at most), units are separated by '// YK-UNIT' lines.");
+  args.optional_ = {&help,        &no_main,    &no_codegen, &use_scratch_files,
+                    &time_report, &time_trace, &units};
   auto code = argparser::PO("mainfile.yaka", "Yaksha code file.");
   auto lib = argparser::PO_OPT("[LIBS_PARENT_PATH]",
                                "Path to the parent directory of the libraries");
@@ -72,13 +98,24 @@ int main(int argc, char *argv[]) {
     argparser::print_help(args);
     return EXIT_FAILURE;
   }
+  std::size_t max_units = 0;
+  if (units.is_set_) {
+    char *end = nullptr;
+    max_units = std::strtoul(units.arg_value_.c_str(), &end, 10);
+    if (max_units == 0 || end == nullptr || *end != '\0') {
+      std::cerr << "Invalid number of units:" << units.arg_value_ << "\n";
+      return EXIT_FAILURE;
+    }
+  }
   comp_result result;
   multifile_compiler mc{};
   try {
     mc.main_required_ = !no_main.is_set_;
     mc.use_scratch_files_ = use_scratch_files.is_set_;
+    mc.time_report_.enabled_ = time_report.is_set_ || time_trace.is_set_;
     if (no_codegen.is_set_) { mc.error_printer_.json_output_ = true; }
     codegen_c cg{};
+    cg.max_units_ = max_units;
     do_nothing_codegen dn_cg{};
     codegen *cg_ptr = &cg;
     codegen *dn_cg_ptr = &dn_cg;
@@ -88,8 +125,12 @@ int main(int argc, char *argv[]) {
     } else {// code.yaka + LIBS_PARENT_PATH
       result = mc.compile(code.value_, lib.value_, codegen);
     }
+    print_time_report(mc, time_report, time_trace);
     if (result.failed_) { return EXIT_FAILURE; }
-  } catch (parsing_error &e) { mc.error_printer_.print_errors({e}); }
+  } catch (parsing_error &e) {
+    mc.error_printer_.print_errors({e});
+    print_time_report(mc, time_report, time_trace);
+  }
   if (!no_codegen.is_set_) { std::cout << result.code_; }
   return EXIT_SUCCESS;
 }
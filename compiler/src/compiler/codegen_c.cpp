@@ -42,7 +42,14 @@
 #include "comp_result.h"
 #include "to_c_compiler.h"
 #include "utilities/error_printer.h"
+#include <algorithm>
+#include <numeric>
 using namespace yaksha;
+static void write_minimal_main(std::stringstream &c_code) {
+  c_code << "#if defined(YK__MINIMAL_MAIN)\n";
+  c_code << "int main(void) { return yy__main(); }\n";
+  c_code << "#endif";
+}
 codegen_c::codegen_c() = default;
 codegen_c::~codegen_c() = default;
 comp_result codegen_c::emit(codefiles *cf, gc_pool<token> *token_pool,
@@ -51,6 +58,7 @@ comp_result codegen_c::emit(codefiles *cf, gc_pool<token> *token_pool,
   bool has_errors = false;
   std::stringstream function_forward_decls{};
   std::stringstream function_body{};
+  std::vector<std::string> bodies{};
   std::stringstream global_consts{};
   std::stringstream header{};
   std::unordered_set<std::string> runtime_features{};
@@ -59,9 +67,14 @@ comp_result codegen_c::emit(codefiles *cf, gc_pool<token> *token_pool,
   for (int i = file_count - 1; i >= 0; i--) {
     auto f = cf->files_[i];
     to_c_compiler c{*f->data_->dsv_, &cf->pool_, cf->esc_, token_pool};
+    c.multi_unit_ = max_units_ > 0;
     auto result = c.compile(cf, f);
     function_forward_decls << result.function_forward_declarations_;
-    function_body << result.body_;
+    if (max_units_ == 0) {
+      function_body << result.body_;
+    } else if (!result.body_.empty()) {
+      bodies.emplace_back(result.body_);
+    }
     global_consts << result.global_constants_;
     header << result.header_;
     for (const std::string &feature : f->data_->dsv_->runtime_features_) {
@@ -126,7 +139,13 @@ comp_result codegen_c::emit(codefiles *cf, gc_pool<token> *token_pool,
   // ----------------------------------------------------------------
   c_code << header.str();
   c_code << global_consts.str();
-  if (cf->esc_->has_bin_data()) { cf->esc_->compile_binary_data_to(c_code); }
+  if (cf->esc_->has_bin_data()) {
+    if (max_units_ == 0) {
+      cf->esc_->compile_binary_data_to(c_code);
+    } else {
+      cf->esc_->compile_binary_data_declarations_to(c_code);
+    }
+  }
   // ----------------------------------------------------------------
   //   ╔═╗┌┬┐┬─┐┬ ┬┌─┐┌┬┐┬ ┬┬─┐┌─┐┌─┐   ╔╦╗┬ ┬┌─┐┌─┐┌┬┐┌─┐┌─┐┌─┐
   //   ╚═╗ │ ├┬┘│ ││   │ │ │├┬┘├┤ └─┐    ║ └┬┘├─┘├┤  ││├┤ ├┤ └─┐
@@ -139,16 +158,56 @@ comp_result codegen_c::emit(codefiles *cf, gc_pool<token> *token_pool,
   //  ╚  └─┘┘└┘└─┘ ┴ ┴└─┘┘└┘└─┘
   // ----------------------------------------------------------------
   c_code << function_forward_decls.str();
+  if (max_units_ > 0) {
+    LOG_COMP("c code generated as translation units");
+    return {false, write_units(c_code.str(), bodies, cf)};
+  }
   c_code << function_body.str();
   // ----------------------------------------------------------------
   // Generate main() if required
   if (!cf->directives_.no_main_) {
     LOG_COMP("main() function is required");
-    c_code << "#if defined(YK__MINIMAL_MAIN)\n";
-    c_code << "int main(void) { return yy__main(); }\n";
-    c_code << "#endif";
+    write_minimal_main(c_code);
   }
   LOG_COMP("c code generated");
   return {false, c_code.str()};
 }
+std::string codegen_c::write_units(const std::string &shared,
+                                   const std::vector<std::string> &bodies,
+                                   codefiles *cf) const {
+  std::size_t unit_count =
+      std::max<std::size_t>(1, std::min(max_units_, bodies.size()));
+  // Largest module first, always into the smallest unit so far
+  std::vector<std::size_t> order(bodies.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&bodies](std::size_t a, std::size_t b) {
+                     return bodies[a].size() > bodies[b].size();
+                   });
+  std::vector<std::vector<std::size_t>> units(unit_count);
+  std::vector<std::size_t> unit_sizes(unit_count, 0);
+  for (std::size_t module : order) {
+    auto smallest = static_cast<std::size_t>(
+        std::min_element(unit_sizes.begin(), unit_sizes.end()) -
+        unit_sizes.begin());
+    units[smallest].push_back(module);
+    unit_sizes[smallest] += bodies[module].size();
+  }
+  std::stringstream c_code{};
+  c_code << shared;
+  for (std::size_t u = 0; u < unit_count; u++) {
+    c_code << YAKSHA_C_UNIT_SEPARATOR;
+    // Definitions that must exist only once go to the first unit
+    if (u == 0 && cf->esc_->has_bin_data()) {
+      cf->esc_->compile_binary_data_to(c_code);
+    }
+    // Keep modules in the same order as single file output
+    std::sort(units[u].begin(), units[u].end());
+    for (std::size_t module : units[u]) { c_code << bodies[module]; }
+    if (u == 0 && !cf->directives_.no_main_) {
+      write_minimal_main(c_code);
+    }
+  }
+  return c_code.str();
+}
 // Text ART -> https://patorjk.com/software/taag/#p=display&f=Calvin%20S&t=Functions
\ No newline at end of file
@@ -40,14 +40,32 @@
 #ifndef CODEGEN_C_H
 #define CODEGEN_C_H
 #include "codegen.h"
+#include <string>
+#include <vector>
+// Separates shared header and translation units when codegen_c::max_units_ > 0
+#define YAKSHA_C_UNIT_SEPARATOR "\n// YK-UNIT\n"
 namespace yaksha {
   struct codegen_c : codegen {
     codegen_c();
     ~codegen_c() override;
     comp_result emit(codefiles *cf, gc_pool<token> *token_pool,
                      errors::error_printer *ep) override;
+    /**
+     * Split generated code to at most this many translation units
+     * (0 = single file, which is the default)
+     *
+     * Output is then a shared header (structures, forward declarations and
+     * constants) followed by units, each unit starts with
+     * YAKSHA_C_UNIT_SEPARATOR. Units are size balanced and contain whole
+     * modules, so if there are more units than modules it is one per module.
+     */
+    std::size_t max_units_{0};
 
 private:
+    [[nodiscard]] std::string
+    write_units(const std::string &shared,
+                const std::vector<std::string> &bodies,
+                codefiles *cf) const;
   };
 }// namespace yaksha
 #endif
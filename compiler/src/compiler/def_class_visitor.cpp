@@ -66,6 +66,23 @@ void def_class_visitor::visit_def_stmt(def_stmt *obj) {
                       "wrap in a Tuple.");
     return;
   }
+  if (obj->annotations_.arena_) {
+    if (obj->annotations_.native_ || obj->annotations_.native_macro_ ||
+        obj->annotations_.native_define_ || obj->annotations_.template_ ||
+        obj->annotations_.varargs_) {
+      error(obj->name_, "@arena cannot be used with @native, @nativemacro, "
+                        "@nativedefine, @template or @varargs");
+      return;
+    }
+    auto return_type = obj->return_type_->const_unwrap();
+    if (!return_type->is_none() && !return_type->is_bool() &&
+        !return_type->is_a_number()) {
+      error(obj->name_, "@arena function can only return None, bool or a "
+                        "number, arena is released when it returns.");
+      return;
+    }
+    runtime_features_.emplace("arena");
+  }
   function_names_.push_back(name);
   functions_.insert({name, obj});
 }
@@ -150,9 +167,10 @@ bool def_class_visitor::has_function(const std::string &prefixed_name) {
 void def_class_visitor::visit_class_stmt(class_stmt *obj) {
   auto name = obj->name_->token_;
   if (obj->annotations_.varargs_ || obj->annotations_.native_ ||
-      obj->annotations_.template_ || obj->annotations_.native_macro_) {
-    error(obj->name_, "@varargs, @native, @nativemacro and @template are not "
-                      "allowed for classes.");
+      obj->annotations_.template_ || obj->annotations_.native_macro_ ||
+      obj->annotations_.arena_) {
+    error(obj->name_, "@varargs, @native, @nativemacro, @template and @arena "
+                      "are not allowed for classes.");
     return;
   }
   if (obj->annotations_.native_define_ &&
@@ -215,7 +233,7 @@ void def_class_visitor::visit_cfor_stmt(cfor_stmt *obj) {}
 void def_class_visitor::visit_enum_stmt(enum_stmt *obj) {
   if (obj->annotations_.native_ || obj->annotations_.native_define_ ||
       obj->annotations_.native_macro_ || obj->annotations_.on_stack_ ||
-      obj->annotations_.template_) {
+      obj->annotations_.template_ || obj->annotations_.arena_) {
     error(obj->name_, "Annotations are not allowed for enums");
     return;
   }
@@ -45,6 +45,7 @@ delete_stack_stack::delete_stack_stack() : delete_stack(ast_type::STMT_PASS) {
 delete_stack_stack::~delete_stack_stack() = default;
 void delete_stack_stack::push(const std::string &name,
                               const std::string &free_code) {
+  if (ignore_pushes_) { return; }
   delete_levels_.back().push(name, free_code);
 }
 void delete_stack_stack::remove(const std::string &name) {
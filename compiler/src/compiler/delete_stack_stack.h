@@ -57,6 +57,9 @@ namespace yaksha {
     void write_upto_loop(std::stringstream &target, int indent_level,
                          const std::string &return_name);
     ~delete_stack_stack() override;
+    // New deletions are ignored while this is set
+    //  (memory of @arena functions is released with the arena)
+    bool ignore_pushes_{false};
 
 private:
     std::vector<delete_stack> delete_levels_{};
@@ -309,6 +309,13 @@ void entry_struct_func_compiler::compile_binary_data_to(
     std::stringstream &target) {
   target << bin_data_.str();
 }
+void entry_struct_func_compiler::compile_binary_data_declarations_to(
+    std::stringstream &target) {
+  // Binary data is defined in a single translation unit, others use these
+  for (unsigned int i = 0; i < counter_bin_data_; i++) {
+    target << "extern uint8_t const ykbindata" << i << "[];\n";
+  }
+}
 std::string
 entry_struct_func_compiler::compile_fixed_array(yk_datatype *fixed_array_dt,
                                                 datatype_compiler *dtc) {
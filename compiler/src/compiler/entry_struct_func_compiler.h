@@ -90,6 +90,7 @@ namespace yaksha {
                             datatype_compiler *dtc,
                             const std::string &member_prefix);
     void compile_binary_data_to(std::stringstream &target);
+    void compile_binary_data_declarations_to(std::stringstream &target);
     bool has_bin_data();
     void compile_structures(std::stringstream &target);
     ~entry_struct_func_compiler();
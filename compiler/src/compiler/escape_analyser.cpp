@@ -0,0 +1,329 @@
+// ==============================================================================================
+// ╦  ┬┌─┐┌─┐┌┐┌┌─┐┌─┐    Yaksha Programming Language
+// ║  ││  ├┤ │││└─┐├┤     is Licensed with GPLv3 + extra terms. Please see below.
+// ╩═╝┴└─┘└─┘┘└┘└─┘└─┘
+// Note: libs - MIT license, runtime/3rd - various
+// ==============================================================================================
+// GPLv3:
+//
+// Yaksha - Programming Language.
+// Copyright (C) 2020 - 2024 Bhathiya Perera
+//
+// This program is free software: you can redistribute it and/or modify it under the terms
+// of the GNU General Public License as published by the Free Software Foundation,
+// either version 3 of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see https://www.gnu.org/licenses/.
+//
+// ==============================================================================================
+// Additional Terms:
+//
+// Please note that any commercial use of the programming language's compiler source code
+// (everything except compiler/runtime, compiler/libs and compiler/3rd) require a written agreement
+// with author of the language (Bhathiya Perera).
+//
+// If you are using it for an open source project, please give credits.
+// Your own project must use GPLv3 license with these additional terms.
+//
+// You may use programs written in Yaksha/YakshaLisp for any legal purpose
+// (commercial, open-source, closed-source, etc) as long as it agrees
+// to the licenses of linked runtime libraries (see compiler/runtime/README.md).
+//
+// ==============================================================================================
+// escape_analyser.cpp
+#include "escape_analyser.h"
+#include "ast/parser.h"
+#include "def_class_visitor.h"
+using namespace yaksha;
+escape_analyser::escape_analyser(file_info *fi) : fi_(fi) {}
+escape_analyser::~escape_analyser() = default;
+void escape_analyser::analyse() {
+  for (auto st : fi_->data_->parser_->stmts_) { st->accept(this); }
+}
+bool escape_analyser::is_on_stack(expr *construction) const {
+  return stack_constructions_.find(construction) != stack_constructions_.end();
+}
+bool escape_analyser::is_on_stack(stmt *deletion) const {
+  return stack_deletions_.find(deletion) != stack_deletions_.end();
+}
+bool escape_analyser::retains(def_stmt *function, size_t index) {
+  analyse_function(function);
+  auto &params = retains_[function];
+  return index >= params.size() || params[index];
+}
+size_t escape_analyser::stack_objects() const {
+  return stack_constructions_.size();
+}
+void escape_analyser::analyse_function(def_stmt *obj) {
+  if (retains_.find(obj) != retains_.end()) { return; }
+  // Assume all parameters are retained until the body is analysed,
+  //   this is what a (mutually) recursive call will see
+  retains_[obj] = std::vector<bool>(obj->params_.size(), true);
+  auto &annotations = obj->annotations_;
+  if (obj->function_body_ == nullptr || annotations.native_ ||
+      annotations.native_macro_ || annotations.native_define_ ||
+      annotations.template_ || annotations.varargs_) {
+    return;
+  }
+  function_scan scan{};
+  for (auto &param : obj->params_) { scan.declared_[param.name_->token_]++; }
+  function_scan *outer = scan_;
+  scan_ = &scan;
+  obj->function_body_->accept(this);
+  scan_ = outer;
+  if (scan.opaque_) { return; }
+  std::vector<bool> retained{};
+  retained.reserve(obj->params_.size());
+  for (auto &param : obj->params_) {
+    const std::string &name = param.name_->token_;
+    retained.emplace_back(scan.declared_[name] != 1 ||
+                          scan.escaped_.count(name) > 0 ||
+                          scan.deletions_.count(name) > 0);
+  }
+  retains_[obj] = retained;
+  for (auto &construction : scan.constructions_) {
+    const std::string &name = construction.first;
+    if (scan.declared_[name] != 1 || scan.escaped_.count(name) > 0) {
+      continue;
+    }
+    stack_constructions_.insert(construction.second);
+    for (auto deletion : scan.deletions_[name]) {
+      stack_deletions_.insert(deletion);
+    }
+  }
+}
+void escape_analyser::declare(token *name, expr *value) {
+  scan_->declared_[name->token_]++;
+  if (value == nullptr) { return; }
+  expr *type_name = nullptr;
+  if (value->get_type() == ast_type::EXPR_FNCALL) {
+    auto fncall = dynamic_cast<fncall_expr *>(value);
+    if (fncall->args_.empty()) { type_name = fncall->name_; }
+  } else if (value->get_type() == ast_type::EXPR_CURLY_CALL) {
+    type_name = dynamic_cast<curly_call_expr *>(value)->dt_expr_;
+  }
+  if (type_name == nullptr) { return; }
+  auto class_ = class_or_null(type_name);
+  if (class_ == nullptr || class_->annotations_.on_stack_ ||
+      class_->annotations_.native_define_) {
+    return;
+  }
+  // Objects with fixed arrays can be large, keep them on heap
+  for (auto &member : class_->members_) {
+    if (member.data_type_->const_unwrap()->is_fixed_size_array()) { return; }
+  }
+  scan_->constructions_[name->token_] = value;
+}
+class_stmt *escape_analyser::class_or_null(expr *name) {
+  if (name->get_type() == ast_type::EXPR_VARIABLE) {
+    auto &class_name = dynamic_cast<variable_expr *>(name)->name_->token_;
+    if (scan_->declared_.count(class_name) > 0 ||
+        !fi_->data_->dsv_->has_class(class_name)) {
+      return nullptr;
+    }
+    return fi_->data_->dsv_->get_class(class_name);
+  }
+  if (name->get_type() == ast_type::EXPR_GET) {
+    auto get = dynamic_cast<get_expr *>(name);
+    auto module = import_or_null(get->lhs_);
+    if (module == nullptr ||
+        !module->data_->dsv_->has_class(get->item_->token_)) {
+      return nullptr;
+    }
+    return module->data_->dsv_->get_class(get->item_->token_);
+  }
+  return nullptr;
+}
+file_info *escape_analyser::import_or_null(expr *name) {
+  if (name->get_type() != ast_type::EXPR_VARIABLE) { return nullptr; }
+  auto &alias = dynamic_cast<variable_expr *>(name)->name_->token_;
+  if (scan_->declared_.count(alias) > 0) { return nullptr; }
+  for (auto imp : fi_->data_->parser_->import_stmts_) {
+    if (imp->name_->token_ == alias) { return imp->data_; }
+  }
+  return nullptr;
+}
+def_stmt *escape_analyser::function_or_null(expr *name,
+                                            escape_analyser **owner) {
+  if (name->get_type() == ast_type::EXPR_VARIABLE) {
+    auto &fn_name = dynamic_cast<variable_expr *>(name)->name_->token_;
+    if (scan_->declared_.count(fn_name) > 0 ||
+        !fi_->data_->dsv_->has_function(fn_name)) {
+      return nullptr;
+    }
+    *owner = this;
+    return fi_->data_->dsv_->get_function(fn_name);
+  }
+  if (name->get_type() == ast_type::EXPR_GET) {
+    auto get = dynamic_cast<get_expr *>(name);
+    auto module = import_or_null(get->lhs_);
+    if (module == nullptr || module->data_->escape_analyser_ == nullptr ||
+        !module->data_->dsv_->has_function(get->item_->token_)) {
+      return nullptr;
+    }
+    *owner = module->data_->escape_analyser_;
+    return module->data_->dsv_->get_function(get->item_->token_);
+  }
+  return nullptr;
+}
+void escape_analyser::visit_assign_expr(assign_expr *obj) {
+  if (obj->promoted_) {
+    declare(obj->name_, obj->right_);
+  } else {
+    scan_->escaped_.insert(obj->name_->token_);
+  }
+  obj->right_->accept(this);
+}
+void escape_analyser::visit_assign_arr_expr(assign_arr_expr *obj) {
+  obj->assign_oper_->accept(this);
+  obj->right_->accept(this);
+}
+void escape_analyser::visit_assign_member_expr(assign_member_expr *obj) {
+  obj->set_oper_->accept(this);
+  obj->right_->accept(this);
+}
+void escape_analyser::visit_binary_expr(binary_expr *obj) {
+  obj->left_->accept(this);
+  obj->right_->accept(this);
+}
+void escape_analyser::visit_curly_call_expr(curly_call_expr *obj) {
+  for (auto &value : obj->values_) { value.value_->accept(this); }
+}
+void escape_analyser::visit_fncall_expr(fncall_expr *obj) {
+  escape_analyser *owner = nullptr;
+  auto function = function_or_null(obj->name_, &owner);
+  if (function == nullptr && obj->name_->get_type() == ast_type::EXPR_VARIABLE) {
+    auto &name = dynamic_cast<variable_expr *>(obj->name_)->name_->token_;
+    if (name == "inlinec") {
+      scan_->opaque_ = true;
+      return;
+    }
+    if (name == "getref") {
+      scan_->getref_depth_++;
+      for (auto arg : obj->args_) { arg->accept(this); }
+      scan_->getref_depth_--;
+      return;
+    }
+  }
+  if (function == nullptr) { obj->name_->accept(this); }
+  for (size_t i = 0; i < obj->args_.size(); i++) {
+    auto arg = obj->args_[i];
+    // Passing x to a parameter that does not escape is same as using x.member
+    if (function != nullptr && arg->get_type() == ast_type::EXPR_VARIABLE &&
+        scan_->getref_depth_ == 0 && !owner->retains(function, i)) {
+      continue;
+    }
+    arg->accept(this);
+  }
+}
+void escape_analyser::visit_get_expr(get_expr *obj) {
+  if (obj->lhs_->get_type() == ast_type::EXPR_VARIABLE &&
+      scan_->getref_depth_ == 0) {
+    return;
+  }
+  obj->lhs_->accept(this);
+}
+void escape_analyser::visit_grouping_expr(grouping_expr *obj) {
+  obj->expression_->accept(this);
+}
+void escape_analyser::visit_literal_expr(literal_expr *obj) {}
+void escape_analyser::visit_logical_expr(logical_expr *obj) {
+  obj->left_->accept(this);
+  obj->right_->accept(this);
+}
+void escape_analyser::visit_macro_call_expr(macro_call_expr *obj) {}
+void escape_analyser::visit_set_expr(set_expr *obj) {
+  if (obj->lhs_->get_type() == ast_type::EXPR_VARIABLE &&
+      scan_->getref_depth_ == 0) {
+    return;
+  }
+  obj->lhs_->accept(this);
+}
+void escape_analyser::visit_square_bracket_access_expr(
+    square_bracket_access_expr *obj) {
+  obj->name_->accept(this);
+  obj->index_expr_->accept(this);
+}
+void escape_analyser::visit_square_bracket_set_expr(
+    square_bracket_set_expr *obj) {
+  obj->name_->accept(this);
+  obj->index_expr_->accept(this);
+}
+void escape_analyser::visit_unary_expr(unary_expr *obj) {
+  obj->right_->accept(this);
+}
+void escape_analyser::visit_variable_expr(variable_expr *obj) {
+  scan_->escaped_.insert(obj->name_->token_);
+}
+void escape_analyser::visit_block_stmt(block_stmt *obj) {
+  for (auto st : obj->statements_) { st->accept(this); }
+}
+void escape_analyser::visit_break_stmt(break_stmt *obj) {}
+void escape_analyser::visit_ccode_stmt(ccode_stmt *obj) {
+  if (scan_ != nullptr) { scan_->opaque_ = true; }
+}
+void escape_analyser::visit_class_stmt(class_stmt *obj) {}
+void escape_analyser::visit_compins_stmt(compins_stmt *obj) {}
+void escape_analyser::visit_const_stmt(const_stmt *obj) {}
+void escape_analyser::visit_continue_stmt(continue_stmt *obj) {}
+void escape_analyser::visit_def_stmt(def_stmt *obj) { analyse_function(obj); }
+void escape_analyser::visit_defer_stmt(defer_stmt *obj) {
+  if (obj->del_statement_ != nullptr) {
+    obj->del_statement_->accept(this);
+  } else {
+    obj->expression_->accept(this);
+  }
+}
+void escape_analyser::visit_del_stmt(del_stmt *obj) {
+  if (obj->expression_->get_type() == ast_type::EXPR_VARIABLE) {
+    auto &name = dynamic_cast<variable_expr *>(obj->expression_)->name_->token_;
+    scan_->deletions_[name].emplace_back(obj);
+    return;
+  }
+  obj->expression_->accept(this);
+}
+void escape_analyser::visit_expression_stmt(expression_stmt *obj) {
+  obj->expression_->accept(this);
+}
+void escape_analyser::visit_foreach_stmt(foreach_stmt *obj) {
+  declare(obj->name_, nullptr);
+  obj->expression_->accept(this);
+  obj->for_body_->accept(this);
+}
+void escape_analyser::visit_forendless_stmt(forendless_stmt *obj) {
+  obj->for_body_->accept(this);
+}
+void escape_analyser::visit_if_stmt(if_stmt *obj) {
+  obj->expression_->accept(this);
+  obj->if_branch_->accept(this);
+  if (obj->else_branch_ != nullptr) { obj->else_branch_->accept(this); }
+}
+void escape_analyser::visit_import_stmt(import_stmt *obj) {}
+void escape_analyser::visit_let_stmt(let_stmt *obj) {
+  declare(obj->name_, obj->expression_);
+  if (obj->expression_ != nullptr) { obj->expression_->accept(this); }
+}
+void escape_analyser::visit_nativeconst_stmt(nativeconst_stmt *obj) {}
+void escape_analyser::visit_pass_stmt(pass_stmt *obj) {}
+void escape_analyser::visit_return_stmt(return_stmt *obj) {
+  if (obj->expression_ != nullptr) { obj->expression_->accept(this); }
+}
+void escape_analyser::visit_runtimefeature_stmt(runtimefeature_stmt *obj) {}
+void escape_analyser::visit_while_stmt(while_stmt *obj) {
+  obj->expression_->accept(this);
+  obj->while_body_->accept(this);
+}
+void escape_analyser::visit_cfor_stmt(cfor_stmt *obj) {
+  if (obj->init_expr_ != nullptr) { obj->init_expr_->accept(this); }
+  if (obj->comparison_ != nullptr) { obj->comparison_->accept(this); }
+  if (obj->operation_ != nullptr) { obj->operation_->accept(this); }
+  obj->for_body_->accept(this);
+}
+void escape_analyser::visit_enum_stmt(enum_stmt *obj) {}
+void escape_analyser::visit_directive_stmt(directive_stmt *obj) {}
@@ -40,6 +40,7 @@
 #include "multifile_compiler.h"
 #include "ast/codefiles.h"
 #include "ast/parser.h"
+#include "compiler/escape_analyser.h"
 #include "compiler/type_checker.h"
 #include "tokenizer/block_analyzer.h"
 #include "usage_analyser.h"
@@ -66,16 +67,34 @@ comp_result multifile_compiler::compile(const std::string &code, bool use_code,
                                         const std::string &libs_path,
                                         codegen *code_generator) {
   LOG_COMP("compile:" << main_file);
+  comp_result result;
+  {
+    scoped_timer timer{&time_report_, "compile"};
+    result =
+        compile_files(code, use_code, main_file, libs_path, code_generator);
+  }
+  if (time_report_.enabled_) { record_statistics(); }
+  return result;
+}
+comp_result multifile_compiler::compile_files(const std::string &code,
+                                              bool use_code,
+                                              const std::string &main_file,
+                                              const std::string &libs_path,
+                                              codegen *code_generator) {
   std::filesystem::path library_parent{libs_path};
   cf_ = new codefiles{library_parent, &error_printer_};
   cf_->use_scratch_files_ = use_scratch_files_;
+  cf_->time_report_ = &time_report_;
   // Step 0) First of all, we initialize parsing
   // In this step, we initialize all files we know of at this point
   file_info *main_file_info;
-  if (!use_code) {
-    main_file_info = cf_->initialize_parsing_or_null(main_file);
-  } else {
-    main_file_info = cf_->initialize_parsing_or_null(code, main_file);
+  {
+    scoped_timer timer{&time_report_, "initialize_parsing"};
+    if (!use_code) {
+      main_file_info = cf_->initialize_parsing_or_null(main_file);
+    } else {
+      main_file_info = cf_->initialize_parsing_or_null(code, main_file);
+    }
   }
   LOG_COMP("init parsing");
   if (main_file_info == nullptr) {
@@ -94,7 +113,11 @@ comp_result multifile_compiler::compile(const std::string &code, bool use_code,
     LOG_COMP("expand");
     step_5_parse();
     LOG_COMP("parse");
-    bool should_bail = step_6_rescan_imports();
+    bool should_bail;
+    {
+      scoped_timer timer{&time_report_, "step_6_rescan_imports"};
+      should_bail = step_6_rescan_imports();
+    }
     if (should_bail) {
       LOG_COMP("rescan failed");
       return {true, ""};
@@ -173,6 +196,7 @@ comp_result multifile_compiler::compile_all(codegen *code_generator) {
   // Extract defs and structs
   for (auto f : cf_->files_) {
     LOG_COMP("file:" << f->filepath_.string());
+    scoped_timer timer{&time_report_, "def_class_visitor", f->filepath_};
     auto builtins_obj = new builtins(&(cf_->pool_), &token_pool_);
     f->data_->dsv_ = new def_class_visitor(builtins_obj, cf_);
     f->data_->dsv_->extract(f->data_->parser_->stmts_);
@@ -203,6 +227,7 @@ comp_result multifile_compiler::compile_all(codegen *code_generator) {
     for (auto f : cf_->files_) { f->data_->parser_->rescan_datatypes(); }
     // Type check all files
     for (auto f : cf_->files_) {
+      scoped_timer timer{&time_report_, "type_checker", f->filepath_};
       f->data_->type_checker_ =
           new type_checker(f->filepath_.string(), cf_, f->data_->dsv_,
                            &(cf_->pool_), &token_pool_);
@@ -226,10 +251,21 @@ comp_result multifile_compiler::compile_all(codegen *code_generator) {
       LOG_COMP("found type checking errors");
       return {true, ""};
     }
+    if (escape_analysis_) {
+      // Find objects that never leave their function, so they can be on stack
+      for (auto f : cf_->files_) {
+        f->data_->escape_analyser_ = new escape_analyser(f);
+      }
+      for (auto f : cf_->files_) {
+        scoped_timer timer{&time_report_, "escape_analyser", f->filepath_};
+        f->data_->escape_analyser_->analyse();
+      }
+    }
   }
   if (usage_analysis_) {
     // Statement usage analysis
     // So we know which 'functions / classes / consts' are actually used
+    scoped_timer timer{&time_report_, "usage_analyser"};
     usage_analyser ua{main_file_info};
     if (cf_->directives_.no_main_) {
       ua.analyse_no_main();
@@ -242,9 +278,11 @@ comp_result multifile_compiler::compile_all(codegen *code_generator) {
       return {true, ""};
     }
   }
+  scoped_timer timer{&time_report_, "codegen"};
   return code_generator->emit(cf_, &token_pool_, &error_printer_);
 }
 void multifile_compiler::step_5_parse() {
+  scoped_timer step_timer{&time_report_, "step_5_parse"};
   LOG_COMP("parsing: parsing to yaksha AST");
   // Step 5) Parse the file
   for (auto f : cf_->files_) {
@@ -252,6 +290,7 @@ void multifile_compiler::step_5_parse() {
         f->step_ >= scanning_step::PARSE_DONE) {
       continue;
     }
+    scoped_timer timer{&time_report_, "parse", f->filepath_};
     f->data_->parser_->parse();
     if (f->data_->parser_->errors_.empty()) {
       f->step_ = scanning_step::PARSE_DONE;
@@ -263,6 +302,7 @@ void multifile_compiler::step_5_parse() {
   }
 }
 void multifile_compiler::step_4_expand_macros() {
+  scoped_timer step_timer{&time_report_, "step_4_expand_macros"};
   LOG_COMP("parsing: dsl macro expansion");
   // Step 4) Expand macros
   for (auto f : cf_->files_) {
@@ -270,6 +310,7 @@ void multifile_compiler::step_4_expand_macros() {
         f->step_ >= scanning_step::MACROS_EXPANDED) {
       continue;
     }
+    scoped_timer timer{&time_report_, "expand_macros", f->filepath_};
     f->data_->parser_->step_4_expand_macros(&(cf_->yaksha_macros_),
                                             &token_pool_);
     if (f->data_->parser_->errors_.empty()) {
@@ -283,6 +324,7 @@ void multifile_compiler::step_4_expand_macros() {
   }
 }
 void multifile_compiler::step_3_macros_setup() {
+  scoped_timer step_timer{&time_report_, "step_3_macros_setup"};
   LOG_COMP("parsing: macros setup by executing all macros statements");
   // Step 3) Macros setup by executing all macros statements
   for (auto f : cf_->files_) {
@@ -290,6 +332,7 @@ void multifile_compiler::step_3_macros_setup() {
         f->step_ >= scanning_step::MACROS_SETUP_DONE) {
       continue;
     }
+    scoped_timer timer{&time_report_, "execute_macros", f->filepath_};
     f->data_->parser_->step_3_execute_macros(&(cf_->yaksha_macros_));
     if (f->data_->parser_->errors_.empty()) {
       f->step_ = scanning_step::MACROS_SETUP_DONE;
@@ -302,6 +345,7 @@ void multifile_compiler::step_3_macros_setup() {
   }
 }
 void multifile_compiler::step_2_initialize_preprocessor_env() {
+  scoped_timer step_timer{&time_report_, "step_2_initialize_preprocessor_env"};
   LOG_COMP("parsing: initialize preprocessing lisp environments for each file");
   // Step 2) initialize preprocessing lisp environments for each file
   for (auto f : cf_->files_) {
@@ -309,6 +353,7 @@ void multifile_compiler::step_2_initialize_preprocessor_env() {
         f->step_ >= scanning_step::ENV_CREATED) {
       continue;
     }
+    scoped_timer timer{&time_report_, "init_env", f->filepath_};
     std::string fp = f->filepath_.string();
     LOG_COMP("parsing: initialize preprocessing lisp environments for " << fp);
     try {
@@ -323,6 +368,7 @@ void multifile_compiler::step_2_initialize_preprocessor_env() {
   }
 }
 void multifile_compiler::step_1_scan_macro_soup() {
+  scoped_timer step_timer{&time_report_, "step_1_scan_macro_soup"};
   LOG_COMP("parsing: scan macro soup");
   // Step 1) Scan macro soup
   for (auto f : cf_->files_) {
@@ -330,6 +376,7 @@ void multifile_compiler::step_1_scan_macro_soup() {
         f->step_ >= scanning_step::SOUP_SCAN_DONE) {
       continue;
     }
+    scoped_timer timer{&time_report_, "scan_macro_soup", f->filepath_};
     f->data_->parser_->step_1_parse_token_soup();
     if (f->data_->parser_->errors_.empty()) {
       f->step_ = scanning_step::SOUP_SCAN_DONE;
@@ -362,6 +409,39 @@ bool multifile_compiler::has_invalid_main_func(
   }
   return has_errors;
 }
+void multifile_compiler::record_statistics() {
+  if (cf_ == nullptr) { return; }
+  std::uint64_t tokens = 0;
+  std::uint64_t expanded_tokens = 0;
+  std::uint64_t ast_nodes = 0;
+  std::uint64_t stack_objects = 0;
+  for (auto f : cf_->files_) {
+    if (f->data_ == nullptr) { continue; }
+    tokens += f->data_->tokenizer_->tokens_.size();
+    expanded_tokens += f->data_->parser_->token_count();
+    ast_nodes += f->data_->parser_->ast_node_count();
+    if (f->data_->escape_analyser_ != nullptr) {
+      stack_objects += f->data_->escape_analyser_->stack_objects();
+    }
+  }
+  time_report_.count("files", cf_->files_.size());
+  time_report_.count("tokens", tokens);
+  time_report_.count("tokens_after_macro_expansion", expanded_tokens);
+  time_report_.count("ast_nodes", ast_nodes);
+  time_report_.count("stack_objects", stack_objects);
+  time_report_.count("builtins_token_pool_allocated", token_pool_.allocated_);
+  auto yk_tokens = cf_->yaksha_macros_.get_yk_token_pool();
+  time_report_.count("token_pool_allocated", yk_tokens->allocated_);
+  auto gc = cf_->yaksha_macros_.gc_stats();
+  time_report_.count("lisp_gc_collections", gc.collections_);
+  time_report_.count("lisp_gc_skipped", gc.skipped_);
+  time_report_.count("lisp_gc_freed", gc.freed_);
+  time_report_.count("lisp_gc_live", gc.live_);
+  time_report_.count("lisp_gc_allocated", gc.allocated_);
+  time_report_.count("lisp_gc_capacity", gc.capacity_);
+  time_report_.count("lisp_gc_pause_us_total", gc.pause_ns_total_ / 1000);
+  time_report_.count("lisp_gc_pause_us_max", gc.pause_ns_max_ / 1000);
+}
 multifile_compiler::~multifile_compiler() { delete cf_; }
 codefiles &multifile_compiler::get_codefiles() const { return *cf_; }
 bool multifile_compiler::has_not_allowed_imports_for_no_std_lib() {
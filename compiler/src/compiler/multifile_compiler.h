@@ -45,6 +45,7 @@
 #include "tokenizer/token.h"
 #include "utilities/error_printer.h"
 #include "utilities/gc_pool.h"
+#include "utilities/time_report.h"
 #include <string>
 namespace yaksha {
   struct do_nothing_codegen : codegen {
@@ -65,11 +66,18 @@ namespace yaksha {
     bool main_required_ = true;
     bool check_types_ = true;
     bool usage_analysis_ = true;
+    bool escape_analysis_ = true;
     bool use_scratch_files_ = false;
     errors::error_printer error_printer_{};
+    time_report time_report_{};
 
 private:
     gc_pool<token> token_pool_{};
+    comp_result compile_files(const std::string &code, bool use_code,
+                              const std::string &main_file,
+                              const std::string &libs_path,
+                              codegen *code_generator);
+    void record_statistics();
     void step_1_scan_macro_soup();
     void step_2_initialize_preprocessor_env();
     void step_3_macros_setup();
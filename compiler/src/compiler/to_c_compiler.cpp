@@ -407,7 +407,7 @@ void to_c_compiler::visit_fncall_expr(fncall_expr *obj) {
       error(obj->paren_token_, "Cannot construct an @onstack object");
     }
     auto prefixed_class_name = prefix(module_class, module_prefix);
-    compile_obj_creation(prefixed_class_name, code,
+    compile_obj_creation(obj, prefixed_class_name, code,
                          dt_pool_->create(module_class, module_file));
   } else if (name_pair.second.object_type_ == object_type::MODULE_FUNCTION) {
     auto module_file = name_pair.second.module_file_;
@@ -448,7 +448,7 @@ void to_c_compiler::visit_fncall_expr(fncall_expr *obj) {
     if (class_->annotations_.on_stack_) {
       error(obj->paren_token_, "Cannot construct an @onstack object");
     }
-    compile_obj_creation(prefix(name, prefix_val_), code,
+    compile_obj_creation(obj, prefix(name, prefix_val_), code,
                          dt_pool_->create(name, this->filepath_));
   } else if (name_pair.second.datatype_->is_function()) {
     LOG_COMP("function_pointer: " << name);
@@ -465,16 +465,27 @@ void to_c_compiler::visit_fncall_expr(fncall_expr *obj) {
     error(obj->paren_token_, "Invalid function call compilation");
   }
 }
-void to_c_compiler::compile_obj_creation(const std::string &name,
+void to_c_compiler::compile_obj_creation(expr *construction,
+                                         const std::string &name,
                                          std::stringstream &code,
                                          yk_datatype *return_type) {
-  obj_calloc(name, code);
+  obj_alloc(construction, name, code);
   auto data = yk_object(return_type);
   push(code.str(), data);
 }
-void to_c_compiler::obj_calloc(const std::string &name,
-                               std::stringstream &code) {
-  code << "calloc(1, sizeof(struct " << name << "))";
+void to_c_compiler::obj_alloc(expr *construction, const std::string &name,
+                              std::stringstream &code) {
+  if (inline_mode_ || escapes_ == nullptr ||
+      !escapes_->is_on_stack(construction)) {
+    code << "yk__obj_alloc(struct " << name << ")";
+    return;
+  }
+  // Object never leaves current function, use a zeroed struct on stack
+  auto storage = temp();
+  write_indent(body_);
+  body_ << "struct " << name << " " << storage << " = {0}";
+  write_end_statement(body_);
+  code << "(&" << storage << ")";
 }
 void to_c_compiler::compile_function_call(
     fncall_expr *obj, const std::string &name, std::stringstream &code,
@@ -812,6 +823,10 @@ void to_c_compiler::visit_block_stmt(block_stmt *obj) {
   body_ << "\n";
   write_prev_indent(body_);
   body_ << "{\n";
+  if (!block_prologue_.empty()) {
+    body_ << block_prologue_;
+    block_prologue_.clear();
+  }
   for (auto st : obj->statements_) { st->accept(this); }
   // Clean out what we create inside while scope or if scope blocks
   // For defs, deletion happen before return
@@ -965,7 +980,20 @@ void to_c_compiler::visit_def_stmt(def_stmt *obj) {
       deletions_.push(to_delete, "yk__sdsfree(" + to_delete + ")");
     }
   }
+  if (obj->annotations_.arena_) {
+    // Everything allocated in the function body comes from a new arena,
+    // it is released in one go instead of freeing each value
+    auto arena = temp();
+    std::stringstream prologue{};
+    write_indent(prologue);
+    prologue << "struct yk__arena* " << arena << " = yk__arena_begin()";
+    write_end_statement(prologue);
+    block_prologue_ = prologue.str();
+    deletions_.push(arena, "yk__arena_end(" + arena + ")");
+    deletions_.ignore_pushes_ = true;
+  }
   obj->function_body_->accept(this);
+  deletions_.ignore_pushes_ = false;
   defers_.pop_defer_stack();
   deletions_.pop_delete_stack();
   dedent();
@@ -1373,6 +1401,7 @@ compiler_output to_c_compiler::compile(codefiles *cf, file_info *fi) {
   // ------ Set to members for ease of access ---------
   this->cf_ = cf;
   this->prefix_val_ = fi->prefix_;
+  this->escapes_ = fi->data_->escape_analyser_;
   // -------- Define forward declarations ---------------
   for (const auto &name : this->defs_classes_.global_const_names_) {
     auto cls = defs_classes_.get_const(name);
@@ -1450,6 +1479,8 @@ void to_c_compiler::visit_class_stmt(class_stmt *obj) {
   esc_->register_structure(name, class_dt, obj, this, prefix_val_);
 }
 void to_c_compiler::visit_del_stmt(del_stmt *obj) {
+  // Object is on stack, nothing to free
+  if (escapes_ != nullptr && escapes_->is_on_stack(obj)) { return; }
   obj->expression_->accept(this);
   auto name = pop();
   if (name.second.is_primitive_or_obj() &&
@@ -1474,11 +1505,24 @@ void to_c_compiler::visit_del_stmt(del_stmt *obj) {
   } else if (name.second.is_primitive_or_obj() &&
              name.second.datatype_->const_unwrap()->is_sr()) {
     body_ << "yk__bstr_free_underlying(" << name.first << ")";
-  } else {
+  } else if (is_native_memory(name.second.datatype_)) {
     body_ << "free(" << name.first << ")";
+  } else {
+    body_ << "yk__obj_free(" << name.first << ")";
   }
   write_end_statement(body_);
 }
+bool to_c_compiler::is_native_memory(yk_datatype *dt) {
+  dt = dt->const_unwrap();
+  if (dt->is_ptr() || dt->is_any_ptr() || dt->is_any_ptr_to_const()) {
+    return true;
+  }
+  if (dt->module_.empty() || cf_ == nullptr) { return false; }
+  auto module = cf_->get_or_null(dt->module_);
+  if (module == nullptr) { return false; }
+  auto class_info = module->data_->dsv_->get_class(dt->token_->token_);
+  return class_info != nullptr && class_info->annotations_.native_define_;
+}
 void to_c_compiler::visit_get_expr(get_expr *obj) {
   obj->lhs_->accept(this);
   auto lhs = pop();
@@ -1693,6 +1737,7 @@ void to_c_compiler::visit_const_stmt(const_stmt *obj) {
         auto exp = compile_expression(obj->expression_);
         if (exp.second.datatype_->const_unwrap()->is_string_literal()) {
           auto u = string_utils::unescape(exp.second.string_val_);
+          if (multi_unit_) { global_constants_ << "static "; }
           global_constants_ << "struct yk__bstr const " << name << " = "
                             << "((struct yk__bstr){.data.s = " << "\""
                             << string_utils::escape(u) << "\""
@@ -1707,6 +1752,7 @@ void to_c_compiler::visit_const_stmt(const_stmt *obj) {
     auto exp = pop();
     auto castable = obj->data_type_->const_unwrap()->auto_cast(
         exp.second.datatype_, dt_pool_, false, true);
+    if (multi_unit_) { global_constants_ << "static "; }
     global_constants_ << this->convert_dt(obj->data_type_,
                                           datatype_location::STRUCT, "", "")
                       << " " << name;
@@ -1870,10 +1916,11 @@ void to_c_compiler::visit_curly_call_expr(curly_call_expr *obj) {
     } else {
       // ---------- On heap --------
       auto temp_name = temp();
+      std::stringstream allocation{};
+      obj_alloc(obj, prefixed_class_name, allocation);
       write_indent(body_);
       body_ << convert_dt(dt, datatype_location::STRUCT, "", "") << " "
-            << temp_name << " = ";
-      obj_calloc(prefixed_class_name, body_);
+            << temp_name << " = " << allocation.str();
       write_end_statement(body_);
       for (auto const &para : obj->values_) {
         para.value_->accept(this);
@@ -1961,15 +2008,22 @@ void to_c_compiler::visit_directive_stmt(directive_stmt *obj) {
     body_ << ::string_utils::unescape(obj->directive_val_->token_);
     write_end_statement(body_);
   } else if (obj->directive_type_->token_ == "c_include") {
-    write_indent(body_);
-    body_ << "#include \""
-          << ::string_utils::unescape(obj->directive_val_->token_) << "\"";
-    write_end_statement(body_);
+    auto &target = include_target();
+    write_indent(target);
+    target << "#include \""
+           << ::string_utils::unescape(obj->directive_val_->token_) << "\"";
+    write_end_statement(target);
   } else if (obj->directive_type_->token_ == "c_sys_include") {
-    write_indent(body_);
-    body_ << "#include <"
-          << ::string_utils::unescape(obj->directive_val_->token_) << ">";
-    write_end_statement(body_);
+    auto &target = include_target();
+    write_indent(target);
+    target << "#include <"
+           << ::string_utils::unescape(obj->directive_val_->token_) << ">";
+    write_end_statement(target);
   }
   // ignore other directives
 }
+std::stringstream &to_c_compiler::include_target() {
+  // Other translation units may depend on global includes
+  if (multi_unit_ && scope_.is_global_level()) { return header_; }
+  return body_;
+}
@@ -47,6 +47,7 @@
 #include "compiler/compiler_utils.h"
 #include "compiler/delete_stack_stack.h"
 #include "compiler/desugaring_compiler.h"
+#include "compiler/escape_analyser.h"
 #include "compiler/function_datatype_extractor.h"
 #include "compiler/statement_writer.h"
 #include "datatype_compiler.h"
@@ -138,6 +139,12 @@ namespace yaksha {
     void visit_cfor_stmt(cfor_stmt *obj) override;
     void visit_enum_stmt(enum_stmt *obj) override;
     void visit_directive_stmt(directive_stmt *obj) override;
+    /**
+     * Set when output is split to multiple translation units.
+     * Global constants become static (they are placed in the shared header)
+     * and global level C includes are written to the header.
+     */
+    bool multi_unit_{false};
 
 private:
     void push_scope_type(ast_type scope_type);
@@ -146,6 +153,7 @@ private:
     void write_indent(std::stringstream &where) const;
     void write_prev_indent(std::stringstream &where) const;
     void write_end_statement(std::stringstream &where);
+    std::stringstream &include_target();
     void push(const std::string &expr, const yk_object &data_type);
     void error(token *tok, const std::string &message);
     void error(const std::string &message);
@@ -181,6 +189,8 @@ private:
     std::vector<yk_object> type_stack_{};
     // Delete stack for strings
     delete_stack_stack deletions_{};
+    // Written at the start of next block (arena of an @arena function)
+    std::string block_prologue_{};
     // Access functions and classes by name
     def_class_visitor &defs_classes_;
     // Different types of scopes stack, -> are we in function body, if or while
@@ -195,6 +205,8 @@ private:
     desugaring_compiler *desugar_;
     // Entry struct & function datatypes compiler
     entry_struct_func_compiler *esc_;
+    // Objects that can be placed on stack (null if not analysed)
+    escape_analyser *escapes_{nullptr};
     // Copy of internal stmt_alias to handle dt parsing in builtins
     std::unordered_map<std::string, import_stmt *> import_stmts_alias_{};
     // Current file path
@@ -205,7 +217,8 @@ private:
                                yk_datatype *return_type,
                                const std::vector<yk_datatype *> &parameters,
                                bool varargs_fnc);
-    void compile_obj_creation(const std::string &name, std::stringstream &code,
+    void compile_obj_creation(expr *construction, const std::string &name,
+                              std::stringstream &code,
                               yk_datatype *return_type);
     std::string
     prefix_function_arg(const std::pair<std::string, yk_object> &arg_val);
@@ -213,7 +226,11 @@ private:
                         std::pair<std::string, yk_object> &rhs,
                         token *operator_token, bool assign_variable,
                         bool lhs_mutates);
-    static void obj_calloc(const std::string &name, std::stringstream &code);
+    void obj_alloc(expr *construction, const std::string &name,
+                   std::stringstream &code);
+    // Pointers and native structures are allocated outside of Yaksha, so
+    // they are freed with free() instead of yk__obj_free()
+    bool is_native_memory(yk_datatype *dt);
     static bool should_wrap_in_paren(const std::string &code);
     void compile_simple_bin_op(const binary_expr *obj,
                                const token_type &operator_type,
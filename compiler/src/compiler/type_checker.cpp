@@ -40,6 +40,7 @@
 #include "type_checker.h"
 #include "ast/parser.h"
 #include "compiler_utils.h"
+#include <algorithm>
 #include <utility>
 using namespace yaksha;
 type_checker::type_checker(std::string filepath, codefiles *cf,
@@ -96,7 +97,11 @@ void type_checker::visit_assign_expr(assign_expr *obj) {
     scope_.define(name, object);
   } else {
     handle_assigns(obj->opr_, object, rhs);
+    if (arena_ && arena_params_.count(name) > 0) {
+      check_arena_store(obj->opr_, nullptr, obj->right_, rhs);
+    }
   }
+  if (arena_) { track_arena_alias(name, obj->right_); }
 }
 template<typename Verifier>
 bool dt_match_ignore_const(yk_datatype *lhs, yk_datatype *rhs, Verifier v) {
@@ -319,6 +324,7 @@ void type_checker::visit_fncall_expr(fncall_expr *obj) {
         }
       }
     }
+    if (arena_) { check_arena_call(obj, funct, arguments); }
     push(yk_object(funct->return_type_));
     return;
   }
@@ -337,6 +343,7 @@ void type_checker::visit_fncall_expr(fncall_expr *obj) {
       push(yk_object(dt_pool_));// Push None here
       return;
     }
+    if (arena_) { check_arena_call(obj, name.string_val_); }
     push(result);
     return;
   }
@@ -561,6 +568,11 @@ void type_checker::visit_def_stmt(def_stmt *obj) {
       scope_.define(name, data);
     }
   }
+  arena_ = obj->annotations_.arena_;
+  if (arena_) {
+    arena_params_ = param_names;
+    arena_outside_ = param_names;
+  }
   auto body = dynamic_cast<block_stmt *>(obj->function_body_);
   if (obj->annotations_.native_ || obj->annotations_.native_macro_ ||
       obj->annotations_.native_define_) {
@@ -626,6 +638,9 @@ void type_checker::visit_def_stmt(def_stmt *obj) {
     }
     obj->function_body_->accept(this);
   }
+  arena_ = false;
+  arena_params_.clear();
+  arena_outside_.clear();
   scope_.pop();
   pop_scope_type();
   pop_function();
@@ -670,6 +685,7 @@ void type_checker::visit_let_stmt(let_stmt *obj) {
     obj->expression_->accept(this);
     auto expression_data = pop();
     handle_assigns(obj->name_, placeholder, expression_data);
+    if (arena_) { track_arena_alias(name, obj->expression_); }
   }
   scope_.define(name, placeholder);
 }
@@ -994,6 +1010,9 @@ void type_checker::visit_assign_member_expr(assign_member_expr *obj) {
   obj->right_->accept(this);
   auto rhs = pop();
   handle_assigns(obj->opr_, lhs, rhs);
+  if (arena_) {
+    check_arena_store(obj->opr_, obj->set_oper_, obj->right_, rhs);
+  }
 }
 void type_checker::visit_square_bracket_access_expr(
     square_bracket_access_expr *obj) {
@@ -1062,6 +1081,9 @@ void type_checker::visit_assign_arr_expr(assign_arr_expr *obj) {
   obj->right_->accept(this);
   auto rhs = pop();
   handle_assigns(obj->opr_, lhs, rhs);
+  if (arena_) {
+    check_arena_store(obj->opr_, obj->assign_oper_, obj->right_, rhs);
+  }
 }
 bool type_checker::safe_tuples(const yk_object &lhs, const yk_object &rhs) {
   if (lhs.datatype_->is_tuple() && rhs.datatype_->is_tuple()) {
@@ -1408,6 +1430,7 @@ void type_checker::visit_foreach_stmt(foreach_stmt *obj) {
   push_scope_type(ast_type::STMT_WHILE);
   scope_.push();
   scope_.define(obj->name_->token_, yk_object(obj->data_type_));
+  if (arena_) { track_arena_alias(obj->name_->token_, obj->expression_); }
   obj->for_body_->accept(this);
   scope_.pop();
   pop_scope_type();
@@ -1544,3 +1567,141 @@ void type_checker::visit_enum_stmt(enum_stmt *obj) {
   }
 }
 void type_checker::visit_directive_stmt(directive_stmt *obj) {}
+// Name of the variable that given expression takes its memory from
+//  (x for x.a[1].b), empty if it is not taken from a variable
+static std::string arena_root(expr *value) {
+  switch (value->get_type()) {
+    case ast_type::EXPR_VARIABLE:
+      return dynamic_cast<variable_expr *>(value)->name_->token_;
+    case ast_type::EXPR_GET:
+      return arena_root(dynamic_cast<get_expr *>(value)->lhs_);
+    case ast_type::EXPR_SET:
+      return arena_root(dynamic_cast<set_expr *>(value)->lhs_);
+    case ast_type::EXPR_SQUARE_BRACKET_ACCESS:
+      return arena_root(
+          dynamic_cast<square_bracket_access_expr *>(value)->name_);
+    case ast_type::EXPR_SQUARE_BRACKET_SET:
+      return arena_root(dynamic_cast<square_bracket_set_expr *>(value)->name_);
+    case ast_type::EXPR_GROUPING:
+      return arena_root(dynamic_cast<grouping_expr *>(value)->expression_);
+    case ast_type::EXPR_FNCALL: {
+      // getref(x), unref(x) and cast("T", x) point to memory of x
+      auto call = dynamic_cast<fncall_expr *>(value);
+      if (call->name_->get_type() != ast_type::EXPR_VARIABLE ||
+          call->args_.empty()) {
+        return "";
+      }
+      auto &name = dynamic_cast<variable_expr *>(call->name_)->name_->token_;
+      if (name == "getref" || name == "unref") {
+        return arena_root(call->args_[0]);
+      }
+      if (name == "cast" && call->args_.size() == 2) {
+        return arena_root(call->args_[1]);
+      }
+      return "";
+    }
+    default:
+      return "";
+  }
+}
+// Numbers and bools are copied, everything else can be (or point to) memory
+//  allocated from the arena
+static bool arena_needs_memory(yk_datatype *dt) {
+  dt = dt->const_unwrap();
+  return !dt->is_a_number() && !dt->is_bool() && !dt->is_none() &&
+         !dt->is_function();
+}
+// str values are copied when assigned or passed, other values that need
+//  memory are references
+static bool arena_is_reference(yk_datatype *dt) {
+  dt = dt->const_unwrap();
+  return arena_needs_memory(dt) && !dt->is_str() && !dt->is_string_literal();
+}
+bool type_checker::is_arena_outside(expr *value) {
+  auto root = arena_root(value);
+  return !root.empty() && arena_outside_.count(root) > 0;
+}
+void type_checker::track_arena_alias(const std::string &name, expr *value) {
+  if (is_arena_outside(value)) { arena_outside_.insert(name); }
+}
+void type_checker::check_arena_store(token *oper, expr *target, expr *value,
+                                     const yk_object &value_data) {
+  // A reference to outside memory is not arena memory, but a copy is
+  if (!arena_needs_memory(value_data.datatype_) ||
+      (arena_is_reference(value_data.datatype_) && is_arena_outside(value))) {
+    return;
+  }
+  if (target == nullptr) {
+    error(oper, "Cannot assign to a parameter inside @arena function, arena "
+                "is released when it returns.");
+    return;
+  }
+  // Target that is not a local variable (eg: returned from a function) is
+  //  treated as outside memory as well
+  if (arena_root(target).empty() || is_arena_outside(target)) {
+    error(oper, "Cannot store arena memory in an object or array created "
+                "outside of @arena function, arena is released when it "
+                "returns.");
+  }
+}
+void type_checker::check_arena_call(fncall_expr *obj,
+                                    const std::string &builtin_name) {
+  // These may allocate memory (from the arena) in to their first argument
+  if (builtin_name != "arrput" && builtin_name != "arrins" &&
+      builtin_name != "arrsetlen" && builtin_name != "arrsetcap" &&
+      builtin_name != "shput" && builtin_name != "hmput" &&
+      builtin_name != "setref") {
+    return;
+  }
+  if (obj->args_.empty()) { return; }
+  auto target = obj->args_[0];
+  if (arena_root(target).empty() || is_arena_outside(target)) {
+    error(obj->paren_token_,
+          "Cannot use " + builtin_name +
+              "() inside @arena function on an array, map or pointer "
+              "created outside of it, arena is released when it returns.");
+  }
+}
+void type_checker::check_arena_call(fncall_expr *obj, def_stmt *funct,
+                                    const std::vector<yk_object> &arguments) {
+  // Active arena is used by the function that is called as well, so anything
+  //  it allocates in to an outside object or container is released with the
+  //  arena. An @arena function checks its own parameters.
+  if (!funct->annotations_.arena_ && !funct->params_.empty()) {
+    for (size_t i = 0; i < arguments.size(); i++) {
+      auto dt = arguments[i].datatype_->const_unwrap();
+      auto &param = funct->params_[std::min(i, funct->params_.size() - 1)];
+      if (arena_is_reference(dt) && !dt->is_sr() &&
+          !param.data_type_->const_unwrap()->is_sr() &&
+          is_arena_outside(obj->args_[i])) {
+        error(obj->paren_token_,
+              "Cannot pass an object or container created outside of @arena "
+              "function to a function that is not @arena, memory it "
+              "allocates there is released with the arena.");
+        return;
+      }
+    }
+  }
+  // A function (eg: add() of a container) may keep any argument that needs
+  //  memory in an outside object or container that is passed along with it
+  bool outside_container = false;
+  bool arena_memory = false;
+  for (size_t i = 0; i < arguments.size(); i++) {
+    auto dt = arguments[i].datatype_->const_unwrap();
+    if (!arena_needs_memory(dt)) { continue; }
+    if (arena_is_reference(dt) && is_arena_outside(obj->args_[i])) {
+      if (!dt->is_sr()) { outside_container = true; }
+      continue;
+    }
+    if (funct->params_.empty()) { continue; }
+    // sr parameters only borrow given value
+    auto &param = funct->params_[std::min(i, funct->params_.size() - 1)];
+    if (!param.data_type_->const_unwrap()->is_sr()) { arena_memory = true; }
+  }
+  if (outside_container && arena_memory) {
+    error(obj->paren_token_,
+          "Cannot pass arena memory along with an object or container created "
+          "outside of @arena function, it may be kept there after the arena "
+          "is released.");
+  }
+}
@@ -47,6 +47,7 @@
 #include "compiler/slot_matcher.h"
 #include "return_checker.h"
 #include "utilities/ykobject.h"
+#include <unordered_set>
 namespace yaksha {
   struct type_checker : expr_visitor, stmt_visitor, slot_matcher {
     explicit type_checker(std::string filepath, codefiles *cf,
@@ -160,6 +161,21 @@ private:
     ast_pool *ast_pool_;
     token *magic_return_token_;
     bool safe_tuples(const yk_object &lhs, const yk_object &rhs);
+    // ---- @arena checks ----
+    // Memory allocated inside an @arena function is released when it returns,
+    //  so it must not be stored in to anything that was created outside
+    bool is_arena_outside(expr *value);
+    void track_arena_alias(const std::string &name, expr *value);
+    void check_arena_store(token *oper, expr *target, expr *value,
+                           const yk_object &value_data);
+    void check_arena_call(fncall_expr *obj, const std::string &builtin_name);
+    void check_arena_call(fncall_expr *obj, def_stmt *funct,
+                          const std::vector<yk_object> &arguments);
+    bool arena_{false};
+    // Parameters of current @arena function
+    std::unordered_set<std::string> arena_params_{};
+    // Parameters and variables that point to memory from outside the arena
+    std::unordered_set<std::string> arena_outside_{};
   };
 }// namespace yaksha
 #endif
@@ -171,6 +171,11 @@ void display_annotations(annotations &annotations) {
     std::cout << "{ \"name\": \"@onstack\" }";
     first = false;
   }
+  if (annotations.arena_) {
+    if (!first) { std::cout << ","; }
+    std::cout << "{ \"name\": \"@arena\" }";
+    first = false;
+  }
   if (annotations.varargs_) {
     if (!first) { std::cout << ","; }
     std::cout << "{ \"name\": \"@varargs\", \"argument\": \"\" }";
@@ -353,6 +358,67 @@ void display(def_class_visitor &df, parser &parser_object,
   }
   std::cout << "\n]}" << std::endl;
 }
+static const char *lisp_token_type_name(yaksha_lisp_token_type type) {
+  switch (type) {
+    case yaksha_lisp_token_type::NUMBER:
+      return "NUMBER";
+    case yaksha_lisp_token_type::STRING:
+      return "STRING";
+    case yaksha_lisp_token_type::SYMBOL:
+      return "SYMBOL";
+    case yaksha_lisp_token_type::PAREN_OPEN:
+      return "PAREN_OPEN";
+    case yaksha_lisp_token_type::PAREN_CLOSE:
+      return "PAREN_CLOSE";
+    case yaksha_lisp_token_type::CURLY_OPEN:
+      return "CURLY_OPEN";
+    case yaksha_lisp_token_type::CURLY_CLOSE:
+      return "CURLY_CLOSE";
+    case yaksha_lisp_token_type::AT:
+      return "AT";
+    case yaksha_lisp_token_type::COLON:
+      return "COLON";
+    case yaksha_lisp_token_type::DOUBLE_COLON:
+      return "DOUBLE_COLON";
+    case yaksha_lisp_token_type::COMMA:
+      return "COMMA";
+    case yaksha_lisp_token_type::YAKSHA_LISP_EOF:
+      return "YAKSHA_LISP_EOF";
+    default:
+      return "INVALID";
+  }
+}
+/**
+ * Dump tokens of a YakshaLisp file as a json list of [type, token, line, pos]
+ * scripts/generate_prelude.py uses this to pre-tokenize prelude
+ */
+int dump_lisp_tokens(const std::string &file_name) {
+  std::ifstream script_file{file_name};
+  std::string data((std::istreambuf_iterator<char>(script_file)),
+                   std::istreambuf_iterator<char>());
+  yaksha_macros yaksha_lisp_m{};
+  auto tok = yaksha_lisp_m.create_tokenizer();
+  tok->tokenize(file_name, data, yaksha_lisp_m.get_yk_token_pool());
+  if (!tok->errors_.empty()) {
+    errors::error_printer ep{};
+    ep.print_errors(tok->errors_);
+    return EXIT_FAILURE;
+  }
+  std::cout << "[";
+  bool first = true;
+  for (auto t : tok->tokens_) {
+    if (first) {
+      first = false;
+    } else {
+      std::cout << ",";
+    }
+    std::cout << "\n[\"" << lisp_token_type_name(t->type_) << "\", \""
+              << string_utils::escape_json(t->token_) << "\", " << t->line_
+              << ", " << t->pos_ << "]";
+  }
+  std::cout << "\n]" << std::endl;
+  return EXIT_SUCCESS;
+}
 int main(int argc, char *argv[]) {
   auto args = argparser::ARGS(
       PROGRAM_NAME, "Create simple json dump of contents of a given file", "");
@@ -366,7 +432,12 @@ int main(int argc, char *argv[]) {
   auto display_paths = argparser::OP_BOOL(
       'p', "--display-paths",
       "Display absolute and relative paths of the files being dumped.");
-  args.optional_ = {&help, &all_files, &ignore_libs, &display_paths};
+  auto lisp_tokens = argparser::OP_BOOL(
+      'l', "--lisp-tokens",
+      "Dump tokens of given YakshaLisp file instead (mainfile.yaka is a "
+      "YakshaLisp file).");
+  args.optional_ = {&help, &all_files, &ignore_libs, &display_paths,
+                    &lisp_tokens};
   auto code = argparser::PO("mainfile.yaka", "Yaksha code file.");
   auto lib = argparser::PO_OPT("[LIBS_PARENT_PATH]",
                                "Path to the parent directory of the libraries");
@@ -381,6 +452,7 @@ int main(int argc, char *argv[]) {
     argparser::print_help(args);
     return EXIT_FAILURE;
   }
+  if (lisp_tokens.is_set_) { return dump_lisp_tokens(code.value_); }
   multifile_compiler mc{};
   mc.main_required_ = false;
   mc.check_types_ = false;
@@ -36,10 +36,20 @@
 // to the licenses of linked runtime libraries (see compiler/runtime/README.md).
 //
 // ==============================================================================================
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdlib>
 #include <filesystem>
 #include <iostream>
+#include <string>
 #include <thread>
+#include <unordered_map>
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
 #ifndef PROGRAM_NAME
 #define PROGRAM_NAME "ykreload"
 #endif
@@ -49,19 +59,214 @@
 #define CR_HOST CR_DISABLE
 #include "../runtime/cr.h"
 #include "../runtime/cr_userdata.h"
+#include "utilities/argparser.h"
+namespace {
+  namespace fs = std::filesystem;
+  using reload_clock = std::chrono::steady_clock;
+  // Wait this long after last source change before building (editors save
+  //   files with multiple writes)
+  constexpr auto REBUILD_DELAY = std::chrono::milliseconds(100);
+  // Where inotify is not available we check file times this often
+  constexpr auto POLL_INTERVAL = std::chrono::milliseconds(100);
+  bool is_source_file(const fs::path &file) {
+    return file.extension() == ".yaka";
+  }
+  /**
+   * Watch plugin binary (and optionally .yaka files of a source directory)
+   *   from a background thread, so game loop only checks a flag per frame
+   * Linux uses inotify, other platforms check last write times
+   * When sources change build command is executed, it should rewrite the
+   *   plugin binary, which is then reloaded
+   */
+  struct reload_watcher {
+    reload_watcher(fs::path plugin, fs::path source_dir,
+                   std::string build_command)
+        : plugin_(std::move(plugin)), source_dir_(std::move(source_dir)),
+          build_command_(std::move(build_command)) {
+      thread_ = std::thread([this]() { run(); });
+    }
+    ~reload_watcher() {
+      stop_ = true;
+      thread_.join();
+    }
+    reload_watcher(const reload_watcher &) = delete;
+    reload_watcher &operator=(const reload_watcher &) = delete;
+    // Returns true once after plugin binary is changed
+    bool take_plugin_changed() {
+      if (!plugin_changed_.load(std::memory_order_relaxed)) { return false; }
+      return plugin_changed_.exchange(false);
+    }
+
+private:
+    void run() {
+#if defined(__linux__)
+      if (run_inotify()) { return; }
+#endif
+      run_polling();
+    }
+    void rebuild() {
+      std::cout << "[YKRELOAD] Sources changed, running: " << build_command_
+                << "\n";
+      auto start = reload_clock::now();
+      int result = std::system(build_command_.c_str());
+      auto took = std::chrono::duration_cast<std::chrono::milliseconds>(
+          reload_clock::now() - start);
+      std::cout << "[YKRELOAD] Build " << (result == 0 ? "done" : "failed")
+                << " in " << took.count() << "ms\n";
+    }
+    static fs::file_time_type last_write(const fs::path &file) {
+      std::error_code ec{};
+      auto time = fs::last_write_time(file, ec);
+      return ec ? fs::file_time_type::min() : time;
+    }
+    fs::file_time_type newest_source() const {
+      auto newest = fs::file_time_type::min();
+      std::error_code ec{};
+      for (fs::recursive_directory_iterator it{source_dir_, ec}, end;
+           !ec && it != end; it.increment(ec)) {
+        if (is_source_file(it->path())) {
+          newest = std::max(newest, last_write(it->path()));
+        }
+      }
+      return newest;
+    }
+    void run_polling() {
+      auto plugin_time = last_write(plugin_);
+      auto source_time = source_dir_.empty() ? fs::file_time_type::min()
+                                             : newest_source();
+      while (!stop_) {
+        std::this_thread::sleep_for(POLL_INTERVAL);
+        auto time = last_write(plugin_);
+        if (time != plugin_time) {
+          plugin_time = time;
+          plugin_changed_ = true;
+        }
+        if (source_dir_.empty()) { continue; }
+        time = newest_source();
+        if (time != source_time) {
+          source_time = time;
+          rebuild();
+        }
+      }
+    }
+#if defined(__linux__)
+    static constexpr uint32_t WATCH_MASK =
+        IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_MOVED_FROM;
+    void watch_directory(int fd, const fs::path &dir) {
+      int wd = inotify_add_watch(fd, dir.c_str(), WATCH_MASK);
+      if (wd >= 0) { source_watches_[wd] = dir; }
+    }
+    void watch_source_tree(int fd, const fs::path &dir) {
+      watch_directory(fd, dir);
+      std::error_code ec{};
+      for (fs::recursive_directory_iterator it{dir, ec}, end;
+           !ec && it != end; it.increment(ec)) {
+        if (it->is_directory(ec)) { watch_directory(fd, it->path()); }
+      }
+    }
+    bool run_inotify() {
+      int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+      if (fd < 0) { return false; }
+      // Builds may replace plugin file, so directory is watched
+      const std::string plugin_name = plugin_.filename().string();
+      int plugin_wd =
+          inotify_add_watch(fd, plugin_.parent_path().c_str(), WATCH_MASK);
+      if (plugin_wd < 0) {
+        close(fd);
+        return false;
+      }
+      if (!source_dir_.empty()) { watch_source_tree(fd, source_dir_); }
+      bool sources_changed = false;
+      auto last_change = reload_clock::now();
+      alignas(inotify_event) char buffer[16 * 1024];
+      while (!stop_) {
+        pollfd pfd{fd, POLLIN, 0};
+        // Timeout is only used to check stop_ and pending rebuilds
+        int ready = poll(&pfd, 1, sources_changed ? 20 : 250);
+        ssize_t length;
+        while (ready > 0 && (length = read(fd, buffer, sizeof(buffer))) > 0) {
+          for (char *ptr = buffer; ptr < buffer + length;) {
+            auto *event = reinterpret_cast<inotify_event *>(ptr);
+            ptr += sizeof(inotify_event) + event->len;
+            if (event->len == 0) { continue; }
+            if (event->wd == plugin_wd && plugin_name == event->name &&
+                (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) != 0) {
+              plugin_changed_ = true;
+            }
+            auto dir = source_watches_.find(event->wd);
+            if (dir == source_watches_.end()) { continue; }
+            fs::path changed = dir->second / event->name;
+            if ((event->mask & IN_ISDIR) != 0) {
+              if ((event->mask & (IN_CREATE | IN_MOVED_TO)) != 0) {
+                watch_source_tree(fd, changed);
+              }
+            } else if (is_source_file(changed)) {
+              sources_changed = true;
+              last_change = reload_clock::now();
+            }
+          }
+        }
+        if (sources_changed &&
+            reload_clock::now() - last_change >= REBUILD_DELAY) {
+          sources_changed = false;
+          rebuild();
+        }
+      }
+      close(fd);
+      return true;
+    }
+    std::unordered_map<int, fs::path> source_watches_{};
+#endif
+    fs::path plugin_;
+    fs::path source_dir_;
+    std::string build_command_;
+    std::atomic<bool> plugin_changed_{false};
+    std::atomic<bool> stop_{false};
+    std::thread thread_;
+  };
+}// namespace
 int main(int argc, char *argv[]) {
-  if (argc != 2) {
-    std::cerr << "Invalid usage. Use as: " << PROGRAM_NAME << " libgame.so"
-              << std::endl;
+  using namespace yaksha;
+  auto args = argparser::ARGS(PROGRAM_NAME, "Run a hot reloadable game",
+                              "Plugin is reloaded when it is rebuilt.");
+  auto help = argparser::OP_BOOL('h', "--help", "Print this help message");
+  auto watch = argparser::OP_VAL(
+      'w', "--watch",
+      "Watch .yaka files in given directory and run build command when they "
+      "change.");
+  auto build = argparser::OP_VAL(
+      'b', "--build",
+      "Build command to run when sources change (in current directory). "
+      "Default: yaksha build -d");
+  args.optional_ = {&help, &watch, &build};
+  auto plugin = argparser::PO("libgame.so", "Hot reloadable game library.");
+  args.positional_ = {&plugin};
+  argparser::parse_args(argc, argv, args);
+  if (help.is_set_) {
+    argparser::print_help(args);
+    return EXIT_SUCCESS;
+  }
+  if (!args.errors_.empty()) {
+    argparser::print_errors(args);
+    argparser::print_help(args);
     return -1;
   }
-  std::filesystem::path plugin_file{argv[1]};
+  std::filesystem::path plugin_file{plugin.value_};
   auto abs_path = std::filesystem::absolute(plugin_file);
   if (!std::filesystem::exists(abs_path)) {
     std::cerr << "[YKRELOAD] File not found. File:" << abs_path.string()
               << std::endl;
     return -1;
   }
+  std::filesystem::path source_dir{};
+  if (watch.is_set_) {
+    source_dir = std::filesystem::absolute(watch.arg_value_);
+    if (!std::filesystem::is_directory(source_dir)) {
+      std::cerr << "[YKRELOAD] Directory not found. Directory:"
+                << source_dir.string() << std::endl;
+      return -1;
+    }
+  }
   auto plugin_str = abs_path.string();
   std::cout << "[YKRELOAD] Loading plugin:" << plugin_str << "\n";
   cr_plugin ctx{};
@@ -70,14 +275,27 @@ int main(int argc, char *argv[]) {
   ctx.userdata = &my_userdata;
   bool success = cr_plugin_open(ctx, plugin_str.c_str());
   std::cout << "[YKRELOAD] Initial load completed \n";
+  reload_watcher watcher{abs_path, source_dir,
+                         build.is_set_ ? build.arg_value_
+                                       : "yaksha build -d"};
+  // First update loads the plugin, after that we only check for a new
+  //   version when watcher says plugin binary changed
+  bool reload_check = true;
   while (success) {
-    cr_plugin_update(ctx);
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    auto step_start = reload_clock::now();
+    cr_plugin_update(ctx, reload_check || watcher.take_plugin_changed());
+    reload_check = false;
     auto *data = static_cast<yk__user_data *>(ctx.userdata);
     if (data != nullptr && data->should_die) {
       std::cout << "[YKRELOAD] Should die received\n";
       break;
     }
+    // Games wait for target FPS inside a step, steps that return
+    //   immediately (failures, no FPS limit) are limited to one per 1ms
+    auto elapsed = reload_clock::now() - step_start;
+    if (elapsed < std::chrono::milliseconds(1)) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1) - elapsed);
+    }
   }
   cr_plugin_close(ctx);
   return 0;
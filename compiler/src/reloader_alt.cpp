@@ -78,13 +78,18 @@ int execute_program(LPCSTR lpApplicationName, LPSTR arg) {
   return (int) exit_code;
 }
 int main(int argc, char *argv[]) {
-  if (argc != 2) {
-    std::cerr << "Invalid usage. Use as: " << PROGRAM_NAME << " libgame.so"
-              << std::endl;
+  if (argc < 2) {
+    std::cerr << "Invalid usage. Use as: " << PROGRAM_NAME
+              << " [-w src_dir] [-b build_command] libgame.so" << std::endl;
     return -1;
   }
   auto reloader = std::filesystem::path(get_exe_path()) / "ykreload.exe";
-  auto argument = std::string("\"") + argv[1] + "\"";
+  // Forward all arguments to ykreload.exe
+  std::string argument{};
+  for (int i = 1; i < argc; i++) {
+    if (i != 1) { argument += " "; }
+    argument += std::string("\"") + argv[i] + "\"";
+  }
   auto cstr = std::make_unique<char[]>(argument.length() + 1);
   strcpy(cstr.get(), argument.c_str());
   return execute_program(reinterpret_cast<LPCSTR>(reloader.c_str()),
@@ -136,154 +136,152 @@ block_analyzer::block_analyzer(const std::vector<token *> &tokens,
     : tokens_(), original_tokens_(tokens), errors_(), token_pool_{token_pool} {}
 void block_analyzer::analyze() {
   if (original_tokens_.empty()) { return; }
-  std::vector<token_type> brackets{};
-  std::vector<std::size_t> indents{};
-  std::vector<token *> cleaned{}; /** Without COMMENTS and extra lines */
-  brackets.reserve(50);
-  indents.reserve(50);
-  cleaned.reserve(original_tokens_.size());
+  brackets_.reserve(50);
+  indents_.reserve(50);
   tokens_.reserve(original_tokens_.size());
-  auto iterator = original_tokens_.begin();
-  auto end = original_tokens_.end();
+  // Clean up comments and extra new lines, cleaned tokens are sent to
+  //  analyze_token() one token late, so it can peek at the next one
+  // INDENT tokens are kept in pending until we know they are not followed
+  //  by a comment or a new line (such indents are removed)
+  std::vector<token *> pending{};
+  token *last = nullptr; /** Last cleaned token that is not in pending */
+  token *held = nullptr; /** Cleaned token waiting for analyze_token() */
   auto prev_comment = false;
-  // clean up comments and extra new lines
-  while (iterator != end) {
-    auto tok = *iterator;
-    iterator++;
+  auto emit = [&](token *tok) {
+    if (held != nullptr) { analyze_token(held, tok); }
+    held = tok;
+  };
+  for (auto tok : original_tokens_) {
     if (tok->type_ == token_type::COMMENT) {
       prev_comment = true;
-      if (!cleaned.empty() && cleaned.back()->type_ == token_type::INDENT) {
-        // get rid of empty indents that just follows by a comment
-        cleaned.pop_back();
-      }
+      // get rid of empty indents that just follows by a comment
+      if (!pending.empty()) { pending.pop_back(); }
       continue;
     } else {
       if (tok->type_ == token_type::NEW_LINE) {
+        token *back = pending.empty() ? last : pending.back();
         // Don't start with new lines, Don't add a newline after a new line
         if (prev_comment) {
-          if (cleaned.empty() || cleaned.back()->line_ != tok->line_) {
-            continue;
-          }
+          if (back == nullptr || back->line_ != tok->line_) { continue; }
         }
-        if (cleaned.empty() || cleaned.back()->type_ == token_type::NEW_LINE) {
+        if (back == nullptr || back->type_ == token_type::NEW_LINE) {
           continue;
-        } else if (cleaned.back()->type_ == token_type::INDENT) {
+        } else if (!pending.empty()) {
           // get rid of empty indents that just follows by a new line
-          cleaned.pop_back();
+          pending.pop_back();
         }
       }
       prev_comment = false;
     }
-    cleaned.emplace_back(tok);
+    if (tok->type_ == token_type::INDENT) {
+      pending.emplace_back(tok);
+      continue;
+    }
+    for (auto indent : pending) { emit(indent); }
+    pending.clear();
+    emit(tok);
+    last = tok;
   }
-  indent_type allowed_indent_type = indent_type::UNKNOWN;
-  // iterate cleaned to capture indent/dedent blocks
-  iterator = cleaned.begin();
-  end = cleaned.end();
-  bool inside_bracket_block = false;
-  while (iterator != end) {
-    auto tok = *iterator;
-    iterator++;
-    if (is_open_bracket(tok->type_)) {
-      brackets.push_back(tok->type_);
-      inside_bracket_block = !brackets.empty();
-    } else if (is_close_bracket(tok->type_)) {
-      if (brackets.empty()) {
-        handle_error(parsing_error("BlockAnalyzer Error"
-                                   " : Unmatched closing bracket",
-                                   tok->file_, tok->line_, tok->pos_));
-        continue;
-      } else if (!is_bracket_matching(brackets.back(), tok->type_)) {
+  for (auto indent : pending) { emit(indent); }
+  if (held != nullptr) { analyze_token(held, nullptr); }
+}
+void block_analyzer::analyze_token(token *tok, token *next) {
+  if (is_open_bracket(tok->type_)) {
+    brackets_.push_back(tok->type_);
+    inside_bracket_block_ = !brackets_.empty();
+  } else if (is_close_bracket(tok->type_)) {
+    if (brackets_.empty()) {
+      handle_error(parsing_error("BlockAnalyzer Error"
+                                 " : Unmatched closing bracket",
+                                 tok->file_, tok->line_, tok->pos_));
+      return;
+    } else if (!is_bracket_matching(brackets_.back(), tok->type_)) {
+      handle_error(parsing_error("BlockAnalyzer Error"
+                                 " : Incorrect closing bracket",
+                                 tok->file_, tok->line_, tok->pos_));
+      return;
+    }
+    brackets_.pop_back();
+    inside_bracket_block_ = !brackets_.empty();
+  } else if (tok->type_ == token_type::INDENT) {
+    if (inside_bracket_block_) {// special case when multi line {a: []} data
+      return;
+    }
+    // based on first indent determine allowed indent
+    // TODO would be better to look at all the indents and then determine
+    // which has the higher probability
+    bool ignored_error = false;
+    if (allowed_indent_type_ == indent_type::UNKNOWN) {
+      allowed_indent_type_ = str_to_indent_type(tok->token_);
+      if (allowed_indent_type_ == indent_type::UNKNOWN) {
         handle_error(parsing_error("BlockAnalyzer Error"
-                                   " : Incorrect closing bracket",
+                                   " : First indent of this file invalid,"
+                                   " assuming 4 spaces are used.",
                                    tok->file_, tok->line_, tok->pos_));
-        continue;
-      }
-      brackets.pop_back();
-      inside_bracket_block = !brackets.empty();
-    } else if (tok->type_ == token_type::INDENT) {
-      if (inside_bracket_block) {// special case when multi line {a: []} data
-        continue;
+        allowed_indent_type_ = indent_type::FOUR_SPACES;
+        ignored_error = true;
       }
-      // based on first indent determine allowed indent
-      // TODO would be better to look at all the indents and then determine
-      // which has the higher probability
-      bool ignored_error = false;
-      if (allowed_indent_type == indent_type::UNKNOWN) {
-        allowed_indent_type = str_to_indent_type(tok->token_);
-        if (allowed_indent_type == indent_type::UNKNOWN) {
+    }
+    if (!ignored_error && !strict_indent_check(tok, allowed_indent_type_)) {
+      handle_error(parsing_error("BlockAnalyzer Error : Invalid indentation",
+                                 tok->file_, tok->line_, tok->pos_));
+      ignored_error = true;
+    }
+    std::size_t previous_level = indents_.empty() ? 0 : indents_.back();
+    std::size_t current_level =
+        ignored_error
+            ? guess_indent_level(previous_level, allowed_indent_type_, tok)
+            : indent_to_level(tok->token_, allowed_indent_type_);
+    if (indents_.empty()) {
+      tokens_.emplace_back(c_token(tok->file_, tok->line_, tok->pos_, "",
+                                   token_type::BA_INDENT));
+    } else {
+      auto prev_level = indents_.back();
+      if (prev_level > current_level) {// dedent
+        create_dedents(tok, prev_level, current_level);
+      } else if (prev_level < current_level) {// indent
+        if (current_level - prev_level != 1) {
           handle_error(parsing_error("BlockAnalyzer Error"
-                                     " : First indent of this file invalid,"
-                                     " assuming 4 spaces are used.",
+                                     " : Too much indentation",
                                      tok->file_, tok->line_, tok->pos_));
-          allowed_indent_type = indent_type::FOUR_SPACES;
-          ignored_error = true;
         }
-      }
-      if (!ignored_error && !strict_indent_check(tok, allowed_indent_type)) {
-        handle_error(parsing_error("BlockAnalyzer Error : Invalid indentation",
-                                   tok->file_, tok->line_, tok->pos_));
-        ignored_error = true;
-      }
-      std::size_t previous_level = indents.empty() ? 0 : indents.back();
-      std::size_t current_level =
-          ignored_error
-              ? guess_indent_level(previous_level, allowed_indent_type, tok)
-              : indent_to_level(tok->token_, allowed_indent_type);
-      if (indents.empty()) {
+        indents_.pop_back();
         tokens_.emplace_back(c_token(tok->file_, tok->line_, tok->pos_, "",
-                                     token_type::BA_INDENT));
-      } else {
-        auto prev_level = indents.back();
-        if (prev_level > current_level) {// dedent
-          create_dedents(indents, tok, prev_level, current_level);
-        } else if (prev_level < current_level) {// indent
-          if (current_level - prev_level != 1) {
-            handle_error(parsing_error("BlockAnalyzer Error"
-                                       " : Too much indentation",
-                                       tok->file_, tok->line_, tok->pos_));
-          }
-          indents.pop_back();
-          tokens_.emplace_back(c_token(tok->file_, tok->line_, tok->pos_, "",
-                                       token_type::BA_INDENT));
-        } else {// same size indents doesn't start a block
-          continue;
-        }
-      }
-      indents.push_back(current_level);
-      continue;
-    } else if (tok->type_ == token_type::NEW_LINE) {
-      if (inside_bracket_block || tokens_.empty() ||
-          tokens_.back()->type_ == token_type::BA_DEDENT) {
-        continue;
-      }
-      if (iterator != end && (*iterator)->type_ != token_type::INDENT) {
-        std::size_t prev_level = indents.empty() ? 0 : indents.back();
-        std::size_t current_level = 0;
-        if (prev_level > current_level) {// dedent
-          tokens_.emplace_back(tok);
-          create_dedents(indents, tok, prev_level, current_level);
-        } else {
-          tokens_.emplace_back(tok);
-        }
-        continue;
+                                   token_type::BA_INDENT));
+      } else {// same size indents doesn't start a block
+        return;
       }
-    } else if (tok->type_ == token_type::END_OF_FILE) {
-      // dedent to level 0
-      std::size_t prev_level = indents.empty() ? 0 : indents.back();
+    }
+    indents_.push_back(current_level);
+    return;
+  } else if (tok->type_ == token_type::NEW_LINE) {
+    if (inside_bracket_block_ || tokens_.empty() ||
+        tokens_.back()->type_ == token_type::BA_DEDENT) {
+      return;
+    }
+    if (next != nullptr && next->type_ != token_type::INDENT) {
+      std::size_t prev_level = indents_.empty() ? 0 : indents_.back();
       std::size_t current_level = 0;
+      tokens_.emplace_back(tok);
       if (prev_level > current_level) {// dedent
-        create_dedents(indents, tok, prev_level, current_level);
+        create_dedents(tok, prev_level, current_level);
       }
+      return;
+    }
+  } else if (tok->type_ == token_type::END_OF_FILE) {
+    // dedent to level 0
+    std::size_t prev_level = indents_.empty() ? 0 : indents_.back();
+    std::size_t current_level = 0;
+    if (prev_level > current_level) {// dedent
+      create_dedents(tok, prev_level, current_level);
     }
-    tokens_.emplace_back(tok);
   }
+  tokens_.emplace_back(tok);
 }
-void block_analyzer::create_dedents(std::vector<std::size_t> &indents,
-                                    token *tok, size_t prev_level,
+void block_analyzer::create_dedents(token *tok, size_t prev_level,
                                     size_t current_level) {
   // prev_level must be > current_level
-  indents.pop_back();
+  indents_.pop_back();
   // we may dedent more than 1 level at one go
   std::size_t dedent_count = prev_level - current_level;
   // Create a new line when it is not present before a chain of dedents
@@ -292,21 +290,21 @@ void block_analyzer::create_dedents(std::vector<std::size_t> &indents,
         c_token(tok->file_, tok->line_, tok->pos_, "\n", token_type::NEW_LINE));
   }
   for (std::size_t x = 0; x < dedent_count; x++) {
-    tokens_.emplace_back(
-        c_token(tok->file_, tok->line_, tok->pos_, "", token_type::BA_DEDENT));
+    tokens_.emplace_back(c_token(tok->file_, tok->line_, tok->pos_, "",
+                                 token_type::BA_DEDENT));
   }
 }
 void block_analyzer::handle_error(const parsing_error &err) {
   errors_.emplace_back(err);
 }
-token *block_analyzer::c_token(std::string file, int line, int pos,
-                               std::string token_buf,
+token *block_analyzer::c_token(const token_file &file, int line, int pos,
+                               std::string_view token_buf,
                                token_type token_type_val) {
   auto tok = token_pool_->allocate();
-  tok->file_ = std::move(file);
+  tok->file_ = file;
   tok->line_ = line;
   tok->pos_ = pos;
-  tok->token_ = std::move(token_buf);
+  tok->token_.assign(token_buf.data(), token_buf.size());
   tok->type_ = token_type_val;
   return tok;
 }
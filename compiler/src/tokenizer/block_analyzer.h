@@ -41,6 +41,7 @@
 #define INDENT_ANALYZER_H
 #include "tokenizer/token.h"
 #include "utilities/gc_pool.h"
+#include <string_view>
 #include <vector>
 namespace yaksha {
   /**
@@ -67,6 +68,11 @@ namespace yaksha {
    * Analyze indented blocks and replace INDENT tokens with
    * BA_INDENT & BA_DEDENT,
    * Additionally this cleans up extra new lines, indents & comments
+   * Cleaning and block detection is done in a single pass, given tokens
+   * are not modified (they may be shared, eg: cached macro expansions).
+   * BA_INDENT, BA_DEDENT and inserted NEW_LINE tokens are still allocated
+   * from the token pool one by one. Shared tokens cannot be used as parser
+   * errors need position of each token.
    * // TODO Extract cleaning to a different class (Single Responsibility/SOLID)
    */
   struct block_analyzer {
@@ -75,15 +81,24 @@ namespace yaksha {
     void analyze();
     std::vector<parsing_error> errors_;
     std::vector<token *> tokens_;
-    token *c_token(std::string file, int line, int pos, std::string token_buf,
-                   token_type token_type_val);
+    token *c_token(const token_file &file, int line, int pos,
+                   std::string_view token_buf, token_type token_type_val);
 
 private:
     void handle_error(const parsing_error &err);
-    void create_dedents(std::vector<std::size_t> &indents, token *tok,
-                        size_t prev_level, size_t current_level);
+    /**
+     * Detect blocks for a cleaned token
+     * @param tok token to process
+     * @param next next cleaned token or nullptr if tok is the last one
+     */
+    void analyze_token(token *tok, token *next);
+    void create_dedents(token *tok, size_t prev_level, size_t current_level);
     const std::vector<token *> &original_tokens_;
     gc_pool<token> *token_pool_{nullptr};
+    std::vector<token_type> brackets_{};
+    std::vector<std::size_t> indents_{};
+    indent_type allowed_indent_type_{indent_type::UNKNOWN};
+    bool inside_bracket_block_{false};
   };
 }// namespace yaksha
 #endif
@@ -2,7 +2,9 @@
 // generated by update_tokens.py
 #ifndef TOKEN_H
 #define TOKEN_H
+#include <cstring>
 #include <filesystem>
+#include <iosfwd>
 #include <string>
 #include <vector>
 namespace yaksha {
@@ -442,38 +444,86 @@ namespace yaksha {
     return token_type::TK_UNKNOWN_TOKEN_DETECTED;
   }
   static inline token_type str_to_keyword(const std::string &t) {
-    if (t == "False") return token_type::KEYWORD_FALSE;
-    if (t == "None") return token_type::KEYWORD_NONE;
-    if (t == "True") return token_type::KEYWORD_TRUE;
-    if (t == "and") return token_type::KEYWORD_AND;
-    if (t == "as") return token_type::KEYWORD_AS;
-    if (t == "assert") return token_type::KEYWORD_ASSERT;
-    if (t == "break") return token_type::KEYWORD_BREAK;
-    if (t == "ccode") return token_type::KEYWORD_CCODE;
-    if (t == "class") return token_type::KEYWORD_CLASS;
-    if (t == "continue") return token_type::KEYWORD_CONTINUE;
-    if (t == "decl") return token_type::KEYWORD_DECL;
-    if (t == "def") return token_type::KEYWORD_DEF;
-    if (t == "defer") return token_type::KEYWORD_DEFER;
-    if (t == "del") return token_type::KEYWORD_DEL;
-    if (t == "directive") return token_type::KEYWORD_DIRECTIVE;
-    if (t == "elif") return token_type::KEYWORD_ELIF;
-    if (t == "else") return token_type::KEYWORD_ELSE;
-    if (t == "enum") return token_type::KEYWORD_ENUM;
-    if (t == "for") return token_type::KEYWORD_FOR;
-    if (t == "from") return token_type::KEYWORD_FROM;
-    if (t == "if") return token_type::KEYWORD_IF;
-    if (t == "import") return token_type::KEYWORD_IMPORT;
-    if (t == "in") return token_type::KEYWORD_IN;
-    if (t == "macros") return token_type::KEYWORD_MACROS;
-    if (t == "not") return token_type::KEYWORD_NOT;
-    if (t == "or") return token_type::KEYWORD_OR;
-    if (t == "pass") return token_type::KEYWORD_PASS;
-    if (t == "return") return token_type::KEYWORD_RETURN;
-    if (t == "runtimefeature") return token_type::KEYWORD_RUNTIMEFEATURE;
-    if (t == "struct") return token_type::KEYWORD_STRUCT;
-    if (t == "try") return token_type::KEYWORD_TRY;
-    if (t == "while") return token_type::KEYWORD_WHILE;
+    switch (t.size()) {
+      case 2:
+        if (std::memcmp(t.data(), "as", 2) == 0) return token_type::KEYWORD_AS;
+        if (std::memcmp(t.data(), "if", 2) == 0) return token_type::KEYWORD_IF;
+        if (std::memcmp(t.data(), "in", 2) == 0) return token_type::KEYWORD_IN;
+        if (std::memcmp(t.data(), "or", 2) == 0) return token_type::KEYWORD_OR;
+        break;
+      case 3:
+        if (std::memcmp(t.data(), "and", 3) == 0)
+          return token_type::KEYWORD_AND;
+        if (std::memcmp(t.data(), "def", 3) == 0)
+          return token_type::KEYWORD_DEF;
+        if (std::memcmp(t.data(), "del", 3) == 0)
+          return token_type::KEYWORD_DEL;
+        if (std::memcmp(t.data(), "for", 3) == 0)
+          return token_type::KEYWORD_FOR;
+        if (std::memcmp(t.data(), "not", 3) == 0)
+          return token_type::KEYWORD_NOT;
+        if (std::memcmp(t.data(), "try", 3) == 0)
+          return token_type::KEYWORD_TRY;
+        break;
+      case 4:
+        if (std::memcmp(t.data(), "None", 4) == 0)
+          return token_type::KEYWORD_NONE;
+        if (std::memcmp(t.data(), "True", 4) == 0)
+          return token_type::KEYWORD_TRUE;
+        if (std::memcmp(t.data(), "decl", 4) == 0)
+          return token_type::KEYWORD_DECL;
+        if (std::memcmp(t.data(), "elif", 4) == 0)
+          return token_type::KEYWORD_ELIF;
+        if (std::memcmp(t.data(), "else", 4) == 0)
+          return token_type::KEYWORD_ELSE;
+        if (std::memcmp(t.data(), "enum", 4) == 0)
+          return token_type::KEYWORD_ENUM;
+        if (std::memcmp(t.data(), "from", 4) == 0)
+          return token_type::KEYWORD_FROM;
+        if (std::memcmp(t.data(), "pass", 4) == 0)
+          return token_type::KEYWORD_PASS;
+        break;
+      case 5:
+        if (std::memcmp(t.data(), "False", 5) == 0)
+          return token_type::KEYWORD_FALSE;
+        if (std::memcmp(t.data(), "break", 5) == 0)
+          return token_type::KEYWORD_BREAK;
+        if (std::memcmp(t.data(), "ccode", 5) == 0)
+          return token_type::KEYWORD_CCODE;
+        if (std::memcmp(t.data(), "class", 5) == 0)
+          return token_type::KEYWORD_CLASS;
+        if (std::memcmp(t.data(), "defer", 5) == 0)
+          return token_type::KEYWORD_DEFER;
+        if (std::memcmp(t.data(), "while", 5) == 0)
+          return token_type::KEYWORD_WHILE;
+        break;
+      case 6:
+        if (std::memcmp(t.data(), "assert", 6) == 0)
+          return token_type::KEYWORD_ASSERT;
+        if (std::memcmp(t.data(), "import", 6) == 0)
+          return token_type::KEYWORD_IMPORT;
+        if (std::memcmp(t.data(), "macros", 6) == 0)
+          return token_type::KEYWORD_MACROS;
+        if (std::memcmp(t.data(), "return", 6) == 0)
+          return token_type::KEYWORD_RETURN;
+        if (std::memcmp(t.data(), "struct", 6) == 0)
+          return token_type::KEYWORD_STRUCT;
+        break;
+      case 8:
+        if (std::memcmp(t.data(), "continue", 8) == 0)
+          return token_type::KEYWORD_CONTINUE;
+        break;
+      case 9:
+        if (std::memcmp(t.data(), "directive", 9) == 0)
+          return token_type::KEYWORD_DIRECTIVE;
+        break;
+      case 14:
+        if (std::memcmp(t.data(), "runtimefeature", 14) == 0)
+          return token_type::KEYWORD_RUNTIMEFEATURE;
+        break;
+      default:
+        break;
+    }
     return token_type::TK_UNKNOWN_TOKEN_DETECTED;
   }
   static inline token_type numeric_id_to_token(const int64_t n) {
@@ -921,11 +971,34 @@ namespace yaksha {
     if (t == token_type::KEYWORD_WHILE) return (value == "while");
     return is_valid_complex(value, t);
   }
+  /**
+   * File name of a token
+   * Names are interned and never freed, so tokens only hold a pointer and
+   * creating or copying a token does not copy the name
+   */
+  struct token_file {
+    token_file();
+    token_file(const std::string &name);
+    token_file(const char *name);
+    const std::string &str() const { return *name_; }
+    operator const std::string &() const { return *name_; }
+    bool empty() const { return name_->empty(); }
+    bool operator==(const token_file &other) const {
+      return name_ == other.name_;
+    }
+    bool operator!=(const token_file &other) const {
+      return name_ != other.name_;
+    }
+
+private:
+    const std::string *name_;
+  };
+  std::ostream &operator<<(std::ostream &out, const token_file &file);
   /**
  * Single token
  */
   struct token {
-    std::string file_;// filename
+    token_file file_;// filename
     int line_;        // line in file
     int pos_;         // position in line
     std::string token_;
@@ -952,12 +1025,14 @@ namespace yaksha {
   struct block_analyzer;
   struct type_checker;
   struct def_class_visitor;
+  struct escape_analyser;
   struct file_data {
     parser *parser_{};
     tokenizer *tokenizer_{};
     block_analyzer *block_analyzer_{};
     type_checker *type_checker_{nullptr};
     def_class_visitor *dsv_{nullptr};
+    escape_analyser *escape_analyser_{nullptr};
   };
   enum class scanning_step {
     /** Step 0) At the begining when we scan main, or find import */
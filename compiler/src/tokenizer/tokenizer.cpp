@@ -39,6 +39,10 @@
 // tokenizer.cpp
 #include "tokenizer/tokenizer.h"
 #include "token.h"
+#include <array>
+#include <mutex>
+#include <ostream>
+#include <unordered_set>
 #include <utility>
 using namespace yaksha;
 #define NORMAL_MATCH 1
@@ -51,77 +55,168 @@ using namespace yaksha;
 #define BIN_MATCH 8
 #define HEX_MATCH 9
 #define MATCH_INTEGER_OR_FLOAT 10
-template<typename octet_iterator>
-std::pair<int, utf8::uint32_t> yaksha::consume_string(std::string &buf,
-                                                      octet_iterator &begin,
-                                                      octet_iterator end) {
-  octet_iterator begin_copy = begin;
+// Character classes for single byte (ASCII) characters
+#define CC_DIGIT 1
+#define CC_ALPHA 2// a-z, A-Z and _
+#define CC_HEX 4
+#define CC_OCT 8
+#define CC_BIN 16
+#define CC_INDENT 32// space or tab
+#define CC_LINE_END 64
+#define CC_STRING_END 128// characters that stop a fast string body scan
+static constexpr std::array<std::uint8_t, 256> build_char_classes() {
+  std::array<std::uint8_t, 256> table{};
+  for (int c = '0'; c <= '9'; c++) { table[c] |= CC_DIGIT | CC_HEX; }
+  for (int c = '0'; c <= '7'; c++) { table[c] |= CC_OCT; }
+  table['0'] |= CC_BIN;
+  table['1'] |= CC_BIN;
+  for (int c = 'a'; c <= 'z'; c++) { table[c] |= CC_ALPHA; }
+  for (int c = 'A'; c <= 'Z'; c++) { table[c] |= CC_ALPHA; }
+  table['_'] |= CC_ALPHA;
+  for (int c = 'a'; c <= 'f'; c++) { table[c] |= CC_HEX; }
+  for (int c = 'A'; c <= 'F'; c++) { table[c] |= CC_HEX; }
+  table[' '] |= CC_INDENT;
+  table['\t'] |= CC_INDENT;
+  table['\n'] |= CC_LINE_END | CC_STRING_END;
+  table['\r'] |= CC_LINE_END | CC_STRING_END;
+  table['"'] |= CC_STRING_END;
+  table['\\'] |= CC_STRING_END;
+  // Multi byte UTF-8 sequences are decoded (and validated) separately
+  for (int c = 0x80; c <= 0xFF; c++) { table[c] |= CC_STRING_END; }
+  return table;
+}
+static constexpr std::array<std::uint8_t, 256> CHAR_CLASSES =
+    build_char_classes();
+static inline bool has_class(char c, std::uint8_t cls) {
+  return (CHAR_CLASSES[static_cast<unsigned char>(c)] & cls) != 0;
+}
+static inline bool is_ascii(char c) {
+  return static_cast<unsigned char>(c) < 0x80;
+}
+/**
+ * Read next character and move to the one after,
+ *   only non ASCII characters are decoded as UTF-8
+ */
+static inline utf8::uint32_t next_char(const char *&it, const char *end) {
+  if (is_ascii(*it)) { return static_cast<unsigned char>(*(it++)); }
+  return utf8::next(it, end);
+}
+/**
+ * Get next 3 characters, 0 is returned if nothing is there
+ */
+static inline void peek3(const char *it, const char *end, utf8::uint32_t &a,
+                         utf8::uint32_t &b, utf8::uint32_t &c) {
+  a = 0;
+  b = 0;
+  c = 0;
+  if (it == end) { return; }
+  a = next_char(it, end);
+  if (it == end) { return; }
+  b = next_char(it, end);
+  if (it == end) { return; }
+  c = next_char(it, end);
+}
+/**
+ * Consume characters of given class, stops at first non ASCII character
+ * @return matched size
+ */
+static inline int consume_class(std::uint8_t cls, const char *&begin,
+                                const char *end) {
+  const char *start = begin;
+  while (begin != end && has_class(*begin, cls)) { begin++; }
+  // Validate the character we stopped at, it is not consumed
+  if (begin != end && !is_ascii(*begin)) { utf8::peek_next(begin, end); }
+  return static_cast<int>(begin - start);
+}
+/**
+ * Consume rest of a comment (until end of line)
+ * @return matched size
+ */
+static inline int consume_comment(const char *&begin, const char *end) {
   int size = 0;
-  auto buf_inserter = std::back_inserter(buf);
-  utf8::uint32_t current = 0;
-  bool skip = false;
-  while (begin_copy != end) {
-    current = utf8::peek_next(begin_copy, end);
-    if (skip) {
-      utf8::append(static_cast<char32_t>(current), buf_inserter);
-      utf8::next(begin_copy, end);// move to next character
-      size++;
-      skip = false;
-      continue;
-    } else if (current == '\\') {
-      skip = true;
-    } else {
-      skip = false;
+  while (begin != end) {
+    const char *run = begin;
+    while (begin != end && is_ascii(*begin) &&
+           !has_class(*begin, CC_LINE_END)) {
+      begin++;
     }
-    if (current != '\"' && current != '\n' && current != '\r') {
-      utf8::append(static_cast<char32_t>(current), buf_inserter);
-      utf8::next(begin_copy, end);// move to next character
+    size += static_cast<int>(begin - run);
+    if (begin == end || has_class(*begin, CC_LINE_END)) { break; }
+    utf8::next(begin, end);
+    size++;
+  }
+  return size;
+}
+/**
+ * Consume a string until (but not including) ending '"'
+ * @param begin current position, updated only on success
+ * @param end last position
+ * @return <matched size, last character>, size is -1 if end is reached
+ */
+static std::pair<int, utf8::uint32_t> consume_string(const char *&begin,
+                                                     const char *end) {
+  const char *it = begin;
+  int size = 0;
+  while (it != end) {
+    // Fast skip of characters that have no special meaning
+    const char *run = it;
+    while (it != end && !has_class(*it, CC_STRING_END)) { it++; }
+    size += static_cast<int>(it - run);
+    if (it == end) { break; }
+    utf8::uint32_t current = static_cast<unsigned char>(*it);
+    if (current == '\\') {
+      // Escaped character is always part of the string
+      it++;
+      size++;
+      if (it == end) { break; }
+      next_char(it, end);
       size++;
+    } else if (current == '"' || current == '\n' || current == '\r') {
+      begin = it;
+      return {size, current};
     } else {
-      begin = begin_copy;
-      return std::make_pair(size, current);
+      utf8::next(it, end);
+      size++;
     }
   }
-  return std::make_pair(-1, 0);
+  return {-1, 0};
 }
-template<typename octet_iterator>
-std::tuple<int, utf8::uint32_t, int>
-yaksha::consume_triple_str(std::string &buf, octet_iterator &begin,
-                           octet_iterator end) {
+/**
+ * Consume a triple quoted string (begin is at second '"' of the prefix)
+ * @param begin current position, updated only on success
+ * @param end last position
+ * @return <matched size, last character, line_count>
+ */
+static std::tuple<int, utf8::uint32_t, int>
+consume_triple_str(const char *&begin, const char *end) {
   int size = 0;
   int lines = 0;
-  octet_iterator copy_begin = begin;
-  auto buf_inserter = std::back_inserter(buf);
+  const char *it = begin;
   utf8::uint32_t prev;
   utf8::uint32_t current = 0;
-  utf8::uint32_t next;
-  utf8::uint32_t after_next;
-  utf8::next(copy_begin, end);
-  utf8::next(copy_begin, end);
-  while (copy_begin != end) {
+  next_char(it, end);
+  next_char(it, end);
+  while (it != end) {
     prev = current;
-    auto characters = ::string_utils::peek3(copy_begin, end);
-    current = std::get<0>(characters);
-    next = std::get<1>(characters);
-    after_next = std::get<2>(characters);
-    if (prev != '\\' && current == '"' && next == '"' && after_next == '"') {
-      utf8::next(copy_begin, end);
-      utf8::next(copy_begin, end);
-      utf8::next(copy_begin, end);
-      // Update the iterator on success.
-      begin = copy_begin;
-      return {size + 2, current, lines};
-    } else {
+    if (is_ascii(*it)) {
+      current = static_cast<unsigned char>(*it);
+      if (prev != '\\' && current == '"' && end - it >= 3 && it[1] == '"' &&
+          it[2] == '"') {
+        // Update the iterator on success.
+        begin = it + 3;
+        return {size + 2, current, lines};
+      }
       if (current == '\n') {
         size = -1;
         lines++;
       }
-      utf8::append(static_cast<char32_t>(current), buf_inserter);
-      utf8::next(copy_begin, end);
-      size++;
+      it++;
+    } else {
+      current = utf8::next(it, end);
     }
+    size++;
   }
-  return std::make_tuple(-1, 0, 0);
+  return {-1, 0, 0};
 }
 #define NUMBER_MATCH_NORMAL 0
 #define NUMBER_MATCH_EXPO 1
@@ -129,40 +224,40 @@ yaksha::consume_triple_str(std::string &buf, octet_iterator &begin,
   do {                                                                         \
     mode = NORMAL_MATCH;                                                       \
     pos++;                                                                     \
-    utf8::next(iterator, end);                                                 \
+    next_char(iterator, end);                                                  \
   } while (0)
-template<typename octet_iterator>
-std::tuple<int, utf8::uint32_t, token_type>
-yaksha::consume_number(std::string &buf, octet_iterator &begin,
-                       octet_iterator end) {
-  auto buf_inserter = std::back_inserter(buf);
+/**
+ * Consume a number (decimal integer or a float)
+ * Hex, Oct, Bin is handled separately
+ * @param begin current position in input
+ * @param end last position in input
+ * @return <matched size, last character,
+ *      token_type::INTEGER_DECIMAL or token_type::FLOAT_NUMBER>
+ */
+static std::tuple<int, utf8::uint32_t, token_type>
+consume_number(const char *&begin, const char *end) {
   char mode = NUMBER_MATCH_NORMAL;
   bool dot_found = false;
   bool exponent_found = false;
   int size = 0;
   int expo_size = 0;
   utf8::uint32_t current = 0;
-  utf8::uint32_t next;
+  utf8::uint32_t next = 0;
+  utf8::uint32_t after_next;
   while (begin != end) {
-    auto characters = ::string_utils::peek3(begin, end);
-    current = std::get<0>(characters);
-    next = std::get<1>(characters);
+    peek3(begin, end, current, next, after_next);
     if (mode == NUMBER_MATCH_NORMAL) {
       if (current == '.') {
         if (dot_found) { return {-1, 0, token_type::UNKNOWN_DECIMAL}; }
         dot_found = true;
-        utf8::append(static_cast<char32_t>(current), buf_inserter);
         size++;
       } else if (::string_utils::is_digit(current)) {
-        utf8::append(static_cast<char32_t>(current), buf_inserter);
         size++;
       } else if (current == 'e' || current == 'E') {
         exponent_found = true;
-        utf8::append(static_cast<char32_t>(current), buf_inserter);
         size++;
         if (next == '+' || next == '-') {
-          utf8::append(static_cast<char32_t>(next), buf_inserter);
-          utf8::next(begin, end);
+          next_char(begin, end);
           size++;
         }
         mode = NUMBER_MATCH_EXPO;
@@ -171,14 +266,13 @@ yaksha::consume_number(std::string &buf, octet_iterator &begin,
       }
     } else {// NUMBER_MATCH_EXPO
       if (::string_utils::is_digit(current)) {
-        utf8::append(static_cast<char32_t>(current), buf_inserter);
         size++;
         expo_size++;
       } else {
         break;
       }
     }
-    utf8::next(begin, end);
+    next_char(begin, end);
   }
   // Cannot end with eE+-
   if ((mode == NUMBER_MATCH_EXPO && (current == 'e' || current == 'E' ||
@@ -190,9 +284,8 @@ yaksha::consume_number(std::string &buf, octet_iterator &begin,
     return {-1, 0, token_type::UNKNOWN_DECIMAL};
   }
   if (current == 'f') {
-    utf8::next(begin, end);
+    next_char(begin, end);
     size++;
-    utf8::append(static_cast<char32_t>(current), buf_inserter);
     current = next;
     return {size, current, token_type::FLOAT_NUMBER};
   }
@@ -202,7 +295,7 @@ yaksha::consume_number(std::string &buf, octet_iterator &begin,
 }
 tokenizer::tokenizer(std::string file, std::string data,
                      gc_pool<token> *token_pool)
-    : tokens_(), file_(std::move(file)), data_(std::move(data)), errors_(),
+    : tokens_(), file_(file), data_(std::move(data)), errors_(),
       token_pool_{token_pool} {}
 void tokenizer::tokenize() {
   try {
@@ -217,20 +310,18 @@ void tokenizer::tokenize() {
   }
 }
 void tokenizer::tokenize_actual() {
-  auto iterator = data_.begin();
-  auto end = data_.end();
+  const char *iterator = data_.data();
+  const char *end = iterator + data_.size();
   utf8::uint32_t current;
   utf8::uint32_t next;
   utf8::uint32_t after_next;
   int line = 0;
   int pos = 1;
   int mode = NORMAL_MATCH;
-  std::string token_buf{};
+  // Most tokens are a few characters long
+  tokens_.reserve(tokens_.size() + data_.size() / 4);
   while (iterator != end) {
-    auto characters = ::string_utils::peek3(iterator, end);
-    current = std::get<0>(characters);
-    next = std::get<1>(characters);
-    after_next = std::get<2>(characters);
+    peek3(iterator, end, current, next, after_next);
     if (mode == NORMAL_MATCH) {
       if (current == '0' && (next == 'o' || next == 'O')) {
         mode = OCT_MATCH;
@@ -253,7 +344,7 @@ void tokenizer::tokenize_actual() {
       if (suffix_result.first != 0) {
         for (int i = 0; i < suffix_result.first; i++) {
           pos++;
-          utf8::next(iterator, end);
+          next_char(iterator, end);
         }
       }
       if (suffix_result.second /* suffix found, need to tokenize next */) {
@@ -301,8 +392,8 @@ void tokenizer::tokenize_actual() {
           if (next == '.' && after_next == '.') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "...", token_type::ELLIPSIS));
-            utf8::next(iterator, end);
-            utf8::next(iterator, end);
+            next_char(iterator, end);
+            next_char(iterator, end);
             pos += 2;
           } else {
             tokens_.emplace_back(
@@ -313,19 +404,19 @@ void tokenizer::tokenize_actual() {
           if (next == '=') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "<=", token_type::LESS_EQ));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else if (next == '<') {
             if (after_next == '=') {
               tokens_.emplace_back(
                   c_token(file_, line, pos, "<<=", token_type::SHL_EQ));
-              utf8::next(iterator, end);
+              next_char(iterator, end);
               pos++;
             } else {
               tokens_.emplace_back(
                   c_token(file_, line, pos, "<<", token_type::SHL));
             }
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else {
             tokens_.emplace_back(
@@ -336,7 +427,7 @@ void tokenizer::tokenize_actual() {
           if (next == '=') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "==", token_type::EQ_EQ));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else {
             tokens_.emplace_back(
@@ -347,19 +438,19 @@ void tokenizer::tokenize_actual() {
           if (next == '=') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, ">=", token_type::GREAT_EQ));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else if (next == '>') {
             if (after_next == '=') {
               tokens_.emplace_back(
                   c_token(file_, line, pos, ">>=", token_type::SHR_EQ));
-              utf8::next(iterator, end);
+              next_char(iterator, end);
               pos++;
             } else {
               tokens_.emplace_back(
                   c_token(file_, line, pos, ">>", token_type::SHR));
             }
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else {
             tokens_.emplace_back(
@@ -370,7 +461,7 @@ void tokenizer::tokenize_actual() {
           if (next == '=') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "!=", token_type::NOT_EQ));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else {
             tokens_.emplace_back(
@@ -381,7 +472,7 @@ void tokenizer::tokenize_actual() {
           if (next == '=') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "+=", token_type::PLUS_EQ));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else {
             tokens_.emplace_back(
@@ -392,12 +483,12 @@ void tokenizer::tokenize_actual() {
           if (next == '=') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "-=", token_type::SUB_EQ));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else if (next == '>') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "->", token_type::ARROW));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else {
             tokens_.emplace_back(
@@ -408,19 +499,19 @@ void tokenizer::tokenize_actual() {
           if (next == '=') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "*=", token_type::MUL_EQ));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else if (next == '*') {
             if (after_next == '=') {
               tokens_.emplace_back(
                   c_token(file_, line, pos, "**=", token_type::POWER_EQ));
-              utf8::next(iterator, end);
+              next_char(iterator, end);
               pos++;
             } else {
               tokens_.emplace_back(
                   c_token(file_, line, pos, "**", token_type::POWER));
             }
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else {
             tokens_.emplace_back(
@@ -431,19 +522,19 @@ void tokenizer::tokenize_actual() {
           if (next == '=') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "/=", token_type::DIV_EQ));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else if (next == '/') {
             if (after_next == '=') {
               tokens_.emplace_back(
                   c_token(file_, line, pos, "//=", token_type::INT_DIV_EQ));
-              utf8::next(iterator, end);
+              next_char(iterator, end);
               pos++;
             } else {
               tokens_.emplace_back(
                   c_token(file_, line, pos, "//", token_type::INT_DIV));
             }
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else {
             tokens_.emplace_back(
@@ -454,7 +545,7 @@ void tokenizer::tokenize_actual() {
           if (next == '=') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "&=", token_type::AND_EQ));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else {
             tokens_.emplace_back(
@@ -465,7 +556,7 @@ void tokenizer::tokenize_actual() {
           if (next == '=') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "|=", token_type::OR_EQ));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else {
             tokens_.emplace_back(
@@ -476,7 +567,7 @@ void tokenizer::tokenize_actual() {
           if (next == '=') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "^=", token_type::XOR_EQ));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else {
             tokens_.emplace_back(
@@ -487,7 +578,7 @@ void tokenizer::tokenize_actual() {
           if (next == '=') {
             tokens_.emplace_back(
                 c_token(file_, line, pos, "%=", token_type::MOD_EQ));
-            utf8::next(iterator, end);
+            next_char(iterator, end);
             pos++;
           } else {
             tokens_.emplace_back(
@@ -522,6 +613,10 @@ void tokenizer::tokenize_actual() {
             continue;
           }
           // Spaces in the middle of context can be ignored safely
+          while (iterator + 1 != end && has_class(*(iterator + 1), CC_INDENT)) {
+            iterator++;
+            pos++;
+          }
           break;
         case '\r':
           break;
@@ -539,11 +634,11 @@ void tokenizer::tokenize_actual() {
           handle_error(parsing_error{"Tokenizer Error : Invalid character",
                                      file_, line, pos});
       }
-      utf8::next(iterator, end);
+      next_char(iterator, end);
       pos++;
     } else if (mode == TRIPLE_STRING_MATCH) {
-      token_buf = {};
-      auto result = ::consume_triple_str(token_buf, iterator, end);
+      const char *token_start = iterator + 2;
+      auto result = consume_triple_str(iterator, end);
       if (std::get<0>(result) == -1) {
         handle_error(
             parsing_error{"Tokenizer Error : Invalid string, end of file "
@@ -552,7 +647,10 @@ void tokenizer::tokenize_actual() {
         CONTINUE_TO_NEXT_CHAR;
         continue;
       }
-      tokens_.emplace_back(c_token(file_, line, pos - 1, token_buf,
+      // Closing """ is not part of the string
+      std::size_t length = iterator - 3 - token_start;
+      tokens_.emplace_back(c_token(file_, line, pos - 1,
+                                   std::string_view{token_start, length},
                                    token_type::THREE_QUOTE_STRING));
       auto lines_in_str = std::get<2>(result);
       pos += std::get<0>(result);
@@ -561,15 +659,10 @@ void tokenizer::tokenize_actual() {
       }
       line += lines_in_str;
       mode = NORMAL_MATCH;
-      try {
-        string_utils::unescape(token_buf);
-      } catch (string_utils::string_error &str_error) {
-        std::string error_message = "Invalid string: " + str_error.message_;
-        handle_error(parsing_error{error_message, tokens_.back()});
-      }
+      validate_escapes(tokens_.back());
     } else if (mode == STRING_MATCH) {
-      token_buf = {};
-      auto result = consume_string(token_buf, iterator, end);
+      const char *token_start = iterator;
+      auto result = consume_string(iterator, end);
       if (result.first == -1) {
         handle_error(
             parsing_error{"Tokenizer Error : Invalid string, end of file "
@@ -584,92 +677,91 @@ void tokenizer::tokenize_actual() {
         CONTINUE_TO_NEXT_CHAR;
         continue;
       }
-      tokens_.emplace_back(
-          c_token(file_, line, pos, token_buf, token_type::STRING));
+      tokens_.emplace_back(c_token(
+          file_, line, pos,
+          std::string_view{token_start,
+                           static_cast<std::size_t>(iterator - token_start)},
+          token_type::STRING));
       pos += result.first;
       pos++;
-      utf8::next(iterator, end);// skip last " in string
+      next_char(iterator, end);// skip last " in string
       mode = NORMAL_MATCH;
-      try {
-        string_utils::unescape(token_buf);
-      } catch (string_utils::string_error &str_error) {
-        std::string error_message = "Invalid string: " + str_error.message_;
-        handle_error(parsing_error{error_message, tokens_.back()});
-      }
+      validate_escapes(tokens_.back());
     } else if (mode == NAME_MATCH) {
-      token_buf = {};
-      auto result = ::string_utils::consume(::string_utils::allowed_in_name,
-                                            token_buf, iterator, end, true);
-      token_type kw = str_to_keyword(token_buf);
-      if (kw == token_type::TK_UNKNOWN_TOKEN_DETECTED) {
-        tokens_.emplace_back(
-            c_token(file_, line, pos, token_buf, token_type::NAME));
-      } else {
-        tokens_.emplace_back(c_token(file_, line, pos, token_buf, kw));
-      }
-      pos += result.first;
+      const char *token_start = iterator;
+      int size = consume_class(CC_ALPHA | CC_DIGIT, iterator, end);
+      token *name = c_token(
+          file_, line, pos,
+          std::string_view{token_start, static_cast<std::size_t>(size)},
+          token_type::NAME);
+      token_type kw = str_to_keyword(name->token_);
+      if (kw != token_type::TK_UNKNOWN_TOKEN_DETECTED) { name->type_ = kw; }
+      tokens_.emplace_back(name);
+      pos += size;
       mode = NORMAL_MATCH;
     } else if (mode == INDENT_MATCH) {
-      token_buf = {};
-      auto result = ::string_utils::consume(::string_utils::allowed_in_indent,
-                                            token_buf, iterator, end, true);
-      if (result.first > 0) {
-        tokens_.emplace_back(
-            c_token(file_, line, pos, token_buf, token_type::INDENT));
-        pos += result.first;
+      const char *token_start = iterator;
+      int size = consume_class(CC_INDENT, iterator, end);
+      if (size > 0) {
+        tokens_.emplace_back(c_token(
+            file_, line, pos,
+            std::string_view{token_start, static_cast<std::size_t>(size)},
+            token_type::INDENT));
+        pos += size;
       }
       mode = NORMAL_MATCH;
     } else if (mode == COMMENT_MATCH) {
-      token_buf = {};
-      auto result = ::string_utils::consume(::string_utils::allowed_in_comment,
-                                            token_buf, iterator, end, true);
-      tokens_.emplace_back(
-          c_token(file_, line, pos - 1, token_buf, token_type::COMMENT));
-      if (result.first > 0) { pos += result.first; }
+      const char *token_start = iterator;
+      int size = consume_comment(iterator, end);
+      tokens_.emplace_back(c_token(
+          file_, line, pos - 1,
+          std::string_view{token_start,
+                           static_cast<std::size_t>(iterator - token_start)},
+          token_type::COMMENT));
+      if (size > 0) { pos += size; }
       mode = NORMAL_MATCH;
     } else if (mode == HEX_MATCH || mode == OCT_MATCH || mode == BIN_MATCH) {
-      token_buf = {};
-      utf8::append(static_cast<char32_t>(current),
-                   std::back_inserter(token_buf));
-      utf8::append(static_cast<char32_t>(next), std::back_inserter(token_buf));
-      auto iterator_copy = iterator;
-      utf8::next(iterator_copy, end);
-      utf8::next(iterator_copy, end);
-      std::pair<int, uint32_t> result;
+      // Prefix (0x, 0o, 0b) is ASCII, current position is at 0
+      const char *iterator_copy = iterator + 2;
+      int size;
       token_type token_type_number;
       if (mode == HEX_MATCH) {
-        result = ::string_utils::consume(::string_utils::allowed_in_hex,
-                                         token_buf, iterator_copy, end, false);
+        size = consume_class(CC_HEX, iterator_copy, end);
         token_type_number = token_type::UNKNOWN_HEX;
       } else if (mode == OCT_MATCH) {
-        result = ::string_utils::consume(::string_utils::allowed_in_oct,
-                                         token_buf, iterator_copy, end, false);
+        size = consume_class(CC_OCT, iterator_copy, end);
         token_type_number = token_type::UNKNOWN_OCT;
       } else {
-        result = ::string_utils::consume(::string_utils::allowed_in_bin,
-                                         token_buf, iterator_copy, end, false);
+        size = consume_class(CC_BIN, iterator_copy, end);
         token_type_number = token_type::UNKNOWN_BIN;
       }
-      if (result.first <= 0) {
+      // Reaching end of file while matching is not allowed
+      if (size <= 0 || iterator_copy == end) {
         handle_error(
             parsing_error{"Tokenizer Error : Invalid number, end of file "
                           "reached before end of name",
                           file_, line, pos});
         CONTINUE_TO_NEXT_CHAR;
         continue;
-      } else {
-        iterator = iterator_copy;
       }
-      tokens_.emplace_back(
-          c_token(file_, line, pos, token_buf, token_type_number));
-      pos += result.first + 1;
+      tokens_.emplace_back(c_token(
+          file_, line, pos,
+          std::string_view{iterator,
+                           static_cast<std::size_t>(iterator_copy - iterator)},
+          token_type_number));
+      iterator = iterator_copy;
+      pos += size + 1;
       mode = NORMAL_MATCH;
     } else {// MATCH_INTEGER_OR_FLOAT
-      token_buf = {};
-      auto result = ::consume_number(token_buf, iterator, end);
+      const char *token_start = iterator;
+      auto result = consume_number(iterator, end);
       int size = std::get<0>(result);
       token_type number_type = std::get<2>(result);
-      tokens_.emplace_back(c_token(file_, line, pos, token_buf, number_type));
+      tokens_.emplace_back(c_token(
+          file_, line, pos,
+          std::string_view{token_start,
+                           static_cast<std::size_t>(iterator - token_start)},
+          number_type));
       pos += size;
       mode = NORMAL_MATCH;
     }
@@ -750,6 +842,16 @@ std::pair<int, bool> tokenizer::consider_integer_suffix(uint32_t current,
   }
   return {skip, should_continue};
 }
+void tokenizer::validate_escapes(token *str) {
+  // Only escape sequences can make a string invalid
+  if (str->token_.find('\\') == std::string::npos) { return; }
+  try {
+    string_utils::unescape(str->token_);
+  } catch (string_utils::string_error &str_error) {
+    std::string error_message = "Invalid string: " + str_error.message_;
+    handle_error(parsing_error{error_message, str});
+  }
+}
 void tokenizer::handle_error(const parsing_error &t) {
   errors_.emplace_back(t);
 }
@@ -893,13 +995,15 @@ bool tokenizer::is_unknown_integer_token(token_type token_type_val) {
          token_type_val == token_type::UNKNOWN_OCT ||
          token_type_val == token_type::UNKNOWN_BIN;
 }
-token *tokenizer::c_token(std::string file, int line, int pos,
-                          std::string token_buf, token_type token_type_val) {
+token *tokenizer::c_token(const token_file &file, int line, int pos,
+                          std::string_view token_buf,
+                          token_type token_type_val) {
   auto tok = token_pool_->allocate();
-  tok->file_ = std::move(file);
+  // Assign (instead of move) so pooled tokens reuse their buffers
+  tok->file_ = file;
   tok->line_ = line;
   tok->pos_ = pos;
-  tok->token_ = std::move(token_buf);
+  tok->token_.assign(token_buf.data(), token_buf.size());
   tok->type_ = token_type_val;
   return tok;
 }
@@ -928,6 +1032,26 @@ void token::clean_state() {
   this->token_ = "";
   this->pos_ = 0;
   this->line_ = 0;
-  this->file_ = "";
+  this->file_ = {};
   this->original_ = "";
 }
+static const std::string &empty_file_name() {
+  static const std::string empty{};
+  return empty;
+}
+static const std::string *intern_file_name(const std::string &name) {
+  if (name.empty()) { return &empty_file_name(); }
+  // Not freed, so names outlive every token (including static ones)
+  static auto *names = new std::unordered_set<std::string>{};
+  static std::mutex names_lock{};
+  std::lock_guard<std::mutex> guard{names_lock};
+  return &*names->insert(name).first;
+}
+token_file::token_file() : name_(&empty_file_name()) {}
+token_file::token_file(const std::string &name)
+    : name_(intern_file_name(name)) {}
+token_file::token_file(const char *name)
+    : name_(intern_file_name(std::string{name})) {}
+std::ostream &yaksha::operator<<(std::ostream &out, const token_file &file) {
+  return out << file.str();
+}
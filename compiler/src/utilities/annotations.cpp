@@ -138,6 +138,16 @@ void annotations::add(const annotation &a) {
       return;
     }
     on_stack_ = true;
+  } else if (a.name_ == "arena") {
+    if (arena_) {
+      error_ = "Duplicate annotation: @arena";
+      return;
+    }
+    if (a.arg_set_) {
+      error_ = "@arena does not allow any argument";
+      return;
+    }
+    arena_ = true;
   } else {
     error_ = "Invalid annotation:" + a.name_;
     return;
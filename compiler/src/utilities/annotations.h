@@ -51,6 +51,7 @@ namespace yaksha {
     bool template_{false};
     bool varargs_{false};
     bool on_stack_{false};
+    bool arena_{false};
     std::string native_arg_{};
     std::string native_macro_arg_{};
     std::string native_define_arg_{};
@@ -94,7 +94,7 @@ namespace yaksha::errors {
         ss << "\"file\":\"" << string_utils::escape_json(err.tok_.file_)
            << "\",";
         auto relative_file =
-            std::filesystem::relative(err.tok_.file_, "./").string();
+            std::filesystem::relative(err.tok_.file_.str(), "./").string();
         ss << "\"relative_file\":\"" << string_utils::escape_json(relative_file)
            << "\",";
         ss << "\"line\":" << err.tok_.line_ + 1 << ",";
@@ -124,6 +124,11 @@ namespace yaksha {
      * Clear the pool and free all allocated memory
      */
     void clear();
+    /**
+     * Number of objects the pool can hold without allocating a new block
+     * @return capacity of the pool (free + used objects)
+     */
+    size_t capacity() const;
     size_t allocated_{0};
 
 private:
@@ -171,6 +176,10 @@ private:
   }
   // ==================== Implementation ====================
   template<typename T>
+  size_t gc_pool<T>::capacity() const {
+    return num_allocated_;
+  }
+  template<typename T>
   void gc_pool<T>::free_block(T *ptr) {
     delete[] (ptr);
   }
@@ -262,11 +271,8 @@ private:
          cur = cur->next_) {
       clear_bit(&cur->mark_, GC_POOL_MARK_BIT);// unmarked
     }
-    // Unmark free list as well?
-    for (T *cur = m_free_doubly_linked_list_; cur != nullptr;
-         cur = cur->next_) {
-      clear_bit(&cur->mark_, GC_POOL_MARK_BIT);// unmarked
-    }
+    // Free list is not walked, free() and allocate_items() already leave
+    // objects unmarked, so this is proportional to used objects only
   }
   template<typename T>
   void gc_pool<T>::mark(T *ptr) {
@@ -0,0 +1,194 @@
+// ==============================================================================================
+// ╦  ┬┌─┐┌─┐┌┐┌┌─┐┌─┐    Yaksha Programming Language
+// ║  ││  ├┤ │││└─┐├┤     is Licensed with GPLv3 + extra terms. Please see below.
+// ╩═╝┴└─┘└─┘┘└┘└─┘└─┘
+// Note: libs - MIT license, runtime/3rd - various
+// ==============================================================================================
+// GPLv3:
+//
+// Yaksha - Programming Language.
+// Copyright (C) 2020 - 2024 Bhathiya Perera
+//
+// This program is free software: you can redistribute it and/or modify it under the terms
+// of the GNU General Public License as published by the Free Software Foundation,
+// either version 3 of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see https://www.gnu.org/licenses/.
+//
+// ==============================================================================================
+// Additional Terms:
+//
+// Please note that any commercial use of the programming language's compiler source code
+// (everything except compiler/runtime, compiler/libs and compiler/3rd) require a written agreement
+// with author of the language (Bhathiya Perera).
+//
+// If you are using it for an open source project, please give credits.
+// Your own project must use GPLv3 license with these additional terms.
+//
+// You may use programs written in Yaksha/YakshaLisp for any legal purpose
+// (commercial, open-source, closed-source, etc) as long as it agrees
+// to the licenses of linked runtime libraries (see compiler/runtime/README.md).
+//
+// ==============================================================================================
+// time_report.cpp
+#include "time_report.h"
+#include "tokenizer/string_utils.h"
+#include "utilities/cpp_util.h"
+#include <iomanip>
+#if defined(YAKSHA_OS_WINDOWS)
+#include <windows.h>
+// windows.h must be included before psapi.h
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+using namespace yaksha;
+time_report::time_report() : origin_(std::chrono::steady_clock::now()) {}
+std::uint64_t time_report::now_us() const {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - origin_)
+      .count();
+}
+void time_report::count(const std::string &name, std::uint64_t value) {
+  for (auto &counter : counters_) {
+    if (counter.first == name) {
+      counter.second += value;
+      return;
+    }
+  }
+  counters_.emplace_back(name, value);
+}
+std::uint64_t time_report::total_us(const std::string &name) const {
+  std::uint64_t total = 0;
+  for (const auto &event : events_) {
+    if (event.name_ == name) { total += event.duration_us_; }
+  }
+  return total;
+}
+std::uint64_t time_report::counter(const std::string &name) const {
+  for (const auto &counter : counters_) {
+    if (counter.first == name) { return counter.second; }
+  }
+  return 0;
+}
+void time_report::print_table(std::ostream &out) const {
+  // aggregate by phase name, keeping the order phases were first seen in
+  struct row {
+    std::string name_;
+    int depth_;
+    std::uint64_t calls_;
+    std::uint64_t total_us_;
+  };
+  std::vector<row> rows{};
+  std::uint64_t wall_us = 0;
+  for (const auto &event : events_) {
+    if (event.depth_ == 0) { wall_us += event.duration_us_; }
+    bool found = false;
+    for (auto &r : rows) {
+      if (r.name_ == event.name_) {
+        r.calls_++;
+        r.total_us_ += event.duration_us_;
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      rows.push_back({event.name_, event.depth_, 1, event.duration_us_});
+    }
+  }
+  out << std::left << std::setw(40) << "phase" << std::right << std::setw(8)
+      << "calls" << std::setw(14) << "total (ms)" << std::setw(9) << "%"
+      << "\n";
+  out << std::fixed;
+  for (const auto &r : rows) {
+    double percent = wall_us == 0 ? 0.0 : 100.0 * r.total_us_ / wall_us;
+    out << std::left << std::setw(40)
+        << (std::string(static_cast<std::size_t>(r.depth_) * 2, ' ') + r.name_)
+        << std::right << std::setw(8) << r.calls_ << std::setw(14)
+        << std::setprecision(3) << (r.total_us_ / 1000.0) << std::setw(9)
+        << std::setprecision(1) << percent << "\n";
+  }
+  out << "\n";
+  for (const auto &counter : counters_) {
+    out << std::left << std::setw(40) << counter.first << std::right
+        << std::setw(31) << counter.second << "\n";
+  }
+  out << std::left << std::setw(40) << "peak_rss (KiB)" << std::right
+      << std::setw(31) << (peak_rss() / 1024) << "\n";
+  out.copyfmt(std::ios(nullptr));
+}
+void time_report::print_trace(std::ostream &out) const {
+  out << "{\"traceEvents\":[";
+  bool first = true;
+  for (const auto &event : events_) {
+    if (!first) { out << ","; }
+    first = false;
+    out << "{\"name\":\"" << string_utils::escape_json(event.name_)
+        << "\",\"cat\":\"yakshac\",\"ph\":\"X\",\"ts\":" << event.start_us_
+        << ",\"dur\":" << event.duration_us_ << ",\"pid\":1,\"tid\":1";
+    if (!event.file_.empty()) {
+      out << ",\"args\":{\"file\":\"" << string_utils::escape_json(event.file_)
+          << "\"}";
+    }
+    out << "}";
+  }
+  out << "],\"displayTimeUnit\":\"ms\",\"otherData\":{";
+  for (const auto &counter : counters_) {
+    out << "\"" << string_utils::escape_json(counter.first)
+        << "\":" << counter.second << ",";
+  }
+  out << "\"peak_rss\":" << peak_rss() << "}}\n";
+}
+#if defined(YAKSHA_OS_WINDOWS)
+std::uint64_t time_report::peak_rss() {
+  PROCESS_MEMORY_COUNTERS counters{};
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+    return 0;
+  }
+  return static_cast<std::uint64_t>(counters.PeakWorkingSetSize);
+}
+#else
+std::uint64_t time_report::peak_rss() {
+  struct rusage usage {};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) { return 0; }
+#if defined(YAKSHA_OS_MACOS)
+  return static_cast<std::uint64_t>(usage.ru_maxrss);// bytes
+#else
+  return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;// kilobytes
+#endif
+}
+#endif
+scoped_timer::scoped_timer(time_report *report, const char *name) {
+  if (report == nullptr || !report->enabled_) { return; }
+  start(report, name, "");
+}
+scoped_timer::scoped_timer(time_report *report, const char *name,
+                           const std::string &file) {
+  if (report == nullptr || !report->enabled_) { return; }
+  start(report, name, file);
+}
+scoped_timer::scoped_timer(time_report *report, const char *name,
+                           const std::filesystem::path &file) {
+  if (report == nullptr || !report->enabled_) { return; }
+  start(report, name, file.string());
+}
+void scoped_timer::start(time_report *report, const char *name,
+                         std::string file) {
+  report_ = report;
+  index_ = report->events_.size();
+  report->events_.push_back(
+      {name, std::move(file), report->now_us(), 0, report->depth_});
+  report->depth_++;
+}
+scoped_timer::~scoped_timer() {
+  if (report_ == nullptr) { return; }
+  auto &event = report_->events_[index_];
+  event.duration_us_ = report_->now_us() - event.start_us_;
+  report_->depth_--;
+}
@@ -0,0 +1,122 @@
+// ==============================================================================================
+// ╦  ┬┌─┐┌─┐┌┐┌┌─┐┌─┐    Yaksha Programming Language
+// ║  ││  ├┤ │││└─┐├┤     is Licensed with GPLv3 + extra terms. Please see below.
+// ╩═╝┴└─┘└─┘┘└┘└─┘└─┘
+// Note: libs - MIT license, runtime/3rd - various
+// ==============================================================================================
+// GPLv3:
+//
+// Yaksha - Programming Language.
+// Copyright (C) 2020 - 2024 Bhathiya Perera
+//
+// This program is free software: you can redistribute it and/or modify it under the terms
+// of the GNU General Public License as published by the Free Software Foundation,
+// either version 3 of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see https://www.gnu.org/licenses/.
+//
+// ==============================================================================================
+// Additional Terms:
+//
+// Please note that any commercial use of the programming language's compiler source code
+// (everything except compiler/runtime, compiler/libs and compiler/3rd) require a written agreement
+// with author of the language (Bhathiya Perera).
+//
+// If you are using it for an open source project, please give credits.
+// Your own project must use GPLv3 license with these additional terms.
+//
+// You may use programs written in Yaksha/YakshaLisp for any legal purpose
+// (commercial, open-source, closed-source, etc) as long as it agrees
+// to the licenses of linked runtime libraries (see compiler/runtime/README.md).
+//
+// ==============================================================================================
+// time_report.h
+#ifndef TIME_REPORT_H
+#define TIME_REPORT_H
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+namespace yaksha {
+  /**
+   * A single timed phase (optionally for a single file)
+   */
+  struct time_report_event {
+    std::string name_;
+    std::string file_;
+    std::uint64_t start_us_;
+    std::uint64_t duration_us_;
+    int depth_;
+  };
+  /**
+   * Phase timings and counters for `yakshac --time-report`
+   * Nothing is recorded unless enabled_ is set, so a disabled scoped_timer
+   * costs a branch.
+   */
+  struct time_report {
+    time_report();
+    bool enabled_{false};
+    /**
+     * Add value to a named counter (created on first use)
+     */
+    void count(const std::string &name, std::uint64_t value);
+    /**
+     * Total microseconds spent in all phases with given name
+     */
+    [[nodiscard]] std::uint64_t total_us(const std::string &name) const;
+    /**
+     * Current value of a counter, 0 if it was never counted
+     */
+    [[nodiscard]] std::uint64_t counter(const std::string &name) const;
+    /**
+     * Print an aggregated (by phase name) human readable table
+     */
+    void print_table(std::ostream &out) const;
+    /**
+     * Print Chrome trace-event format JSON (chrome://tracing, perfetto)
+     */
+    void print_trace(std::ostream &out) const;
+    /**
+     * Peak resident set size of this process in bytes, 0 if unknown
+     */
+    static std::uint64_t peak_rss();
+
+private:
+    friend struct scoped_timer;
+    [[nodiscard]] std::uint64_t now_us() const;
+    std::chrono::steady_clock::time_point origin_;
+    std::vector<time_report_event> events_{};
+    std::vector<std::pair<std::string, std::uint64_t>> counters_{};
+    int depth_{0};
+  };
+  /**
+   * Time the enclosing scope as a phase of given report
+   */
+  struct scoped_timer {
+    scoped_timer(time_report *report, const char *name);
+    scoped_timer(time_report *report, const char *name,
+                 const std::string &file);
+    scoped_timer(time_report *report, const char *name,
+                 const std::filesystem::path &file);
+    ~scoped_timer();
+    scoped_timer(const scoped_timer &) = delete;
+    scoped_timer(scoped_timer &&) = delete;
+    scoped_timer &operator=(const scoped_timer &) = delete;
+    scoped_timer &operator=(scoped_timer &&) = delete;
+
+private:
+    void start(time_report *report, const char *name, std::string file);
+    time_report *report_{nullptr};
+    std::size_t index_{0};
+  };
+}// namespace yaksha
+#endif
@@ -38,6 +38,7 @@
 // ==============================================================================================
 #ifndef YAKSHA_LISP_PRELUDE_H
 #define YAKSHA_LISP_PRELUDE_H
+#include "yaksha_lisp/yaksha_lisp.h"
 #include <string>
 const std::string YAKSHA_LISP_PRELUDE = R"<><><><>(
 
@@ -57,8 +58,11 @@ const std::string YAKSHA_LISP_PRELUDE = R"<><><><>(
     (defun yk_is_token (x) (== (yk_get_type x) YK_TYPE_TOKEN))
     (defun yk_is_expr (x) (== (yk_get_type x) YK_TYPE_EXPR))
     (defun yk_is_stmt (x) (== (yk_get_type x) YK_TYPE_STMT))
+    # {dsl name func} or {dsl name func pure}
+    # pure macros only use token types & values of input, so expansions are cached
     (defun yk_register (type_name_func)
-        (if (!= (len type_name_func) 3) (raise_error "yk_register: expected 3 item list"))
+        (if (and (!= (len type_name_func) 3) (!= (len type_name_func) 4))
+            (raise_error "yk_register: expected 3 or 4 item list"))
         (def macro_type (repr (index type_name_func 0)))
         (def macro_name (repr (index type_name_func 1)))
         (def macro_func (eval (index type_name_func 2)))
@@ -66,6 +70,10 @@ const std::string YAKSHA_LISP_PRELUDE = R"<><><><>(
         (def macro_metadata (+ "metadata#" target))
         (map_set (parent) target macro_func)
         (map_set (parent) macro_metadata type_name_func)
+        (if (== (len type_name_func) 4) (do
+            (if (!= (repr (index type_name_func 3)) "pure")
+                (raise_error "yk_register: 4th item must be pure"))
+            (map_set (parent) (+ "pure#" target) 1)))
     )
     # =========== #
     #  Constants
@@ -289,4 +297,1866 @@ const std::string YAKSHA_LISP_PRELUDE = R"<><><><>(
     (system_lock_root_scope)
 
 )<><><><>";
+// Pre-tokenized YAKSHA_LISP_PRELUDE, used only if size and hash match
+const std::size_t YAKSHA_LISP_PRELUDE_SIZE = 12557;
+const std::uint64_t YAKSHA_LISP_PRELUDE_HASH = 0xed94f33ec4454255ULL;
+const yaksha::yaksha_lisp_token_snapshot YAKSHA_LISP_PRELUDE_TOKENS[] = {
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 2, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 2, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_PRELUDE_INCLUDED", 2, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "1", 2, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 2, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 4, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 4, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "noop", 4, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 4, 17},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "&", 4, 18},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "x", 4, 19},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 4, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 4, 22},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ghost", 4, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "nil", 4, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 4, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 4, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 9, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 9, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_OBJECT_TYPE", 9, 10},
+    {yaksha::yaksha_lisp_token_type::STRING, "yk_type", 9, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 9, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 11, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 11, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_KEY_WHAT", 11, 10},
+    {yaksha::yaksha_lisp_token_type::STRING, "yk_what", 11, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 11, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 12, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 12, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TYPE_TOKEN", 12, 10},
+    {yaksha::yaksha_lisp_token_type::STRING, "yk_token", 12, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 12, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 13, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 13, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_get_type", 13, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 13, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "x", 13, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 13, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 13, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "map_get", 13, 29},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "x", 13, 37},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_KEY_TYPE", 13, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 13, 50},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 13, 51},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 14, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 14, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_what", 14, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 14, 20},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "x", 14, 21},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 14, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 14, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "map_get", 14, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "x", 14, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_KEY_NODE_TYPE", 14, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 14, 51},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 14, 52},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 15, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 15, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_is_token", 15, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 15, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "x", 15, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 15, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 15, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "==", 15, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 15, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_get_type", 15, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "x", 15, 45},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 15, 46},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TYPE_TOKEN", 15, 48},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 15, 61},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 15, 62},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 16, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 16, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_is_expr", 16, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 16, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "x", 16, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 16, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 16, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "==", 16, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 16, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_get_type", 16, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "x", 16, 44},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 16, 45},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TYPE_EXPR", 16, 47},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 16, 59},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 16, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 17, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 17, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_is_stmt", 17, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 17, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "x", 17, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 17, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 17, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "==", 17, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 17, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_get_type", 17, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "x", 17, 44},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 17, 45},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TYPE_STMT", 17, 47},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 17, 59},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 17, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 20, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 20, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_register", 20, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 20, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "type_name_func", 20, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 20, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 21, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "if", 21, 10},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 21, 13},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "and", 21, 14},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 21, 18},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "!=", 21, 19},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 21, 22},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "len", 21, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "type_name_func", 21, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 21, 41},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "3", 21, 43},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 21, 44},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 21, 46},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "!=", 21, 47},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 21, 50},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "len", 21, 51},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "type_name_func", 21, 55},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 21, 69},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "4", 21, 71},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 21, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 21, 73},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 22, 13},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "raise_error", 22, 14},
+    {yaksha::yaksha_lisp_token_type::STRING, "yk_register: expected 3 or 4 item list", 22, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 22, 66},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 22, 67},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 23, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 23, 10},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "macro_type", 23, 14},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 23, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "repr", 23, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 23, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "index", 23, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "type_name_func", 23, 38},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "0", 23, 53},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 23, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 23, 55},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 23, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 24, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 24, 10},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "macro_name", 24, 14},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 24, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "repr", 24, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 24, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "index", 24, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "type_name_func", 24, 38},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "1", 24, 53},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 24, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 24, 55},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 24, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 25, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 25, 10},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "macro_func", 25, 14},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 25, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "eval", 25, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 25, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "index", 25, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "type_name_func", 25, 38},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "2", 25, 53},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 25, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 25, 55},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 25, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 26, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 26, 10},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "target", 26, 14},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 26, 21},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "+", 26, 22},
+    {yaksha::yaksha_lisp_token_type::STRING, "yaksha#macro#", 26, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "macro_type", 26, 40},
+    {yaksha::yaksha_lisp_token_type::STRING, "#", 26, 52},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "macro_name", 26, 55},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 26, 65},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 26, 66},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 27, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 27, 10},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "macro_metadata", 27, 14},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 27, 29},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "+", 27, 30},
+    {yaksha::yaksha_lisp_token_type::STRING, "metadata#", 27, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "target", 27, 44},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 27, 50},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 27, 51},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 28, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "map_set", 28, 10},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 28, 18},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "parent", 28, 19},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 28, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "target", 28, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "macro_func", 28, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 28, 44},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 29, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "map_set", 29, 10},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 29, 18},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "parent", 29, 19},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 29, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "macro_metadata", 29, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "type_name_func", 29, 42},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 29, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 30, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "if", 30, 10},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 30, 13},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "==", 30, 14},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 30, 17},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "len", 30, 18},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "type_name_func", 30, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 30, 36},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "4", 30, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 30, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 30, 41},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "do", 30, 42},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 31, 13},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "if", 31, 14},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 31, 17},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "!=", 31, 18},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 31, 21},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "repr", 31, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 31, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "index", 31, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "type_name_func", 31, 34},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "3", 31, 49},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 31, 50},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 31, 51},
+    {yaksha::yaksha_lisp_token_type::STRING, "pure", 31, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 31, 59},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 32, 17},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "raise_error", 32, 18},
+    {yaksha::yaksha_lisp_token_type::STRING, "yk_register: 4th item must be pure", 32, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 32, 66},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 32, 67},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 33, 13},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "map_set", 33, 14},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 33, 22},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "parent", 33, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 33, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 33, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "+", 33, 32},
+    {yaksha::yaksha_lisp_token_type::STRING, "pure#", 33, 35},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "target", 33, 42},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 33, 48},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "1", 33, 50},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 33, 51},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 33, 52},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 33, 53},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 34, 5},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 38, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 38, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_AND", 38, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28864", 38, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 38, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 39, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 39, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_AND_EQ", 39, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28865", 39, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 39, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 40, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 40, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_ARROW", 40, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28866", 40, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 40, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 41, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 41, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_AT", 41, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28867", 41, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 41, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 42, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 42, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_BA_DEDENT", 42, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28868", 42, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 42, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 43, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 43, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_BA_INDENT", 43, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28869", 43, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 43, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 44, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 44, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_COLON", 44, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28870", 44, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 44, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 45, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 45, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_COMMA", 45, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28871", 45, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 45, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 46, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 46, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_CURLY_BRACKET_CLOSE", 46, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28873", 46, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 46, 44},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 47, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 47, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_CURLY_BRACKET_OPEN", 47, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28874", 47, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 47, 43},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 48, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 48, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_DIV", 48, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28875", 48, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 48, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 49, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 49, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_DIV_EQ", 49, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28876", 49, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 49, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 50, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 50, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_DOT", 50, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28877", 50, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 50, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 51, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 51, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_DOUBLE_NUMBER", 51, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28878", 51, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 51, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 52, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 52, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_ELLIPSIS", 52, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28879", 52, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 52, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 53, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 53, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_EQ", 53, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28881", 53, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 53, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 54, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 54, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_EQ_EQ", 54, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28882", 54, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 54, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 55, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 55, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_FLOAT_NUMBER", 55, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28883", 55, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 55, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 56, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 56, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_GREAT", 56, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28884", 56, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 56, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 57, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 57, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_GREAT_EQ", 57, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28885", 57, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 57, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 58, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 58, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_BIN", 58, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28887", 58, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 58, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 59, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 59, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_BIN_16", 59, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28888", 59, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 59, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 60, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 60, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_BIN_64", 60, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28889", 60, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 60, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 61, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 61, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_BIN_8", 61, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28890", 61, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 61, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 62, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 62, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_DECIMAL", 62, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28891", 62, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 62, 40},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 63, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 63, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_DECIMAL_16", 63, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28892", 63, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 63, 43},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 64, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 64, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_DECIMAL_64", 64, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28893", 64, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 64, 43},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 65, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 65, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_DECIMAL_8", 65, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28894", 65, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 65, 42},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 66, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 66, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_HEX", 66, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28895", 66, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 66, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 67, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 67, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_HEX_16", 67, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28896", 67, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 67, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 68, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 68, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_HEX_64", 68, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28897", 68, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 68, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 69, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 69, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_HEX_8", 69, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28898", 69, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 69, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 70, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 70, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_OCT", 70, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28899", 70, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 70, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 71, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 71, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_OCT_16", 71, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28900", 71, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 71, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 72, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 72, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_OCT_64", 72, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28901", 72, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 72, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 73, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 73, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_OCT_8", 73, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28902", 73, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 73, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 74, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 74, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INT_DIV", 74, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28903", 74, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 74, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 75, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 75, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INT_DIV_EQ", 75, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28904", 75, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 75, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 76, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 76, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_LESS", 76, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28905", 76, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 76, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 77, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 77, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_LESS_EQ", 77, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28906", 77, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 77, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 78, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 78, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_MOD", 78, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28907", 78, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 78, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 79, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 79, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_MOD_EQ", 79, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28908", 79, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 79, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 80, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 80, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_MUL", 80, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28909", 80, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 80, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 81, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 81, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_MUL_EQ", 81, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28910", 81, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 81, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 82, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 82, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_NAME", 82, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28911", 82, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 82, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 83, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 83, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_NEW_LINE", 83, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28912", 83, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 83, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 84, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 84, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_NOT_EQ", 84, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28913", 84, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 84, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 85, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 85, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_NOT_SYMBOL", 85, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28914", 85, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 85, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 86, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 86, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_OR", 86, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28915", 86, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 86, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 87, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 87, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_OR_EQ", 87, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28916", 87, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 87, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 88, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 88, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_PAREN_CLOSE", 88, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28917", 88, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 88, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 89, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 89, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_PAREN_OPEN", 89, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28918", 89, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 89, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 90, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 90, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_PLUS", 90, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28919", 90, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 90, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 91, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 91, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_PLUS_EQ", 91, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28920", 91, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 91, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 92, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 92, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_POWER", 92, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28921", 92, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 92, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 93, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 93, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_POWER_EQ", 93, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28922", 93, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 93, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 94, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 94, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SEMICOLON", 94, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28923", 94, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 94, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 95, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 95, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SHL", 95, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28924", 95, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 95, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 96, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 96, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SHL_EQ", 96, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28925", 96, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 96, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 97, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 97, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SHR", 97, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28926", 97, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 97, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 98, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 98, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SHR_EQ", 98, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28927", 98, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 98, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 99, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 99, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SQUARE_BRACKET_CLOSE", 99, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28928", 99, 40},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 99, 45},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 100, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 100, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SQUARE_BRACKET_OPEN", 100, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28929", 100, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 100, 44},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 101, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 101, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_STRING", 101, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28930", 101, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 101, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 102, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 102, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SUB", 102, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28931", 102, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 102, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 103, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 103, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SUB_EQ", 103, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28932", 103, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 103, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 104, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 104, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_THREE_QUOTE_STRING", 104, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28933", 104, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 104, 43},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 105, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 105, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_TILDE", 105, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28934", 105, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 105, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 106, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 106, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_BIN", 106, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28935", 106, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 106, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 107, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 107, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_BIN_16", 107, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28936", 107, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 107, 40},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 108, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 108, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_BIN_64", 108, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28937", 108, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 108, 40},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 109, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 109, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_BIN_8", 109, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28938", 109, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 109, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 110, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 110, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_DECIMAL", 110, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28939", 110, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 110, 41},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 111, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 111, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_DECIMAL_16", 111, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28940", 111, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 111, 44},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 112, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 112, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_DECIMAL_64", 112, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28941", 112, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 112, 44},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 113, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 113, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_DECIMAL_8", 113, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28942", 113, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 113, 43},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 114, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 114, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_HEX", 114, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28943", 114, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 114, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 115, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 115, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_HEX_16", 115, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28944", 115, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 115, 40},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 116, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 116, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_HEX_64", 116, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28945", 116, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 116, 40},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 117, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 117, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_HEX_8", 117, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28946", 117, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 117, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 118, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 118, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_OCT", 118, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28947", 118, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 118, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 119, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 119, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_OCT_16", 119, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28948", 119, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 119, 40},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 120, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 120, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_OCT_64", 120, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28949", 120, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 120, 40},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 121, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 121, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_UINTEGER_OCT_8", 121, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28950", 121, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 121, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 122, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 122, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_XOR", 122, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28955", 122, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 122, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 123, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 123, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_XOR_EQ", 123, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28956", 123, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 123, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 124, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 124, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_FALSE", 124, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28957", 124, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 124, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 125, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 125, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_NONE", 125, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28958", 125, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 125, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 126, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 126, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_TRUE", 126, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28959", 126, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 126, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 127, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 127, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_AND", 127, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28960", 127, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 127, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 128, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 128, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_AS", 128, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28961", 128, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 128, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 129, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 129, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_ASSERT", 129, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28962", 129, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 129, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 130, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 130, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_BREAK", 130, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28963", 130, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 130, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 131, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 131, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_CCODE", 131, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28964", 131, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 131, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 132, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 132, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_CLASS", 132, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28965", 132, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 132, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 133, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 133, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_CONTINUE", 133, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28966", 133, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 133, 41},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 134, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 134, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_DECL", 134, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28967", 134, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 134, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 135, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 135, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_DEF", 135, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28968", 135, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 135, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 136, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 136, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_DEFER", 136, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28969", 136, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 136, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 137, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 137, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_DEL", 137, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28970", 137, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 137, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 138, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 138, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_DIRECTIVE", 138, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28971", 138, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 138, 42},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 139, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 139, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_ELIF", 139, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28972", 139, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 139, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 140, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 140, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_ELSE", 140, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28973", 140, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 140, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 141, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 141, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_ENUM", 141, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28974", 141, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 141, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 142, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 142, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_FOR", 142, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28975", 142, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 142, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 143, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 143, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_FROM", 143, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28976", 143, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 143, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 144, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 144, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_IF", 144, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28977", 144, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 144, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 145, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 145, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_IMPORT", 145, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28978", 145, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 145, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 146, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 146, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_IN", 146, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28979", 146, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 146, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 147, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 147, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_MACROS", 147, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28980", 147, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 147, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 148, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 148, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_NOT", 148, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28981", 148, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 148, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 149, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 149, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_OR", 149, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28982", 149, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 149, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 150, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 150, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_PASS", 150, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28983", 150, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 150, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 151, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 151, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_RETURN", 151, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28984", 151, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 151, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 152, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 152, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_RUNTIMEFEATURE", 152, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28985", 152, 42},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 152, 47},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 153, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 153, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_STRUCT", 153, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28986", 153, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 153, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 154, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 154, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_TRY", 154, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28987", 154, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 154, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 155, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 155, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_WHILE", 155, 10},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "28988", 155, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 155, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 159, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 159, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 159, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 159, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "token_type", 159, 29},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "value", 159, 40},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 159, 45},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 160, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "def", 160, 10},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "m", 160, 14},
+    {yaksha::yaksha_lisp_token_type::AT, "@", 160, 16},
+    {yaksha::yaksha_lisp_token_type::CURLY_OPEN, "{", 160, 17},
+    {yaksha::yaksha_lisp_token_type::CURLY_CLOSE, "}", 160, 18},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 160, 19},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 161, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "map_set", 161, 10},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "m", 161, 18},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_OBJECT_TYPE", 161, 20},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TYPE_TOKEN", 161, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 161, 48},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 162, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "map_set", 162, 10},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "m", 162, 18},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_KEY_WHAT", 162, 20},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "token_type", 162, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 162, 42},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 163, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "map_set", 163, 10},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "m", 163, 18},
+    {yaksha::yaksha_lisp_token_type::STRING, "value", 163, 21},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "value", 163, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 163, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 164, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "map_set", 164, 10},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "m", 164, 18},
+    {yaksha::yaksha_lisp_token_type::STRING, "line", 164, 21},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "-1", 164, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 164, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 165, 9},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "map_set", 165, 10},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "m", 165, 18},
+    {yaksha::yaksha_lisp_token_type::STRING, "pos", 165, 21},
+    {yaksha::yaksha_lisp_token_type::NUMBER, "-1", 165, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 165, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "m", 166, 9},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 166, 10},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 167, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 167, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_assert_token", 167, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 167, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "tok", 167, 29},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "tok_type", 167, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 167, 41},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 167, 43},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "if", 167, 44},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 167, 47},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "!=", 167, 48},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 167, 51},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "map_get", 167, 52},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "tok", 167, 60},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_KEY_WHAT", 167, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 167, 75},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "tok_type", 167, 77},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 167, 85},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 167, 87},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "raise_error", 167, 88},
+    {yaksha::yaksha_lisp_token_type::STRING, "invalid token type", 167, 101},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 167, 120},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 167, 121},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 167, 122},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 168, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 168, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_integer_decimal", 168, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 168, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "value", 168, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 168, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 168, 40},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 168, 41},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INTEGER_DECIMAL", 168, 57},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "value", 168, 82},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 168, 87},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 168, 88},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 169, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 169, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_float", 169, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 169, 22},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "value", 169, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 169, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 169, 30},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 169, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_FLOAT_NUMBER", 169, 47},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "value", 169, 69},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 169, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 169, 75},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 170, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 170, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_double", 170, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 170, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "value", 170, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 170, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 170, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 170, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_DOUBLE_NUMBER", 170, 48},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "value", 170, 71},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 170, 76},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 170, 77},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 171, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 171, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_string", 171, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 171, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "value", 171, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 171, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 171, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 171, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_STRING", 171, 48},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "value", 171, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 171, 69},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 171, 70},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 172, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 172, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_indent", 172, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 172, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 172, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 172, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 172, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_BA_INDENT", 172, 43},
+    {yaksha::yaksha_lisp_token_type::STRING, " ", 172, 63},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 172, 65},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 172, 66},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 173, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 173, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_dedent", 173, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 173, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 173, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 173, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 173, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_BA_DEDENT", 173, 43},
+    {yaksha::yaksha_lisp_token_type::STRING, " ", 173, 63},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 173, 65},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 173, 66},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 174, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 174, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_newline", 174, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 174, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 174, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 174, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 174, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_NEW_LINE", 174, 44},
+    {yaksha::yaksha_lisp_token_type::STRING, "\\n", 174, 63},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 174, 66},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 174, 67},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 175, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 175, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_at", 175, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 175, 19},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 175, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 175, 22},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 175, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_AT", 175, 39},
+    {yaksha::yaksha_lisp_token_type::STRING, "@", 175, 52},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 175, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 175, 55},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 176, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 176, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_colon", 176, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 176, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 176, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 176, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 176, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_COLON", 176, 42},
+    {yaksha::yaksha_lisp_token_type::STRING, ":", 176, 58},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 176, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 176, 61},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 177, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 177, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_semicolon", 177, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 177, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 177, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 177, 29},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 177, 30},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SEMICOLON", 177, 46},
+    {yaksha::yaksha_lisp_token_type::STRING, ";", 177, 66},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 177, 68},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 177, 69},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 178, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 178, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_paren_open", 178, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 178, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 178, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 178, 30},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 178, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_PAREN_OPEN", 178, 47},
+    {yaksha::yaksha_lisp_token_type::STRING, "(", 178, 68},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 178, 70},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 178, 71},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 179, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 179, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_paren_close", 179, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 179, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 179, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 179, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 179, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_PAREN_CLOSE", 179, 48},
+    {yaksha::yaksha_lisp_token_type::STRING, ")", 179, 70},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 179, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 179, 73},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 180, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 180, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_square_bracket_open", 180, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 180, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 180, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 180, 39},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 180, 40},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SQUARE_BRACKET_OPEN", 180, 56},
+    {yaksha::yaksha_lisp_token_type::STRING, "[", 180, 86},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 180, 88},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 180, 89},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 181, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 181, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_square_bracket_close", 181, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 181, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 181, 38},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 181, 40},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 181, 41},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SQUARE_BRACKET_CLOSE", 181, 57},
+    {yaksha::yaksha_lisp_token_type::STRING, "]", 181, 88},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 181, 90},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 181, 91},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 182, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 182, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_curly_bracket_open", 182, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 182, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 182, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 182, 38},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 182, 39},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_CURLY_BRACKET_OPEN", 182, 55},
+    {yaksha::yaksha_lisp_token_type::STRING, "{", 182, 84},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 182, 86},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 182, 87},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 183, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 183, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_curly_bracket_close", 183, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 183, 36},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 183, 37},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 183, 39},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 183, 40},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_CURLY_BRACKET_CLOSE", 183, 56},
+    {yaksha::yaksha_lisp_token_type::STRING, "}", 183, 86},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 183, 88},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 183, 89},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 184, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 184, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_less", 184, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 184, 21},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 184, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 184, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 184, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_LESS", 184, 41},
+    {yaksha::yaksha_lisp_token_type::STRING, "<", 184, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 184, 58},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 184, 59},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 185, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 185, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_eq", 185, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 185, 19},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 185, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 185, 22},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 185, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_EQ", 185, 39},
+    {yaksha::yaksha_lisp_token_type::STRING, "=", 185, 52},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 185, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 185, 55},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 186, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 186, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_great", 186, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 186, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 186, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 186, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 186, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_GREAT", 186, 42},
+    {yaksha::yaksha_lisp_token_type::STRING, ">", 186, 58},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 186, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 186, 61},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 187, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 187, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_or", 187, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 187, 19},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 187, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 187, 22},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 187, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_OR", 187, 39},
+    {yaksha::yaksha_lisp_token_type::STRING, "|", 187, 52},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 187, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 187, 55},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 188, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 188, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_plus", 188, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 188, 21},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 188, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 188, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 188, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_PLUS", 188, 41},
+    {yaksha::yaksha_lisp_token_type::STRING, "+", 188, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 188, 58},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 188, 59},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 189, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 189, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_sub", 189, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 189, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 189, 21},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 189, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 189, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SUB", 189, 40},
+    {yaksha::yaksha_lisp_token_type::STRING, "-", 189, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 189, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 189, 57},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 190, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 190, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_mul", 190, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 190, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 190, 21},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 190, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 190, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_MUL", 190, 40},
+    {yaksha::yaksha_lisp_token_type::STRING, "*", 190, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 190, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 190, 57},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 191, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 191, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_div", 191, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 191, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 191, 21},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 191, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 191, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_DIV", 191, 40},
+    {yaksha::yaksha_lisp_token_type::STRING, "/", 191, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 191, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 191, 57},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 192, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 192, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_and", 192, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 192, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 192, 21},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 192, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 192, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_AND", 192, 40},
+    {yaksha::yaksha_lisp_token_type::STRING, "&", 192, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 192, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 192, 57},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 193, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 193, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_xor", 193, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 193, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 193, 21},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 193, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 193, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_XOR", 193, 40},
+    {yaksha::yaksha_lisp_token_type::STRING, "^", 193, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 193, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 193, 57},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 194, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 194, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_mod", 194, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 194, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 194, 21},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 194, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 194, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_MOD", 194, 40},
+    {yaksha::yaksha_lisp_token_type::STRING, "%", 194, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 194, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 194, 57},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 195, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 195, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_int_div", 195, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 195, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 195, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 195, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 195, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INT_DIV", 195, 44},
+    {yaksha::yaksha_lisp_token_type::STRING, "//", 195, 62},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 195, 65},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 195, 66},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 196, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 196, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_power", 196, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 196, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 196, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 196, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 196, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_POWER", 196, 42},
+    {yaksha::yaksha_lisp_token_type::STRING, "**", 196, 58},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 196, 61},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 196, 62},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 197, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 197, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_less_eq", 197, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 197, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 197, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 197, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 197, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_LESS_EQ", 197, 44},
+    {yaksha::yaksha_lisp_token_type::STRING, "<=", 197, 62},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 197, 65},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 197, 66},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 198, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 198, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_eq_eq", 198, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 198, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 198, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 198, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 198, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_EQ_EQ", 198, 42},
+    {yaksha::yaksha_lisp_token_type::STRING, "==", 198, 58},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 198, 61},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 198, 62},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 199, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 199, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_great_eq", 199, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 199, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 199, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 199, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 199, 29},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_GREAT_EQ", 199, 45},
+    {yaksha::yaksha_lisp_token_type::STRING, ">=", 199, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 199, 67},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 199, 68},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 200, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 200, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_or_eq", 200, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 200, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 200, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 200, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 200, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_OR_EQ", 200, 42},
+    {yaksha::yaksha_lisp_token_type::STRING, "|=", 200, 58},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 200, 61},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 200, 62},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 201, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 201, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_plus_eq", 201, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 201, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 201, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 201, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 201, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_PLUS_EQ", 201, 44},
+    {yaksha::yaksha_lisp_token_type::STRING, "+=", 201, 62},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 201, 65},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 201, 66},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 202, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 202, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_sub_eq", 202, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 202, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 202, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 202, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 202, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SUB_EQ", 202, 43},
+    {yaksha::yaksha_lisp_token_type::STRING, "-=", 202, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 202, 63},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 202, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 203, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 203, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_mul_eq", 203, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 203, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 203, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 203, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 203, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_MUL_EQ", 203, 43},
+    {yaksha::yaksha_lisp_token_type::STRING, "*=", 203, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 203, 63},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 203, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 204, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 204, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_div_eq", 204, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 204, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 204, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 204, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 204, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_DIV_EQ", 204, 43},
+    {yaksha::yaksha_lisp_token_type::STRING, "/=", 204, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 204, 63},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 204, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 205, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 205, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_and_eq", 205, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 205, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 205, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 205, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 205, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_AND_EQ", 205, 43},
+    {yaksha::yaksha_lisp_token_type::STRING, "&=", 205, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 205, 63},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 205, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 206, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 206, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_xor_eq", 206, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 206, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 206, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 206, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 206, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_XOR_EQ", 206, 43},
+    {yaksha::yaksha_lisp_token_type::STRING, "^=", 206, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 206, 63},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 206, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 207, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 207, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_mod_eq", 207, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 207, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 207, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 207, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 207, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_MOD_EQ", 207, 43},
+    {yaksha::yaksha_lisp_token_type::STRING, "%=", 207, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 207, 63},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 207, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 208, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 208, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_int_div_eq", 208, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 208, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 208, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 208, 30},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 208, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_INT_DIV_EQ", 208, 47},
+    {yaksha::yaksha_lisp_token_type::STRING, "//=", 208, 68},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 208, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 208, 73},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 209, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 209, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_power_eq", 209, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 209, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 209, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 209, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 209, 29},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_POWER_EQ", 209, 45},
+    {yaksha::yaksha_lisp_token_type::STRING, "**=", 209, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 209, 68},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 209, 69},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 210, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 210, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_arrow", 210, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 210, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 210, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 210, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 210, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_ARROW", 210, 42},
+    {yaksha::yaksha_lisp_token_type::STRING, "->", 210, 58},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 210, 61},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 210, 62},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 211, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 211, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_ellipsis", 211, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 211, 25},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 211, 26},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 211, 28},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 211, 29},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_ELLIPSIS", 211, 45},
+    {yaksha::yaksha_lisp_token_type::STRING, "...", 211, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 211, 68},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 211, 69},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 212, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 212, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_dot", 212, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 212, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 212, 21},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 212, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 212, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_DOT", 212, 40},
+    {yaksha::yaksha_lisp_token_type::STRING, ".", 212, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 212, 56},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 212, 57},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 213, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 213, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_comma", 213, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 213, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 213, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 213, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 213, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_COMMA", 213, 42},
+    {yaksha::yaksha_lisp_token_type::STRING, ",", 213, 58},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 213, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 213, 61},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 214, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 214, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_shl", 214, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 214, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 214, 21},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 214, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 214, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SHL", 214, 40},
+    {yaksha::yaksha_lisp_token_type::STRING, "<<", 214, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 214, 57},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 214, 58},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 215, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 215, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_shr", 215, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 215, 20},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 215, 21},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 215, 23},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 215, 24},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SHR", 215, 40},
+    {yaksha::yaksha_lisp_token_type::STRING, ">>", 215, 54},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 215, 57},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 215, 58},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 216, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 216, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_shl_eq", 216, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 216, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 216, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 216, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 216, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SHL_EQ", 216, 43},
+    {yaksha::yaksha_lisp_token_type::STRING, "<<=", 216, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 216, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 216, 65},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 217, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 217, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_shr_eq", 217, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 217, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 217, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 217, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 217, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_SHR_EQ", 217, 43},
+    {yaksha::yaksha_lisp_token_type::STRING, ">>=", 217, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 217, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 217, 65},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 218, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 218, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_not_eq", 218, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 218, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 218, 24},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 218, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 218, 27},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_NOT_EQ", 218, 43},
+    {yaksha::yaksha_lisp_token_type::STRING, "!=", 218, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 218, 63},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 218, 64},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 219, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 219, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_tilde", 219, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 219, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 219, 23},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 219, 25},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 219, 26},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_TILDE", 219, 42},
+    {yaksha::yaksha_lisp_token_type::STRING, "~", 219, 58},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 219, 60},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 219, 61},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 220, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 220, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_not_symbol", 220, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 220, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 220, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 220, 30},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 220, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_NOT_SYMBOL", 220, 47},
+    {yaksha::yaksha_lisp_token_type::STRING, "!", 220, 68},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 220, 70},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 220, 71},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 221, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 221, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_false", 221, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 221, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 221, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 221, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 221, 34},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_FALSE", 221, 50},
+    {yaksha::yaksha_lisp_token_type::STRING, "False", 221, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 221, 80},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 221, 81},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 222, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 222, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_none", 222, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 222, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 222, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 222, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 222, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_NONE", 222, 49},
+    {yaksha::yaksha_lisp_token_type::STRING, "None", 222, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 222, 77},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 222, 78},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 223, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 223, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_true", 223, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 223, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 223, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 223, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 223, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_TRUE", 223, 49},
+    {yaksha::yaksha_lisp_token_type::STRING, "True", 223, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 223, 77},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 223, 78},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 224, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 224, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_and", 224, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 224, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 224, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 224, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 224, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_AND", 224, 48},
+    {yaksha::yaksha_lisp_token_type::STRING, "and", 224, 70},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 224, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 224, 75},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 225, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 225, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_as", 225, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 225, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 225, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 225, 30},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 225, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_AS", 225, 47},
+    {yaksha::yaksha_lisp_token_type::STRING, "as", 225, 68},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 225, 71},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 225, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 226, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 226, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_assert", 226, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 226, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 226, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 226, 34},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 226, 35},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_ASSERT", 226, 51},
+    {yaksha::yaksha_lisp_token_type::STRING, "assert", 226, 76},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 226, 83},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 226, 84},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 227, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 227, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_break", 227, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 227, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 227, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 227, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 227, 34},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_BREAK", 227, 50},
+    {yaksha::yaksha_lisp_token_type::STRING, "break", 227, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 227, 80},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 227, 81},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 228, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 228, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_ccode", 228, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 228, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 228, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 228, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 228, 34},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_CCODE", 228, 50},
+    {yaksha::yaksha_lisp_token_type::STRING, "ccode", 228, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 228, 80},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 228, 81},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 229, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 229, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_class", 229, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 229, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 229, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 229, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 229, 34},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_CLASS", 229, 50},
+    {yaksha::yaksha_lisp_token_type::STRING, "class", 229, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 229, 80},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 229, 81},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 230, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 230, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_continue", 230, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 230, 33},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 230, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 230, 36},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 230, 37},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_CONTINUE", 230, 53},
+    {yaksha::yaksha_lisp_token_type::STRING, "continue", 230, 80},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 230, 89},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 230, 90},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 231, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 231, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_decl", 231, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 231, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 231, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 231, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 231, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_DECL", 231, 49},
+    {yaksha::yaksha_lisp_token_type::STRING, "decl", 231, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 231, 77},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 231, 78},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 232, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 232, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_def", 232, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 232, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 232, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 232, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 232, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_DEF", 232, 48},
+    {yaksha::yaksha_lisp_token_type::STRING, "def", 232, 70},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 232, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 232, 75},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 233, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 233, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_defer", 233, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 233, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 233, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 233, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 233, 34},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_DEFER", 233, 50},
+    {yaksha::yaksha_lisp_token_type::STRING, "defer", 233, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 233, 80},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 233, 81},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 234, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 234, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_del", 234, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 234, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 234, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 234, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 234, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_DEL", 234, 48},
+    {yaksha::yaksha_lisp_token_type::STRING, "del", 234, 70},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 234, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 234, 75},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 235, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 235, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_directive", 235, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 235, 34},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 235, 35},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 235, 37},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 235, 38},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_DIRECTIVE", 235, 54},
+    {yaksha::yaksha_lisp_token_type::STRING, "directive", 235, 82},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 235, 92},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 235, 93},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 236, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 236, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_elif", 236, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 236, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 236, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 236, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 236, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_ELIF", 236, 49},
+    {yaksha::yaksha_lisp_token_type::STRING, "elif", 236, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 236, 77},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 236, 78},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 237, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 237, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_else", 237, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 237, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 237, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 237, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 237, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_ELSE", 237, 49},
+    {yaksha::yaksha_lisp_token_type::STRING, "else", 237, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 237, 77},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 237, 78},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 238, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 238, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_enum", 238, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 238, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 238, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 238, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 238, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_ENUM", 238, 49},
+    {yaksha::yaksha_lisp_token_type::STRING, "enum", 238, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 238, 77},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 238, 78},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 239, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 239, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_for", 239, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 239, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 239, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 239, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 239, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_FOR", 239, 48},
+    {yaksha::yaksha_lisp_token_type::STRING, "for", 239, 70},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 239, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 239, 75},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 240, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 240, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_from", 240, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 240, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 240, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 240, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 240, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_FROM", 240, 49},
+    {yaksha::yaksha_lisp_token_type::STRING, "from", 240, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 240, 77},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 240, 78},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 241, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 241, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_if", 241, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 241, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 241, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 241, 30},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 241, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_IF", 241, 47},
+    {yaksha::yaksha_lisp_token_type::STRING, "if", 241, 68},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 241, 71},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 241, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 242, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 242, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_import", 242, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 242, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 242, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 242, 34},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 242, 35},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_IMPORT", 242, 51},
+    {yaksha::yaksha_lisp_token_type::STRING, "import", 242, 76},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 242, 83},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 242, 84},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 243, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 243, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_in", 243, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 243, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 243, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 243, 30},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 243, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_IN", 243, 47},
+    {yaksha::yaksha_lisp_token_type::STRING, "in", 243, 68},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 243, 71},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 243, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 244, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 244, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_macros", 244, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 244, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 244, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 244, 34},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 244, 35},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_MACROS", 244, 51},
+    {yaksha::yaksha_lisp_token_type::STRING, "macros", 244, 76},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 244, 83},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 244, 84},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 245, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 245, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_not", 245, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 245, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 245, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 245, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 245, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_NOT", 245, 48},
+    {yaksha::yaksha_lisp_token_type::STRING, "not", 245, 70},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 245, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 245, 75},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 246, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 246, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_or", 246, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 246, 27},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 246, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 246, 30},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 246, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_OR", 246, 47},
+    {yaksha::yaksha_lisp_token_type::STRING, "or", 246, 68},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 246, 71},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 246, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 247, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 247, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_pass", 247, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 247, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 247, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 247, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 247, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_PASS", 247, 49},
+    {yaksha::yaksha_lisp_token_type::STRING, "pass", 247, 72},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 247, 77},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 247, 78},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 248, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 248, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_return", 248, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 248, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 248, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 248, 34},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 248, 35},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_RETURN", 248, 51},
+    {yaksha::yaksha_lisp_token_type::STRING, "return", 248, 76},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 248, 83},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 248, 84},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 249, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 249, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_runtimefeature", 249, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 249, 39},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 249, 40},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 249, 42},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 249, 43},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_RUNTIMEFEATURE", 249, 59},
+    {yaksha::yaksha_lisp_token_type::STRING, "runtimefeature", 249, 92},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 249, 107},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 249, 108},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 250, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 250, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_struct", 250, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 250, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 250, 32},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 250, 34},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 250, 35},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_STRUCT", 250, 51},
+    {yaksha::yaksha_lisp_token_type::STRING, "struct", 250, 76},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 250, 83},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 250, 84},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 251, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 251, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_try", 251, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 251, 28},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 251, 29},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 251, 31},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 251, 32},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_TRY", 251, 48},
+    {yaksha::yaksha_lisp_token_type::STRING, "try", 251, 70},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 251, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 251, 75},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 252, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "defun", 252, 6},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "ykt_keyword_while", 252, 12},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 252, 30},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 252, 31},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 252, 33},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "yk_create_token", 252, 34},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "YK_TOKEN_KEYWORD_WHILE", 252, 50},
+    {yaksha::yaksha_lisp_token_type::STRING, "while", 252, 74},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 252, 80},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 252, 81},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 253, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "system_enable_gc", 253, 6},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 253, 22},
+    {yaksha::yaksha_lisp_token_type::PAREN_OPEN, "(", 254, 5},
+    {yaksha::yaksha_lisp_token_type::SYMBOL, "system_lock_root_scope", 254, 6},
+    {yaksha::yaksha_lisp_token_type::PAREN_CLOSE, ")", 254, 28},
+    {yaksha::yaksha_lisp_token_type::YAKSHA_LISP_EOF, "", 256, 1},
+};
 #endif
\ No newline at end of file
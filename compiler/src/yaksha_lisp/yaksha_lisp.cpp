@@ -45,6 +45,8 @@
 #include "yaksha_lisp/prelude.h"
 #include "yaksha_lisp/yaksha_lisp_builtins.h"
 #include <cassert>
+#include <charconv>
+#include <iterator>
 #include <queue>
 #include <regex>
 #include <utility>
@@ -73,6 +75,21 @@ void yaksha_lisp_tokenizer::tokenize(std::string file,
   file_ = std::move(file);
   convert_tokens(tokens);
 }
+void yaksha_lisp_tokenizer::load_snapshot(
+    std::string file, const yaksha_lisp_token_snapshot *tokens, size_t count) {
+  file_ = std::move(file);
+  tokens_.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    auto dt = mm_->create_token();
+    dt->file_ = file_;
+    dt->type_ = tokens[i].type_;
+    dt->token_ = tokens[i].token_;
+    dt->line_ = tokens[i].line_;
+    dt->pos_ = tokens[i].pos_;
+    tokens_.emplace_back(dt);
+  }
+  inject_eof();
+}
 void yaksha_lisp_tokenizer::process_yk_tokens(tokenizer &tok) {
   convert_tokens(tok.tokens_);
 }
@@ -298,6 +315,12 @@ yaksha_lisp_parser::create_terminal_expr_from_token(yaksha_lisp_token *token) {
   de->token_ = token;
   if (token->type_ == yaksha_lisp_token_type::STRING) {
     de->token_->token_ = string_utils::unescape(token->token_);
+  } else if (token->type_ == yaksha_lisp_token_type::NUMBER) {
+    // parse number literals once, anything unusual falls back to stoll in eval
+    auto begin = token->token_.data();
+    auto end = begin + token->token_.size();
+    auto parsed = std::from_chars(begin, end, de->num_);
+    de->num_compiled_ = parsed.ec == std::errc{} && parsed.ptr == end;
   }
   de->close_token_ = de->token_;
   return de;
@@ -438,7 +461,8 @@ yaksha_envmap::yaksha_envmap(yk_memory_manager *pool)
 yaksha_envmap::yaksha_envmap() : parent_(nullptr), symbols_{}, mm_{nullptr} {}
 yaksha_envmap::~yaksha_envmap() = default;
 yaksha_lisp_value *yaksha_envmap::get_internal(const std::string &symbol) {
-  if (symbols_.find(symbol) != symbols_.end()) { return symbols_[symbol]; }
+  auto it = symbols_.find(symbol);
+  if (it != symbols_.end()) { return it->second; }
   if (parent_ != nullptr) {
     auto v = parent_->get(symbol);
     if (v != nullptr) { return v; }
@@ -526,10 +550,9 @@ void yaksha_envmap::setq_internal(const std::string &symbol,
 void yaksha_envmap::define_internal(const std::string &symbol,
                                     yaksha_lisp_value *value) {
   LOG_COMP("is it defined: " << symbol);
-  if (symbols_.find(symbol) == symbols_.end()) {
-    symbols_[symbol] = value;// insert
-    return;
+  if (symbols_.emplace(symbol, value).second) {
     LOG_COMP("defined: " << symbol);
+    return;
   }
   throw parsing_error{"symbol already defined: " + symbol, "", 0, 0};
 }
@@ -565,6 +588,10 @@ yaksha_lisp_value *yaksha_envmap::create_expr_val(yaksha_lisp_expr *exp) {
   v->expr_ = exp;
   return v;
 }
+yaksha_lisp_value *yaksha_envmap::expr_val(yaksha_lisp_expr *exp) {
+  if (exp->value_ == nullptr) { exp->value_ = create_expr_val(exp); }
+  return exp->value_;
+}
 yaksha_lisp_value *yaksha_envmap::create_val() { return mm_->create_value(); }
 yaksha_lisp_value *
 yaksha_envmap::eval(const std::vector<yaksha_lisp_expr *> &expressions_) {
@@ -579,6 +606,7 @@ yaksha_envmap::eval(const std::vector<yaksha_lisp_expr *> &expressions_) {
     std::cout << ">>======= " << exp << " =========" << std::endl;
 #endif
     last = eval(exp);
+    if (!mm_->should_collect()) { continue; }
     mm_->gc_mark();
     for (auto exp_i : expressions_) { exp_i->gc_mark(mm_); }
     if (prev != nullptr) { prev->gc_mark(mm_); }
@@ -594,6 +622,7 @@ yaksha_envmap::eval(const std::vector<yaksha_lisp_expr *> &expressions_) {
 yaksha_lisp_value *yaksha_envmap::eval_internal(yaksha_lisp_expr *exp) {
   if (exp->type_ == yaksha_lisp_expr_type::TERMINAL) {
     if (exp->token_->type_ == yaksha_lisp_token_type::NUMBER) {
+      if (exp->num_compiled_) { return create_number(exp->num_); }
       return create_number(std::stoll(exp->token_->token_));
     }
     if (exp->token_->type_ == yaksha_lisp_token_type::STRING) {
@@ -635,22 +664,48 @@ yaksha_lisp_value *yaksha_envmap::eval_internal(yaksha_lisp_expr *exp) {
       throw parsing_error{"empty S-Expression", exp->token_->file_,
                           exp->token_->line_, exp->token_->pos_};
     }
-    auto symbol = create_expr_val(exp->list_.front());
-    auto cur = exp->list_.begin() + 1;
-    auto end = exp->list_.end();
-    auto arg_vals = std::vector<yaksha_lisp_value *>{};
-    while (cur != end) {
-      arg_vals.emplace_back(create_expr_val(*cur));
-      ++cur;
-    }
-    return eval_call(symbol, arg_vals);
+    auto symbol = expr_val(exp->list_.front());
+    return eval_call(symbol, compile_args(exp));
   }
   // Q-EXPR
   auto val = create_val();
   val->type_ = yaksha_lisp_value_type::LIST;
-  for (auto e : exp->list_) { val->list_.emplace_back(create_expr_val(e)); }
+  val->list_.reserve(exp->list_.size());
+  for (auto e : exp->list_) { val->list_.emplace_back(expr_val(e)); }
   return val;
 }
+const std::vector<yaksha_lisp_value *> &
+yaksha_envmap::compile_args(yaksha_lisp_expr *exp) {
+  // S-Expression arguments are passed as unevaluated EXPR values,
+  // these never change, so create them once per expression
+  if (!exp->args_compiled_) {
+    exp->args_.clear();
+    exp->args_.reserve(exp->list_.size() - 1);
+    for (auto cur = exp->list_.begin() + 1; cur != exp->list_.end(); ++cur) {
+      exp->args_.emplace_back(expr_val(*cur));
+    }
+    exp->args_compiled_ = true;
+  }
+  return exp->args_;
+}
+void yaksha_envmap::compile_params(yaksha_lisp_value *callable,
+                                   yaksha_lisp_expr *params) {
+  if (params->params_compiled_) { return; }
+  auto param_len = params->list_.size();
+  params->params_.clear();
+  for (std::size_t i = 0; i < param_len; i++) {
+    auto &name = params->list_[i]->token_->token_;
+    if (name == "&" && i + 2 != param_len) {
+      throw parsing_error{"& must be present only as penultimate param: " +
+                              callable->str_,
+                          "", 0, 0};
+    }
+    if (name != "&") { params->params_.emplace_back(name); }
+  }
+  params->variadic_ =
+      param_len > 1 && params->list_[param_len - 2]->token_->token_ == "&";
+  params->params_compiled_ = true;
+}
 yaksha_lisp_value *yaksha_envmap::eval(yaksha_lisp_expr *exp) {
   try {
 #ifdef YAKSHA_LISP_EVAL_DEBUG_IS_PRINTED
@@ -707,24 +762,11 @@ yaksha_lisp_value *yaksha_envmap::eval_call_internal(
   // we already know params is an s-expr of symbols
   auto params_val = callable->list_[0];
   auto body = callable->list_[1];
-  // get each name of params to a vector
-  auto params = std::vector<std::string>{};
-  auto params_actual = std::vector<std::string>{};
-  for (auto p : params_val->expr_->list_) {
-    params.emplace_back(p->token_->token_);
-  }
-  auto param_len = params.size();
-  for (std::size_t j = 1; j < param_len + 1; j++) {
-    int i = (int) j - 1;
-    if (params[i] == "&" && i != param_len - 2) {
-      throw parsing_error{"& must be present only as penultimate param: " +
-                              callable->str_,
-                          "", 0, 0};
-    }
-    if (params[i] != "&") { params_actual.emplace_back(params[i]); }
-  }
+  // get each name of params (resolved once per parameter list)
+  compile_params(callable, params_val->expr_);
+  const auto &params_actual = params_val->expr_->params_;
   // check if args count is correct
-  bool variadic = params.size() > 1 && params[param_len - 2] == "&";
+  bool variadic = params_val->expr_->variadic_;
   if (variadic) {
     if (args.size() + 1 < params_actual.size()) {
       throw parsing_error{"too few arguments: " + callable->str_, "", 0, 0};
@@ -752,7 +794,7 @@ yaksha_lisp_value *yaksha_envmap::eval_call_internal(
     child_scope->set(params_actual[i - 1], e_args[i - 1]);
   }
   if (variadic && !params_actual.empty()) {
-    auto last_param = params_actual.back();
+    auto &last_param = params_actual.back();
     auto variadic_args = std::vector<yaksha_lisp_value *>{};
     for (std::size_t i = params_actual.size(); i < args.size() + 1; i++) {
       variadic_args.emplace_back(e_args[i - 1]);
@@ -762,7 +804,7 @@ yaksha_lisp_value *yaksha_envmap::eval_call_internal(
     v->list_ = variadic_args;
     child_scope->set(last_param, v);
   } else if (!params_actual.empty()) {
-    auto last_param = params_actual.back();
+    auto &last_param = params_actual.back();
     child_scope->set(last_param, e_args.back());
   }
   child_scope->push_closure(callable->closure_);
@@ -970,6 +1012,9 @@ void yaksha_envmap::setup_builtins() {
   set("system_disable_gc",
       create_builtin(this, "system_disable_gc",
                      yaksha_lisp_builtins::system_disable_gc_));
+  set("system_gc_stats",
+      create_builtin(this, "system_gc_stats",
+                     yaksha_lisp_builtins::system_gc_stats_));
   set("system_lock_root_scope",
       create_builtin(this, "system_lock_root_scope",
                      yaksha_lisp_builtins::system_lock_root_scope_));
@@ -1074,13 +1119,30 @@ yaksha_lisp_value *yaksha_envmap::values_map(yaksha_envmap *env) {
   for (auto &i : symbols_) { result->list_.emplace_back(i.second); }
   return result;
 }
+static std::uint64_t prelude_hash(const std::string &code) {
+  // FNV-1a, must match generate_prelude.py
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  for (unsigned char c : code) {
+    hash ^= c;
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
 void yaksha_envmap::setup_prelude() {
   LOG_COMP("create tokenizer to parse prelude");
   auto tok = mm_->create_tokenizer();
   LOG_COMP("created tokenizer to parse prelude");
-  tok->tokenize("prelude.yaksha_lisp", YAKSHA_LISP_PRELUDE,
-                mm_->get_yk_token_pool());
-  LOG_COMP("tokenized");
+  // Use pre-tokenized prelude unless prelude.h was edited by hand
+  if (YAKSHA_LISP_PRELUDE.size() == YAKSHA_LISP_PRELUDE_SIZE &&
+      prelude_hash(YAKSHA_LISP_PRELUDE) == YAKSHA_LISP_PRELUDE_HASH) {
+    tok->load_snapshot("prelude.yaksha_lisp", YAKSHA_LISP_PRELUDE_TOKENS,
+                       std::size(YAKSHA_LISP_PRELUDE_TOKENS));
+    LOG_COMP("loaded pre-tokenized prelude");
+  } else {
+    tok->tokenize("prelude.yaksha_lisp", YAKSHA_LISP_PRELUDE,
+                  mm_->get_yk_token_pool());
+    LOG_COMP("tokenized");
+  }
   if (!tok->errors_.empty()) {
     throw parsing_error{"prelude.yaksha_lisp failed to tokenize", "", 0, 0};
   }
@@ -1351,8 +1413,48 @@ size_t yaksha_macros::sweep() {
 #ifdef GC_POOL_DEBUG
   std::cout << "\n// GC total = " << freed << std::endl;
 #endif
+  auto pause = static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - gc_start_)
+          .count());
+  gc_stats_.collections_++;
+  gc_stats_.freed_ += freed;
+  gc_stats_.live_ = allocated_objects();
+  gc_stats_.pause_ns_total_ += pause;
+  gc_stats_.pause_ns_max_ = std::max(gc_stats_.pause_ns_max_, pause);
   return freed;
 }
+bool yaksha_macros::should_collect() {
+  if (!enable_gc_) { return false; }
+  if (allocated_objects() < gc_threshold()) {
+    gc_stats_.skipped_++;
+    return false;
+  }
+  return true;
+}
+yk_gc_stats yaksha_macros::gc_stats() {
+  auto stats = gc_stats_;
+  stats.allocated_ = allocated_objects();
+  stats.capacity_ = pool_capacity();
+  stats.threshold_ = gc_threshold();
+  return stats;
+}
+std::size_t yaksha_macros::gc_threshold() const {
+  // allow the heap to double (or grow by the minimum) before next collection
+  return gc_stats_.live_ +
+         std::max(static_cast<std::size_t>(YAKSHA_LISP_GC_MIN_THRESHOLD),
+                  gc_stats_.live_);
+}
+std::size_t yaksha_macros::allocated_objects() {
+  return value_pool_.allocated_ + env_pool_.allocated_ +
+         expr_pool_.allocated_ + token_pool_.allocated_ +
+         tokenizer_pool_.allocated_ + parser_pool_.allocated_;
+}
+std::size_t yaksha_macros::pool_capacity() {
+  return value_pool_.capacity() + env_pool_.capacity() +
+         expr_pool_.capacity() + token_pool_.capacity() +
+         tokenizer_pool_.capacity() + parser_pool_.capacity();
+}
 void yaksha_macros::execute(
     std::string &filepath, std::vector<token *> &lisp_code,
     std::unordered_map<std::string, import_stmt *> &imports) {
@@ -1377,15 +1479,14 @@ std::vector<token *> yaksha_macros::expand_dsl(
     std::string &dsl_macro_name, std::vector<token *> &dsl_macro_input,
     std::string imported_macro, token *macro_name) {
   yaksha_envmap *env;
-  if (imported_macro.empty()) {
-    env = validate_and_get_environment_root(filepath);
-  } else {
+  std::string root = filepath;
+  if (!imported_macro.empty()) {
     if (imports.find(imported_macro) == imports.end()) {
       throw parsing_error{"invalid import: " + imported_macro, filepath, 0, 0};
     }
-    env = validate_and_get_environment_root(
-        imports[imported_macro]->data_->filepath_.string());
+    root = imports[imported_macro]->data_->filepath_.string();
   }
+  env = validate_and_get_environment_root(root);
   auto callable = "yaksha#macro#dsl#" + dsl_macro_name;
   auto callable_value = env->get_map(callable, nullptr);
   if (callable_value == nullptr) {
@@ -1396,6 +1497,19 @@ std::vector<token *> yaksha_macros::expand_dsl(
         0,
     };
   }
+  // Pure macros (yk_register {dsl name func pure}) only depend on
+  // input token types and values, so the expansion can be reused
+  bool pure = env->has_map("pure#" + callable);
+  std::string cache_key{};
+  if (pure) {
+    cache_key =
+        dsl_cache_key(root, imported_macro, dsl_macro_name, dsl_macro_input);
+    auto cached = dsl_cache_.find(cache_key);
+    if (cached != dsl_cache_.end()) {
+      dsl_cache_hits_++;
+      return from_dsl_cache(cached->second, dsl_macro_input, macro_name);
+    }
+  }
   if (env->has_map(KEY_IMPORT_REFERENCE)) {
     env->set(KEY_IMPORT_REFERENCE, env->create_string(imported_macro), false);
   } else {
@@ -1409,7 +1523,77 @@ std::vector<token *> yaksha_macros::expand_dsl(
         callable_value,
         create_token_maps_from_yaksha_tokens(dsl_macro_input, env));
   }
-  return create_yaksha_tokens_from_result(dsl_macro_name, result, macro_name);
+  auto tokens =
+      create_yaksha_tokens_from_result(dsl_macro_name, result, macro_name);
+  if (pure) {
+    dsl_cache_[cache_key] = to_dsl_cache(tokens, dsl_macro_input, macro_name);
+  }
+  return tokens;
+}
+std::string yaksha_macros::dsl_cache_key(const std::string &root,
+                                         const std::string &imported_macro,
+                                         const std::string &dsl_macro_name,
+                                         const std::vector<token *> &input) {
+  // '\0' cannot be part of a file name or a token, use it as a separator
+  std::string key{};
+  key.reserve(root.size() + imported_macro.size() + dsl_macro_name.size() +
+              input.size() * 8);
+  key.append(root).push_back('\0');
+  key.append(imported_macro).push_back('\0');
+  key.append(dsl_macro_name).push_back('\0');
+  for (auto t : input) {
+    key.append(std::to_string(token_to_numeric_id(t->type_))).push_back(':');
+    key.append(t->token_).push_back('\0');
+  }
+  return key;
+}
+std::vector<yk_dsl_cached_token>
+yaksha_macros::to_dsl_cache(const std::vector<token *> &result,
+                            const std::vector<token *> &input,
+                            token *macro_name) {
+  std::vector<yk_dsl_cached_token> cached{};
+  cached.reserve(result.size());
+  for (auto t : result) {
+    int input_index = -1;
+    if (t->line_ == macro_name->line_ && t->pos_ == macro_name->pos_) {
+      input_index = YK_DSL_AT_MACRO_NAME;
+    } else {
+      for (int i = 0; i < (int) input.size(); i++) {
+        if (input[i]->line_ == t->line_ && input[i]->pos_ == t->pos_) {
+          input_index = i;
+          break;
+        }
+      }
+    }
+    cached.push_back({t->type_, t->token_, t->line_, t->pos_, input_index});
+  }
+  return cached;
+}
+std::vector<token *>
+yaksha_macros::from_dsl_cache(const std::vector<yk_dsl_cached_token> &cached,
+                              const std::vector<token *> &input,
+                              token *macro_name) {
+  std::vector<token *> result{};
+  result.reserve(cached.size());
+  for (auto &c : cached) {
+    auto t = yk_token_pool_.allocate();
+    t->type_ = c.type_;
+    t->token_ = c.token_;
+    t->original_ = c.token_;
+    t->file_ = macro_name->file_;
+    if (c.input_index_ == YK_DSL_AT_MACRO_NAME) {
+      t->line_ = macro_name->line_;
+      t->pos_ = macro_name->pos_;
+    } else if (c.input_index_ >= 0) {
+      t->line_ = input[c.input_index_]->line_;
+      t->pos_ = input[c.input_index_]->pos_;
+    } else {
+      t->line_ = c.line_;
+      t->pos_ = c.pos_;
+    }
+    result.emplace_back(t);
+  }
+  return result;
 }
 yaksha_envmap *
 yaksha_macros::validate_and_get_environment_root(const std::string &filepath) {
@@ -1601,6 +1785,7 @@ void yaksha_macros::init_env(
 }
 void yaksha_macros::gc_mark() {
   if (!enable_gc_) { return; }
+  gc_start_ = std::chrono::steady_clock::now();
   init_mark_sweep();
   builtins_root_->gc_mark();
   for (auto &root : roots_) { root.second->gc_mark(); }
@@ -1654,6 +1839,7 @@ void yaksha_lisp_expr::gc_mark(yk_memory_manager *memory_manager) {
   if (get_bit(&mark_, GC_POOL_MARK_BIT)) { return; }
   memory_manager->mark(this);
   memory_manager->mark(this->token_);
+  if (this->value_ != nullptr) { this->value_->gc_mark(memory_manager); }
   if (this->type_ == yaksha_lisp_expr_type::TERMINAL) {
     return;// nothing else to mark
   }
@@ -1669,6 +1855,14 @@ void yaksha_lisp_expr::clean_state() {
   this->type_ = yaksha_lisp_expr_type::TERMINAL;
   this->list_.clear();
   this->close_token_ = nullptr;
+  this->num_ = 0;
+  this->num_compiled_ = false;
+  this->value_ = nullptr;
+  this->args_.clear();
+  this->args_compiled_ = false;
+  this->params_.clear();
+  this->params_compiled_ = false;
+  this->variadic_ = false;
 }
 void yaksha_lisp_token::clean_state() {
   this->token_ = "";
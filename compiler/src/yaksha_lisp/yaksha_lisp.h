@@ -43,6 +43,8 @@
 #include "macro_processor.h"
 #include "tokenizer/token.h"
 #include "utilities/gc_pool.h"
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <map>
@@ -67,8 +69,18 @@
  *
  */
 static const char *const KEY_IMPORT_REFERENCE = "yk_import_ref";
+/**
+ * Mark and sweep runs only after this many objects (or as many as survived
+ * the previous collection, whichever is larger) are allocated since then.
+ * This keeps total GC work proportional to allocation instead of running a
+ * full mark and sweep of the heap after each top level expression.
+ */
+#ifndef YAKSHA_LISP_GC_MIN_THRESHOLD
+#define YAKSHA_LISP_GC_MIN_THRESHOLD 4096
+#endif
 namespace yaksha {
   struct yk_memory_manager;
+  struct yaksha_lisp_value;
   enum class yaksha_lisp_token_type {
     NUMBER,
     STRING,
@@ -111,6 +123,15 @@ namespace yaksha {
     std::uint8_t mark_{0};
     void clean_state();
   };
+  /**
+   * Statically initialized token, used for pre-tokenized code (prelude.h)
+   */
+  struct yaksha_lisp_token_snapshot {
+    yaksha_lisp_token_type type_;
+    const char *token_;
+    int line_;
+    int pos_;
+  };
   // ┌─┐─┐ ┬┌─┐┬─┐┌─┐┌─┐┌─┐┬┌─┐┌┐┌
   // ├┤ ┌┴┬┘├─┘├┬┘├┤ └─┐└─┐││ ││││
   // └─┘┴ └─┴  ┴└─└─┘└─┘└─┘┴└─┘┘└┘
@@ -119,6 +140,19 @@ namespace yaksha {
     std::vector<yaksha_lisp_expr *> list_;
     yaksha_lisp_token *token_;
     yaksha_lisp_token *close_token_;
+    // compiled form, filled once so repeated evaluation does not redo work
+    // num_ - parsed value of a NUMBER terminal (valid if num_compiled_)
+    // value_ - EXPR value wrapping this expression (shared, never mutated)
+    // args_ - EXPR values of list_[1..] (valid if args_compiled_)
+    // params_ - symbol names if this is a lambda parameter list
+    std::int64_t num_{0};
+    bool num_compiled_{false};
+    yaksha_lisp_value *value_{nullptr};
+    std::vector<yaksha_lisp_value *> args_{};
+    bool args_compiled_{false};
+    std::vector<std::string> params_{};
+    bool params_compiled_{false};
+    bool variadic_{false};
     // for pool
     yaksha_lisp_expr *next_{nullptr};
     yaksha_lisp_expr *prev_{nullptr};
@@ -136,6 +170,14 @@ namespace yaksha {
     void tokenize(std::string file, std::string code,
                   gc_pool<token> *token_pool);
     void tokenize(std::string file, std::vector<token *> &tokens);
+    /**
+     * Load tokens that were tokenized ahead of time (no tokenizer is used)
+     * @param file file name to use for tokens
+     * @param tokens pre-tokenized tokens, last one must be EOF
+     * @param count number of tokens
+     */
+    void load_snapshot(std::string file,
+                       const yaksha_lisp_token_snapshot *tokens, size_t count);
     std::vector<yaksha_lisp_token *> tokens_;
     std::vector<parsing_error> errors_;
     std::string file_;
@@ -212,6 +254,21 @@ private:
   // ┌┬┐┌─┐┌┬┐  ┌┬┐┌─┐┌┐┌┌─┐┌─┐┌─┐┬─┐
   // │││├┤ │││  │││├─┤│││├─┤│ ┬├┤ ├┬┘
   // ┴ ┴└─┘┴ ┴  ┴ ┴┴ ┴┘└┘┴ ┴└─┘└─┘┴└─
+  /**
+   * Counters collected by the memory manager, exposed to YakshaLisp
+   * via (system_gc_stats)
+   */
+  struct yk_gc_stats {
+    std::size_t collections_{0};// completed mark and sweep cycles
+    std::size_t skipped_{0};    // cycles skipped (allocation below threshold)
+    std::size_t freed_{0};      // total objects freed
+    std::size_t live_{0};       // objects that survived the last collection
+    std::size_t allocated_{0};  // objects currently allocated
+    std::size_t capacity_{0};   // objects the pools can hold without growing
+    std::size_t threshold_{0};  // allocated count that triggers a collection
+    std::uint64_t pause_ns_total_{0};
+    std::uint64_t pause_ns_max_{0};
+  };
   struct yk_memory_manager {
     virtual ~yk_memory_manager() = default;
     virtual yaksha_lisp_value *create_value() = 0;
@@ -228,6 +285,8 @@ private:
     virtual void mark(yaksha_lisp_tokenizer *tokenizer) = 0;
     virtual void mark(yaksha_lisp_parser *parser) = 0;
     virtual size_t sweep() = 0;
+    virtual bool should_collect() = 0;
+    virtual yk_gc_stats gc_stats() = 0;
     virtual gc_pool<token> *get_yk_token_pool() = 0;
     virtual void gc_mark() = 0;
     virtual void enable_gc() = 0;
@@ -287,6 +346,7 @@ private:
     yaksha_lisp_value *create_number(std::int64_t num);
     yaksha_lisp_value *create_string(const std::string &str);
     yaksha_lisp_value *create_expr_val(yaksha_lisp_expr *exp);
+    yaksha_lisp_value *expr_val(yaksha_lisp_expr *exp);
     yaksha_lisp_value *create_val();
     static bool is_truthy(yaksha_lisp_value *val);
     static std::string to_string(yaksha_lisp_value *value);
@@ -324,6 +384,10 @@ private:
     yaksha_lisp_value *get_internal(const std::string &symbol);
     void increase_indent();
     void decrease_indent();
+    const std::vector<yaksha_lisp_value *> &
+    compile_args(yaksha_lisp_expr *exp);
+    static void compile_params(yaksha_lisp_value *callable,
+                               yaksha_lisp_expr *params);
     static std::string derive_key(yaksha_lisp_value *key);
     bool locked_down_env_{false};
     void define_internal(const std::string &symbol, yaksha_lisp_value *value);
@@ -356,6 +420,21 @@ private:
   };
   static std::vector<yaksha_lisp_value *>
   eval_args(const std::vector<yaksha_lisp_value *> &args, yaksha_envmap *env);
+  /**
+   * Token produced by a pure DSL macro, kept in yaksha_macros::dsl_cache_
+   * Positions are stored relative to the invocation so a cache hit can be
+   * placed at a different location
+   */
+  struct yk_dsl_cached_token {
+    token_type type_;
+    std::string token_;
+    int line_;
+    int pos_;
+    // index of dsl!{} input token this was copied from,
+    // YK_DSL_AT_MACRO_NAME if it was placed at macro name, or -1 if neither
+    int input_index_;
+  };
+  static const int YK_DSL_AT_MACRO_NAME = -2;
   // ┌┬┐┌─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌─┐┌─┐┌─┐┌─┐┬┌┐┌┌─┐
   // │││├─┤│  ├┬┘│ │  ├─┘├┬┘│ ││  ├┤ └─┐└─┐│││││ ┬
   // ┴ ┴┴ ┴└─┘┴└─└─┘  ┴  ┴└─└─┘└─┘└─┘└─┘└─┘┴┘└┘└─┘
@@ -379,6 +458,8 @@ private:
     void mark(yaksha_lisp_tokenizer *tokenizer) override;
     void mark(yaksha_lisp_parser *parser) override;
     size_t sweep() override;
+    bool should_collect() override;
+    yk_gc_stats gc_stats() override;
     void
     execute(std::string &filepath, std::vector<token *> &lisp_code,
             std::unordered_map<std::string, import_stmt *> &imports) override;
@@ -402,6 +483,11 @@ private:
 
 private:
     bool enable_gc_{false};
+    yk_gc_stats gc_stats_{};
+    std::chrono::steady_clock::time_point gc_start_{};
+    std::size_t allocated_objects();
+    std::size_t pool_capacity();
+    std::size_t gc_threshold() const;
     gc_pool<yaksha_lisp_value> value_pool_{};
     gc_pool<yaksha_envmap> env_pool_{};
     gc_pool<yaksha_lisp_expr> expr_pool_{};
@@ -411,6 +497,13 @@ private:
     gc_pool<token> yk_token_pool_{};
     yaksha_envmap *builtins_root_{nullptr};
     std::unordered_map<std::string, yaksha_envmap *> roots_{};
+    /**
+     * Expansions of DSL macros registered as pure, keyed by macro identity
+     * (root file, import alias, name) and input token types/values
+     */
+    std::unordered_map<std::string, std::vector<yk_dsl_cached_token>>
+        dsl_cache_{};
+    std::size_t dsl_cache_hits_{0};
     std::vector<token *>
     create_yaksha_tokens_from_result(const std::string &dsl_macro_name,
                                      yaksha_lisp_value *result,
@@ -418,6 +511,16 @@ private:
     std::vector<yaksha_lisp_value *>
     create_token_maps_from_yaksha_tokens(std::vector<token *> &dsl_macro_input,
                                          yaksha_envmap *env);
+    static std::string dsl_cache_key(const std::string &root,
+                                     const std::string &imported_macro,
+                                     const std::string &dsl_macro_name,
+                                     const std::vector<token *> &input);
+    std::vector<yk_dsl_cached_token>
+    to_dsl_cache(const std::vector<token *> &result,
+                 const std::vector<token *> &input, token *macro_name);
+    std::vector<token *>
+    from_dsl_cache(const std::vector<yk_dsl_cached_token> &cached,
+                   const std::vector<token *> &input, token *macro_name);
   };
   // ┌─┐┬─┐┬┌┐┌┌┬┐┬┌┐┌┌─┐
   // ├─┘├┬┘││││ │ │││││ ┬
@@ -1661,6 +1661,30 @@ yaksha_lisp_value *yaksha_lisp_builtins::system_disable_gc_(
   env->gc_disable();
   return env->create_nil();
 }
+yaksha_lisp_value *yaksha_lisp_builtins::system_gc_stats_(
+    const std::vector<yaksha_lisp_value *> &args, yaksha_envmap *env) {
+  if (!args.empty()) {
+    throw parsing_error{"system_gc_stats takes no arguments", "", 0, 0};
+  }
+  auto stats = env->get_memory_manager()->gc_stats();
+  auto result = env->create_val();
+  result->type_ = yaksha_lisp_value_type::MAP;
+  result->closure_ = env->get_memory_manager()->create_env();
+  auto m = result->closure_;
+  auto num = [env](std::uint64_t n) {
+    return env->create_number((std::int64_t) n);
+  };
+  m->set_map("collections", num(stats.collections_));
+  m->set_map("skipped", num(stats.skipped_));
+  m->set_map("freed", num(stats.freed_));
+  m->set_map("live", num(stats.live_));
+  m->set_map("allocated", num(stats.allocated_));
+  m->set_map("capacity", num(stats.capacity_));
+  m->set_map("threshold", num(stats.threshold_));
+  m->set_map("pause_us_total", num(stats.pause_ns_total_ / 1000));
+  m->set_map("pause_us_max", num(stats.pause_ns_max_ / 1000));
+  return result;
+}
 yaksha_lisp_value *yaksha_lisp_builtins::system_enable_print_(
     const std::vector<yaksha_lisp_value *> &args, yaksha_envmap *env) {
   if (!args.empty()) {
@@ -284,6 +284,9 @@ namespace yaksha {
     system_disable_gc_(const std::vector<yaksha_lisp_value *> &args,
                        yaksha_envmap *env);
     static yaksha_lisp_value *
+    system_gc_stats_(const std::vector<yaksha_lisp_value *> &args,
+                     yaksha_envmap *env);
+    static yaksha_lisp_value *
     system_enable_print_(const std::vector<yaksha_lisp_value *> &args,
                          yaksha_envmap *env);
     static yaksha_lisp_value *
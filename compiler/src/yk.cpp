@@ -42,6 +42,9 @@
  * Wraps - compiler, dump, viz, reload, lisp commands
  */
 #include "utilities/colours.h"
+#include <filesystem>
+#include <fstream>
+#include <string_view>
 // ============================================================================
 // compiler_main(int: argc, char** argv)
 #define PROGRAM_NAME "yaksha compile"
@@ -119,6 +122,90 @@ yk_compile_result compile(char *main_file, size_t main_file_len,
   }
   return {compile_result, result.code_.size(), compile_result != nullptr};
 }
+// In process compilation (used by carpntr when it is linked in to yaksha)
+// Compiled code is kept here and written to files without copying it out
+struct yk_compilation {
+  yaksha::comp_result result_;
+  std::string header_;
+};
+yk_compilation *compile_in_memory(char *main_file, size_t main_file_len,
+                                  char *library_path, size_t library_path_len,
+                                  size_t max_units) {
+  yaksha::multifile_compiler mc{};
+  yaksha::codegen_c cg{};
+  cg.max_units_ = max_units;
+  std::string main_file_str{main_file, main_file_len};
+  std::string lib_path_str{library_path, library_path_len};
+  auto *compilation = new (std::nothrow) yk_compilation{};
+  if (compilation == nullptr) { return nullptr; }
+  compilation->result_ = mc.compile(main_file_str, lib_path_str, &cg);
+  if (compilation->result_.failed_) {
+    delete compilation;
+    return nullptr;
+  }
+  const std::string &code = compilation->result_.code_;
+  compilation->header_ = code.substr(0, code.find('\n'));
+  return compilation;
+}
+// First line of compiled code (// YK:runtime,features#)
+const char *compilation_header(yk_compilation *compilation) {
+  return compilation->header_.c_str();
+}
+static bool write_parts(const std::filesystem::path &file_path,
+                        std::initializer_list<std::string_view> parts) {
+  std::ofstream out(file_path, std::ios::binary);
+  for (auto part : parts) {
+    out.write(part.data(), static_cast<std::streamsize>(part.size()));
+  }
+  return out.good();
+}
+// Write compiled code to directory/name.c, if code is split to translation
+//   units shared code is written to directory/name.h and each unit to
+//   directory/name_N.c
+// prefix (declarations) is written at the start of name.c/name.h,
+//   unit_prefix (definitions) after prefix in name.c or only in name_1.c
+// Number of name_N.c files written is returned, -1 if failed
+int write_compilation(yk_compilation *compilation, char *prefix,
+                      size_t prefix_len, char *unit_prefix,
+                      size_t unit_prefix_len, char *directory,
+                      size_t directory_len, char *name, size_t name_len) {
+  const std::string_view code{compilation->result_.code_};
+  const std::string_view prefix_sv{prefix, prefix_len};
+  const std::string_view unit_prefix_sv{unit_prefix, unit_prefix_len};
+  const std::string_view sep{YAKSHA_C_UNIT_SEPARATOR};
+  const std::filesystem::path dir{std::string{directory, directory_len}};
+  const std::string base{name, name_len};
+  auto unit_start = code.find(sep);
+  if (unit_start == std::string_view::npos) {
+    return write_parts(dir / (base + ".c"),
+                       {prefix_sv, unit_prefix_sv, code, "\n"})
+               ? 0
+               : -1;
+  }
+  const std::string header_name = base + ".h";
+  if (!write_parts(dir / header_name,
+                   {"#ifndef YK__PROGRAM_CODE_H\n#define YK__PROGRAM_CODE_H\n",
+                    prefix_sv, code.substr(0, unit_start), "\n#endif\n"})) {
+    return -1;
+  }
+  const std::string include = "#include \"" + header_name + "\"\n";
+  int units = 0;
+  while (unit_start != std::string_view::npos) {
+    auto begin = unit_start + sep.size();
+    unit_start = code.find(sep, begin);
+    auto unit = code.substr(begin, unit_start == std::string_view::npos
+                                       ? std::string_view::npos
+                                       : unit_start - begin);
+    units++;
+    if (!write_parts(dir / (base + "_" + std::to_string(units) + ".c"),
+                     {include, units == 1 ? unit_prefix_sv : "", unit,
+                      "\n"})) {
+      return -1;
+    }
+  }
+  return units;
+}
+void del_compilation(yk_compilation *compilation) { delete compilation; }
 void display_banner() {
   std::cout << colours::red("                                 \n"
                             " __ __ _____ _____     _   _____ \n"
@@ -142,8 +229,10 @@ void display_help() {
   std::cout << "yaksha ast file_path.yaka [libs_path]\n";
   std::cout << colours::green(
       " # Compile Yaksha to a JSON representation of the AST\n");
-  std::cout << "yaksha reload dll_path/dll.so\n";
-  std::cout << colours::green(" # Run given hot-reload .dll/.dylib/.so file\n");
+  std::cout << "yaksha reload [-w src_dir] [-b build_command] dll_path/dll.so\n";
+  std::cout << colours::green(
+      " # Run given hot-reload .dll/.dylib/.so file, reload it when it is "
+      "rebuilt (-w: rebuild when .yaka files in src_dir change)\n");
   std::cout << "yaksha viz file_path.yaka\n";
   std::cout << colours::green(" # Visualize given file as HTML structure\n");
   std::cout << "yaksha dump file_path.yaka\n";
@@ -11,7 +11,7 @@ void yy__use_a(struct yy__A*);
 int32_t yy__main();
 struct yy__A* yy__new_a() 
 {
-    struct yy__A* yy__x = calloc(1, sizeof(struct yy__A));
+    struct yy__A* yy__x = yk__obj_alloc(struct yy__A);
     yy__x->yy__a = yk__sdsnewlen("hello world", 11);
     struct yy__A* t__0 = yy__x;
     return t__0;
@@ -19,7 +19,7 @@ struct yy__A* yy__new_a()
 void yy__del_a(struct yy__A* yy__x) 
 {
     yk__sdsfree(yy__x->yy__a);
-    free(yy__x);
+    yk__obj_free(yy__x);
     return;
 }
 yk__sds yy__get_a(struct yy__A* yy__x) 
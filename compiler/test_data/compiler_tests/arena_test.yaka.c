@@ -0,0 +1,84 @@
+// YK:arena#
+#include "yk__lib.h"
+struct yy__Request;
+struct yy__Request {
+    yk__sds yy__path;
+    yk__sds* yy__parts;
+};
+yk__sds* yy__strings_split(struct yk__bstr, struct yk__bstr);
+struct yy__Request* yy__make_request(yk__sds);
+int32_t yy__handle(yk__sds);
+int32_t yy__main();
+yk__sds* yy__strings_split(struct yk__bstr nn__value, struct yk__bstr nn__sep) 
+{
+    int count;
+    yk__sds* result = yk__sdssplitlen(yk__bstr_get_reference(nn__value), yk__bstr_len(nn__value),
+            yk__bstr_get_reference(nn__sep), yk__bstr_len(nn__sep), &count);
+    if (NULL == result) {
+        return NULL;
+    }
+    yk__sds* newarr = NULL;
+    for (int i = 0; i < count; i++) {
+        yk__arrput(newarr, result[i]);
+    }
+    yk__sds_free(result); // free array itself.
+    return newarr;
+}
+struct yy__Request* yy__make_request(yk__sds yy__path) 
+{
+    struct yy__Request* yy__r = yk__obj_alloc(struct yy__Request);
+    yy__r->yy__path = yk__sdsdup(yy__path);
+    yy__r->yy__parts = yy__strings_split(yk__bstr_h(yy__path), yk__bstr_s("/", 1));
+    struct yy__Request* t__3 = yy__r;
+    yk__sdsfree(yy__path);
+    return t__3;
+}
+int32_t yy__handle(yk__sds yy__path) 
+{
+    struct yk__arena* t__4 = yk__arena_begin();
+    struct yy__Request* yy__r = yy__make_request(yk__sdsdup(yy__path));
+    int32_t yy__total = INT32_C(0);
+    yk__sds* yy__0t = yy__r->yy__parts;
+    int32_t yy__1t = INT32_C(0);
+    int32_t yy__2t = yk__arrlen(yy__0t);
+    while (true)
+    {
+        if (!(yy__1t < yy__2t))
+        {
+            break;
+        }
+        yk__sds t__5 = yk__concat_lit_sds("part:", 5, (yy__0t[yy__1t]));
+        yk__sds yy__msg = yk__sdsdup(t__5);
+        yy__total += yk__sdslen(yy__msg);
+        yy__1t += INT32_C(1);
+    }
+    if (yy__total == INT32_C(0))
+    {
+        yk__printlnint((intmax_t)yy__total);
+        yk__arena_end(t__4);
+        yk__sdsfree(yy__path);
+        return INT32_C(0);
+    }
+    int32_t t__6 = yk__arrlen(yy__r->yy__parts);
+    yk__printlnint((intmax_t)yy__total);
+    yk__arena_end(t__4);
+    yk__sdsfree(yy__path);
+    return t__6;
+}
+int32_t yy__main() 
+{
+    int32_t yy__x = INT32_C(0);
+    while (true)
+    {
+        if (!(((yy__x < INT32_C(3)))))
+        {
+            break;
+        }
+        yk__printlnint((intmax_t)yy__handle(yk__sdsnewlen("a/bb/ccc", 8)));
+        yy__x += INT32_C(1);
+    }
+    return INT32_C(0);
+}
+#if defined(YK__MINIMAL_MAIN)
+int main(void) { return yy__main(); }
+#endif
\ No newline at end of file
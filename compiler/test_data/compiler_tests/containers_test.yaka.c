@@ -0,0 +1,148 @@
+// YK:containers#
+#include "yk__lib.h"
+#define yy__strset_StrSet struct yk__strset*
+#define yy__strset_new yk__strset_new
+#define yy__strset_destroy yk__strset_del
+#define yy__strset_add yk__strset_add
+#define yy__strset_has yk__strset_has
+#define yy__strset_size yk__strset_len
+#define yy__ordmap_OrdMap struct yk__ordmap*
+#define yy__ordmap_Iter struct yk__ordmap_iter*
+#define yy__ordmap_new yk__ordmap_new
+#define yy__ordmap_destroy yk__ordmap_del
+#define yy__ordmap_put yk__ordmap_put
+#define yy__ordmap_remove yk__ordmap_remove
+#define yy__ordmap_size yk__ordmap_len
+#define yy__ordmap_range yk__ordmap_range
+#define yy__ordmap_next yk__ordmap_iter_next
+#define yy__ordmap_iter_key yk__ordmap_iter_key
+#define yy__ordmap_destroy_iter yk__ordmap_iter_del
+#define yy__intset_IntSet struct yk__i64set*
+#define yy__intset_new yk__i64set_new
+#define yy__intset_destroy yk__i64set_del
+#define yy__intset_add yk__i64set_add
+#define yy__intset_has yk__i64set_has
+#define yy__intset_remove yk__i64set_remove
+#define yy__intset_size yk__i64set_len
+#define yy__heap_Heap struct yk__heap*
+#define yy__heap_new yk__heap_new
+#define yy__heap_destroy yk__heap_del
+#define yy__heap_push yk__heap_push
+#define yy__heap_pop yk__heap_pop
+#define yy__heap_size yk__heap_len
+#define yy__deque_Deque struct yk__deque*
+#define yy__deque_new yk__deque_new
+#define yy__deque_destroy yk__deque_del
+#define yy__deque_push_back yk__deque_push_back
+#define yy__deque_push_front yk__deque_push_front
+#define yy__deque_pop_back yk__deque_pop_back
+#define yy__deque_pop_front yk__deque_pop_front
+bool yy__by_last_digit(int64_t, int64_t);
+void yy__sets();
+void yy__ordered();
+void yy__queues();
+int32_t yy__main();
+bool yy__by_last_digit(int64_t yy__a, int64_t yy__b) 
+{
+    bool t__0 = (((yy__a % INT64_C(10))) < ((yy__b % INT64_C(10))));
+    return t__0;
+}
+void yy__sets() 
+{
+    yy__intset_IntSet yy__s = yy__intset_new();
+    int64_t yy__i = INT64_C(0);
+    while (true)
+    {
+        if (!(((yy__i < INT64_C(100)))))
+        {
+            break;
+        }
+        yy__intset_add(yy__s, (yy__i % INT64_C(7)));
+        yy__i += INT64_C(1);
+    }
+    yk__printstr("intset size=");
+    yk__printlnint((intmax_t)yy__intset_size(yy__s));
+    yy__intset_remove(yy__s, INT64_C(3));
+    yk__printstr("has 3=");
+    yk__printlnstr((yy__intset_has(yy__s, INT64_C(3))) ? "True" : "False");
+    yy__strset_StrSet yy__names = yy__strset_new();
+    yy__strset_add(yy__names, yk__bstr_s("apple", 5));
+    yy__strset_add(yy__names, yk__bstr_s("banana", 6));
+    yy__strset_add(yy__names, yk__bstr_s("apple", 5));
+    yk__printstr("strset size=");
+    yk__printlnint((intmax_t)yy__strset_size(yy__names));
+    yk__printstr("has banana=");
+    yk__printlnstr((yy__strset_has(yy__names, yk__bstr_s("banana", 6))) ? "True" : "False");
+    yy__strset_destroy(yy__names);
+    yy__intset_destroy(yy__s);
+    return;
+}
+void yy__ordered() 
+{
+    yy__ordmap_OrdMap yy__m = yy__ordmap_new();
+    int64_t yy__i = INT64_C(0);
+    while (true)
+    {
+        if (!(((yy__i < INT64_C(1000)))))
+        {
+            break;
+        }
+        yy__ordmap_put(yy__m, (((yy__i * INT64_C(37))) % INT64_C(1000)), yy__i);
+        yy__i += INT64_C(1);
+    }
+    yy__ordmap_remove(yy__m, INT64_C(15));
+    yk__printstr("ordmap size=");
+    yk__printlnint((intmax_t)yy__ordmap_size(yy__m));
+    yy__ordmap_Iter yy__it = yy__ordmap_range(yy__m, INT64_C(10), INT64_C(20));
+    while (true)
+    {
+        if (!((yy__ordmap_next(yy__it))))
+        {
+            break;
+        }
+        yk__printint((intmax_t)yy__ordmap_iter_key(yy__it));
+        yk__printstr(" ");
+    }
+    yk__printlnstr("");
+    yy__ordmap_destroy_iter(yy__it);
+    yy__ordmap_destroy(yy__m);
+    return;
+}
+void yy__queues() 
+{
+    yy__heap_Heap yy__h = yy__heap_new(yy__by_last_digit);
+    yy__heap_push(yy__h, INT64_C(25));
+    yy__heap_push(yy__h, INT64_C(31));
+    yy__heap_push(yy__h, INT64_C(19));
+    yy__heap_push(yy__h, INT64_C(42));
+    while (true)
+    {
+        if (!(((yy__heap_size(yy__h) > INT64_C(0)))))
+        {
+            break;
+        }
+        yk__printint((intmax_t)yy__heap_pop(yy__h));
+        yk__printstr(" ");
+    }
+    yk__printlnstr("");
+    yy__deque_Deque yy__d = yy__deque_new();
+    yy__deque_push_back(yy__d, INT64_C(2));
+    yy__deque_push_back(yy__d, INT64_C(3));
+    yy__deque_push_front(yy__d, INT64_C(1));
+    yk__printint((intmax_t)yy__deque_pop_front(yy__d));
+    yk__printstr(" ");
+    yk__printlnint((intmax_t)yy__deque_pop_back(yy__d));
+    yy__deque_destroy(yy__d);
+    yy__heap_destroy(yy__h);
+    return;
+}
+int32_t yy__main() 
+{
+    yy__sets();
+    yy__ordered();
+    yy__queues();
+    return INT32_C(0);
+}
+#if defined(YK__MINIMAL_MAIN)
+int main(void) { return yy__main(); }
+#endif
\ No newline at end of file
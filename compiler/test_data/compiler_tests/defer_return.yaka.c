@@ -14,11 +14,11 @@ int32_t yy__f2(struct yy__B* yy__b)
 }
 int32_t yy__f1() 
 {
-    struct yy__B* yy__b = calloc(1, sizeof(struct yy__B));
+    struct yy__B t__1 = {0};
+    struct yy__B* yy__b = (&t__1);
     yy__b->yy__a = INT32_C(4);
-    int32_t t__1 = yy__f2(yy__b);
-    free(yy__b);
-    return t__1;
+    int32_t t__2 = yy__f2(yy__b);
+    return t__2;
 }
 int32_t yy__main() 
 {
@@ -21,7 +21,7 @@ void set_global_state(void* state) {
 ;
 int32_t yy__main() 
 {
-    struct yy__MyState* yy__state = calloc(1, sizeof(struct yy__MyState));
+    struct yy__MyState* yy__state = yk__obj_alloc(struct yy__MyState);
     yy__state->yy__x = INT32_C(1);
     yy__state->yy__y = INT32_C(2);
     yy__set_global_state(yy__state);
@@ -31,7 +31,7 @@ int32_t yy__main()
     yk__printlnint((intmax_t)yy__get_global_state()->yy__y);
     yy__state->yy__x = INT32_C(5);
     yk__printlnint((intmax_t)yy__get_global_state()->yy__x);
-    free(yy__state);
+    yk__obj_free(yy__state);
     return INT32_C(0);
 }
 #if defined(YK__MINIMAL_MAIN)
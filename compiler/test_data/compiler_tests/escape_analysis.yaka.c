@@ -0,0 +1,73 @@
+// YK
+#include "yk__lib.h"
+struct yy__Holder;
+struct yy__Vec;
+struct yy__Holder {
+    struct yy__Vec* yy__v;
+};
+struct yy__Vec {
+    float yy__x;
+    float yy__y;
+};
+float yy__length_sq(struct yy__Vec*);
+float yy__scaled_length_sq(struct yy__Vec*, float);
+void yy__keep(struct yy__Holder*, struct yy__Vec*);
+struct yy__Vec* yy__make_vec(float, float);
+int32_t yy__main();
+float yy__length_sq(struct yy__Vec* yy__v) 
+{
+    float t__0 = ((yy__v->yy__x * yy__v->yy__x) + (yy__v->yy__y * yy__v->yy__y));
+    return t__0;
+}
+float yy__scaled_length_sq(struct yy__Vec* yy__v, float yy__s) 
+{
+    float t__1 = (yy__length_sq(yy__v) * yy__s);
+    return t__1;
+}
+void yy__keep(struct yy__Holder* yy__h, struct yy__Vec* yy__v) 
+{
+    yy__h->yy__v = yy__v;
+    return;
+}
+struct yy__Vec* yy__make_vec(float yy__x, float yy__y) 
+{
+    struct yy__Vec* yy__v = yk__obj_alloc(struct yy__Vec);
+    yy__v->yy__x = yy__x;
+    yy__v->yy__y = yy__y;
+    struct yy__Vec* t__2 = yy__v;
+    return t__2;
+}
+int32_t yy__main() 
+{
+    float yy__total = 0.0f;
+    int32_t yy__i = INT32_C(0);
+    while (true)
+    {
+        if (!(((yy__i < INT32_C(10)))))
+        {
+            break;
+        }
+        struct yy__Vec t__4 = {0};
+        struct yy__Vec* t__3 = (&t__4);
+        t__3->yy__x = (1.0f);
+        t__3->yy__y = (2.0f);
+        struct yy__Vec* yy__a = t__3;
+        yy__total += yy__scaled_length_sq(yy__a, 2.0f);
+        yy__i += INT32_C(1);
+    }
+    struct yy__Vec t__5 = {0};
+    struct yy__Vec* yy__b = (&t__5);
+    yy__b->yy__x = 3.0f;
+    yy__total += yy__length_sq(yy__b);
+    struct yy__Vec* yy__c = yy__make_vec(1.0f, 1.0f);
+    struct yy__Holder t__6 = {0};
+    struct yy__Holder* yy__h = (&t__6);
+    yy__keep(yy__h, yy__c);
+    yy__total += yy__length_sq(yy__h->yy__v);
+    yk__obj_free(yy__h->yy__v);
+    yk__printlndbl(yy__total);
+    return INT32_C(0);
+}
+#if defined(YK__MINIMAL_MAIN)
+int main(void) { return yy__main(); }
+#endif
\ No newline at end of file
@@ -0,0 +1,133 @@
+// YK:csv,json#
+#include "yk__lib.h"
+#define yy__c_CStr char*
+#define yy__numbers_cstr2i atoi
+#define yy__json_Json struct yk__json*
+#define yy__json_destroy yk__json_del
+#define yy__json_valid(nn__doc) (NULL != nn__doc && NULL == yk__json_error(nn__doc))
+#define yy__json_root yk__json_root
+#define yy__json_first yk__json_first
+#define yy__json_next yk__json_next
+#define yy__json_raw yk__json_raw
+#define yy__json_as_str yk__json_str
+#define yy__json_as_i64 yk__json_i64
+#define yy__csv_Csv struct yk__csv*
+#define yy__csv_destroy yk__csv_del
+#define yy__csv_rows yk__csv_rows
+#define yy__csv_field_str yk__csv_field_str
+int32_t yy__numbers_s2i(yk__sds);
+yy__json_Json yy__json_parse(struct yk__bstr);
+yk__sds yy__json_error(yy__json_Json);
+int64_t yy__json_get(yy__json_Json, int64_t, struct yk__bstr);
+yy__csv_Csv yy__csv_parse(struct yk__bstr);
+void yy__read_json();
+void yy__read_csv();
+int32_t yy__main();
+int32_t yy__numbers_s2i(yk__sds yy__numbers_s) 
+{
+    int32_t t__0 = yy__numbers_cstr2i(((yy__c_CStr)yy__numbers_s));
+    yk__sdsfree(yy__numbers_s);
+    return t__0;
+}
+yy__json_Json yy__json_parse(struct yk__bstr nn__data) 
+{
+    return yk__json_parse(yk__bstr_get_reference(nn__data), yk__bstr_len(nn__data));
+}
+yk__sds yy__json_error(yy__json_Json nn__doc) 
+{
+    if (NULL == nn__doc) return yk__sdsnew("out of memory");
+    const char* err = yk__json_error(nn__doc);
+    return yk__sdsnew(NULL == err ? "" : err);
+}
+int64_t yy__json_get(yy__json_Json nn__doc, int64_t nn__obj, struct yk__bstr nn__name) 
+{
+    return yk__json_get(nn__doc, nn__obj, yk__bstr_get_reference(nn__name), yk__bstr_len(nn__name));
+}
+yy__csv_Csv yy__csv_parse(struct yk__bstr nn__data) 
+{
+    return yk__csv_parse(yk__bstr_get_reference(nn__data), yk__bstr_len(nn__data), ',');
+}
+void yy__read_json() 
+{
+    yy__json_Json yy__doc = yy__json_parse(yk__bstr_s("{\"name\": \"yaksha\", \"langs\": [\"c\", \"yaksha\"], \"stars\": 42, \"ok\": true}", 69));
+    if (!(yy__json_valid(yy__doc)))
+    {
+        yk__sds t__0 = yy__json_error(yy__doc);
+        yk__printlnstr(t__0);
+        yy__json_destroy(yy__doc);
+        yk__sdsfree(t__0);
+        return;
+        yk__sdsfree(t__0);
+    }
+    int64_t yy__root = yy__json_root(yy__doc);
+    yk__printstr("name=");
+    yk__sds t__1 = yy__json_as_str(yy__doc, yy__json_get(yy__doc, yy__root, yk__bstr_s("name", 4)));
+    yk__printlnstr(t__1);
+    yk__printstr("stars=");
+    yk__printlnint((intmax_t)yy__json_as_i64(yy__doc, yy__json_get(yy__doc, yy__root, yk__bstr_s("stars", 5))));
+    int64_t yy__langs = yy__json_get(yy__doc, yy__root, yk__bstr_s("langs", 5));
+    int64_t yy__item = yy__json_first(yy__doc, yy__langs);
+    while (true)
+    {
+        if (!(((yy__item >= INT64_C(0)))))
+        {
+            break;
+        }
+        if (yk__cmp_bstr_lit(yy__json_raw(yy__doc, yy__item), "yaksha", 6) == 0)
+        {
+            yk__printstr("*");
+        }
+        yk__sds t__2 = yy__json_as_str(yy__doc, yy__item);
+        yk__printstr(t__2);
+        yk__printstr(" ");
+        yy__item = yy__json_next(yy__doc, yy__item);
+        yk__sdsfree(t__2);
+    }
+    yk__printlnstr("");
+    yy__json_Json yy__bad = yy__json_parse(yk__bstr_s("[1, 2", 5));
+    yk__printstr("error=");
+    yk__sds t__3 = yy__json_error(yy__bad);
+    yk__printlnstr(t__3);
+    yy__json_destroy(yy__bad);
+    yy__json_destroy(yy__doc);
+    yk__sdsfree(t__3);
+    yk__sdsfree(t__1);
+    return;
+}
+void yy__read_csv() 
+{
+    yy__csv_Csv yy__data = yy__csv_parse(yk__bstr_s("name,score\n\"Doe, J\",10\nyaksha,20\n", 33));
+    int64_t yy__total = INT64_C(0);
+    int64_t yy__row = INT64_C(1);
+    while (true)
+    {
+        if (!(((yy__row < yy__csv_rows(yy__data)))))
+        {
+            break;
+        }
+        yk__sds t__4 = yy__csv_field_str(yy__data, yy__row, INT64_C(0));
+        yk__printstr(t__4);
+        yk__printstr(";");
+        yk__sds t__5 = yy__csv_field_str(yy__data, yy__row, INT64_C(1));
+        yk__sds yy__score = yk__sdsdup(t__5);
+        yy__total += ((int64_t)yy__numbers_s2i(yk__sdsdup(yy__score)));
+        yy__row += INT64_C(1);
+        yk__sdsfree(yy__score);
+        yk__sdsfree(t__5);
+        yk__sdsfree(t__4);
+    }
+    yk__printlnstr("");
+    yk__printstr("total=");
+    yk__printlnint((intmax_t)yy__total);
+    yy__csv_destroy(yy__data);
+    return;
+}
+int32_t yy__main() 
+{
+    yy__read_json();
+    yy__read_csv();
+    return INT32_C(0);
+}
+#if defined(YK__MINIMAL_MAIN)
+int main(void) { return yy__main(); }
+#endif
\ No newline at end of file
@@ -10,7 +10,8 @@ struct yy__My {
 int32_t yy__main();
 int32_t yy__main() 
 {
-    struct yy__My* t__0 = calloc(1, sizeof(struct yy__My));
+    struct yy__My t__1 = {0};
+    struct yy__My* t__0 = (&t__1);
     t__0->yy__a = (INT32_C(0));
     t__0->yy__b = (INT32_C(0));
     t__0->yy__c = (0);
@@ -55,8 +56,8 @@ int32_t yy__main()
     {
         yy__d += INT32_C(10000);
     }
-    int32_t t__1 = yy__d;
-    return t__1;
+    int32_t t__2 = yy__d;
+    return t__2;
 }
 #if defined(YK__MINIMAL_MAIN)
 int main(void) { return yy__main(); }
@@ -57,7 +57,7 @@ struct yy__State {
 int32_t yy__main();
 int32_t yy__main() 
 {
-    struct yy__State* yy__state = calloc(1, sizeof(struct yy__State));
+    struct yy__State* yy__state = yk__obj_alloc(struct yy__State);
     yy__state->yy__width = INT32_C(800);
     yy__state->yy__height = INT32_C(600);
     yy__state->yy__frame_count = ((uint64_t)(UINT8_C(0)));
@@ -83,7 +83,7 @@ int32_t yy__main()
     yy__state->yy__player.yy__lives = INT32_C(0);
     yy__state->yy__player.yy__speed_reset = ((uint64_t)(UINT8_C(0)));
     yy__state->yy__player.yy__current_frame = INT32_C(0);
-    free(yy__state);
+    yk__obj_free(yy__state);
     return INT32_C(0);
 }
 #if defined(YK__MINIMAL_MAIN)
@@ -8,7 +8,8 @@ struct yy__Spaceship {
 int32_t yy__main();
 int32_t yy__main() 
 {
-    struct yy__Spaceship* yy__myship = calloc(1, sizeof(struct yy__Spaceship));
+    struct yy__Spaceship t__0 = {0};
+    struct yy__Spaceship* yy__myship = (&t__0);
     int32_t yy__a = INT32_C(10);
     while (true)
     {
@@ -20,7 +21,6 @@ int32_t yy__main()
         yk__printstr("\n");
         yy__a = (yy__a - INT32_C(1));
     }
-    free(yy__myship);
     return INT32_C(0);
 }
 #if defined(YK__MINIMAL_MAIN)
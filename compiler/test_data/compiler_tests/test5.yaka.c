@@ -50,18 +50,18 @@ int32_t yy__print_ship(struct yy__Spaceship* yy__s)
 }
 int32_t yy__main() 
 {
-    struct yy__Spaceship* yy__myship = calloc(1, sizeof(struct yy__Spaceship));
+    struct yy__Spaceship t__0 = {0};
+    struct yy__Spaceship* yy__myship = (&t__0);
     yy__myship->yy__name = yk__sdsnewlen("USS Enterprise", 14);
     yy__myship->yy__class_ = yk__sdsnewlen("Galaxy", 6);
-    yy__myship->yy__captain = calloc(1, sizeof(struct yy__Captain));
+    yy__myship->yy__captain = yk__obj_alloc(struct yy__Captain);
     yy__myship->yy__captain->yy__name = yk__sdsnewlen("Picard", 6);
     yy__myship->yy__captain->yy__age = INT32_C(59);
     yy__print_ship(yy__myship);
     yk__sdsfree(yy__myship->yy__captain->yy__name);
-    free(yy__myship->yy__captain);
+    yk__obj_free(yy__myship->yy__captain);
     yk__sdsfree(yy__myship->yy__name);
     yk__sdsfree(yy__myship->yy__class_);
-    free(yy__myship);
     return INT32_C(0);
 }
 #if defined(YK__MINIMAL_MAIN)
@@ -763,7 +763,7 @@ void yy__game_step(void* yy__d)
 }
 struct yy__State* yy__init_state() 
 {
-    struct yy__State* yy__s = calloc(1, sizeof(struct yy__State));
+    struct yy__State* yy__s = yk__obj_alloc(struct yy__State);
     yy__s->yy__width = INT32_C(160);
     yy__s->yy__height = INT32_C(160);
     yy__s->yy__frame_count = UINT64_C(0);
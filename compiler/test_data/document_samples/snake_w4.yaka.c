@@ -1,5 +1,6 @@
 // YK:graphicutils,wasm4#
 #include "yk__lib.h"
+#define yy__random_set_seed yk__set_random_seed
 #define yy__random_random_u64 yk__random_u64
 #define yy__w4_set_draw_colors(nn__value) *((uint16_t*)0x14) = nn__value
 #define yy__w4_gamepad1() (*((const uint8_t*)0x16))
@@ -32,7 +33,6 @@ struct yy__State {
     uint32_t yy__frame_count;
     uint8_t yy__gamepad_prev;
 };
-void yy__random_set_seed(uint64_t);
 void yy__w4_set_palette(uint32_t, uint32_t, uint32_t, uint32_t);
 void yy__w4_blit(uint8_t const *, int32_t, int32_t, uint32_t, uint32_t, uint32_t);
 void yy__w4_rect(int32_t, int32_t, uint32_t, uint32_t);
@@ -52,10 +52,6 @@ void yy__snake_reset(struct yy__Snake*);
 void yy__handle_input(struct yy__State*);
 void yy__game_step(void*);
 int32_t yy__main();
-void yy__random_set_seed(uint64_t nn__seed) 
-{
-    srand((unsigned) nn__seed);
-}
 void yy__w4_set_palette(uint32_t nn__c1, uint32_t nn__c2, uint32_t nn__c3, uint32_t nn__c4) 
 {
     
@@ -73,7 +69,7 @@ void yy__w4_set_game_state(void* nn__data)
 }
 struct yy__Point* yy__point(int16_t yy__x, int16_t yy__y) 
 {
-    struct yy__Point* yy__my_point = calloc(1, sizeof(struct yy__Point));
+    struct yy__Point* yy__my_point = yk__obj_alloc(struct yy__Point);
     yy__my_point->yy__x = yy__x;
     yy__my_point->yy__y = yy__y;
     struct yy__Point* t__0 = yy__my_point;
@@ -196,7 +192,7 @@ bool yy__snake_isdead(struct yy__Snake* yy__snake)
 }
 bool yy__del_point(struct yy__Point* yy__p, int32_t yy__ignored) 
 {
-    free(yy__p);
+    yk__obj_free(yy__p);
     return true;
 }
 void yy__snake_reset(struct yy__Snake* yy__snake) 
@@ -275,8 +271,8 @@ int32_t yy__main()
 {
     yy__random_set_seed(UINT64_C(32));
     yy__w4_set_palette(UINT32_C(16513011), UINT32_C(15052931), UINT32_C(4353629), UINT32_C(2107453));
-    struct yy__State* yy__state = calloc(1, sizeof(struct yy__State));
-    yy__state->yy__snake = calloc(1, sizeof(struct yy__Snake));
+    struct yy__State* yy__state = yk__obj_alloc(struct yy__State);
+    yy__state->yy__snake = yk__obj_alloc(struct yy__Snake);
     yy__state->yy__fruit = yy__point(INT16_C(10), INT16_C(8));
     yy__state->yy__snake->yy__direction = yy__point(INT16_C(1), INT16_C(0));
     yy__state->yy__frame_count = UINT32_C(0);
@@ -71,7 +71,7 @@ struct yy__pool_ThreadPool* yy__pool_create(uint8_t yy__pool_thread_count, uint3
         struct yy__pool_ThreadPool* t__0 = NULL;
         return t__0;
     }
-    struct yy__pool_ThreadPool* yy__pool_tpool = calloc(1, sizeof(struct yy__pool_ThreadPool));
+    struct yy__pool_ThreadPool* yy__pool_tpool = yk__obj_alloc(struct yy__pool_ThreadPool);
     if (yy__pool_tpool == NULL)
     {
         struct yy__pool_ThreadPool* t__1 = yy__pool_tpool;
@@ -225,7 +225,7 @@ int32_t yy__pool_internal_del_pool(struct yy__pool_ThreadPool* yy__pool_tpool)
         yy__mutex_destroy((&(yy__pool_tpool->yy__pool_lock)));
         yy__condition_destroy((&(yy__pool_tpool->yy__pool_notify)));
     }
-    free(yy__pool_tpool);
+    yk__obj_free(yy__pool_tpool);
     int32_t const  t__12 = yy__pool_SUCCESS;
     return t__12;
 }
@@ -1,6 +1,8 @@
 // YK:graphicutils,raylib#
 #include "yk__lib.h"
 #define yy__random_init_random yk__init_random
+#define yy__random_set_seed yk__set_random_seed
+#define yy__random_randomf yk__random_f32
 #define yy__perlin_noise1df(nn__x) ((float)yk__perlin1d((double) nn__x))
 #define yy__numbers_f2i(nn__a) ((int32_t)(nn__a))
 #define yy__numbers_uu2f(nn__a) ((float)nn__a)
@@ -32,28 +34,12 @@ struct yy__State {
     yy__raylib_Color yy__green;
     yy__raylib_Color yy__color3;
 };
-void yy__random_set_seed(uint64_t);
-float yy__random_randomf();
 float yy__random_random_betweenf(float, float);
 float yy__utils_remap(float, float, float, float, float);
 yy__raylib_Color yy__utils_lerp_color(yy__raylib_Color, yy__raylib_Color, float);
 void yy__branch(float, float, float, float, struct yy__State*);
 void yy__update_draw_frame(struct yy__State*);
 int32_t yy__main();
-void yy__random_set_seed(uint64_t nn__seed) 
-{
-    srand((unsigned) nn__seed);
-}
-float yy__random_randomf() 
-{
-    float val;
-    #if defined(YK__WASM4)
-    val = ((float)rand() / 32767.0f);
-    #else
-    val = ((float)rand() / (float)RAND_MAX);
-    #endif
-    return val;
-}
 float yy__random_random_betweenf(float yy__random_a, float yy__random_b) 
 {
     float yy__random_min = yy__random_a;
@@ -121,7 +107,7 @@ void yy__update_draw_frame(struct yy__State* yy__s)
 }
 int32_t yy__main() 
 {
-    struct yy__State* yy__s = calloc(1, sizeof(struct yy__State));
+    struct yy__State* yy__s = yk__obj_alloc(struct yy__State);
     yy__s->yy__angle = yy__random_random_betweenf(30.0f, 45.0f);
     yy__s->yy__width = 600.0f;
     yy__s->yy__height = 600.0f;
@@ -146,7 +132,7 @@ int32_t yy__main()
         yy__random_set_seed(yy__seed);
     }
     yy__raylib_close_window();
-    free(yy__s);
+    yk__obj_free(yy__s);
     return INT32_C(0);
 }
 #if defined(YK__MINIMAL_MAIN)
@@ -37,17 +37,17 @@ void yy__jungle_print_banana(struct yy__jungle_banana* yy__jungle_b)
 }
 int32_t yy__main() 
 {
-    struct yy__MainClass* yy__mc = calloc(1, sizeof(struct yy__MainClass));
-    struct yy__house_ColomboHouse* yy__hs = calloc(1, sizeof(struct yy__house_ColomboHouse));
-    struct yy__jungle_monkey* yy__m = calloc(1, sizeof(struct yy__jungle_monkey));
+    struct yy__MainClass t__0 = {0};
+    struct yy__MainClass* yy__mc = (&t__0);
+    struct yy__house_ColomboHouse t__1 = {0};
+    struct yy__house_ColomboHouse* yy__hs = (&t__1);
+    struct yy__jungle_monkey t__2 = {0};
+    struct yy__jungle_monkey* yy__m = (&t__2);
     yy__m->yy__jungle_id = INT32_C(10);
-    yy__m->yy__jungle_food = calloc(1, sizeof(struct yy__jungle_banana));
+    yy__m->yy__jungle_food = yk__obj_alloc(struct yy__jungle_banana);
     yy__m->yy__jungle_food->yy__jungle_id = INT32_C(50);
     yy__jungle_print_monkey(yy__m);
-    free(yy__m->yy__jungle_food);
-    free(yy__m);
-    free(yy__hs);
-    free(yy__mc);
+    yk__obj_free(yy__m->yy__jungle_food);
     return INT32_C(0);
 }
 #if defined(YK__MINIMAL_MAIN)
@@ -0,0 +1,497 @@
+// ==============================================================================================
+// ╦  ┬┌─┐┌─┐┌┐┌┌─┐┌─┐    Yaksha Programming Language
+// ║  ││  ├┤ │││└─┐├┤     is Licensed with GPLv3 + extra terms. Please see below.
+// ╩═╝┴└─┘└─┘┘└┘└─┘└─┘
+// Note: libs - MIT license, runtime/3rd - various
+// ==============================================================================================
+// GPLv3:
+//
+// Yaksha - Programming Language.
+// Copyright (C) 2020 - 2024 Bhathiya Perera
+//
+// This program is free software: you can redistribute it and/or modify it under the terms
+// of the GNU General Public License as published by the Free Software Foundation,
+// either version 3 of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see https://www.gnu.org/licenses/.
+//
+// ==============================================================================================
+// Additional Terms:
+//
+// Please note that any commercial use of the programming language's compiler source code
+// (everything except compiler/runtime, compiler/libs and compiler/3rd) require a written agreement
+// with author of the language (Bhathiya Perera).
+//
+// If you are using it for an open source project, please give credits.
+// Your own project must use GPLv3 license with these additional terms.
+//
+// You may use programs written in Yaksha/YakshaLisp for any legal purpose
+// (commercial, open-source, closed-source, etc) as long as it agrees
+// to the licenses of linked runtime libraries (see compiler/runtime/README.md).
+//
+// ==============================================================================================
+// bench_main.cpp
+/**
+ * YakshaBench - compiler throughput benchmarks
+ *
+ * Runs tokenizer, block_analyzer, YakshaLisp prelude / macro expansion and
+ * the full multifile_compiler pipeline (phase times via time_report) over
+ * carpntr/main.yaka, test_data/byol/lisp.yaka and a generated program.
+ *
+ * Save a baseline with `YakshaBench -o base.json` and compare a later run
+ * with `YakshaBench -b base.json` (exit code 1 on regressions).
+ */
+#include "ast/parser.h"
+#include "compiler/codegen_c.h"
+#include "compiler/multifile_compiler.h"
+#include "tokenizer/block_analyzer.h"
+#include "tokenizer/tokenizer.h"
+#include "utilities/argparser.h"
+#include "utilities/cpp_util.h"
+#include "yaksha_lisp/yaksha_lisp.h"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <new>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+using namespace yaksha;
+// ┌─┐┬  ┬  ┌─┐┌─┐┌─┐┌┬┐┬┌─┐┌┐┌┌─┐
+// ├─┤│  │  │ ││  ├─┤ │ ││ ││││└─┐
+// ┴ ┴┴─┘┴─┘└─┘└─┘┴ ┴ ┴ ┴└─┘┘└┘└─┘
+static std::uint64_t allocation_count = 0;
+void *operator new(std::size_t size) {
+  allocation_count++;
+  void *ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) { throw std::bad_alloc{}; }
+  return ptr;
+}
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+// ┬ ┬┌─┐┬─┐┌┐┌┌─┐┌─┐┌─┐
+// ├─┤├─┤├┬┘│││├┤ └─┐└─┐
+// ┴ ┴┴ ┴┴└─┘└┘└─┘└─┘└─┘
+struct bench_result {
+  std::string name_;
+  std::uint64_t iterations_{0};
+  std::uint64_t min_ns_{0};
+  std::uint64_t mean_ns_{0};
+  std::uint64_t items_{0};      // items processed in a single iteration
+  std::string unit_{};          // tokens, nodes, expansions, ...
+  std::uint64_t allocations_{0};// heap allocations in a single iteration
+};
+struct bench_settings {
+  std::string filter_{};
+  std::uint64_t min_time_ns_{500000000};
+  std::uint64_t max_iterations_{1000};
+};
+struct corpus {
+  std::string name_;
+  std::string path_;
+  std::string code_;
+};
+static std::uint64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+static bool selected(const bench_settings &settings, const std::string &name) {
+  return settings.filter_.empty() ||
+         name.find(settings.filter_) != std::string::npos;
+}
+/**
+ * Run given function until min_time_ns_ passes (at least once)
+ * function must return number of items it processed
+ */
+static void run_bench(const bench_settings &settings,
+                      std::vector<bench_result> &results,
+                      const std::string &name, const std::string &unit,
+                      const std::function<std::uint64_t()> &fn) {
+  if (!selected(settings, name)) { return; }
+  bench_result r{name};
+  r.unit_ = unit;
+  r.min_ns_ = UINT64_MAX;
+  std::uint64_t total_ns = 0;
+  std::uint64_t total_allocations = 0;
+  while (r.iterations_ == 0 || (total_ns < settings.min_time_ns_ &&
+                                r.iterations_ < settings.max_iterations_)) {
+    std::uint64_t allocations_before = allocation_count;
+    std::uint64_t start = now_ns();
+    r.items_ = fn();
+    std::uint64_t elapsed = now_ns() - start;
+    total_allocations += allocation_count - allocations_before;
+    total_ns += elapsed;
+    if (elapsed < r.min_ns_) { r.min_ns_ = elapsed; }
+    r.iterations_++;
+  }
+  r.mean_ns_ = total_ns / r.iterations_;
+  r.allocations_ = total_allocations / r.iterations_;
+  std::cerr << "." << std::flush;
+  results.emplace_back(r);
+}
+// ┌─┐┌─┐┬─┐┌─┐┌─┐┬─┐┌─┐
+// │  │ │├┬┘├─┘│ │├┬┘├─┤
+// └─┘└─┘┴└─┴  └─┘┴└─┴ ┴
+static std::string read_all(const std::filesystem::path &path) {
+  std::ifstream file(path);
+  if (!file.good()) {
+    std::cerr << "Failed to read corpus:" << path.string() << "\n";
+    exit(EXIT_FAILURE);
+  }
+  return {(std::istreambuf_iterator<char>(file)),
+          std::istreambuf_iterator<char>()};
+}
+/**
+ * Generate a program with given number of lines, every function is used
+ * so usage analysis does not drop anything before codegen
+ */
+static std::string synthetic_program(std::size_t lines) {
+  std::stringstream code{};
+  std::size_t functions = lines / 10;
+  if (functions == 0) { functions = 1; }
+  for (std::size_t i = 0; i < functions; i++) {
+    code << "def fn_" << i << "(a: int, b: int) -> int:\n";
+    code << "    x: int = a + b * " << i % 97 << "\n";
+    if (i == 0) {
+      code << "    y: int = 0\n";
+    } else {
+      code << "    y: int = fn_" << i - 1 << "(b, a)\n";
+    }
+    code << "    while x > 0:\n";
+    code << "        x = x - (x % 7) - 1\n";
+    code << "        y = y + 1\n";
+    code << "    if y > 10:\n";
+    code << "        return y - a\n";
+    code << "    return y + b\n\n";
+  }
+  code << "def main() -> int:\n";
+  code << "    return fn_" << functions - 1 << "(1, 2)\n";
+  return code.str();
+}
+/**
+ * Generate a program that expands a (non-pure, so never cached) dsl macro
+ * given number of times, macro itself does some YakshaLisp work
+ */
+static std::string macro_program(std::size_t expansions) {
+  std::stringstream code{};
+  code << "macros! {\n";
+  code << "    (defun fib (n) (if (< n 2) n (+ (fib (- n 1)) "
+          "(fib (- n 2)))))\n";
+  code << "    (defun twice (&x) (do (fib 10) (+ x (list (ykt_plus)) x)))\n";
+  code << "    (yk_register {dsl twice twice})\n";
+  code << "}\n\n";
+  code << "def main() -> int:\n";
+  code << "    a: int = 0\n";
+  for (std::size_t i = 0; i < expansions; i++) {
+    code << "    a = twice!{a + " << i % 13 << "}\n";
+  }
+  code << "    return a\n";
+  return code.str();
+}
+// ┌┐ ┌─┐┌┐┌┌─┐┬ ┬┌┬┐┌─┐┬─┐┬┌─┌─┐
+// ├┴┐├┤ ││││  ├─┤│││├─┤├┬┘├┴┐└─┐
+// └─┘└─┘┘└┘└─┘┴ ┴┴ ┴┴ ┴┴└─┴ ┴└─┘
+static void bench_front_end(const bench_settings &settings,
+                            std::vector<bench_result> &results,
+                            const corpus &c) {
+  run_bench(settings, results, c.name_ + "/tokenizer", "tokens", [&]() {
+    gc_pool<token> token_pool{};
+    tokenizer t{c.path_, c.code_, &token_pool};
+    t.tokenize();
+    return static_cast<std::uint64_t>(t.tokens_.size());
+  });
+  gc_pool<token> token_pool{};
+  tokenizer t{c.path_, c.code_, &token_pool};
+  t.tokenize();
+  run_bench(settings, results, c.name_ + "/block_analyzer", "tokens", [&]() {
+    gc_pool<token> block_pool{};
+    block_analyzer b{t.tokens_, &block_pool};
+    b.analyze();
+    return static_cast<std::uint64_t>(t.tokens_.size());
+  });
+}
+/**
+ * Compile whole corpus (with imports) and split time into compiler phases
+ */
+static void bench_compile(const bench_settings &settings,
+                          std::vector<bench_result> &results,
+                          const corpus &c, const std::string &libs_path,
+                          bool use_code) {
+  // phase name in report -> time_report phases that make it up
+  const std::vector<std::pair<std::string, std::vector<std::string>>> phases{
+      {"tokenizer", {"tokenize"}},
+      {"block_analyzer", {"block_analyze"}},
+      {"lisp_macros", {"init_env", "execute_macros", "expand_macros"}},
+      {"parser", {"parse_token_soup", "parse"}},
+      {"type_checker", {"type_checker"}},
+      {"escape_analyser", {"escape_analyser"}},
+      {"codegen", {"codegen"}},
+      {"compile", {"compile"}},
+  };
+  bool any_selected = false;
+  for (const auto &phase : phases) {
+    any_selected |= selected(settings, c.name_ + "/compile:" + phase.first);
+  }
+  if (!any_selected) { return; }
+  std::vector<bench_result> rows{};
+  for (const auto &phase : phases) {
+    bench_result r{c.name_ + "/compile:" + phase.first};
+    r.min_ns_ = UINT64_MAX;
+    rows.emplace_back(r);
+  }
+  std::vector<std::uint64_t> totals(phases.size(), 0);
+  std::uint64_t total_ns = 0;
+  std::uint64_t iterations = 0;
+  std::uint64_t total_allocations = 0;
+  while (iterations == 0 || (total_ns < settings.min_time_ns_ &&
+                             iterations < settings.max_iterations_)) {
+    std::uint64_t allocations_before = allocation_count;
+    std::uint64_t start = now_ns();
+    multifile_compiler mc{};
+    mc.time_report_.enabled_ = true;
+    codegen_c cg{};
+    std::string empty_code{};
+    auto result = mc.compile(use_code ? c.code_ : empty_code, use_code,
+                             c.path_, libs_path, &cg);
+    total_ns += now_ns() - start;
+    total_allocations += allocation_count - allocations_before;
+    iterations++;
+    if (result.failed_) {
+      std::cerr << "Failed to compile corpus:" << c.path_ << "\n";
+      exit(EXIT_FAILURE);
+    }
+    std::uint64_t tokens = mc.time_report_.counter("tokens");
+    std::uint64_t nodes = mc.time_report_.counter("ast_nodes");
+    for (std::size_t i = 0; i < phases.size(); i++) {
+      std::uint64_t phase_ns = 0;
+      for (const auto &part : phases[i].second) {
+        phase_ns += mc.time_report_.total_us(part) * 1000;
+      }
+      totals[i] += phase_ns;
+      if (phase_ns < rows[i].min_ns_) { rows[i].min_ns_ = phase_ns; }
+      bool per_token = i < 3 || phases[i].first == "compile";
+      rows[i].items_ = per_token ? tokens : nodes;
+      rows[i].unit_ = per_token ? "tokens" : "nodes";
+    }
+  }
+  for (std::size_t i = 0; i < phases.size(); i++) {
+    rows[i].iterations_ = iterations;
+    rows[i].mean_ns_ = totals[i] / iterations;
+    if (phases[i].first == "compile") {
+      rows[i].allocations_ = total_allocations / iterations;
+    }
+    if (selected(settings, rows[i].name_)) { results.emplace_back(rows[i]); }
+  }
+  std::cerr << "." << std::flush;
+}
+static void bench_lisp(const bench_settings &settings,
+                       std::vector<bench_result> &results) {
+  run_bench(settings, results, "lisp/prelude", "envs", []() {
+    yaksha_macros yaksha_lisp_m{};
+    std::unordered_map<std::string, import_stmt *> imports{};
+    yaksha_lisp_m.init_env("bench.yaka", imports);
+    return static_cast<std::uint64_t>(1);
+  });
+  const std::size_t expansions = 500;
+  std::string code = macro_program(expansions);
+  run_bench(settings, results, "lisp/macro_expansion", "expansions", [&]() {
+    yaksha_macros yaksha_lisp_m{};
+    yk_datatype_pool datatypes{};
+    tokenizer t{"bench.yaka", code, yaksha_lisp_m.get_yk_token_pool()};
+    t.tokenize();
+    block_analyzer b{t.tokens_, yaksha_lisp_m.get_yk_token_pool()};
+    b.analyze();
+    parser p{"bench.yaka", b.tokens_, &datatypes};
+    p.preprocess(&yaksha_lisp_m, yaksha_lisp_m.get_yk_token_pool());
+    if (!p.errors_.empty()) {
+      std::cerr << "Failed to expand macros:" << p.errors_[0].message_ << "\n";
+      exit(EXIT_FAILURE);
+    }
+    return static_cast<std::uint64_t>(expansions);
+  });
+}
+// ┬─┐┌─┐┌─┐┬ ┬┬ ┌┬┐┌─┐
+// ├┬┘├┤ └─┐│ ││  │ └─┐
+// ┴└─└─┘└─┘└─┘┴─┘┴ └─┘
+static double per_second(const bench_result &r) {
+  if (r.min_ns_ == 0) { return 0.0; }
+  return static_cast<double>(r.items_) * 1e9 / static_cast<double>(r.min_ns_);
+}
+static void print_results(const std::vector<bench_result> &results) {
+  std::cout << std::left << std::setw(42) << "benchmark" << std::right
+            << std::setw(7) << "iters" << std::setw(12) << "min (ms)"
+            << std::setw(12) << "mean (ms)" << std::setw(16) << "items/s"
+            << std::setw(13) << "allocs/iter"
+            << "\n";
+  std::cout << std::fixed;
+  for (const auto &r : results) {
+    std::string rate = std::to_string(static_cast<std::uint64_t>(
+                           per_second(r))) +
+                       " " + r.unit_;
+    std::cout << std::left << std::setw(42) << r.name_ << std::right
+              << std::setw(7) << r.iterations_ << std::setw(12)
+              << std::setprecision(3) << (r.min_ns_ / 1e6) << std::setw(12)
+              << (r.mean_ns_ / 1e6) << std::setw(16) << rate << std::setw(13)
+              << r.allocations_ << "\n";
+  }
+}
+static bool write_json(const std::vector<bench_result> &results,
+                       const std::string &path) {
+  std::ofstream out(path);
+  if (!out.good()) { return false; }
+  out << "{\"benchmarks\": [\n";
+  for (std::size_t i = 0; i < results.size(); i++) {
+    const auto &r = results[i];
+    out << "  {\"name\": \"" << string_utils::escape_json(r.name_)
+        << "\", \"iterations\": " << r.iterations_
+        << ", \"min_ns\": " << r.min_ns_ << ", \"mean_ns\": " << r.mean_ns_
+        << ", \"items\": " << r.items_ << ", \"unit\": \"" << r.unit_
+        << "\", \"items_per_second\": "
+        << static_cast<std::uint64_t>(per_second(r))
+        << ", \"allocations\": " << r.allocations_ << "}"
+        << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  out << "]}\n";
+  return true;
+}
+/**
+ * Read name -> min_ns from a file written by write_json
+ * (one benchmark per line, so there is no need for a full JSON parser)
+ */
+static bool read_baseline(const std::string &path,
+                          std::unordered_map<std::string, std::uint64_t> &out) {
+  std::ifstream file(path);
+  if (!file.good()) { return false; }
+  std::string line;
+  const std::string name_key = "\"name\": \"";
+  const std::string min_key = "\"min_ns\": ";
+  while (std::getline(file, line)) {
+    auto name_pos = line.find(name_key);
+    auto min_pos = line.find(min_key);
+    if (name_pos == std::string::npos || min_pos == std::string::npos) {
+      continue;
+    }
+    name_pos += name_key.size();
+    auto name_end = line.find('"', name_pos);
+    if (name_end == std::string::npos) { continue; }
+    out[line.substr(name_pos, name_end - name_pos)] =
+        std::strtoull(line.c_str() + min_pos + min_key.size(), nullptr, 10);
+  }
+  return true;
+}
+/**
+ * Compare min times against baseline
+ * @return number of benchmarks slower than threshold percent
+ */
+static int compare(const std::vector<bench_result> &results,
+                   const std::unordered_map<std::string, std::uint64_t> &base,
+                   double threshold) {
+  int regressions = 0;
+  std::cout << "\n"
+            << std::left << std::setw(42) << "benchmark" << std::right
+            << std::setw(15) << "baseline (ms)" << std::setw(14)
+            << "current (ms)" << std::setw(10) << "change"
+            << "\n";
+  for (const auto &r : results) {
+    auto it = base.find(r.name_);
+    if (it == base.end() || it->second == 0) { continue; }
+    double change = 100.0 * (static_cast<double>(r.min_ns_) -
+                             static_cast<double>(it->second)) /
+                    static_cast<double>(it->second);
+    bool regressed = change > threshold;
+    if (regressed) { regressions++; }
+    std::cout << std::left << std::setw(42) << r.name_ << std::right
+              << std::setw(15) << std::setprecision(3) << (it->second / 1e6)
+              << std::setw(14) << (r.min_ns_ / 1e6) << std::setw(9)
+              << std::setprecision(1) << std::showpos << change
+              << std::noshowpos << "%" << (regressed ? "  REGRESSION" : "")
+              << "\n";
+  }
+  return regressions;
+}
+int main(int argc, char *argv[]) {
+  auto args = argparser::ARGS("YakshaBench", "Yaksha compiler benchmarks", "");
+  auto help = argparser::OP_BOOL('h', "--help", "Print this help message");
+  auto filter = argparser::OP_VAL(
+      'f', "--filter", "Only run benchmarks containing given text.");
+  auto min_time = argparser::OP_VAL(
+      'm', "--min-time", "Minimum milliseconds to run each benchmark (500).");
+  auto lines = argparser::OP_VAL(
+      'l', "--lines", "Lines in generated synthetic program (100000).");
+  auto json = argparser::OP_VAL('o', "--json", "Write results to JSON file.");
+  auto baseline = argparser::OP_VAL(
+      'b', "--baseline", "Compare against JSON file written by --json.");
+  auto threshold = argparser::OP_VAL(
+      'r', "--regression",
+      "Percent slowdown reported as a regression (10).");
+  args.optional_ = {&help, &filter, &min_time, &lines,
+                    &json, &baseline, &threshold};
+  argparser::parse_args(argc, argv, args);
+  if (help.is_set_) {
+    argparser::print_help(args);
+    return EXIT_SUCCESS;
+  }
+  if (!args.errors_.empty()) {
+    argparser::print_errors(args);
+    argparser::print_help(args);
+    return EXIT_FAILURE;
+  }
+  bench_settings settings{};
+  settings.filter_ = filter.arg_value_;
+  if (min_time.is_set_) {
+    settings.min_time_ns_ = std::stoull(min_time.arg_value_) * 1000000;
+  }
+  std::size_t synthetic_lines = 100000;
+  if (lines.is_set_) { synthetic_lines = std::stoull(lines.arg_value_); }
+  // binary is in compiler/bin
+  auto root = std::filesystem::path{get_my_exe_path()}.parent_path();
+  root = root.parent_path();
+  std::string libs_path = (root / "libs").string();
+  std::vector<corpus> corpora{};
+  auto carpntr_path = root / "carpntr" / "main.yaka";
+  corpora.push_back(
+      {"carpntr", carpntr_path.string(), read_all(carpntr_path)});
+  auto lisp_path = root / "test_data" / "byol" / "lisp.yaka";
+  corpora.push_back({"byol_lisp", lisp_path.string(), read_all(lisp_path)});
+  auto synthetic_path =
+      std::filesystem::temp_directory_path() / "yaksha_bench_synthetic.yaka";
+  corpora.push_back({"synthetic_" + std::to_string(synthetic_lines),
+                     synthetic_path.string(),
+                     synthetic_program(synthetic_lines)});
+  std::vector<bench_result> results{};
+  for (const auto &c : corpora) { bench_front_end(settings, results, c); }
+  bench_lisp(settings, results);
+  for (std::size_t i = 0; i < corpora.size(); i++) {
+    // synthetic program only exists in memory
+    bench_compile(settings, results, corpora[i], libs_path,
+                  i == corpora.size() - 1);
+  }
+  std::cerr << "\n";
+  print_results(results);
+  if (json.is_set_ && !write_json(results, json.arg_value_)) {
+    std::cerr << "Failed to write:" << json.arg_value_ << "\n";
+    return EXIT_FAILURE;
+  }
+  if (baseline.is_set_) {
+    std::unordered_map<std::string, std::uint64_t> base{};
+    if (!read_baseline(baseline.arg_value_, base)) {
+      std::cerr << "Failed to read baseline:" << baseline.arg_value_ << "\n";
+      return EXIT_FAILURE;
+    }
+    double percent = 10.0;
+    if (threshold.is_set_) { percent = std::stod(threshold.arg_value_); }
+    if (compare(results, base, percent) > 0) { return EXIT_FAILURE; }
+  }
+  return EXIT_SUCCESS;
+}
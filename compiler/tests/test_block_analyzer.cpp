@@ -96,3 +96,27 @@ TEST_CASE("block_analyzer: Test weird_file.py") {
   test_block_analyzer_yaka_file("../test_data/weird_file.py", "weird_file.py",
                                 "../test_data/weird_file.py.block_tokens");
 }
+TEST_CASE("block_analyzer: Given tokens are not modified") {
+  std::ifstream code_file("../test_data/block_analyzer_test.py");
+  REQUIRE(code_file.good());
+  std::string code((std::istreambuf_iterator<char>(code_file)),
+                   std::istreambuf_iterator<char>());
+  gc_pool<token> token_pool{};
+  yaksha::tokenizer tt("block_analyzer_test.py", code, &token_pool);
+  tt.tokenize();
+  std::vector<std::pair<token_type, std::string>> before{};
+  for (auto tok : tt.tokens_) { before.emplace_back(tok->type_, tok->token_); }
+  yaksha::block_analyzer first(tt.tokens_, &token_pool);
+  first.analyze();
+  yaksha::block_analyzer second(tt.tokens_, &token_pool);
+  second.analyze();
+  REQUIRE(tt.tokens_.size() == before.size());
+  for (std::size_t i = 0; i < before.size(); i++) {
+    REQUIRE(tt.tokens_[i]->type_ == before[i].first);
+    REQUIRE(tt.tokens_[i]->token_ == before[i].second);
+  }
+  REQUIRE(first.tokens_.size() == second.tokens_.size());
+  for (std::size_t i = 0; i < first.tokens_.size(); i++) {
+    REQUIRE(first.tokens_[i]->type_ == second.tokens_[i]->type_);
+  }
+}
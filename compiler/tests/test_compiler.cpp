@@ -636,3 +636,92 @@ TEST_CASE("compiler: setref usage") {
   test_compile_yaka_file(
       "../test_data/compiler_tests/setref_test.yaka");
 }
+TEST_CASE("compiler: escape analysis - objects that do not escape are on stack") {
+  test_compile_yaka_file("../test_data/compiler_tests/escape_analysis.yaka");
+}
+TEST_CASE("compiler: @arena function releases memory with an arena") {
+  test_compile_yaka_file("../test_data/compiler_tests/arena_test.yaka");
+}
+TEST_CASE("compiler: libs.containers - sets, ordered map, heap and deque") {
+  test_compile_yaka_file("../test_data/compiler_tests/containers_test.yaka");
+}
+TEST_CASE("compiler: libs.fileformats - json and csv readers") {
+  test_compile_yaka_file("../test_data/compiler_tests/fileformats_test.yaka");
+}
+TEST_CASE("compiler: time report records phases and counters") {
+  std::string exe_path = get_my_exe_path();
+  auto libs_path =
+      std::filesystem::path(exe_path).parent_path().parent_path() / "libs";
+  multifile_compiler mc{};
+  mc.time_report_.enabled_ = true;
+  codegen_c cg{};
+  auto result = mc.compile("../test_data/compiler_tests/setref_test.yaka",
+                           libs_path.string(), &cg);
+  REQUIRE(result.failed_ == false);
+  std::stringstream trace{};
+  mc.time_report_.print_trace(trace);
+  std::string json = trace.str();
+  REQUIRE(json.find("\"name\":\"tokenize\"") != std::string::npos);
+  REQUIRE(json.find("\"name\":\"type_checker\"") != std::string::npos);
+  REQUIRE(json.find("\"name\":\"codegen\"") != std::string::npos);
+  REQUIRE(json.find("\"ast_nodes\":0,") == std::string::npos);
+  REQUIRE(json.find("\"peak_rss\":") != std::string::npos);
+}
+TEST_CASE("compiler: time report is empty when disabled") {
+  std::string exe_path = get_my_exe_path();
+  auto libs_path =
+      std::filesystem::path(exe_path).parent_path().parent_path() / "libs";
+  multifile_compiler mc{};
+  codegen_c cg{};
+  auto result = mc.compile("../test_data/compiler_tests/setref_test.yaka",
+                           libs_path.string(), &cg);
+  REQUIRE(result.failed_ == false);
+  std::stringstream trace{};
+  mc.time_report_.print_trace(trace);
+  REQUIRE(trace.str().find("\"traceEvents\":[]") != std::string::npos);
+}
+TEST_CASE("compiler: split output to translation units") {
+  std::string exe_path = get_my_exe_path();
+  auto libs_path =
+      std::filesystem::path(exe_path).parent_path().parent_path() / "libs";
+  multifile_compiler mc{};
+  codegen_c cg{};
+  cg.max_units_ = 2;
+  auto result = mc.compile("../test_data/compiler_tests/native_func_sort.yaka",
+                           libs_path.string(), &cg);
+  REQUIRE(result.failed_ == false);
+  std::string code = result.code_;
+  std::string separator{YAKSHA_C_UNIT_SEPARATOR};
+  auto first = code.find(separator);
+  REQUIRE(first != std::string::npos);
+  auto second = code.find(separator, first + separator.size());
+  REQUIRE(second != std::string::npos);
+  REQUIRE(code.find(separator, second + separator.size()) == std::string::npos);
+  // Shared part only has declarations, main() is in the first unit
+  std::string shared = code.substr(0, first);
+  REQUIRE(shared.rfind("// YK", 0) == 0);
+  REQUIRE(shared.find("int32_t yy__main();") != std::string::npos);
+  REQUIRE(shared.find("int32_t yy__main() ") == std::string::npos);
+  std::string first_unit = code.substr(first, second - first);
+  REQUIRE(first_unit.find("YK__MINIMAL_MAIN") != std::string::npos);
+}
+TEST_CASE("compiler: split output defines binary data once") {
+  std::string exe_path = get_my_exe_path();
+  auto libs_path =
+      std::filesystem::path(exe_path).parent_path().parent_path() / "libs";
+  multifile_compiler mc{};
+  codegen_c cg{};
+  cg.max_units_ = 4;
+  auto result =
+      mc.compile("../test_data/compiler_tests/binarydata_builtin_test.yaka",
+                 libs_path.string(), &cg);
+  REQUIRE(result.failed_ == false);
+  auto first = result.code_.find(YAKSHA_C_UNIT_SEPARATOR);
+  REQUIRE(first != std::string::npos);
+  std::string shared = result.code_.substr(0, first);
+  std::string units = result.code_.substr(first);
+  REQUIRE(shared.find("extern uint8_t const ykbindata0[];") !=
+          std::string::npos);
+  REQUIRE(shared.find("ykbindata0[] = {") == std::string::npos);
+  REQUIRE(units.find("uint8_t const ykbindata0[] = {") != std::string::npos);
+}
@@ -224,6 +224,15 @@ TEST_CASE("parser: function trying to return a FixedArr") {
                     "Functions cannot return fixed size arrays. Use Array or "
                     "wrap in a Tuple.");
 }
+TEST_CASE("parser: @arena function trying to return a str") {
+  TEST_SNIPPET_FULL("@arena\n"
+                    "def bad() -> str:\n"
+                    "    return \"arena memory\"\n"
+                    "def main() -> int:\n"
+                    "    return 0",
+                    "@arena function can only return None, bool or a number, "
+                    "arena is released when it returns.");
+}
 TEST_CASE("parser: function data type returns FixedArr") {
   TEST_SNIPPET_FULL("def main() -> int:\n"
                     "    a: Function[In[int], Out[FixedArr[int, 10]]]\n"
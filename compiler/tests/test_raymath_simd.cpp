@@ -0,0 +1,165 @@
+// ==============================================================================================
+// ╦  ┬┌─┐┌─┐┌┐┌┌─┐┌─┐    Yaksha Programming Language
+// ║  ││  ├┤ │││└─┐├┤     is Licensed with GPLv3 + extra terms. Please see below.
+// ╩═╝┴└─┘└─┘┘└┘└─┘└─┘
+// Note: libs - MIT license, runtime/3rd - various
+// ==============================================================================================
+// GPLv3:
+//
+// Yaksha - Programming Language.
+// Copyright (C) 2020 - 2024 Bhathiya Perera
+//
+// This program is free software: you can redistribute it and/or modify it under the terms
+// of the GNU General Public License as published by the Free Software Foundation,
+// either version 3 of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see https://www.gnu.org/licenses/.
+//
+// ==============================================================================================
+// Additional Terms:
+//
+// Please note that any commercial use of the programming language's compiler source code
+// (everything except compiler/runtime, compiler/libs and compiler/3rd) require a written agreement
+// with author of the language (Bhathiya Perera).
+//
+// If you are using it for an open source project, please give credits.
+// Your own project must use GPLv3 license with these additional terms.
+//
+// You may use programs written in Yaksha/YakshaLisp for any legal purpose
+// (commercial, open-source, closed-source, etc) as long as it agrees
+// to the licenses of linked runtime libraries (see compiler/runtime/README.md).
+//
+// ==============================================================================================
+// test_raymath_simd.cpp
+// Compare SIMD functions of yk__raymath_simd.h with raymath.h over random
+//   inputs. Needs runtime/raylib submodule, skipped if it is not present.
+#include "catch2/catch.hpp"
+#if __has_include("raylib/src/raymath.h")
+#define RAYMATH_STATIC_INLINE
+#include "raylib/src/raymath.h"
+#include "raylib_additional/yk__raymath_simd.h"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+// Operations are done in raymath's order, so results are expected to be bit
+//   equal. Tolerance only allows for a compiler fusing multiply + add (FMA)
+//   on one side: |simd - scalar| <= 1e-5 * max(1, |scalar|)
+static const float TOLERANCE = 1e-5f;
+static const int ITERATIONS = 20000;
+static bool close_enough(float simd, float scalar) {
+  if (std::isnan(simd) || std::isnan(scalar)) {
+    return std::isnan(simd) && std::isnan(scalar);
+  }
+  return std::fabs(simd - scalar) <=
+         TOLERANCE * std::fmax(1.0f, std::fabs(scalar));
+}
+static bool close_enough(const float *simd, const float *scalar, int count) {
+  for (int i = 0; i < count; i++) {
+    if (!close_enough(simd[i], scalar[i])) { return false; }
+  }
+  return true;
+}
+// xorshift32, fixed seed so failures can be reproduced
+struct random_floats {
+  uint32_t state_{2463534242u};
+  float next(float low, float high) {
+    state_ ^= state_ << 13;
+    state_ ^= state_ >> 17;
+    state_ ^= state_ << 5;
+    return low + (high - low) * (float) (state_ >> 8) / (float) (1u << 24);
+  }
+  Vector3 vector3() { return {next(-100, 100), next(-100, 100), next(-100, 100)}; }
+  Vector4 vector4() {
+    return {next(-10, 10), next(-10, 10), next(-10, 10), next(-10, 10)};
+  }
+  Matrix matrix() {
+    Matrix m;
+    float *f = &m.m0;
+    for (int i = 0; i < 16; i++) { f[i] = next(-10, 10); }
+    return m;
+  }
+};
+TEST_CASE("raymath simd: yk__matrix_multiply") {
+  random_floats r{};
+  for (int i = 0; i < ITERATIONS; i++) {
+    Matrix left = r.matrix();
+    Matrix right = r.matrix();
+    Matrix simd = yk__matrix_multiply(left, right);
+    Matrix scalar = MatrixMultiply(left, right);
+    REQUIRE(close_enough(&simd.m0, &scalar.m0, 16));
+  }
+}
+TEST_CASE("raymath simd: yk__quaternion_multiply") {
+  random_floats r{};
+  for (int i = 0; i < ITERATIONS; i++) {
+    Quaternion q1 = r.vector4();
+    Quaternion q2 = r.vector4();
+    Quaternion simd = yk__quaternion_multiply(q1, q2);
+    Quaternion scalar = QuaternionMultiply(q1, q2);
+    REQUIRE(close_enough(&simd.x, &scalar.x, 4));
+  }
+}
+TEST_CASE("raymath simd: yk__vector4_lerp and yk__quaternion_lerp") {
+  random_floats r{};
+  for (int i = 0; i < ITERATIONS; i++) {
+    Vector4 v1 = r.vector4();
+    Vector4 v2 = r.vector4();
+    float amount = r.next(-1, 2);
+    Vector4 simd = yk__vector4_lerp(v1, v2, amount);
+    Vector4 scalar = Vector4Lerp(v1, v2, amount);
+    REQUIRE(close_enough(&simd.x, &scalar.x, 4));
+    Quaternion simd_q = yk__quaternion_lerp(v1, v2, amount);
+    Quaternion scalar_q = QuaternionLerp(v1, v2, amount);
+    REQUIRE(close_enough(&simd_q.x, &scalar_q.x, 4));
+  }
+}
+TEST_CASE("raymath simd: yk__quaternion_nlerp") {
+  random_floats r{};
+  for (int i = 0; i < ITERATIONS; i++) {
+    Quaternion q1 = r.vector4();
+    // Same quaternions give a zero length when amount is 0.5
+    Quaternion q2 = (i % 100 == 0) ? q1 : r.vector4();
+    float amount = (i % 100 == 0) ? 0.5f : r.next(0, 1);
+    Quaternion simd = yk__quaternion_nlerp(q1, q2, amount);
+    Quaternion scalar = QuaternionNlerp(q1, q2, amount);
+    REQUIRE(close_enough(&simd.x, &scalar.x, 4));
+  }
+}
+TEST_CASE("raymath simd: yk__vector3_transform_array") {
+  random_floats r{};
+  for (int i = 0; i < ITERATIONS / 100; i++) {
+    Matrix mat = r.matrix();
+    // Counts that are not a multiple of 4 cover the remainder loop
+    std::vector<Vector3> values(i % 37);
+    for (auto &v : values) { v = r.vector3(); }
+    std::vector<Vector3> simd = values;
+    yk__vector3_transform_array(simd.data(), simd.size(), mat);
+    for (size_t j = 0; j < values.size(); j++) {
+      Vector3 scalar = Vector3Transform(values[j], mat);
+      REQUIRE(close_enough(&simd[j].x, &scalar.x, 3));
+    }
+  }
+}
+TEST_CASE("raymath simd: yk__vector3_normalize_array") {
+  random_floats r{};
+  for (int i = 0; i < ITERATIONS / 100; i++) {
+    std::vector<Vector3> values(i % 37);
+    for (size_t j = 0; j < values.size(); j++) {
+      // Zero length vectors must be kept as they are
+      values[j] = (j % 5 == 0) ? Vector3{0, 0, 0} : r.vector3();
+    }
+    std::vector<Vector3> simd = values;
+    yk__vector3_normalize_array(simd.data(), simd.size());
+    for (size_t j = 0; j < values.size(); j++) {
+      Vector3 scalar = Vector3Normalize(values[j]);
+      REQUIRE(close_enough(&simd[j].x, &scalar.x, 3));
+    }
+  }
+}
+#endif
@@ -327,6 +327,27 @@ TEST_CASE("tokenizer: Comment: Two lines") {
   REQUIRE(t.tokens_[5]->type_ == token_type::COMMENT);
   REQUIRE(t.errors_.empty());
 }
+TEST_CASE("tokenizer: Non ASCII in strings and comments") {
+  gc_pool<token> token_pool{};
+  yaksha::tokenizer t("test.py",
+                      "a = \"\xe0\xb6\xba\\\"\xc3\xa9\" # \xe0\xb6\xba\n b",
+                      &token_pool);
+  t.tokenize();
+  REQUIRE(t.tokens_.size() == 7 + 1);
+  TOK_REQUIRE(2, "\xe0\xb6\xba\\\"\xc3\xa9", token_type::STRING);
+  REQUIRE(t.tokens_[2]->pos_ == 6);
+  TOK_REQUIRE(3, " \xe0\xb6\xba", token_type::COMMENT);
+  REQUIRE(t.tokens_[3]->pos_ == 12);
+  REQUIRE(t.errors_.empty());
+}
+TEST_CASE("tokenizer: Invalid UTF-8 in a comment") {
+  gc_pool<token> token_pool{};
+  yaksha::tokenizer t("test.py", "a = 1 # \xff\n", &token_pool);
+  t.tokenize();
+  REQUIRE(t.errors_.size() == 1);
+  REQUIRE(t.errors_[0].message_ ==
+          "Invalid UTF-8 detected for input file. Will not continue.");
+}
 TEST_CASE("tokenizer: Parse test_vector_add.py") {
   test_tokenizer_yaka_file("../test_data/test_vector_add.py",
                            "test_vector_add.py",
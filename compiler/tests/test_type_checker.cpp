@@ -37,6 +37,7 @@
 //
 // ==============================================================================================
 #include "catch2/catch.hpp"
+#include "ast/environment_stack.h"
 #include "compiler/codegen_c.h"
 #include "compiler/multifile_compiler.h"
 #include "utilities/error_printer.h"
@@ -959,3 +960,203 @@ TEST_CASE("type checker: Widening u16 + i32 can happen") {
 TEST_CASE("type checker: Widening u16 + i64 can happen") {
   test_typechecker_snippet_ok("a: i64 = 2u16 + 1i64");
 }
+TEST_CASE("type checker: @arena storing to a parameter's member") {
+  test_typechecker_snippet_full(
+      "class Node:\n"
+      "    name: str\n"
+      "    items: Array[str]\n"
+      "    child: Node\n"
+      "@arena\n"
+      "def f(n: Node) -> None:\n"
+      "    n.name = \"arena\"\n"
+      "def main() -> int:\n"
+      "    return 0",
+      "Cannot store arena memory in an object or array created outside of "
+      "@arena function, arena is released when it returns.");
+}
+TEST_CASE("type checker: @arena storing to a parameter array") {
+  test_typechecker_snippet_full(
+      "@arena\n"
+      "def f(items: Array[str]) -> None:\n"
+      "    items[0] = \"arena\"\n"
+      "def main() -> int:\n"
+      "    return 0",
+      "Cannot store arena memory in an object or array created outside of "
+      "@arena function, arena is released when it returns.");
+}
+TEST_CASE("type checker: @arena storing to an object taken from a parameter") {
+  test_typechecker_snippet_full(
+      "class Node:\n"
+      "    name: str\n"
+      "    items: Array[str]\n"
+      "    child: Node\n"
+      "@arena\n"
+      "def f(n: Node) -> None:\n"
+      "    c = n.child\n"
+      "    c.name = \"arena\"\n"
+      "def main() -> int:\n"
+      "    return 0",
+      "Cannot store arena memory in an object or array created outside of "
+      "@arena function, arena is released when it returns.");
+}
+TEST_CASE("type checker: @arena storing to a foreach item of a parameter") {
+  test_typechecker_snippet_full(
+      "class Node:\n"
+      "    name: str\n"
+      "    items: Array[str]\n"
+      "    child: Node\n"
+      "@arena\n"
+      "def f(nodes: Array[Node]) -> None:\n"
+      "    for x: Node in nodes:\n"
+      "        x.name = \"arena\"\n"
+      "def main() -> int:\n"
+      "    return 0",
+      "Cannot store arena memory in an object or array created outside of "
+      "@arena function, arena is released when it returns.");
+}
+TEST_CASE("type checker: @arena storing an object in to a parameter") {
+  test_typechecker_snippet_full(
+      "class Node:\n"
+      "    name: str\n"
+      "    items: Array[str]\n"
+      "    child: Node\n"
+      "@arena\n"
+      "def f(n: Node) -> None:\n"
+      "    n.child = Node()\n"
+      "def main() -> int:\n"
+      "    return 0",
+      "Cannot store arena memory in an object or array created outside of "
+      "@arena function, arena is released when it returns.");
+}
+TEST_CASE("type checker: @arena storing a copy of outside str") {
+  test_typechecker_snippet_full(
+      "class Node:\n"
+      "    name: str\n"
+      "    items: Array[str]\n"
+      "    child: Node\n"
+      "@arena\n"
+      "def f(n: Node) -> None:\n"
+      "    n.name = n.child.name\n"
+      "def main() -> int:\n"
+      "    return 0",
+      "Cannot store arena memory in an object or array created outside of "
+      "@arena function, arena is released when it returns.");
+}
+TEST_CASE("type checker: @arena assigning to a parameter") {
+  test_typechecker_snippet_full(
+      "@arena\n"
+      "def f(s: str) -> None:\n"
+      "    s = \"arena\"\n"
+      "def main() -> int:\n"
+      "    return 0",
+      "Cannot assign to a parameter inside @arena function, arena is "
+      "released when it returns.");
+}
+TEST_CASE("type checker: @arena arrput to a parameter's array") {
+  test_typechecker_snippet_full(
+      "class Node:\n"
+      "    name: str\n"
+      "    items: Array[str]\n"
+      "    child: Node\n"
+      "@arena\n"
+      "def f(n: Node) -> None:\n"
+      "    arrput(n.items, \"arena\")\n"
+      "def main() -> int:\n"
+      "    return 0",
+      "Cannot use arrput() inside @arena function on an array, map or "
+      "pointer created outside of it, arena is released when it returns.");
+}
+TEST_CASE("type checker: @arena shput to a parameter map") {
+  test_typechecker_snippet_full(
+      "@arena\n"
+      "def f(m: Array[SMEntry[int]]) -> None:\n"
+      "    shput(m, \"arena\", 1)\n"
+      "def main() -> int:\n"
+      "    return 0",
+      "Cannot use shput() inside @arena function on an array, map or "
+      "pointer created outside of it, arena is released when it returns.");
+}
+TEST_CASE("type checker: @arena passing arena memory along with a parameter") {
+  test_typechecker_snippet_full(
+      "class Node:\n"
+      "    name: str\n"
+      "    items: Array[str]\n"
+      "    child: Node\n"
+      "@arena\n"
+      "def keep(n: Node, c: Node) -> None:\n"
+      "    n.child = c\n"
+      "@arena\n"
+      "def f(n: Node) -> None:\n"
+      "    keep(n, Node())\n"
+      "def main() -> int:\n"
+      "    return 0",
+      "Cannot pass arena memory along with an object or container created "
+      "outside of @arena function, it may be kept there after the arena is "
+      "released.");
+}
+TEST_CASE("type checker: @arena passing a parameter to a function") {
+  test_typechecker_snippet_full(
+      "class Holder:\n"
+      "    name: str\n"
+      "def set_name(h: Holder, n: int) -> None:\n"
+      "    h.name = \"name\" + \"x\"\n"
+      "@arena\n"
+      "def fill(h: Holder, n: int) -> None:\n"
+      "    set_name(h, n)\n"
+      "def main() -> int:\n"
+      "    return 0",
+      "Cannot pass an object or container created outside of @arena "
+      "function to a function that is not @arena, memory it allocates there "
+      "is released with the arena.");
+}
+TEST_CASE("type checker: @arena passing an alias of a parameter to a function") {
+  test_typechecker_snippet_full(
+      "def add(items: Array[str]) -> None:\n"
+      "    arrput(items, \"x\")\n"
+      "class Holder:\n"
+      "    items: Array[str]\n"
+      "@arena\n"
+      "def fill(h: Holder) -> None:\n"
+      "    items = h.items\n"
+      "    add(items)\n"
+      "def main() -> int:\n"
+      "    return 0",
+      "Cannot pass an object or container created outside of @arena "
+      "function to a function that is not @arena, memory it allocates there "
+      "is released with the arena.");
+}
+TEST_CASE("type checker: @arena can use parameters and its own memory") {
+  test_typechecker_snippet_full_ok(
+      "class Node:\n"
+      "    name: str\n"
+      "    items: Array[str]\n"
+      "    child: Node\n"
+      "@arena\n"
+      "def f(n: Node, count: int) -> int:\n"
+      "    local = Node()\n"
+      "    local.name = \"ok\"\n"
+      "    arrput(local.items, n.name)\n"
+      "    n.child = n\n"
+      "    count = count + 1\n"
+      "    x: str = n.name\n"
+      "    del local\n"
+      "    return len(x) + count\n"
+      "def main() -> int:\n"
+      "    n = Node()\n"
+      "    n.child = n\n"
+      "    f(n, 1)\n"
+      "    del n\n"
+      "    return 0");
+}
+TEST_CASE("type checker: environment_stack assign updates outer scope") {
+  yk_datatype_pool pool{};
+  environment_stack env{&pool};
+  env.push();
+  env.define("x", yk_object(1, &pool));
+  env.push();
+  REQUIRE(env.is_defined("x"));
+  env.assign("x", yk_object(std::string{"updated"}, &pool));
+  REQUIRE(env.get("x").string_val_ == "updated");
+  env.pop();
+  REQUIRE(env.get("x").string_val_ == "updated");
+}
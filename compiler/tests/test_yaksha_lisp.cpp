@@ -44,6 +44,8 @@
 #undef private
 #include "tokenizer/block_analyzer.h"
 #include "tokenizer/tokenizer.h"
+#include "yaksha_lisp/prelude.h"
+#include <iterator>
 #include <string>
 #include <utility>
 using namespace yaksha;
@@ -776,6 +778,82 @@ TEST_CASE("yaksha_lisp: metamacro support twice twice") {
     (if (== value 5) (= success 1))
     )");
 }
+TEST_CASE("yaksha_lisp: repeated calls reuse compiled expressions") {
+  test_snippet_execute(R"(
+    (defun fib (n) (if (< n 2) n (+ (fib (- n 1)) (fib (- n 2)))))
+    (defun count_args (a & rest) (+ 1 (len rest)))
+    (= x 0)
+    (for i (range 0 10) (= x (+ x (count_args i i i))))
+    (if (and (== (fib 15) 610) (== x 30)) (= success 1))
+    )");
+}
+TEST_CASE("yaksha_lisp: invalid & position fails on every call") {
+  test_snippet_execute(R"(
+    (defun bad (& a b) a)
+    (= x 0)
+    (try_catch e (bad 1 2) (= x (+ x 1)))
+    (try_catch e (bad 1 2) (= x (+ x 1)))
+    (if (== x 2) (= success 1))
+    )");
+}
+TEST_CASE("yaksha_lisp: s-expr arguments are created once") {
+  auto yaksha_lisp_m = yaksha_macros{};
+  auto dt = yaksha_lisp_m.create_tokenizer();
+  auto parser = yaksha_lisp_m.create_parser(dt);
+  dt->tokenize("test.macro", "(+ 1 2 -3)", yaksha_lisp_m.get_yk_token_pool());
+  parser->parse();
+  REQUIRE(parser->errors_.empty());
+  auto env = yaksha_lisp_m.create_env();
+  env->setup_builtins();
+  auto exp = parser->exprs_.front();
+  REQUIRE(exp->list_[3]->num_compiled_);
+  REQUIRE(exp->list_[3]->num_ == -3);
+  REQUIRE(env->eval(exp)->num_ == 0);
+  auto args = exp->args_;
+  REQUIRE(args.size() == 3);
+  REQUIRE(env->eval(exp)->num_ == 0);
+  REQUIRE(exp->args_ == args);
+}
+TEST_CASE("yaksha_lisp: system_gc_stats") {
+  test_snippet_execute(R"(
+    (= x 0)
+    (for i (range 0 5000) (= x (+ x (len (list i i)))))
+    (= stats (system_gc_stats))
+    (= stats2 (system_gc_stats))
+    (if (and (>= stats::collections 1)
+             (and (> stats::freed 0) (> stats2::skipped stats::skipped)))
+        (= success 1))
+    )");
+}
+TEST_CASE("yaksha_lisp: pre-tokenized prelude is up to date") {
+  // If this fails, run scripts/generate_prelude.py
+  // Snapshot is silently ignored if size or hash (FNV-1a) does not match
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  for (unsigned char c : YAKSHA_LISP_PRELUDE) {
+    hash ^= c;
+    hash *= 0x100000001b3ULL;
+  }
+  REQUIRE(hash == YAKSHA_LISP_PRELUDE_HASH);
+  yaksha_macros yaksha_lisp_m{};
+  auto dt = yaksha_lisp_m.create_tokenizer();
+  dt->tokenize("prelude.yaksha_lisp", YAKSHA_LISP_PRELUDE,
+               yaksha_lisp_m.get_yk_token_pool());
+  REQUIRE(dt->errors_.empty());
+  auto snapshot = yaksha_lisp_m.create_tokenizer();
+  snapshot->load_snapshot("prelude.yaksha_lisp", YAKSHA_LISP_PRELUDE_TOKENS,
+                          std::size(YAKSHA_LISP_PRELUDE_TOKENS));
+  REQUIRE(YAKSHA_LISP_PRELUDE.size() == YAKSHA_LISP_PRELUDE_SIZE);
+  REQUIRE(dt->tokens_.size() == snapshot->tokens_.size());
+  for (size_t i = 0; i < dt->tokens_.size(); i++) {
+    auto expected = dt->tokens_[i];
+    auto actual = snapshot->tokens_[i];
+    REQUIRE((int) expected->type_ == (int) actual->type_);
+    REQUIRE(expected->token_ == actual->token_);
+    REQUIRE(expected->line_ == actual->line_);
+    REQUIRE(expected->pos_ == actual->pos_);
+    REQUIRE(expected->file_ == actual->file_);
+  }
+}
 TEST_CASE("yaksha_lisp: '::' syntax sugar to get from map") {
   test_snippet_execute(R"(
     (= my_map @{a: 1})
@@ -844,6 +922,56 @@ def main() -> int:
     return 0)**");
   // --------
 }
+static void dsl_cache_preprocess(yaksha_macros &yaksha_lisp_m,
+                                 const std::string &pure) {
+  std::string code = R"**(macros! {
+    (= calls 0)
+    (defun echo (&x) (do (= calls (+ calls 1)) (+ x (list (ykt_integer_decimal 1)))))
+    (yk_register {dsl echo echo $PURE$})
+}
+
+def main() -> int:
+    a = echo!{1 +}
+    b = echo!{1 +}
+    c = echo!{2 +}
+    return a + b + c)**";
+  code.replace(code.find("$PURE$"), 6, pure);
+  yk_datatype_pool datatypes{};
+  tokenizer t{"test", code, yaksha_lisp_m.get_yk_token_pool()};
+  t.tokenize();
+  block_analyzer ba{t.tokens_, yaksha_lisp_m.get_yk_token_pool()};
+  ba.analyze();
+  parser p{"test", ba.tokens_, &datatypes};
+  try {
+    p.preprocess(&yaksha_lisp_m, yaksha_lisp_m.get_yk_token_pool());
+    p.parse();
+  } catch (const parsing_error &e) { FAIL(e.message_); }
+  REQUIRE(p.errors_.empty());
+}
+TEST_CASE("yaksha_macro_support: pure dsl!{} expansions are cached") {
+  yaksha_macros yaksha_lisp_m{};
+  dsl_cache_preprocess(yaksha_lisp_m, "pure");
+  REQUIRE(yaksha_lisp_m.roots_["test"]->symbols_["calls"]->num_ == 2);
+  REQUIRE(yaksha_lisp_m.dsl_cache_hits_ == 1);
+  REQUIRE(yaksha_lisp_m.dsl_cache_.size() == 2);
+  // cache hit is placed at second echo!{} input
+  token one{"test", 0, 0, "1", token_type::INTEGER_DECIMAL, "1"};
+  token plus{"test", 0, 0, "+", token_type::PLUS, "+"};
+  auto key = yaksha_macros::dsl_cache_key("test", "", "echo", {&one, &plus});
+  REQUIRE(yaksha_lisp_m.dsl_cache_.count(key) == 1);
+  auto &cached = yaksha_lisp_m.dsl_cache_[key];
+  REQUIRE(cached.size() == 3);
+  REQUIRE(cached[0].input_index_ == 0);
+  REQUIRE(cached[1].input_index_ == 1);
+  REQUIRE(cached[2].input_index_ == YK_DSL_AT_MACRO_NAME);
+}
+TEST_CASE("yaksha_macro_support: impure dsl!{} expansions are not cached") {
+  yaksha_macros yaksha_lisp_m{};
+  dsl_cache_preprocess(yaksha_lisp_m, "");
+  REQUIRE(yaksha_lisp_m.roots_["test"]->symbols_["calls"]->num_ == 3);
+  REQUIRE(yaksha_lisp_m.dsl_cache_hits_ == 0);
+  REQUIRE(yaksha_lisp_m.dsl_cache_.empty());
+}
 TEST_CASE("yaksha_macro_support: list builtins") {
   // ----------
   yaksha_macro_preprocess_happy_path(
@@ -138,6 +138,7 @@ public class YakshaCompletionContributor extends CompletionContributor {
                         resultSet.addElement(LookupElementBuilder.create("@nativemacro").withIcon(YakshaIcons.KEYWORD));
                         resultSet.addElement(LookupElementBuilder.create("@varargs").withIcon(YakshaIcons.KEYWORD));
                         resultSet.addElement(LookupElementBuilder.create("@onstack").withIcon(YakshaIcons.KEYWORD));
+                        resultSet.addElement(LookupElementBuilder.create("@arena").withIcon(YakshaIcons.KEYWORD));
 
                         resultSet.addElement(LookupElementBuilder.create("Array").withIcon(YakshaIcons.DATA_TYPE));
                         resultSet.addElement(LookupElementBuilder.create("FixedArr").withIcon(YakshaIcons.DATA_TYPE));